@@ -0,0 +1,27 @@
+CREATE EXTENSION vgram;
+
+-- "ab", "abc" and "bc" are frequent, so word "abcd" is indexed by "cd" only
+INSERT INTO qgram_stat VALUES ('ab', 0.5), ('abc', 0.5), ('bc', 0.5);
+SELECT qgram_stat_reset_cache();
+
+CREATE TABLE docs (id int4, s text);
+INSERT INTO docs VALUES (1, 'abcd'), (2, 'xyz');
+CREATE INDEX docs_s_idx ON docs USING gin (s vgram_gin_ops);
+
+-- "abc" becomes infrequent, new extraction gives "abc" key
+INSERT INTO qgram_stat_prev SELECT * FROM qgram_stat;
+DELETE FROM qgram_stat WHERE qgram = 'abc';
+SELECT qgram_stat_reset_cache();
+SELECT qgram, frequent FROM qgram_stat_changes();
+
+SET enable_seqscan = off;
+
+-- index isn't migrated yet, so document isn't found
+SELECT id FROM docs WHERE s LIKE '%abc%';
+
+-- document is located by "cd" key starting inside "abc"
+SELECT vgram_migrate_index('docs_s_idx', '(0,0)', 0) IS NULL AS done;
+SELECT id FROM docs WHERE s LIKE '%abc%';
+
+RESET enable_seqscan;
+DROP TABLE docs;
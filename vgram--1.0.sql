@@ -7,6 +7,20 @@ CREATE TABLE qgram_stat
 	frequency float4
 );
 
+-- Used for lazy lookups of q-grams, "C" collation matches strcmp() order
+CREATE INDEX qgram_stat_qgram_idx ON qgram_stat (qgram COLLATE "C");
+
+CREATE TABLE qgram_stat_prev
+(
+	qgram text,
+	frequency float4
+);
+
+CREATE TABLE qgram_stat_sketch
+(
+	sketch bytea
+);
+
 CREATE FUNCTION print_qgrams(text)
 RETURNS void
 AS 'MODULE_PATHNAME'
@@ -27,6 +41,11 @@ RETURNS void
 AS 'MODULE_PATHNAME'
 LANGUAGE C;
 
+CREATE FUNCTION vgram_charops_fingerprint()
+RETURNS int8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STABLE;
+
 CREATE OR REPLACE FUNCTION qgram_stat_transfn(internal, text)
 RETURNS internal
 AS 'MODULE_PATHNAME'
@@ -37,12 +56,115 @@ RETURNS int4
 AS 'MODULE_PATHNAME'
 LANGUAGE C IMMUTABLE;
 
-CREATE AGGREGATE qgram_stat(text) (
-	SFUNC = qgram_stat_transfn,
-	STYPE = internal,
-	FINALFUNC = qgram_stat_finalfn
+-- Separate transition function, so that state isn't shared with qgram_stat()
+CREATE OR REPLACE FUNCTION qgram_stat_export_transfn(internal, text)
+RETURNS internal
+AS 'MODULE_PATHNAME', 'qgram_stat_transfn'
+LANGUAGE C IMMUTABLE;
+
+CREATE OR REPLACE FUNCTION qgram_stat_export_finalfn(internal)
+RETURNS bytea
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE;
+
+CREATE OR REPLACE FUNCTION qgram_stat_merge_transfn(internal, bytea)
+RETURNS internal
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE;
+
+-- Final functions write statistics or spill counts and free the state, so
+-- the state must be neither shared nor reused.  FINALFUNC_MODIFY requires
+-- PostgreSQL 11+.
+DO $$
+DECLARE
+	modify text := CASE WHEN current_setting('server_version_num')::int >= 110000
+						THEN ', FINALFUNC_MODIFY = READ_WRITE' ELSE '' END;
+BEGIN
+	EXECUTE 'CREATE AGGREGATE qgram_stat(text) (
+		SFUNC = qgram_stat_transfn,
+		STYPE = internal,
+		FINALFUNC = qgram_stat_finalfn' || modify || ')';
+	EXECUTE 'CREATE AGGREGATE qgram_stat_export(text) (
+		SFUNC = qgram_stat_export_transfn,
+		STYPE = internal,
+		FINALFUNC = qgram_stat_export_finalfn' || modify || ')';
+	EXECUTE 'CREATE AGGREGATE qgram_stat_merge(bytea) (
+		SFUNC = qgram_stat_merge_transfn,
+		STYPE = internal,
+		FINALFUNC = qgram_stat_finalfn' || modify || ')';
+END
+$$;
+
+CREATE FUNCTION qgram_stat_progressive(rel regclass, attname text,
+										tolerance float4 DEFAULT 0.05,
+										initial_percent float4 DEFAULT 0.1)
+RETURNS float4
+AS 'MODULE_PATHNAME'
+LANGUAGE C VOLATILE STRICT;
+
+CREATE FUNCTION qgram_stat_from_index(index regclass,
+									   sample_percent float4 DEFAULT 1.0)
+RETURNS int8
+AS 'MODULE_PATHNAME'
+LANGUAGE C VOLATILE STRICT;
+
+CREATE FUNCTION qgram_stat_changes(OUT qgram text, OUT frequent bool)
+RETURNS SETOF record
+AS $$
+	SELECT coalesce(c.qgram, p.qgram), c.qgram IS NOT NULL
+	FROM (SELECT qgram FROM qgram_stat WHERE length(qgram) > 1) c
+	FULL JOIN (SELECT qgram FROM qgram_stat_prev WHERE length(qgram) > 1) p
+	ON c.qgram = p.qgram
+	WHERE c.qgram IS NULL OR p.qgram IS NULL;
+$$
+LANGUAGE sql STABLE;
+
+CREATE FUNCTION vgram_keys_match(text, text[])
+RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE OPERATOR &~ (
+	LEFTARG = text,
+	RIGHTARG = text[],
+	PROCEDURE = vgram_keys_match,
+	RESTRICT = contsel,
+	JOIN = contjoinsel
 );
 
+CREATE FUNCTION vgram_like_any(text, text[])
+RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE OPERATOR @~~ (
+	LEFTARG = text,
+	RIGHTARG = text[],
+	PROCEDURE = vgram_like_any,
+	RESTRICT = contsel,
+	JOIN = contjoinsel
+);
+
+CREATE FUNCTION vgram_ilike_any(text, text[])
+RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE OPERATOR @~~* (
+	LEFTARG = text,
+	RIGHTARG = text[],
+	PROCEDURE = vgram_ilike_any,
+	RESTRICT = contsel,
+	JOIN = contjoinsel
+);
+
+CREATE FUNCTION vgram_migrate_index(index regclass,
+									after tid DEFAULT '(0,0)',
+									batch_size int4 DEFAULT 10000)
+RETURNS tid
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT;
+
 -- support functions for gin
 CREATE FUNCTION vgram_cmp(text, text)
 RETURNS int4
@@ -64,6 +186,11 @@ RETURNS bool
 AS 'MODULE_PATHNAME'
 LANGUAGE C IMMUTABLE STRICT;
 
+CREATE FUNCTION vgram_gin_compare_partial(text, text, int2, internal)
+RETURNS int4
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
 CREATE FUNCTION vgram_gin_triconsistent(internal, int2, text, int4, internal, internal, internal)
 RETURNS "char"
 AS 'MODULE_PATHNAME'
@@ -74,10 +201,346 @@ FOR TYPE text USING gin
 AS
 		OPERATOR		3		pg_catalog.~~ (text, text),
 		OPERATOR		4		pg_catalog.~~* (text, text),
+		OPERATOR		5		&~ (text, text[]),
+		OPERATOR		6		@~~ (text, text[]),
+		OPERATOR		7		@~~* (text, text[]),
 		FUNCTION		1		vgram_cmp (text, text),
 		FUNCTION		2		vgram_gin_extract_value (text, internal),
 		FUNCTION		3		vgram_gin_extract_query (text, internal, int2, internal, internal, internal, internal),
 		FUNCTION		4		vgram_gin_consistent (internal, int2, text, int4, internal, internal, internal, internal),
+		FUNCTION		5		vgram_gin_compare_partial (text, text, int2, internal),
 		FUNCTION		6		vgram_gin_triconsistent (internal, int2, text, int4, internal, internal, internal),
 		STORAGE			text;
 
+
+CREATE FUNCTION vgram_pattern_like(text, text)
+RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE OPERATOR ~~@ (
+	LEFTARG = text,
+	RIGHTARG = text,
+	PROCEDURE = vgram_pattern_like,
+	RESTRICT = contsel,
+	JOIN = contjoinsel
+);
+
+CREATE FUNCTION vgram_pattern_ilike(text, text)
+RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE OPERATOR ~~*@ (
+	LEFTARG = text,
+	RIGHTARG = text,
+	PROCEDURE = vgram_pattern_ilike,
+	RESTRICT = contsel,
+	JOIN = contjoinsel
+);
+
+-- support functions for gin index over patterns
+CREATE FUNCTION vgram_pattern_extract_value(text, internal)
+RETURNS internal
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE FUNCTION vgram_pattern_extract_query(text, internal, int2, internal, internal, internal, internal)
+RETURNS internal
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE FUNCTION vgram_pattern_consistent(internal, int2, text, int4, internal, internal, internal, internal)
+RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE FUNCTION vgram_pattern_triconsistent(internal, int2, text, int4, internal, internal, internal)
+RETURNS "char"
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE OPERATOR CLASS vgram_pattern_gin_ops
+FOR TYPE text USING gin
+AS
+		OPERATOR		1		~~@ (text, text),
+		OPERATOR		2		~~*@ (text, text),
+		FUNCTION		1		vgram_cmp (text, text),
+		FUNCTION		2		vgram_pattern_extract_value (text, internal),
+		FUNCTION		3		vgram_pattern_extract_query (text, internal, int2, internal, internal, internal, internal),
+		FUNCTION		4		vgram_pattern_consistent (internal, int2, text, int4, internal, internal, internal, internal),
+		FUNCTION		6		vgram_pattern_triconsistent (internal, int2, text, int4, internal, internal, internal),
+		STORAGE			text;
+
+CREATE FUNCTION vgram_minhash(text, k int4 DEFAULT 128)
+RETURNS int4[]
+AS 'MODULE_PATHNAME'
+LANGUAGE C STABLE STRICT;
+
+CREATE FUNCTION vgram_minhash_bands(signature int4[], bands int4 DEFAULT 32)
+RETURNS int4[]
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE FUNCTION vgram_minhash_similarity(int4[], int4[])
+RETURNS float4
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE TYPE vgramvector;
+
+CREATE FUNCTION vgramvector_in(cstring)
+RETURNS vgramvector
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE FUNCTION vgramvector_out(vgramvector)
+RETURNS cstring
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE FUNCTION vgramvector_recv(internal)
+RETURNS vgramvector
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE FUNCTION vgramvector_send(vgramvector)
+RETURNS bytea
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE TYPE vgramvector (
+	INPUT = vgramvector_in,
+	OUTPUT = vgramvector_out,
+	RECEIVE = vgramvector_recv,
+	SEND = vgramvector_send,
+	INTERNALLENGTH = VARIABLE,
+	STORAGE = extended
+);
+
+CREATE FUNCTION to_vgramvector(text)
+RETURNS vgramvector
+AS 'MODULE_PATHNAME'
+LANGUAGE C STABLE STRICT;
+
+CREATE FUNCTION vgramvector_length(vgramvector)
+RETURNS int4
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE FUNCTION vgramvector_similarity(vgramvector, vgramvector)
+RETURNS float4
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE FUNCTION vgramvector_overlap(vgramvector, vgramvector)
+RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE OPERATOR && (
+	LEFTARG = vgramvector,
+	RIGHTARG = vgramvector,
+	PROCEDURE = vgramvector_overlap,
+	COMMUTATOR = '&&',
+	RESTRICT = contsel,
+	JOIN = contjoinsel
+);
+
+CREATE FUNCTION vgramvector_contains(vgramvector, vgramvector)
+RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE FUNCTION vgramvector_contained(vgramvector, vgramvector)
+RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE OPERATOR @> (
+	LEFTARG = vgramvector,
+	RIGHTARG = vgramvector,
+	PROCEDURE = vgramvector_contains,
+	COMMUTATOR = '<@',
+	RESTRICT = contsel,
+	JOIN = contjoinsel
+);
+
+CREATE OPERATOR <@ (
+	LEFTARG = vgramvector,
+	RIGHTARG = vgramvector,
+	PROCEDURE = vgramvector_contained,
+	COMMUTATOR = '@>',
+	RESTRICT = contsel,
+	JOIN = contjoinsel
+);
+
+CREATE FUNCTION vgramvector_union(vgramvector, vgramvector)
+RETURNS vgramvector
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE OPERATOR | (
+	LEFTARG = vgramvector,
+	RIGHTARG = vgramvector,
+	PROCEDURE = vgramvector_union,
+	COMMUTATOR = '|'
+);
+
+CREATE FUNCTION vgramvector_intersect(vgramvector, vgramvector)
+RETURNS vgramvector
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE OPERATOR & (
+	LEFTARG = vgramvector,
+	RIGHTARG = vgramvector,
+	PROCEDURE = vgramvector_intersect,
+	COMMUTATOR = '&'
+);
+
+-- support functions for vgramvector gin
+CREATE FUNCTION vgramvector_gin_extract_value(vgramvector, internal)
+RETURNS internal
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE FUNCTION vgramvector_gin_extract_query(vgramvector, internal, int2, internal, internal, internal, internal)
+RETURNS internal
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE FUNCTION vgramvector_gin_consistent(internal, int2, vgramvector, int4, internal, internal, internal, internal)
+RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE FUNCTION vgramvector_gin_triconsistent(internal, int2, vgramvector, int4, internal, internal, internal)
+RETURNS "char"
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE OPERATOR CLASS vgramvector_gin_ops
+DEFAULT FOR TYPE vgramvector USING gin
+AS
+		OPERATOR		3		&& (vgramvector, vgramvector),
+		OPERATOR		7		@> (vgramvector, vgramvector),
+		OPERATOR		8		<@ (vgramvector, vgramvector),
+		FUNCTION		1		btint4cmp (int4, int4),
+		FUNCTION		2		vgramvector_gin_extract_value (vgramvector, internal),
+		FUNCTION		3		vgramvector_gin_extract_query (vgramvector, internal, int2, internal, internal, internal, internal),
+		FUNCTION		4		vgramvector_gin_consistent (internal, int2, vgramvector, int4, internal, internal, internal, internal),
+		FUNCTION		6		vgramvector_gin_triconsistent (internal, int2, vgramvector, int4, internal, internal, internal),
+		STORAGE			int4;
+
+-- support functions for vgramvector gist
+CREATE FUNCTION vgramvector_gist_consistent(internal, vgramvector, int2, oid, internal)
+RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE FUNCTION vgramvector_gist_union(internal, internal)
+RETURNS bytea
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE FUNCTION vgramvector_gist_compress(internal)
+RETURNS internal
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE FUNCTION vgramvector_gist_decompress(internal)
+RETURNS internal
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE FUNCTION vgramvector_gist_penalty(internal, internal, internal)
+RETURNS internal
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE FUNCTION vgramvector_gist_picksplit(internal, internal)
+RETURNS internal
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE FUNCTION vgramvector_gist_same(bytea, bytea, internal)
+RETURNS internal
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE OPERATOR CLASS vgramvector_gist_ops
+FOR TYPE vgramvector USING gist
+AS
+		OPERATOR		3		&& (vgramvector, vgramvector),
+		OPERATOR		7		@> (vgramvector, vgramvector),
+		OPERATOR		8		<@ (vgramvector, vgramvector),
+		FUNCTION		1		vgramvector_gist_consistent (internal, vgramvector, int2, oid, internal),
+		FUNCTION		2		vgramvector_gist_union (internal, internal),
+		FUNCTION		3		vgramvector_gist_compress (internal),
+		FUNCTION		4		vgramvector_gist_decompress (internal),
+		FUNCTION		5		vgramvector_gist_penalty (internal, internal, internal),
+		FUNCTION		6		vgramvector_gist_picksplit (internal, internal),
+		FUNCTION		7		vgramvector_gist_same (bytea, bytea, internal),
+		STORAGE			bytea;
+
+CREATE FUNCTION vgram_estimate_index(rel regclass, attname text,
+									 sample_percent float4 DEFAULT 1.0,
+									 OUT max_q int4,
+									 OUT limit_frequency float4,
+									 OUT distinct_keys float8,
+									 OUT total_postings float8,
+									 OUT index_size int8,
+									 OUT build_time float8)
+RETURNS SETOF record
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT;
+
+CREATE FUNCTION vgram_like_search(index regclass, pattern text,
+								  max_rows int4,
+								  case_insensitive bool DEFAULT false)
+RETURNS SETOF tid
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT;
+
+CREATE FUNCTION vgram_like_candidates(index regclass, pattern text,
+									  case_insensitive bool DEFAULT false)
+RETURNS SETOF tid
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT;
+
+CREATE FUNCTION vgram_like_join(index regclass, patterns text[],
+								case_insensitive bool DEFAULT false,
+								OUT pattern_no int4, OUT ctid tid)
+RETURNS SETOF record
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT;
+
+CREATE FUNCTION vgram_ranked_search(index regclass, query text,
+									k int4 DEFAULT 10,
+									OUT ctid tid, OUT score float4)
+RETURNS SETOF record
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT;
+
+CREATE FUNCTION vgram_estimate_count(index regclass, pattern text,
+									 OUT estimate float8,
+									 OUT lower_bound float8,
+									 OUT upper_bound float8)
+RETURNS record
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT;
+
+CREATE FUNCTION vgram_stat_progress(OUT pid int4, OUT datid oid,
+									OUT phase text, OUT rows_processed int8,
+									OUT rows_total int8,
+									OUT distinct_qgrams int8,
+									OUT memory_bytes int8,
+									OUT started timestamptz,
+									OUT estimated_completion timestamptz)
+RETURNS SETOF record
+AS 'MODULE_PATHNAME'
+LANGUAGE C VOLATILE;
+
+CREATE VIEW vgram_stat_progress AS
+	SELECT * FROM vgram_stat_progress();
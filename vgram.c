@@ -12,42 +12,83 @@
  *-------------------------------------------------------------------------
  */
 #include "postgres.h"
+
+#include <arpa/inet.h>
+#include <limits.h>
+#include <math.h>
+
 #include "fmgr.h"
+#include "libpq/pqformat.h"
 #include "mb/pg_wchar.h"
 #include "access/hash.h"
 #include "utils/builtins.h"
 #include "utils/memutils.h"
 #include "utils/hsearch.h"
+#include "utils/guc.h"
 #include "catalog/pg_type.h"
 #include "executor/spi.h"
+#include "miscadmin.h"
+#include "access/genam.h"
+#include "access/transam.h"
+#include "catalog/index.h"
+#include "storage/buffile.h"
+#include "storage/itemptr.h"
+#include "utils/lsyscache.h"
 
 #include "vgram.h"
 
 PG_MODULE_MAGIC;
 
+void		_PG_init(void);
 Datum		print_qgrams(PG_FUNCTION_ARGS);
 Datum		get_vgrams(PG_FUNCTION_ARGS);
 Datum		qgram_stat_transfn(PG_FUNCTION_ARGS);
 Datum		qgram_stat_finalfn(PG_FUNCTION_ARGS);
+Datum		qgram_stat_export_finalfn(PG_FUNCTION_ARGS);
+Datum		qgram_stat_merge_transfn(PG_FUNCTION_ARGS);
+Datum		qgram_stat_progressive(PG_FUNCTION_ARGS);
+Datum		qgram_stat_from_index(PG_FUNCTION_ARGS);
 Datum		print_qgram_stat(PG_FUNCTION_ARGS);
 Datum		qgram_stat_reset_cache(PG_FUNCTION_ARGS);
+Datum		vgram_charops_fingerprint(PG_FUNCTION_ARGS);
 
 PG_FUNCTION_INFO_V1(get_vgrams);
 PG_FUNCTION_INFO_V1(print_qgrams);
 PG_FUNCTION_INFO_V1(qgram_stat_transfn);
 PG_FUNCTION_INFO_V1(qgram_stat_finalfn);
+PG_FUNCTION_INFO_V1(qgram_stat_export_finalfn);
+PG_FUNCTION_INFO_V1(qgram_stat_merge_transfn);
+PG_FUNCTION_INFO_V1(qgram_stat_progressive);
+PG_FUNCTION_INFO_V1(qgram_stat_from_index);
 PG_FUNCTION_INFO_V1(qgram_stat_reset_cache);
+PG_FUNCTION_INFO_V1(vgram_charops_fingerprint);
 
 static int	qgramTableElementCmp(const void *a1, const void *a2);
-static int	qgram_key_match(const void *key1, const void *key2, Size keysize);
-static uint32 qgram_key_hash(const void *key, Size keysize);
+static void defaultDictionaryAssign(int newval, void *extra);
+static void continuousScriptsAssign(bool newval, void *extra);
+static void freeStats(void);
 static void addVGram(char *vgram, void *userData);
 
+/*
+ * Partition of q-grams spilled to temporary file.  File contains records of
+ * q-gram length, q-gram itself and its count.  The same q-gram might appear
+ * in several records, which are summed when partition is loaded.
+ *
+ * Partition too large for the memory limit is split into
+ * VGRAM_SPILL_PARTITIONS children keyed by one more character.  Q-grams
+ * shorter than the key of children are prefixes of q-grams of many children,
+ * so they are owned by one child and copied to the others as context
+ * records, which have negative length and are used only by the cost model.
+ */
 typedef struct
 {
-	char	   *qgram;
-	float		frequency;
-} QGramTableElement;
+	BufFile		   *file;			/* NULL when partition is split */
+	int64			nitems;
+	int				endFile;
+	off_t			endOffset;
+	int				level;			/* characters over minQ in the key */
+	int				children;		/* first child, -1 for leaf */
+} QGramPartition;
 
 /*
  * State of q-grams statistics collection.
@@ -55,67 +96,290 @@ typedef struct
 typedef struct
 {
 	MemoryContext	context,
-					tmpContext;
+					tmpContext,
+					qgramsContext;	/* q-grams hash and its keys */
 	HTAB		   *qgramsHash,
 				   *stringQGramsHash,
 				   *charactersHash;
+	HTAB		   *contextHash;	/* context q-grams of loaded partition */
+	QGramPartition *partitions;		/* NULL until q-grams are spilled */
+	int				npartitions,
+					allocatedPartitions;
+	int			   *leaves;			/* leaf partitions being iterated */
+	int				nleaves;
 	int64			totalCount,
 					totalLength;
-} QGramStatState;
 
-typedef struct
-{
-	char		   *qgram;
-} QGramHashKey;
+	/*
+	 * Adjustment of q-gram counts applied when q-grams are loaded for
+	 * finalization: counts are multiplied by countScale, then raised to the
+	 * counts of countOverrides hash.
+	 */
+	double			countScale;
+	HTAB		   *countOverrides;
+
+	/*
+	 * Dense counters of q-grams not longer than VGRAM_DENSE_MAXQ and of
+	 * characters.  Characters are remapped to ids, q-grams consisting of
+	 * remapped characters are counted in arrays indexed by ids.  Ids are
+	 * given to the most frequent characters of the first
+	 * VGRAM_DENSE_SEED_ROWS rows, then to new characters in order of
+	 * appearance while alphabet isn't full.  Counters are allocated by the
+	 * first counted row, so merged or loaded states don't hold them.  NULL
+	 * counters disable dense counting.
+	 */
+	int64		   *denseCounts,
+				   *denseCharCounts;
+	uint32		   *denseStamps;	/* row which last counted the cell */
+	uint32			denseStamp;
+	int64			denseOffsets[VGRAM_DENSE_MAXQ + 2];
+	bool			denseUsed;
+	int				denseCharsCount;
+	int64			denseSeedRows;	/* rows seen before ids are seeded */
+	bool			denseSeeded;
+	bool			denseChecked;	/* allocation of counters was tried */
+	int16			byteIds[256];	/* id + 1 of single-byte character, 0 if
+									 * unknown or alphabet was full */
+	HTAB		   *charIdsHash;	/* ids of multibyte characters */
+	char			denseChars[VGRAM_DENSE_ALPHABET][MAX_MULTIBYTE_CHAR_LEN + 1];
+} QGramStatState;
 
+/* Id of multibyte character for dense counting */
 typedef struct
 {
-	QGramHashKey	key;
-	int64			count;
-} QGramHashValue;
+	uint32			character;		/* bytes of character */
+	int				id;				/* -1 when alphabet is full */
+} DenseCharId;
 
-bool				qgramTableLoaded = false;
+bool				qgramTableLoaded = false,
+					qgramTableBuiltin = false,
+					qgramTableLazy = false;
 int					qgramTableSize = 0,
 					characterTableSize = 0;
 QGramTableElement  *qgramTable = NULL,
 				   *characterTable = NULL;
 float4				avgCharactersCount = 0.0f;
 
+/* Lowest frequency of q-grams not loaded in lazy statistics mode */
+static float4		lazyLimitFrequency = 1.0f;
+
+/* Value of vgram.lazy_stats statistics was loaded with */
+static bool			statsLoadedLazy = false;
+
+/*
+ * Count-min sketch of frequencies of infrequent q-grams, which are extracted
+ * as V-grams.  Sketch is stored in qgram_stat_sketch table in network byte
+ * order: magic, depth, width and frequencies.
+ */
+typedef struct
+{
+	int32		depth;
+	int32		width;
+	float4		frequencies[FLEXIBLE_ARRAY_MEMBER];
+} QGramSketch;
+
+#define QGramSketchSize(depth, width) \
+	(offsetof(QGramSketch, frequencies) + sizeof(float4) * (depth) * (width))
+#define QGRAM_SKETCH_MAGIC			0x56474b31	/* "VGK1" */
+
+QGramSketch		   *qgramSketch = NULL;
+
+/* Incremented each time cached statistics is discarded */
+uint32				statsGeneration = 0;
+
+/* Budgets for frequent q-grams set selection, zero means "not set" */
+int					vgramTargetIndexSize = 0;
+double				vgramTargetScanFraction = 0.0;
+
+/*
+ * Memory limit of q-grams hash during statistics collection in kB, -1 means
+ * maintenance_work_mem and 0 means no limit.
+ */
+int					vgramStatsMemoryLimit = -1;
+
+/* Maximal number of cached query extraction results, zero disables cache */
+int					vgramQueryCacheSize = 1024;
+
+/* Built-in dictionary used when qgram_stat table is empty */
+int					vgramDefaultDictionary = VGRAM_DICTIONARY_NONE;
+
+/* Split scripts written without spaces into segments instead of words */
+bool				vgramContinuousScripts = false;
+
+/*
+ * Frequency of characters missing in the characters table.  They are rarer
+ * than any character of the table, which matters for large alphabets.
+ */
+static float4		unknownCharacterFrequency = DEFAULT_CHARACTER_FREQUENCY;
+
+static const struct config_enum_entry defaultDictionaryOptions[] = {
+	{"none", VGRAM_DICTIONARY_NONE, false},
+	{"english", VGRAM_DICTIONARY_ENGLISH, false},
+	{"russian", VGRAM_DICTIONARY_RUSSIAN, false},
+	{"code", VGRAM_DICTIONARY_CODE, false},
+	{NULL, 0, false}
+};
+
+void
+_PG_init(void)
+{
+	DefineCustomIntVariable("vgram.target_index_size",
+							"Target size of V-gram index used by qgram_stat() "
+							"to choose the frequent q-grams set.",
+							"Zero means no size target.",
+							&vgramTargetIndexSize,
+							0, 0, INT_MAX,
+							PGC_USERSET, GUC_UNIT_KB,
+							NULL, NULL, NULL);
+
+	DefineCustomRealVariable("vgram.target_scan_fraction",
+							 "Target expected fraction of rows scanned per "
+							 "V-gram of query used by qgram_stat() to choose "
+							 "the frequent q-grams set.",
+							 "Zero means no scan cost target.",
+							 &vgramTargetScanFraction,
+							 0.0, 0.0, 1.0,
+							 PGC_USERSET, 0,
+							 NULL, NULL, NULL);
+
+	DefineCustomIntVariable("vgram.stats_memory_limit",
+							"Memory used for q-grams counting by qgram_stat() "
+							"before spilling to temporary files.",
+							"-1 means maintenance_work_mem, zero means no limit.",
+							&vgramStatsMemoryLimit,
+							-1, -1, INT_MAX / 1024,
+							PGC_USERSET, GUC_UNIT_KB,
+							NULL, NULL, NULL);
+
+	DefineCustomIntVariable("vgram.query_cache_size",
+							"Maximal number of patterns whose extracted "
+							"V-grams are cached in backend memory.",
+							"Zero disables the cache.",
+							&vgramQueryCacheSize,
+							1024, 0, INT_MAX,
+							PGC_USERSET, 0,
+							NULL, NULL, NULL);
+
+	DefineCustomEnumVariable("vgram.default_dictionary",
+							 "Built-in q-gram statistics used when qgram_stat "
+							 "table is empty.",
+							 "Indexes built with other statistics must be rebuilt.",
+							 &vgramDefaultDictionary,
+							 VGRAM_DICTIONARY_NONE,
+							 defaultDictionaryOptions,
+							 PGC_SIGHUP, 0,
+							 NULL, defaultDictionaryAssign, NULL);
+
+	DefineCustomBoolVariable("vgram.continuous_scripts",
+							 "Extract V-grams of scripts written without "
+							 "spaces (CJK, Thai etc.) from continuous "
+							 "segments instead of words.",
+							 "Requires UTF8 database.",
+							 &vgramContinuousScripts,
+							 false,
+							 PGC_SIGHUP, 0,
+							 NULL, continuousScriptsAssign, NULL);
+
+	resultCacheInit();
+	progressInit();
+	lazyStatsInit();
+}
+
+/*
+ * Statistics might be taken from the built-in dictionary, so it's reloaded
+ * on next use.  Indexes keep V-grams extracted with the previous dictionary,
+ * that's why parameter can't be changed per session.
+ */
+static void
+defaultDictionaryAssign(int newval, void *extra)
+{
+	freeStats();
+}
+
+/*
+ * Tokenization changes, so V-grams cached for queries are no longer valid,
+ * and frequency of unknown characters depends on the mode.  Indexes keep
+ * V-grams extracted with the previous tokenization, that's why parameter
+ * can't be changed per session.
+ */
+static void
+continuousScriptsAssign(bool newval, void *extra)
+{
+	freeStats();
+}
+
 /**
- * Search q-grams stat table for given prefix. Initially lower and upper
- * bounds should cover all indexes of qgramTable. Resulting lower and upper
- * bounds can be reused for search with longer prefix.
+ * Check if character belongs to script written without spaces between words,
+ * when continuous scripts handling is enabled.
  *
- * @param prefix Pointer to prefix
- * @param len Length of prefix *in bytes*
- * @param lower Pointer to current lower bound
- * @param upper Pointer to current upper bound
- * @return Index of found q-gram
+ * @param c Pointer to character
+ * @return true if character is part of continuous segment
+ */
+bool
+isContinuousChar(const char *c)
+{
+	if (!vgramContinuousScripts || GetDatabaseEncoding() != PG_UTF8 ||
+		!IS_HIGHBIT_SET(*c))
+		return false;
+	return vgramIsContinuousCode(utf8_to_unicode((const unsigned char *) c));
+}
+
+/*
+ * Extraction core is fed with palloc and server encoding functions, so errors
+ * are thrown by elog() and core never sees allocation failure.
  */
+static void *
+backendAlloc(size_t size, void *arg)
+{
+	return palloc(size);
+}
+
+static void
+backendFree(void *ptr, void *arg)
+{
+	pfree(ptr);
+}
+
 static int
-prefixQGramSearch(const char *prefix, int len, int *lower, int *upper)
+backendCharLength(const char *c)
 {
-	int			mid,
-				cmp;
+	return pg_mblen(c);
+}
 
-	while (*lower <= *upper)
-	{
-		mid = (*lower + *upper) / 2;
-		cmp = strncmp(qgramTable[mid].qgram, prefix, len);
-		if (cmp < 0)
-		{
-			*lower = mid + 1;
-		}
-		else if (cmp > 0)
-		{
-			*upper = mid - 1;
-		}
-		else
-		{
-			return mid;
-		}
-	}
-	return -1;
+static int
+backendIsExtractable(const char *c)
+{
+	return isExtractable(c);
+}
+
+static char *
+backendLower(const char *str, size_t len, const VGramAllocator *allocator)
+{
+	return lowerstr_with_len(str, len);
+}
+
+static int
+backendIsContinuous(const char *c)
+{
+	return isContinuousChar(c);
+}
+
+static const VGramAllocator backendAllocator = {backendAlloc, backendFree, NULL};
+static const VGramCharOps backendCharOps = {backendCharLength,
+	backendIsExtractable, backendLower, backendIsContinuous};
+
+/**
+ * Get dictionary handle of current q-grams stat table.
+ */
+static const VGramDict *
+getStatsDict(void)
+{
+	static VGramDict dict = {NULL, 0, NULL, &backendCharOps, &backendAllocator};
+
+	dict.qgrams = qgramTable;
+	dict.qgramsCount = qgramTableSize;
+	dict.lookup = qgramTableLazy ? &lazyStatsLookup : NULL;
+	return &dict;
 }
 
 /**
@@ -171,6 +435,97 @@ addCharacterToHash(char *character, HTAB *charactersHash)
 	}
 }
 
+/**
+ * Get id of character for dense counting, assigning new id if alphabet isn't
+ * full.
+ *
+ * @param state Statistics collection state
+ * @param c Pointer to character
+ * @param len Length of character in bytes
+ * @return Id of character or -1
+ */
+static int
+getDenseCharId(QGramStatState *state, const char *c, int len)
+{
+	DenseCharId *entry = NULL;
+	uint32		character = 0;
+	bool		found;
+	int			id;
+
+	/* Single-byte characters include high-bit ones of single-byte encodings */
+	if (len == 1 && state->byteIds[(unsigned char) *c] != 0)
+		return state->byteIds[(unsigned char) *c] - 1;
+
+	if (len > 1)
+	{
+		memcpy(&character, c, Min(len, sizeof(character)));
+		entry = (DenseCharId *) hash_search(state->charIdsHash,
+											(const void *) &character,
+											HASH_ENTER, &found);
+		if (found)
+			return entry->id;
+	}
+
+	if (state->denseCharsCount < VGRAM_DENSE_ALPHABET &&
+		len <= MAX_MULTIBYTE_CHAR_LEN)
+	{
+		id = state->denseCharsCount++;
+		memcpy(state->denseChars[id], c, len);
+		state->denseChars[id][len] = '\0';
+	}
+	else
+		id = -1;
+
+	if (len > 1)
+		entry->id = id;
+	else
+		state->byteIds[(unsigned char) *c] = id + 1;
+	return id;
+}
+
+static int
+characterCountCmp(const void *a1, const void *a2)
+{
+	const QGramHashValue *v1 = *((QGramHashValue *const *) a1);
+	const QGramHashValue *v2 = *((QGramHashValue *const *) a2);
+
+	if (v1->count > v2->count)
+		return -1;
+	else if (v1->count < v2->count)
+		return 1;
+	return strcmp(v1->key.qgram, v2->key.qgram);
+}
+
+/**
+ * Give dense ids to the most frequent characters counted so far.  Ids given
+ * in order of appearance would be wasted to rare characters of the first
+ * rows.
+ *
+ * @param state Statistics collection state
+ */
+static void
+seedDenseCharIds(QGramStatState *state)
+{
+	HASH_SEQ_STATUS scanStatus;
+	QGramHashValue *item,
+			  **items;
+	int			nitems = 0,
+				i;
+
+	items = (QGramHashValue **) palloc(sizeof(QGramHashValue *) *
+									   Max(hash_get_num_entries(state->charactersHash), 1));
+	hash_seq_init(&scanStatus, state->charactersHash);
+	while ((item = (QGramHashValue *) hash_seq_search(&scanStatus)) != NULL)
+		items[nitems++] = item;
+	qsort(items, nitems, sizeof(QGramHashValue *), characterCountCmp);
+
+	for (i = 0; i < nitems && state->denseCharsCount < VGRAM_DENSE_ALPHABET; i++)
+		(void) getDenseCharId(state, items[i]->key.qgram,
+							  strlen(items[i]->key.qgram));
+	pfree(items);
+	state->denseSeeded = true;
+}
+
 /**
  * Collect statistics from distinct word.
  *
@@ -184,51 +539,83 @@ collectStatsWord(const char *wordStart, const char *wordEnd,
 {
 	QGramStatState *state = (QGramStatState *) userData;
 	const char	   *p,
-				   *r;
-	int				q;
+				  **starts;
+	int			   *ids;
+	int				q,
+					n = 0,
+					i;
+
+	/* Split word into characters and remap them for dense counting */
+	starts = (const char **) palloc(sizeof(char *) * (wordEnd - wordStart + 1));
+	ids = (int *) palloc(sizeof(int) * (wordEnd - wordStart));
+	for (p = wordStart; p < wordEnd; p += pg_mblen(p))
+	{
+		starts[n] = p;
+		ids[n] = state->denseSeeded ? getDenseCharId(state, p, pg_mblen(p)) : -1;
+		n++;
+	}
+	starts[n] = wordEnd;
 
 	/* Collect q-grams stat */
 	for (q = minQ; q <= maxQ; q++)
 	{
-		char	   *qgram;
-		int			pos = 0,
-					size;
-
-		p = wordStart, r = wordStart;
-		do
+		for (i = 0; i + q <= n; i++)
 		{
-			pos++;
-			p += pg_mblen(p);
+			char	   *qgram;
+			int			size,
+						j;
+			int64		cell = 0;
 
-			if (pos >= q)
+			if (q <= VGRAM_DENSE_MAXQ && state->denseCounts)
 			{
-				size = p - r;
-				qgram = (char *) palloc(size + 1);
-				qgram[size] = 0;
-				memcpy(qgram, r, size);
-				r += pg_mblen(r);
-
-				addQGramToHash(qgram, state->stringQGramsHash);
+				for (j = 0; j < q && ids[i + j] >= 0; j++)
+					cell = cell * VGRAM_DENSE_ALPHABET + ids[i + j];
+				if (j == q)
+				{
+					/* Count each q-gram once per row */
+					cell += state->denseOffsets[q];
+					if (state->denseStamps[cell] != state->denseStamp)
+					{
+						state->denseStamps[cell] = state->denseStamp;
+						state->denseCounts[cell]++;
+						state->denseUsed = true;
+					}
+					continue;
+				}
 			}
+
+			size = starts[i + q] - starts[i];
+			qgram = (char *) palloc(size + 1);
+			qgram[size] = 0;
+			memcpy(qgram, starts[i], size);
+
+			addQGramToHash(qgram, state->stringQGramsHash);
 		}
-		while (p < wordEnd);
 	}
 
 	/* Collect characters stat */
-	p = wordStart + pg_mblen(wordStart);
-	while (p < wordEnd)
+	for (i = 1; i < n; i++)
 	{
-		int			len = pg_mblen(p);
-		char	   *character = (char *) MemoryContextAlloc(state->context, len + 1);
+		int			len = starts[i + 1] - starts[i];
+		char	   *character;
+
+		state->totalLength++;
+		if (ids[i] >= 0)
+		{
+			state->denseCharCounts[ids[i]]++;
+			state->denseUsed = true;
+			continue;
+		}
 
-		memcpy(character, p, len);
+		character = (char *) MemoryContextAlloc(state->context, len + 1);
+		memcpy(character, starts[i], len);
 		character[len] = 0;
 
 		addCharacterToHash(character, state->charactersHash);
-		state->totalLength++;
-
-		p += len;
 	}
+
+	pfree(starts);
+	pfree(ids);
 }
 
 static float4
@@ -256,7 +643,79 @@ getCharacterFrequency(const char *c, int len)
 			return characterTable[mid].frequency;
 		}
 	}
-	return DEFAULT_CHARACTER_FREQUENCY;
+	return unknownCharacterFrequency;
+}
+
+/**
+ * Get position of q-gram in the given row of count-min sketch.
+ */
+static int
+sketchPosition(const char *qgram, int row, int width)
+{
+	uint32		hash;
+
+	hash = DatumGetUInt32(hash_any((const unsigned char *) qgram,
+								   (int) strlen(qgram)));
+	hash = DatumGetUInt32(hash_uint32(hash ^ ((uint32) row * 0x9E3779B9)));
+	return row * width + (int) (hash % (uint32) width);
+}
+
+/**
+ * Estimate frequency of infrequent q-gram using count-min sketch.  Sketch
+ * never underestimates, so minimum over rows is taken.
+ */
+static float4
+sketchFrequency(const char *qgram)
+{
+	float4		result = 1.0f;
+	int			row;
+
+	for (row = 0; row < qgramSketch->depth; row++)
+		result = Min(result,
+					 qgramSketch->frequencies[sketchPosition(qgram, row,
+															 qgramSketch->width)]);
+	return result;
+}
+
+/**
+ * Deserialize count-min sketch stored by writeSketch().  Q-grams hitting the
+ * sketch are infrequent, so cells are clamped to the frequency limit of the
+ * loaded statistics.
+ *
+ * @param stored Bytea read from qgram_stat_sketch table
+ * @return Sketch allocated in current memory context
+ */
+static QGramSketch *
+readSketch(bytea *stored)
+{
+	StringInfoData buf;
+	QGramSketch *sketch;
+	float4		limitFrequency = getStatsLimitFrequency();
+	int32		depth,
+				width;
+	int			i;
+
+	buf.data = VARDATA_ANY(stored);
+	buf.len = VARSIZE_ANY_EXHDR(stored);
+	buf.maxlen = buf.len;
+	buf.cursor = 0;
+
+	if (buf.len < 12 || pq_getmsgint(&buf, 4) != QGRAM_SKETCH_MAGIC)
+		elog(ERROR, "Corrupted q-gram frequencies sketch.");
+	depth = pq_getmsgint(&buf, 4);
+	width = pq_getmsgint(&buf, 4);
+	if (depth <= 0 || width <= 0 || width > VGRAM_SKETCH_MAX_WIDTH ||
+		(int64) buf.len != 12 + (int64) sizeof(float4) * depth * width)
+		elog(ERROR, "Corrupted q-gram frequencies sketch.");
+
+	sketch = (QGramSketch *) palloc(QGramSketchSize(depth, width));
+	sketch->depth = depth;
+	sketch->width = width;
+	for (i = 0; i < depth * width; i++)
+		sketch->frequencies[i] = Min(pq_getmsgfloat4(&buf), limitFrequency);
+	pq_getmsgend(&buf);
+
+	return sketch;
 }
 
 float4
@@ -276,6 +735,8 @@ estimateVGramSelectivilty(const char *vgram)
 
 	if (len < minQ)
 		elog(ERROR, "Short vgram %s", vgram);
+	else if (qgramSketch)
+		return sketchFrequency(vgram);
 	else if (len == minQ)
 	{
 		float4		result = 1.0f;
@@ -292,13 +753,24 @@ estimateVGramSelectivilty(const char *vgram)
 
 		return result;
 	}
+	else if (qgramTableLazy)
+	{
+		float		frequency;
+
+		if (lazyStatsLookup.lookup(vgram, prev - vgram, &frequency,
+								   lazyStatsLookup.arg) == VGRAM_LOOKUP_NONE)
+			elog(ERROR, "Corrupted vgram %s", vgram);
+
+		return frequency * getCharacterFrequency(prev, p - prev);
+	}
 	else
 	{
 		int			lower = 0,
 					upper = qgramTableSize - 1,
 					i;
 
-		i = prefixQGramSearch(vgram, prev - vgram, &lower, &upper);
+		i = vgramPrefixSearch(getStatsDict(), vgram, prev - vgram,
+							  &lower, &upper);
 		if (i < 0)
 			elog(ERROR, "Corrupted vgram %s", vgram);
 
@@ -310,87 +782,72 @@ estimateVGramSelectivilty(const char *vgram)
 void
 extractVGramsWord(const char *wordStart, const char *wordEnd, void *userData)
 {
-	const char *p = wordStart;
 	ExtractVGramsInfo *info = (ExtractVGramsInfo *) userData;
 
-	while (p < wordEnd)
-	{
-		const char *r = p;
-		int			lower = 0,
-					upper = qgramTableSize - 1,
-					len = 0;
-
-		while (len < maxQ && r < wordEnd)
-		{
-			r += pg_mblen(r);
-			len++;
-			if (len >= minQ && prefixQGramSearch(p, r - p, &lower, &upper) < 0)
-			{
-				char	   *qgram;
+	vgramExtractWordVGrams(getStatsDict(), wordStart, wordEnd,
+						   info->callback, info->userData);
+}
 
-				qgram = (char *) palloc(r - p + 1);
-				memcpy(qgram, p, r - p);
-				qgram[r - p] = 0;
-				info->callback(qgram, info->userData);
-				break;
-			}
-		}
-		p += pg_mblen(p);
-	}
+/**
+ * Extract minimal V-grams from the word.
+ *
+ * @param wordStart Pointer to the first character of the word.
+ * @param wordEnd Pointer below to the last character of the word.
+ * @param info Callback to be called for each V-gram.
+ * @param maxLength Maximal length of V-gram, at most maxQ.
+ * @param limitFrequency Q-grams of statistics table less frequent than this
+ *		  are considered infrequent.  Zero means whole table is used.
+ */
+static void
+extractMinimalVGramsWordInternal(const char *wordStart, const char *wordEnd,
+								 ExtractVGramsInfo *info, int maxLength,
+								 float4 limitFrequency)
+{
+	vgramExtractMinimalWordVGrams(getStatsDict(), wordStart, wordEnd,
+								  maxLength, limitFrequency,
+								  info->callback, info->userData);
 }
 
 void
 extractMinimalVGramsWord(const char *wordStart, const char *wordEnd, void *userData)
 {
-	const char *p = wordStart,
-			   *prevR = NULL,
-			   *prevP = NULL;
-	ExtractVGramsInfo *info = (ExtractVGramsInfo *) userData;
+	extractMinimalVGramsWordInternal(wordStart, wordEnd,
+									 (ExtractVGramsInfo *) userData,
+									 maxQ, 0.0f);
+}
 
-	while (p < wordEnd)
-	{
-		const char *r = p;
-		int			lower = 0,
-					upper = qgramTableSize - 1,
-					len = 0;
+void
+extractMinimalVGramsWordLimited(const char *wordStart, const char *wordEnd,
+								void *userData)
+{
+	LimitedExtractVGramsInfo *limited = (LimitedExtractVGramsInfo *) userData;
 
-		while (len < maxQ && r < wordEnd)
-		{
-			r += pg_mblen(r);
-			len++;
-			if (len >= minQ && prefixQGramSearch(p, r - p, &lower, &upper) < 0)
-			{
-				if (prevR && prevP && prevR < r)
-				{
-					char	   *qgram;
+	extractMinimalVGramsWordInternal(wordStart, wordEnd, &limited->info,
+									 Min(limited->maxLength, maxQ),
+									 limited->limitFrequency);
+}
 
-					qgram = (char *) palloc(prevR - prevP + 1);
-					memcpy(qgram, prevP, prevR - prevP);
-					qgram[prevR - prevP] = 0;
-					info->callback(qgram, info->userData);
-				}
-				prevR = r;
-				prevP = p;
-				break;
-			}
-		}
-		p += pg_mblen(p);
-	}
-	if (prevR && prevP)
-	{
-		char	   *qgram;
+/**
+ * Get the lowest frequency of q-gram in the statistics table, i.e. actual
+ * limit frequency statistics was collected with.
+ */
+float4
+getStatsLimitFrequency(void)
+{
+	float4		result = 1.0f;
+	int			i;
 
-		qgram = (char *) palloc(prevR - prevP + 1);
-		memcpy(qgram, prevP, prevR - prevP);
-		qgram[prevR - prevP] = 0;
-		info->callback(qgram, info->userData);
-	}
+	if (qgramTableLazy)
+		return lazyLimitFrequency;
+	for (i = 0; i < qgramTableSize; i++)
+		result = Min(result, qgramTable[i].frequency);
+	return result;
 }
 
 /**
- * Extract words from given string add call callback function for each of them.
- * Word is a continuous sequence of isExtractable characters. Surrounds each
- * word with EMPTY_CHARACTER.
+ * Extract words from given string add call callback function for each of them,
+ * see vgramExtractWords().  Word is a continuous sequence of isExtractable
+ * characters surrounded with EMPTY_CHARACTER.
  *
  * @param string Pointer to the source string
  * @param len Length of string *in bytes*
@@ -401,50 +858,7 @@ void
 extractWords(const char *string, size_t len, WordCallback callback,
 			 void *userData)
 {
-	const char *p,
-			   *end = string + len,
-			   *firstExtractable = NULL;
-	char	   *lower,
-			   *buf;
-	size_t		lowerLen;
-
-	buf = (char *) palloc(len + 2);
-	buf[0] = EMPTY_CHARACTER;
-
-	for (p = string; p < end; p += pg_mblen(p))
-	{
-		if (isExtractable(p))
-		{
-			if (!firstExtractable)
-				firstExtractable = p;
-		}
-		else
-		{
-			if (firstExtractable)
-			{
-				lower = lowerstr_with_len(firstExtractable, p - firstExtractable);
-				lowerLen = strlen(lower);
-				memcpy(buf + 1, lower, lowerLen);
-				pfree(lower);
-				buf[lowerLen + 1] = EMPTY_CHARACTER;
-
-				callback(buf, buf + lowerLen + 2, userData);
-
-				firstExtractable = NULL;
-			}
-		}
-	}
-	if (firstExtractable)
-	{
-		lower = lowerstr_with_len(firstExtractable, p - firstExtractable);
-		lowerLen = strlen(lower);
-		memcpy(buf + 1, lower, lowerLen);
-		pfree(lower);
-		buf[lowerLen + 1] = EMPTY_CHARACTER;
-
-		callback(buf, buf + lowerLen + 2, userData);
-	}
-	pfree(buf);
+	vgramExtractWords(getStatsDict(), string, len, callback, userData);
 }
 
 Datum
@@ -470,6 +884,8 @@ print_qgrams(PG_FUNCTION_ARGS)
 									   &qgramsHashCtl,
 								   HASH_ELEM | HASH_FUNCTION | HASH_COMPARE);
 	state.context = CurrentMemoryContext;
+	state.denseCounts = NULL;
+	state.denseSeeded = false;
 
 	extractWords(VARDATA_ANY(s), VARSIZE_ANY_EXHDR(s), collectStatsWord, &state);
 
@@ -531,7 +947,7 @@ get_vgrams(PG_FUNCTION_ARGS)
 		);
 }
 
-static uint32
+uint32
 qgram_key_hash(const void *key, Size keysize)
 {
 	const QGramHashKey *qgramKey = (const QGramHashKey *) key;
@@ -541,7 +957,7 @@ qgram_key_hash(const void *key, Size keysize)
 								   (int) len));
 }
 
-static int
+int
 qgram_key_match(const void *key1, const void *key2, Size keysize)
 {
 	const QGramHashKey *qgramKey1 = (const QGramHashKey *) key1;
@@ -550,21 +966,896 @@ qgram_key_match(const void *key1, const void *key2, Size keysize)
 	return strcmp(qgramKey1->qgram, qgramKey2->qgram);
 }
 
-Datum
-qgram_stat_transfn(PG_FUNCTION_ARGS)
+/**
+ * Create empty q-grams hash of statistics collection state.
+ *
+ * @param state Statistics collection state
+ */
+static void
+createQGramsHash(QGramStatState *state)
 {
-	MemoryContext	oldcontext;
-	QGramStatState *state;
-	HASHCTL			qgramsHashCtl;
-	HASH_SEQ_STATUS	scanStatus;
-	QGramHashValue *item;
-
-	state = PG_ARGISNULL(0) ? NULL : (QGramStatState *) PG_GETARG_POINTER(0);
+	HASHCTL		qgramsHashCtl;
 
-	if (state == NULL)
-	{
-		MemoryContext context,
-					aggcontext;
+	qgramsHashCtl.keysize = sizeof(QGramHashKey);
+	qgramsHashCtl.entrysize = sizeof(QGramHashValue);
+	qgramsHashCtl.hcxt = state->qgramsContext;
+	qgramsHashCtl.hash = qgram_key_hash;
+	qgramsHashCtl.match = qgram_key_match;
+	state->qgramsHash = hash_create("qgrams hash",
+									1024,
+									&qgramsHashCtl,
+									HASH_ELEM | HASH_CONTEXT
+									| HASH_FUNCTION | HASH_COMPARE);
+	state->contextHash = hash_create("context qgrams hash",
+									 64,
+									 &qgramsHashCtl,
+									 HASH_ELEM | HASH_CONTEXT
+									 | HASH_FUNCTION | HASH_COMPARE);
+}
+
+/*
+ * Get memory limit of q-grams hash in bytes, zero means no limit.
+ */
+static Size
+getStatsMemoryLimit(void)
+{
+	int			limit = vgramStatsMemoryLimit;
+
+	if (limit < 0)
+		limit = maintenance_work_mem;
+	return (Size) limit * 1024;
+}
+
+/*
+ * Get memory used by dense counters of statistics collection state.
+ */
+static Size
+getDenseCountersMemory(QGramStatState *state)
+{
+	if (!state->denseCounts)
+		return 0;
+	return (sizeof(int64) + sizeof(uint32)) *
+		state->denseOffsets[VGRAM_DENSE_MAXQ + 1] +
+		sizeof(int64) * VGRAM_DENSE_ALPHABET;
+}
+
+/**
+ * Allocate dense counters of statistics collection state.  Counters are
+ * accounted in memory limit of statistics collection, so they aren't
+ * allocated when they would take more than half of the limit.
+ *
+ * @param state Statistics collection state
+ */
+static void
+initDenseCounters(QGramStatState *state)
+{
+	HASHCTL		charIdsHashCtl;
+	int64		cells = 1;
+	Size		limit = getStatsMemoryLimit();
+	int			q;
+
+	state->denseChecked = true;
+
+	StaticAssertStmt(minQ <= VGRAM_DENSE_MAXQ,
+					 "VGRAM_DENSE_MAXQ must be at least minQ");
+	state->denseOffsets[minQ] = 0;
+	for (q = 1; q <= VGRAM_DENSE_MAXQ; q++)
+	{
+		cells *= VGRAM_DENSE_ALPHABET;
+		if (q >= minQ)
+			state->denseOffsets[q + 1] = state->denseOffsets[q] + cells;
+	}
+
+	cells = state->denseOffsets[VGRAM_DENSE_MAXQ + 1];
+	if (limit > 0 && (sizeof(int64) + sizeof(uint32)) * cells +
+		sizeof(int64) * VGRAM_DENSE_ALPHABET > limit / 2)
+		return;
+
+	state->denseCharCounts = (int64 *)
+		MemoryContextAllocZero(state->context,
+							   sizeof(int64) * VGRAM_DENSE_ALPHABET);
+	state->denseCounts = (int64 *)
+		MemoryContextAllocZero(state->context, sizeof(int64) * cells);
+	state->denseStamps = (uint32 *)
+		MemoryContextAllocZero(state->context, sizeof(uint32) * cells);
+	state->denseStamp = 0;
+
+	charIdsHashCtl.keysize = sizeof(uint32);
+	charIdsHashCtl.entrysize = sizeof(DenseCharId);
+	charIdsHashCtl.hcxt = state->context;
+	state->charIdsHash = hash_create("dense character ids hash",
+									 256,
+									 &charIdsHashCtl,
+									 HASH_ELEM | HASH_CONTEXT | HASH_BLOBS);
+}
+
+/*
+ * Q-grams sharing first nchars characters belong to the same partition.
+ * Thus, every q-gram is in the same partition as its prefixes used by cost
+ * model, except prefixes shorter than nchars.  Hash is salted by level of
+ * partitioning, so children of the partition don't inherit its skew.
+ */
+static int
+qgramPartition(const char *qgram, int nchars, int level)
+{
+	const char *p = qgram;
+	uint32		hash;
+	int			i;
+
+	for (i = 0; i < nchars && *p; i++)
+		p += pg_mblen(p);
+	hash = DatumGetUInt32(hash_any((const unsigned char *) qgram, p - qgram));
+	if (level > 0)
+		hash = DatumGetUInt32(hash_uint32(hash ^ ((uint32) level * 0x9E3779B9)));
+	return hash % VGRAM_SPILL_PARTITIONS;
+}
+
+/*
+ * Estimated memory used by single entry of q-grams hash.
+ */
+static Size
+getQGramEntrySize(void)
+{
+	return MAXALIGN(sizeof(HASHELEMENT)) + MAXALIGN(sizeof(QGramHashValue)) +
+		MAXALIGN(maxQ * pg_database_encoding_max_length() + 1) + 16;
+}
+
+/*
+ * Get memory used by q-grams hash and dense counters.
+ */
+static Size
+getQGramsMemory(QGramStatState *state)
+{
+#if PG_VERSION_NUM >= 130000
+	return MemoryContextMemAllocated(state->qgramsContext, true) +
+		getDenseCountersMemory(state);
+#else
+	return hash_get_num_entries(state->qgramsHash) * getQGramEntrySize() +
+		getDenseCountersMemory(state);
+#endif
+}
+
+/**
+ * Add empty leaf partitions to statistics collection state.
+ *
+ * @param state Statistics collection state
+ * @param level Partitioning level of new partitions
+ * @return Index of the first new partition
+ */
+static int
+addStatsPartitions(QGramStatState *state, int level)
+{
+	MemoryContext oldcontext = MemoryContextSwitchTo(state->context);
+	int			first = state->npartitions,
+				i;
+
+	if (!state->partitions)
+	{
+		state->allocatedPartitions = VGRAM_SPILL_PARTITIONS;
+		state->partitions = (QGramPartition *)
+			palloc(sizeof(QGramPartition) * state->allocatedPartitions);
+	}
+	else if (state->npartitions + VGRAM_SPILL_PARTITIONS > state->allocatedPartitions)
+	{
+		state->allocatedPartitions *= 2;
+		state->partitions = (QGramPartition *)
+			repalloc(state->partitions,
+					 sizeof(QGramPartition) * state->allocatedPartitions);
+	}
+
+	for (i = 0; i < VGRAM_SPILL_PARTITIONS; i++)
+	{
+		QGramPartition *partition = &state->partitions[first + i];
+
+		partition->file = BufFileCreateTemp(false);
+		partition->nitems = 0;
+		partition->endFile = 0;
+		partition->endOffset = 0;
+		partition->level = level;
+		partition->children = -1;
+	}
+	state->npartitions += VGRAM_SPILL_PARTITIONS;
+
+	MemoryContextSwitchTo(oldcontext);
+	return first;
+}
+
+/*
+ * Remember end of leaf partition files, where next spill continues.
+ */
+static void
+tellStatsPartitions(QGramStatState *state)
+{
+	int			i;
+
+	for (i = 0; i < state->npartitions; i++)
+	{
+		QGramPartition *partition = &state->partitions[i];
+
+		if (partition->file)
+			BufFileTell(partition->file, &partition->endFile,
+						&partition->endOffset);
+	}
+}
+
+/*
+ * Write q-gram record to leaf partition reached from the given one.  Short
+ * q-grams are routed to all the children of split partition.
+ */
+static void
+routeQGram(QGramStatState *state, int i, const char *qgram, int32 len,
+		   int nchars, int64 count, bool context)
+{
+	QGramPartition *partition = &state->partitions[i];
+	int			keyChars = minQ + partition->level + 1,
+				children = partition->children,
+				owner,
+				j;
+
+	if (children < 0)
+	{
+		int32		header = context ? -len : len;
+
+		BufFileWrite(partition->file, &header, sizeof(header));
+		BufFileWrite(partition->file, (void *) qgram, len);
+		BufFileWrite(partition->file, &count, sizeof(count));
+		partition->nitems++;
+		return;
+	}
+
+	if (nchars >= keyChars)
+	{
+		routeQGram(state, children + qgramPartition(qgram, keyChars, partition->level + 1),
+				   qgram, len, nchars, count, context);
+		return;
+	}
+
+	owner = qgramPartition(qgram, nchars, partition->level + 1);
+	for (j = 0; j < VGRAM_SPILL_PARTITIONS; j++)
+		routeQGram(state, children + j, qgram, len, nchars, count,
+				   context || j != owner);
+}
+
+/*
+ * Find leaf partition owning the q-gram.
+ */
+static int
+getQGramOwner(QGramStatState *state, const char *qgram)
+{
+	int			nchars = pg_mbstrlen(qgram),
+				i = qgramPartition(qgram, minQ, 0);
+
+	while (state->partitions[i].children >= 0)
+	{
+		QGramPartition *partition = &state->partitions[i];
+		int			keyChars = minQ + partition->level + 1;
+
+		i = partition->children + qgramPartition(qgram, Min(nchars, keyChars),
+												 partition->level + 1);
+	}
+	return i;
+}
+
+/**
+ * Read record of partition file.
+ *
+ * @param file Partition file
+ * @param buffer Buffer for q-gram, enlarged when needed
+ * @param bufferSize Size of buffer
+ * @param count Receives count of q-gram
+ * @param context Receives whether record is context one
+ * @return Length of q-gram
+ */
+static int32
+readPartitionRecord(BufFile *file, char **buffer, int32 *bufferSize,
+					int64 *count, bool *context)
+{
+	int32		len;
+
+	if (BufFileRead(file, &len, sizeof(len)) != sizeof(len))
+		elog(ERROR, "Error reading q-gram statistics temporary file.");
+	*context = (len < 0);
+	if (len < 0)
+		len = -len;
+	if (len >= *bufferSize)
+	{
+		*bufferSize = len + 1;
+		*buffer = (char *) repalloc(*buffer, *bufferSize);
+	}
+	if (BufFileRead(file, *buffer, len) != len ||
+		BufFileRead(file, count, sizeof(*count)) != sizeof(*count))
+		elog(ERROR, "Error reading q-gram statistics temporary file.");
+	(*buffer)[len] = '\0';
+	return len;
+}
+
+/**
+ * Split leaf partition into VGRAM_SPILL_PARTITIONS children keyed by one
+ * more character.
+ *
+ * @param state Statistics collection state
+ * @param i Number of partition
+ */
+static void
+splitStatsPartition(QGramStatState *state, int i)
+{
+	BufFile    *file = state->partitions[i].file;
+	int64		nitems = state->partitions[i].nitems,
+				j;
+	int32		bufferSize = 64;
+	char	   *buffer = (char *) MemoryContextAlloc(state->context, bufferSize);
+	int			children;
+
+	children = addStatsPartitions(state, state->partitions[i].level + 1);
+	state->partitions[i].children = children;
+	state->partitions[i].file = NULL;
+	state->partitions[i].nitems = 0;
+
+	if (BufFileSeek(file, 0, 0, SEEK_SET) != 0)
+		elog(ERROR, "Error seeking q-gram statistics temporary file.");
+	for (j = 0; j < nitems; j++)
+	{
+		int64		count;
+		bool		context;
+		int32		len;
+
+		CHECK_FOR_INTERRUPTS();
+
+		len = readPartitionRecord(file, &buffer, &bufferSize, &count, &context);
+		routeQGram(state, i, buffer, len, pg_mbstrlen_with_len(buffer, len),
+				   count, context);
+	}
+	BufFileClose(file);
+	pfree(buffer);
+	tellStatsPartitions(state);
+}
+
+/**
+ * Write all q-grams held in memory to partitions and empty q-grams hash.
+ *
+ * @param state Statistics collection state
+ */
+static void
+spillQGrams(QGramStatState *state)
+{
+	HASH_SEQ_STATUS scanStatus;
+	QGramHashValue *item;
+	int			i;
+
+	if (!state->partitions)
+		(void) addStatsPartitions(state, 0);
+
+	/* Partitions could be read since last spill */
+	for (i = 0; i < state->npartitions; i++)
+	{
+		QGramPartition *partition = &state->partitions[i];
+
+		if (partition->file &&
+			BufFileSeek(partition->file, partition->endFile,
+						partition->endOffset, SEEK_SET) != 0)
+			elog(ERROR, "Error seeking q-gram statistics temporary file.");
+	}
+
+	hash_seq_init(&scanStatus, state->qgramsHash);
+	while ((item = (QGramHashValue *) hash_seq_search(&scanStatus)) != NULL)
+		routeQGram(state, qgramPartition(item->key.qgram, minQ, 0),
+				   item->key.qgram, strlen(item->key.qgram),
+				   pg_mbstrlen(item->key.qgram), item->count, false);
+
+	tellStatsPartitions(state);
+
+	MemoryContextReset(state->qgramsContext);
+	createQGramsHash(state);
+}
+
+/*
+ * Spill q-grams held in memory when they exceed memory limit.
+ */
+static void
+checkStatsMemory(QGramStatState *state)
+{
+	Size		limit = getStatsMemoryLimit();
+
+	if (limit > 0 && getQGramsMemory(state) > limit)
+		spillQGrams(state);
+}
+
+/**
+ * Move dense counts into q-grams and characters hashes.
+ *
+ * @param state Statistics collection state
+ */
+static void
+flushDenseCounters(QGramStatState *state)
+{
+	int			q,
+				i;
+
+	if (!state->denseCounts || !state->denseUsed)
+		return;
+
+	for (q = minQ; q <= VGRAM_DENSE_MAXQ; q++)
+	{
+		int64		cell,
+					cells = state->denseOffsets[q + 1] - state->denseOffsets[q];
+
+		for (cell = 0; cell < cells; cell++)
+		{
+			int64	   *count = &state->denseCounts[state->denseOffsets[q] + cell];
+			char		qgram[VGRAM_DENSE_MAXQ * MAX_MULTIBYTE_CHAR_LEN + 1];
+			char	   *p = qgram + sizeof(qgram) - 1;
+			int64		rest = cell;
+			QGramHashKey key;
+			QGramHashValue *value;
+			bool		found;
+
+			if (*count == 0)
+				continue;
+
+			/* Decode ids from the last character */
+			*p = '\0';
+			for (i = 0; i < q; i++)
+			{
+				const char *c = state->denseChars[rest % VGRAM_DENSE_ALPHABET];
+				int			len = strlen(c);
+
+				p -= len;
+				memcpy(p, c, len);
+				rest /= VGRAM_DENSE_ALPHABET;
+			}
+
+			key.qgram = p;
+			value = (QGramHashValue *) hash_search(state->qgramsHash,
+												   (const void *) &key,
+												   HASH_ENTER, &found);
+			if (!found)
+			{
+				value->key.qgram = MemoryContextStrdup(state->qgramsContext, p);
+				value->count = 0;
+			}
+			value->count += *count;
+			*count = 0;
+
+			if (hash_get_num_entries(state->qgramsHash) % VGRAM_PROGRESS_INTERVAL == 0)
+				checkStatsMemory(state);
+		}
+	}
+
+	for (i = 0; i < state->denseCharsCount; i++)
+	{
+		QGramHashKey key;
+		QGramHashValue *value;
+		bool		found;
+
+		if (state->denseCharCounts[i] == 0)
+			continue;
+
+		key.qgram = state->denseChars[i];
+		value = (QGramHashValue *) hash_search(state->charactersHash,
+											   (const void *) &key,
+											   HASH_ENTER, &found);
+		if (!found)
+		{
+			value->key.qgram = MemoryContextStrdup(state->context, key.qgram);
+			value->count = 0;
+		}
+		value->count += state->denseCharCounts[i];
+		state->denseCharCounts[i] = 0;
+	}
+
+	state->denseUsed = false;
+}
+
+/**
+ * Apply count adjustment to q-grams held in memory.
+ *
+ * @param state Statistics collection state
+ * @param partition Partition held in memory, or -1 when all q-grams are
+ */
+static void
+adjustLoadedCounts(QGramStatState *state, int partition)
+{
+	HASH_SEQ_STATUS scanStatus;
+	QGramHashValue *item;
+
+	if (!state->countOverrides)
+		return;
+
+	hash_seq_init(&scanStatus, state->qgramsHash);
+	while ((item = (QGramHashValue *) hash_seq_search(&scanStatus)) != NULL)
+		item->count = (int64) (item->count * state->countScale + 0.5);
+	hash_seq_init(&scanStatus, state->contextHash);
+	while ((item = (QGramHashValue *) hash_seq_search(&scanStatus)) != NULL)
+		item->count = (int64) (item->count * state->countScale + 0.5);
+
+	hash_seq_init(&scanStatus, state->countOverrides);
+	while ((item = (QGramHashValue *) hash_seq_search(&scanStatus)) != NULL)
+	{
+		QGramHashValue *value;
+		bool		found;
+
+		/* Q-grams owned by other partitions are adjusted only as context */
+		if (partition >= 0 &&
+			getQGramOwner(state, item->key.qgram) != state->leaves[partition])
+		{
+			value = (QGramHashValue *) hash_search(state->contextHash,
+												   (const void *) &item->key,
+												   HASH_FIND, NULL);
+			if (value)
+				value->count = Max(value->count, item->count);
+			continue;
+		}
+
+		value = (QGramHashValue *) hash_search(state->qgramsHash,
+											   (const void *) &item->key,
+											   HASH_ENTER, &found);
+		if (!found)
+		{
+			value->key.qgram = MemoryContextStrdup(state->qgramsContext,
+												   item->key.qgram);
+			value->count = 0;
+		}
+		value->count = Max(value->count, item->count);
+	}
+}
+
+/*
+ * Prepare to iterate over q-grams partition by partition.  Returns number of
+ * partitions.  When q-grams were never spilled, the only partition is q-grams
+ * hash held in memory.  Partitions, which wouldn't fit memory limit, are
+ * split while key of their children is not longer than maxQ.
+ */
+static int
+beginStatsPartitions(QGramStatState *state)
+{
+	Size		limit;
+	int			i;
+
+	flushDenseCounters(state);
+	checkStatsMemory(state);
+	if (!state->partitions)
+	{
+		/* Adjustment of q-grams held in memory is applied once */
+		adjustLoadedCounts(state, -1);
+		state->countOverrides = NULL;
+		return 1;
+	}
+
+	spillQGrams(state);
+
+	/* Children are appended, so they are checked by the same loop */
+	limit = getStatsMemoryLimit();
+	for (i = 0; i < state->npartitions; i++)
+	{
+		QGramPartition *partition = &state->partitions[i];
+
+		if (partition->children < 0 && limit > 0 &&
+			partition->level < maxQ - minQ &&
+			(double) partition->nitems * getQGramEntrySize() > (double) limit)
+			splitStatsPartition(state, i);
+	}
+
+	if (state->leaves)
+		pfree(state->leaves);
+	state->leaves = (int *) MemoryContextAlloc(state->context,
+											   sizeof(int) * state->npartitions);
+	state->nleaves = 0;
+	for (i = 0; i < state->npartitions; i++)
+	{
+		if (state->partitions[i].children < 0)
+			state->leaves[state->nleaves++] = i;
+	}
+	return state->nleaves;
+}
+
+/**
+ * Rewrite partition file with one record per q-gram loaded into memory, so
+ * next load of partition doesn't sum the same records again.
+ *
+ * @param state Statistics collection state
+ * @param partition Loaded partition
+ */
+static void
+compactStatsPartition(QGramStatState *state, QGramPartition *partition)
+{
+	MemoryContext oldcontext;
+	HASH_SEQ_STATUS scanStatus;
+	QGramHashValue *item;
+	int			pass;
+
+	BufFileClose(partition->file);
+	oldcontext = MemoryContextSwitchTo(state->context);
+	partition->file = BufFileCreateTemp(false);
+	MemoryContextSwitchTo(oldcontext);
+	partition->nitems = 0;
+
+	for (pass = 0; pass < 2; pass++)
+	{
+		hash_seq_init(&scanStatus, pass ? state->contextHash : state->qgramsHash);
+		while ((item = (QGramHashValue *) hash_seq_search(&scanStatus)) != NULL)
+		{
+			int32		len = strlen(item->key.qgram),
+						header = pass ? -len : len;
+
+			BufFileWrite(partition->file, &header, sizeof(header));
+			BufFileWrite(partition->file, item->key.qgram, len);
+			BufFileWrite(partition->file, &item->count, sizeof(item->count));
+			partition->nitems++;
+		}
+	}
+	BufFileTell(partition->file, &partition->endFile, &partition->endOffset);
+}
+
+/**
+ * Load partition of q-grams into q-grams hash summing counts of the same
+ * q-gram.  Context records go to context hash.
+ *
+ * @param state Statistics collection state
+ * @param i Number of partition
+ */
+static void
+loadStatsPartition(QGramStatState *state, int i)
+{
+	QGramPartition *partition;
+	int64		j,
+				loaded;
+	char	   *buffer;
+	int32		bufferSize = 64;
+
+	if (!state->partitions)
+		return;
+
+	partition = &state->partitions[state->leaves[i]];
+	MemoryContextReset(state->qgramsContext);
+	createQGramsHash(state);
+	buffer = (char *) MemoryContextAlloc(state->qgramsContext, bufferSize);
+
+	if (BufFileSeek(partition->file, 0, 0, SEEK_SET) != 0)
+		elog(ERROR, "Error seeking q-gram statistics temporary file.");
+
+	for (j = 0; j < partition->nitems; j++)
+	{
+		QGramHashKey key;
+		QGramHashValue *value;
+		int64		count;
+		bool		found,
+					context;
+
+		(void) readPartitionRecord(partition->file, &buffer, &bufferSize,
+								   &count, &context);
+
+		key.qgram = buffer;
+		value = (QGramHashValue *) hash_search(context ? state->contextHash :
+											   state->qgramsHash,
+											   (const void *) &key,
+											   HASH_ENTER, &found);
+		if (!found)
+		{
+			value->key.qgram = MemoryContextStrdup(state->qgramsContext, buffer);
+			value->count = 0;
+		}
+		value->count += count;
+	}
+
+	/* Counts are adjusted in memory only, so file keeps the raw ones */
+	loaded = hash_get_num_entries(state->qgramsHash) +
+		hash_get_num_entries(state->contextHash);
+	if (partition->nitems > loaded)
+		compactStatsPartition(state, partition);
+
+	adjustLoadedCounts(state, i);
+}
+
+/*
+ * Finish iteration over partitions.  Loaded partition is already on disk, so
+ * q-grams hash is emptied before collection continues.
+ */
+static void
+endStatsPartitions(QGramStatState *state)
+{
+	if (!state->partitions)
+		return;
+
+	MemoryContextReset(state->qgramsContext);
+	createQGramsHash(state);
+}
+
+/*
+ * Close temporary files of partitions.
+ */
+static void
+freeStatsPartitions(QGramStatState *state)
+{
+	int			i;
+
+	if (!state->partitions)
+		return;
+
+	for (i = 0; i < state->npartitions; i++)
+	{
+		if (state->partitions[i].file)
+			BufFileClose(state->partitions[i].file);
+	}
+	pfree(state->partitions);
+	state->partitions = NULL;
+	state->npartitions = 0;
+	if (state->leaves)
+		pfree(state->leaves);
+	state->leaves = NULL;
+	state->nleaves = 0;
+}
+
+/**
+ * Create state of q-grams statistics collection.
+ *
+ * @param aggcontext Aggregate memory context
+ * @return New state
+ */
+static QGramStatState *
+createQGramStatState(MemoryContext aggcontext)
+{
+	MemoryContext context;
+	QGramStatState *state;
+	HASHCTL		qgramsHashCtl;
+
+	/* Make a temporary context to hold all the junk */
+	context = AllocSetContextCreate(aggcontext,
+									"qgram_stat result",
+									ALLOCSET_DEFAULT_MINSIZE,
+									ALLOCSET_DEFAULT_INITSIZE,
+									ALLOCSET_DEFAULT_MAXSIZE);
+	state = (QGramStatState *) MemoryContextAlloc(context, sizeof(QGramStatState));
+	state->tmpContext = AllocSetContextCreate(aggcontext,
+											  "qgram_stat result",
+											  ALLOCSET_DEFAULT_MINSIZE,
+											  ALLOCSET_DEFAULT_INITSIZE,
+											  ALLOCSET_DEFAULT_MAXSIZE);
+	state->qgramsContext = AllocSetContextCreate(context,
+												 "qgram_stat qgrams",
+												 ALLOCSET_DEFAULT_MINSIZE,
+												 ALLOCSET_DEFAULT_INITSIZE,
+												 ALLOCSET_DEFAULT_MAXSIZE);
+	state->context = context;
+	state->partitions = NULL;
+	state->npartitions = 0;
+	state->allocatedPartitions = 0;
+	state->leaves = NULL;
+	state->nleaves = 0;
+	state->totalCount = 0;
+	state->totalLength = 0;
+	state->countScale = 1.0;
+	state->countOverrides = NULL;
+
+	createQGramsHash(state);
+
+	/* Dense counters are allocated once the first row is counted */
+	state->denseCounts = NULL;
+	state->denseCharCounts = NULL;
+	state->denseStamps = NULL;
+	state->charIdsHash = NULL;
+	state->denseUsed = false;
+	state->denseCharsCount = 0;
+	state->denseSeedRows = 0;
+	state->denseSeeded = false;
+	state->denseChecked = false;
+	memset(state->byteIds, 0, sizeof(state->byteIds));
+
+	qgramsHashCtl.keysize = sizeof(QGramHashKey);
+	qgramsHashCtl.entrysize = sizeof(QGramHashValue);
+	qgramsHashCtl.hcxt = state->context;
+	qgramsHashCtl.hash = qgram_key_hash;
+	qgramsHashCtl.match = qgram_key_match;
+	state->charactersHash = hash_create("letters hash",
+										1024,
+										&qgramsHashCtl,
+										HASH_ELEM | HASH_CONTEXT
+										| HASH_FUNCTION | HASH_COMPARE);
+	progressStart(-1);
+	return state;
+}
+
+/**
+ * Report progress of statistics collection.  Unless forced, progress is
+ * reported once per VGRAM_PROGRESS_INTERVAL rows.
+ *
+ * @param state Statistics collection state
+ * @param phase Current phase
+ * @param force Report regardless of number of rows processed
+ */
+static void
+reportStatsProgress(QGramStatState *state, VGramProgressPhase phase,
+					bool force)
+{
+	int64		memory = -1;
+
+	if (!force && state->totalCount % VGRAM_PROGRESS_INTERVAL != 0)
+		return;
+
+#if PG_VERSION_NUM >= 130000
+	memory = MemoryContextMemAllocated(state->context, true);
+#endif
+	progressUpdate(phase, state->totalCount,
+				   hash_get_num_entries(state->qgramsHash), memory);
+}
+
+/**
+ * Account q-grams and characters of the document in the statistics.
+ *
+ * @param state Statistics collection state
+ * @param s Document
+ */
+static void
+collectStatsRow(QGramStatState *state, text *s)
+{
+	MemoryContext	oldcontext;
+	HASHCTL			qgramsHashCtl;
+	HASH_SEQ_STATUS	scanStatus;
+	QGramHashValue *item;
+
+	if (!state->denseChecked)
+		initDenseCounters(state);
+
+	oldcontext = MemoryContextSwitchTo(state->tmpContext);
+
+	/* New stamp makes all the dense cells uncounted for this row */
+	if (state->denseCounts && ++state->denseStamp == 0)
+	{
+		memset(state->denseStamps, 0,
+			   sizeof(uint32) * state->denseOffsets[VGRAM_DENSE_MAXQ + 1]);
+		state->denseStamp = 1;
+	}
+
+	qgramsHashCtl.keysize = sizeof(QGramHashKey);
+	qgramsHashCtl.entrysize = sizeof(QGramHashValue);
+	qgramsHashCtl.hcxt = state->tmpContext;
+	qgramsHashCtl.hash = qgram_key_hash;
+	qgramsHashCtl.match = qgram_key_match;
+	state->stringQGramsHash = hash_create("string qgrams hash",
+										  1024,
+										  &qgramsHashCtl,
+										  HASH_ELEM | HASH_CONTEXT
+										  | HASH_FUNCTION | HASH_COMPARE);
+
+	extractWords(VARDATA_ANY(s), VARSIZE_ANY_EXHDR(s), collectStatsWord, state);
+	hash_seq_init(&scanStatus, state->stringQGramsHash);
+	while ((item = (QGramHashValue *) hash_seq_search(&scanStatus)) != NULL)
+	{
+		bool		found;
+		QGramHashValue *value;
+
+		value = (QGramHashValue *) hash_search(state->qgramsHash,
+											   (const void *) &item->key,
+											   HASH_ENTER,
+											   &found);
+		if (!found)
+		{
+			value->key.qgram = MemoryContextStrdup(state->qgramsContext, value->key.qgram);
+			value->count = 1;
+		}
+		else
+			value->count++;
+	}
+	hash_destroy(state->stringQGramsHash);
+
+	MemoryContextSwitchTo(oldcontext);
+	MemoryContextReset(state->tmpContext);
+
+	if (state->denseCounts && !state->denseSeeded &&
+		++state->denseSeedRows >= VGRAM_DENSE_SEED_ROWS)
+		seedDenseCharIds(state);
+	checkStatsMemory(state);
+}
+
+Datum
+qgram_stat_transfn(PG_FUNCTION_ARGS)
+{
+	QGramStatState *state;
+
+	state = PG_ARGISNULL(0) ? NULL : (QGramStatState *) PG_GETARG_POINTER(0);
+
+	if (state == NULL)
+	{
+		MemoryContext aggcontext;
 
 		/* First time through --- initialize */
 		if (!AggCheckCallContext(fcinfo, &aggcontext))
@@ -572,94 +1863,207 @@ qgram_stat_transfn(PG_FUNCTION_ARGS)
 			/* cannot be called directly because of internal-type argument */
 			elog(ERROR, "array_agg_transfn called in non-aggregate context");
 		}
+		state = createQGramStatState(aggcontext);
+	}
+	state->totalCount++;
+
+	if (!PG_ARGISNULL(1))
+		collectStatsRow(state, PG_GETARG_TEXT_PP(1));
+	reportStatsProgress(state, VGRAM_PROGRESS_COUNTING, false);
+
+	PG_RETURN_POINTER(state);
+}
+
+/*
+ * Exported statistics format version.  Exported state is stored in network
+ * byte order, so it can be transferred between servers of any architecture.
+ */
+#define QGRAM_STAT_EXPORT_MAGIC		0x56475331	/* "VGS1" */
+
+/**
+ * Write counts of hash table to exported statistics.  Number of items is
+ * written before items by the caller.
+ *
+ * @param buf Buffer to write to
+ * @param hash Hash table of q-grams or characters
+ */
+static void
+serializeCounts(StringInfo buf, HTAB *hash)
+{
+	HASH_SEQ_STATUS scanStatus;
+	QGramHashValue *item;
+
+	hash_seq_init(&scanStatus, hash);
+	while ((item = (QGramHashValue *) hash_seq_search(&scanStatus)) != NULL)
+	{
+		int			len = strlen(item->key.qgram);
+
+		pq_sendint(buf, len, 4);
+		pq_sendbytes(buf, item->key.qgram, len);
+		pq_sendint64(buf, item->count);
+	}
+}
+
+/**
+ * Read counts from exported statistics and add them to the state.
+ *
+ * @param buf Buffer to read from
+ * @param state Statistics collection state
+ * @param qgrams Read q-grams when true, characters otherwise
+ */
+static void
+mergeCounts(StringInfo buf, QGramStatState *state, bool qgrams)
+{
+	int			count,
+				i;
+
+	count = pq_getmsgint(buf, 4);
+	if (count < 0)
+		elog(ERROR, "Error reading exported q-gram statistics.");
+
+	for (i = 0; i < count; i++)
+	{
+		QGramHashKey key;
+		QGramHashValue *value;
+		bool		found;
+		int			len;
+
+		len = pq_getmsgint(buf, 4);
+		if (len <= 0 || len > buf->len - buf->cursor)
+			elog(ERROR, "Error reading exported q-gram statistics.");
+		key.qgram = pnstrdup(pq_getmsgbytes(buf, len), len);
+		pg_verifymbstr(key.qgram, len, false);
+
+		value = (QGramHashValue *) hash_search(qgrams ? state->qgramsHash :
+											   state->charactersHash,
+											   (const void *) &key,
+											   HASH_ENTER, &found);
+		if (!found)
+		{
+			value->key.qgram = MemoryContextStrdup(qgrams ? state->qgramsContext :
+												   state->context,
+												   key.qgram);
+			value->count = 0;
+		}
+		value->count += pq_getmsgint64(buf);
+		pfree(key.qgram);
 
-		/* Make a temporary context to hold all the junk */
-		context = AllocSetContextCreate(aggcontext,
-										"qgram_stat result",
-										ALLOCSET_DEFAULT_MINSIZE,
-										ALLOCSET_DEFAULT_INITSIZE,
-										ALLOCSET_DEFAULT_MAXSIZE);
-		state = (QGramStatState *) MemoryContextAlloc(context, sizeof(QGramStatState));
-		state->tmpContext = AllocSetContextCreate(aggcontext,
-												  "qgram_stat result",
-												  ALLOCSET_DEFAULT_MINSIZE,
-												  ALLOCSET_DEFAULT_INITSIZE,
-												  ALLOCSET_DEFAULT_MAXSIZE);
-		state->context = context;
-		oldcontext = MemoryContextSwitchTo(state->tmpContext);
-		state->totalCount = 0;
-
-		qgramsHashCtl.keysize = sizeof(QGramHashKey);
-		qgramsHashCtl.entrysize = sizeof(QGramHashValue);
-		qgramsHashCtl.hcxt = state->context;
-		qgramsHashCtl.hash = qgram_key_hash;
-		qgramsHashCtl.match = qgram_key_match;
-		state->qgramsHash = hash_create("qgrams hash",
-										1024,
-										&qgramsHashCtl,
-										HASH_ELEM | HASH_CONTEXT
-										| HASH_FUNCTION | HASH_COMPARE);
-		state->charactersHash = hash_create("letters hash",
-											1024,
-											&qgramsHashCtl,
-											HASH_ELEM | HASH_CONTEXT
-											| HASH_FUNCTION | HASH_COMPARE);
-
+		if (qgrams && i % VGRAM_PROGRESS_INTERVAL == 0)
+			checkStatsMemory(state);
 	}
-	else
+}
+
+/*
+ * Final function of qgram_stat_export() aggregate: export collected counts
+ * instead of writing statistics, so they could be merged with counts
+ * collected on other shards using qgram_stat_merge().
+ */
+Datum
+qgram_stat_export_finalfn(PG_FUNCTION_ARGS)
+{
+	QGramStatState *state;
+	StringInfoData buf;
+	int			countOffset,
+				nparts,
+				i;
+	uint32		count = 0;
+
+	state = PG_ARGISNULL(0) ? NULL : (QGramStatState *) PG_GETARG_POINTER(0);
+	if (!state)
+		PG_RETURN_NULL();
+
+	pq_begintypsend(&buf);
+	pq_sendint(&buf, QGRAM_STAT_EXPORT_MAGIC, 4);
+	pq_sendint(&buf, minQ, 4);
+	pq_sendint(&buf, maxQ, 4);
+	pq_sendint64(&buf, state->totalCount);
+	pq_sendint64(&buf, state->totalLength);
+	reportStatsProgress(state, VGRAM_PROGRESS_WRITING, true);
+
+	/* Number of q-grams is known only after all partitions are written */
+	countOffset = buf.len;
+	pq_sendint(&buf, 0, 4);
+	nparts = beginStatsPartitions(state);
+	for (i = 0; i < nparts; i++)
 	{
-		oldcontext = MemoryContextSwitchTo(state->tmpContext);
-		state->totalCount++;
+		loadStatsPartition(state, i);
+		count += hash_get_num_entries(state->qgramsHash);
+		serializeCounts(&buf, state->qgramsHash);
 	}
+	freeStatsPartitions(state);
+	count = htonl(count);
+	memcpy(buf.data + countOffset, &count, sizeof(count));
 
-	if (!PG_ARGISNULL(1))
+	pq_sendint(&buf, (int32) hash_get_num_entries(state->charactersHash), 4);
+	serializeCounts(&buf, state->charactersHash);
+	progressEnd();
+
+	PG_RETURN_BYTEA_P(pq_endtypsend(&buf));
+}
+
+/*
+ * Transition function of qgram_stat_merge() aggregate: add counts exported
+ * by qgram_stat_export() to the state.
+ */
+Datum
+qgram_stat_merge_transfn(PG_FUNCTION_ARGS)
+{
+	MemoryContext oldcontext;
+	QGramStatState *state;
+	bytea	   *exported;
+	StringInfoData buf;
+
+	state = PG_ARGISNULL(0) ? NULL : (QGramStatState *) PG_GETARG_POINTER(0);
+
+	if (state == NULL)
 	{
-		text	   *s = PG_GETARG_TEXT_PP(1);
-
-		qgramsHashCtl.keysize = sizeof(QGramHashKey);
-		qgramsHashCtl.entrysize = sizeof(QGramHashValue);
-		qgramsHashCtl.hcxt = state->tmpContext;
-		qgramsHashCtl.hash = qgram_key_hash;
-		qgramsHashCtl.match = qgram_key_match;
-		state->stringQGramsHash = hash_create("string qgrams hash",
-											  1024,
-											  &qgramsHashCtl,
-											  HASH_ELEM | HASH_CONTEXT
-											  | HASH_FUNCTION | HASH_COMPARE);
-
-		extractWords(VARDATA_ANY(s), VARSIZE_ANY_EXHDR(s), collectStatsWord, state);
-		hash_seq_init(&scanStatus, state->stringQGramsHash);
-		while ((item = (QGramHashValue *) hash_seq_search(&scanStatus)) != NULL)
-		{
-			bool		found;
-			QGramHashValue *value;
+		MemoryContext aggcontext;
 
-			value = (QGramHashValue *) hash_search(state->qgramsHash,
-												   (const void *) &item->key,
-												   HASH_ENTER,
-												   &found);
-			if (!found)
-			{
-				value->key.qgram = MemoryContextStrdup(state->context, value->key.qgram);
-				value->count = 1;
-			}
-			else
-				value->count++;
-		}
-		hash_destroy(state->stringQGramsHash);
-		MemoryContextReset(state->tmpContext);
+		if (!AggCheckCallContext(fcinfo, &aggcontext))
+			elog(ERROR, "qgram_stat_merge_transfn called in non-aggregate context");
+		state = createQGramStatState(aggcontext);
 	}
 
+	if (PG_ARGISNULL(1))
+		PG_RETURN_POINTER(state);
+
+	exported = PG_GETARG_BYTEA_PP(1);
+	oldcontext = MemoryContextSwitchTo(state->tmpContext);
+
+	buf.data = VARDATA_ANY(exported);
+	buf.len = VARSIZE_ANY_EXHDR(exported);
+	buf.maxlen = buf.len;
+	buf.cursor = 0;
+
+	if (pq_getmsgint(&buf, 4) != QGRAM_STAT_EXPORT_MAGIC)
+		elog(ERROR, "Exported q-gram statistics has invalid format.");
+	if (pq_getmsgint(&buf, 4) != minQ || pq_getmsgint(&buf, 4) != maxQ)
+		elog(ERROR, "Exported q-gram statistics was collected with different q-gram lengths.");
+
+	state->totalCount += pq_getmsgint64(&buf);
+	state->totalLength += pq_getmsgint64(&buf);
+	mergeCounts(&buf, state, true);
+	mergeCounts(&buf, state, false);
+	pq_getmsgend(&buf);
 
 	MemoryContextSwitchTo(oldcontext);
+	MemoryContextReset(state->tmpContext);
+	reportStatsProgress(state, VGRAM_PROGRESS_COUNTING, true);
 	PG_RETURN_POINTER(state);
 }
 
 static void
-freeStats()
+freeStats(void)
 {
 	int			i;
 
+	/* Built-in tables are static */
+	if (qgramTableBuiltin)
+	{
+		qgramTable = NULL;
+		characterTable = NULL;
+	}
+
 	if (qgramTable)
 	{
 		for (i = 0; i < qgramTableSize; i++)
@@ -672,7 +2076,14 @@ freeStats()
 			pfree(characterTable[i].qgram);
 		pfree(characterTable);
 	}
+	if (qgramSketch)
+		pfree(qgramSketch);
+	qgramSketch = NULL;
 	qgramTableLoaded = false;
+	qgramTableBuiltin = false;
+	qgramTableLazy = false;
+	lazyStatsReset();
+	statsGeneration++;
 	qgramTable = NULL;
 	qgramTableSize = 0;
 	characterTable = NULL;
@@ -686,136 +2097,642 @@ qgram_stat_reset_cache(PG_FUNCTION_ARGS)
 	PG_RETURN_VOID();
 }
 
+/*
+ * Fingerprint of server character handling, which clients extracting
+ * V-grams with vgram_core compare against vgramCharOpsFingerprint() of their
+ * own handling.
+ */
+Datum
+vgram_charops_fingerprint(PG_FUNCTION_ARGS)
+{
+	uint32		fingerprint;
+
+	if (GetDatabaseEncoding() != PG_UTF8)
+		elog(ERROR, "Character handling fingerprint is defined only for UTF-8 databases.");
+	(void) vgramCharOpsFingerprint(&backendCharOps, &backendAllocator,
+								   &fingerprint);
+	PG_RETURN_INT64((int64) fingerprint);
+}
+
 static void
 loadTable(char *query, QGramTableElement ** table, int *size)
 {
-	int			result,
+	int			result,
+				i;
+
+	result = SPI_execute(query, true, 0);
+
+	if (result != SPI_OK_SELECT)
+		elog(ERROR, "Can't read table qgram_stat;");
+	if (SPI_tuptable->tupdesc->natts != 2)
+		elog(ERROR, "qgram_stat table must have 2 columns.");
+	if (SPI_gettypeid(SPI_tuptable->tupdesc, 1) != TEXTOID)
+		elog(ERROR, "1st column of qgram_stat table must be text.");
+	if (SPI_gettypeid(SPI_tuptable->tupdesc, 2) != FLOAT4OID)
+		elog(ERROR, "2nd column of qgram_stat table must be float4.");
+
+	if (SPI_processed == 0)
+	{
+		*table = NULL;
+		*size = 0;
+		return;
+	}
+
+	*table = MemoryContextAlloc(TopMemoryContext, sizeof(QGramTableElement) * SPI_processed);
+	for (i = 0; i < SPI_processed; i++)
+	{
+		bool		isnullfreq,
+					isnullqgram;
+		text	   *qgram;
+		MemoryContext oldContext;
+
+		qgram = DatumGetTextP(SPI_getbinval(SPI_tuptable->vals[i], SPI_tuptable->tupdesc, 1, &isnullqgram));
+		if (isnullqgram)
+			elog(ERROR, "qgram value must be not null.");
+
+		oldContext = MemoryContextSwitchTo(TopMemoryContext);
+		(*table)[i].qgram = text_to_cstring(qgram);
+		MemoryContextSwitchTo(oldContext);
+		(*table)[i].frequency = DatumGetFloat4(SPI_getbinval(SPI_tuptable->vals[i], SPI_tuptable->tupdesc, 2, &isnullfreq));
+		if (isnullfreq)
+			elog(ERROR, "qgram value must be not null.");
+	}
+	*size = SPI_processed;
+
+	qsort(*table, *size, sizeof(QGramTableElement), qgramTableElementCmp);
+}
+
+void
+loadStats(void)
+{
+	int			result,
+				i;
+	bool		isnull;
+
+	/*
+	 * Switching lazy statistics mode reloads statistics, as well as lazy
+	 * lookup noticing that statistics was rewritten.
+	 */
+	if (qgramTableLoaded &&
+		(statsLoadedLazy != vgramLazyStats || (qgramTableLazy && lazyStatsStale)))
+		freeStats();
+	if (qgramTableLoaded)
+		return;
+
+	SPI_connect();
+
+	if (vgramLazyStats)
+	{
+		/*
+		 * Only the lowest frequency is read from its own row together with
+		 * statistics version, q-grams are looked up lazily.
+		 */
+		TransactionId version = InvalidTransactionId;
+
+		result = SPI_execute("SELECT frequency, xmin FROM qgram_stat WHERE qgram COLLATE \"C\" = '' LIMIT 1;", true, 0);
+		if (result != SPI_OK_SELECT)
+			elog(ERROR, "Can't read table qgram_stat;");
+		if (SPI_gettypeid(SPI_tuptable->tupdesc, 1) != FLOAT4OID)
+			elog(ERROR, "frequency column of qgram_stat table must be float4.");
+		if (SPI_processed > 0)
+		{
+			version = DatumGetTransactionId(SPI_getbinval(SPI_tuptable->vals[0], SPI_tuptable->tupdesc, 2, &isnull));
+			lazyLimitFrequency = DatumGetFloat4(SPI_getbinval(SPI_tuptable->vals[0], SPI_tuptable->tupdesc, 1, &isnull));
+		}
+		else
+		{
+			/* Statistics written without limit frequency row */
+			result = SPI_execute("SELECT min(frequency) FROM qgram_stat WHERE length(qgram) > 1;", true, 0);
+			if (result != SPI_OK_SELECT)
+				elog(ERROR, "Can't read table qgram_stat;");
+			lazyLimitFrequency = DatumGetFloat4(SPI_getbinval(SPI_tuptable->vals[0], SPI_tuptable->tupdesc, 1, &isnull));
+		}
+		qgramTableLazy = !isnull;
+		if (isnull)
+			lazyLimitFrequency = 1.0f;
+		lazyStatsSetVersion(version);
+	}
+	else
+		loadTable("SELECT * FROM qgram_stat WHERE length(qgram) > 1;",
+				  &qgramTable, &qgramTableSize);
+	loadTable("SELECT * FROM qgram_stat WHERE length(qgram) = 1;",
+			  &characterTable, &characterTableSize);
+
+	result = SPI_execute("SELECT frequency FROM qgram_stat WHERE qgram IS NULL", true, 0);
+
+	if (result != SPI_OK_SELECT)
+		elog(ERROR, "Can't read table qgram_stat;");
+	if (SPI_tuptable->tupdesc->natts != 1 ||
+		SPI_gettypeid(SPI_tuptable->tupdesc, 1) != FLOAT4OID)
+		elog(ERROR, "frequency column of qgram_stat table must be float4.");
+
+	if (SPI_processed == 0)
+		avgCharactersCount = 25.0f;
+	else
+		avgCharactersCount = DatumGetFloat4(SPI_getbinval(SPI_tuptable->vals[0], SPI_tuptable->tupdesc, 1, &isnull));
+
+	result = SPI_execute("SELECT sketch FROM qgram_stat_sketch", true, 0);
+	if (result != SPI_OK_SELECT)
+		elog(ERROR, "Can't read table qgram_stat_sketch;");
+	if (SPI_processed > 0)
+	{
+		Datum		sketch;
+		MemoryContext oldContext;
+
+		sketch = SPI_getbinval(SPI_tuptable->vals[0], SPI_tuptable->tupdesc, 1, &isnull);
+		if (!isnull)
+		{
+			bytea	   *stored = DatumGetByteaPP(sketch);
+
+			oldContext = MemoryContextSwitchTo(TopMemoryContext);
+			qgramSketch = readSketch(stored);
+			MemoryContextSwitchTo(oldContext);
+		}
+	}
+
+	SPI_finish();
+
+	if (qgramTableSize == 0 && characterTableSize == 0 && !qgramTableLazy)
+	{
+		const BuiltinDictionary *dictionary;
+
+		dictionary = getBuiltinDictionary(vgramDefaultDictionary);
+		if (dictionary)
+		{
+			qgramTable = (QGramTableElement *) dictionary->qgrams;
+			qgramTableSize = dictionary->qgramsCount;
+			characterTable = (QGramTableElement *) dictionary->characters;
+			characterTableSize = dictionary->charactersCount;
+			avgCharactersCount = dictionary->avgCharactersCount;
+			qgramTableBuiltin = true;
+		}
+	}
+
+	/*
+	 * Large alphabets of continuous scripts have many characters missing in
+	 * statistics, which are considered rarer than any collected one.
+	 */
+	unknownCharacterFrequency = DEFAULT_CHARACTER_FREQUENCY;
+	if (vgramContinuousScripts)
+	{
+		for (i = 0; i < characterTableSize; i++)
+			unknownCharacterFrequency = Min(unknownCharacterFrequency,
+											characterTable[i].frequency);
+	}
+
+	statsLoadedLazy = vgramLazyStats;
+	qgramTableLoaded = true;
+}
+
+static int
+qgramTableElementCmp(const void *a1, const void *a2)
+{
+	const QGramTableElement *e1 = (const QGramTableElement *) a1;
+	const QGramTableElement *e2 = (const QGramTableElement *) a2;
+
+	return strcmp(e1->qgram, e2->qgram);
+}
+
+typedef struct
+{
+	char	   *qgram;
+	int64		count;
+	int			parent;		/* index of prefix shorter by one character */
+	bool		context;	/* prefix owned by another partition */
+} QGramCostItem;
+
+static int
+qgramCostItemCmp(const void *a1, const void *a2)
+{
+	const QGramCostItem *e1 = (const QGramCostItem *) a1;
+	const QGramCostItem *e2 = (const QGramCostItem *) a2;
+
+	return strcmp(e1->qgram, e2->qgram);
+}
+
+/**
+ * Search sorted array of cost items for exact match of given q-gram.
+ *
+ * @param items Sorted array of cost items
+ * @param nitems Number of items
+ * @param qgram Pointer to q-gram
+ * @param len Length of q-gram *in bytes*
+ * @return Index of found item or -1
+ */
+static int
+findCostItem(QGramCostItem *items, int nitems, const char *qgram, int len)
+{
+	int			lower = 0,
+				upper = nitems - 1,
+				mid,
+				cmp;
+
+	while (lower <= upper)
+	{
+		mid = (lower + upper) / 2;
+		cmp = strncmp(items[mid].qgram, qgram, len);
+		if (cmp == 0 && items[mid].qgram[len] != '\0')
+			cmp = 1;
+		if (cmp < 0)
+			lower = mid + 1;
+		else if (cmp > 0)
+			upper = mid - 1;
+		else
+			return mid;
+	}
+	return -1;
+}
+
+/*
+ * Sums over V-grams of index produced by given frequency limit.
+ */
+typedef struct
+{
+	int64		limitCount;
+	double		keys,
+				keyBytes,
+				postings,
+				postingsSquares;
+} QGramCostTotals;
+
+/**
+ * Account q-grams of partition in the estimate of V-gram index produced by
+ * given frequency limit.  Q-gram is extracted as V-gram when it's infrequent
+ * itself, while its prefix is frequent (or it's of minimal length).  Counts
+ * of q-grams are document frequencies, so they are lengths of posting lists.
+ *
+ * @param items Sorted array of cost items
+ * @param nitems Number of items
+ * @param totals Sums to account q-grams in
+ */
+static void
+accumulateIndexCost(QGramCostItem *items, int nitems, QGramCostTotals *totals)
+{
+	int			i;
+
+	for (i = 0; i < nitems; i++)
+	{
+		QGramCostItem *item = &items[i];
+
+		if (item->context || item->count >= totals->limitCount)
+			continue;
+		if (item->parent >= 0 &&
+			items[item->parent].count < totals->limitCount)
+			continue;
+
+		totals->keys += 1.0;
+		totals->keyBytes += strlen(item->qgram);
+		totals->postings += (double) item->count;
+		totals->postingsSquares += (double) item->count * (double) item->count;
+	}
+}
+
+/**
+ * Estimate V-gram index from accumulated sums.
+ *
+ * @param totals Sums over V-grams of index
+ * @param totalCount Total number of documents
+ * @param indexSize Receives estimated index size in bytes
+ * @param scanFraction Receives expected fraction of rows scanned per V-gram
+ */
+static void
+estimateIndexCost(QGramCostTotals *totals, int64 totalCount,
+				  double *indexSize, double *scanFraction)
+{
+	*indexSize = totals->keys * VGRAM_ENTRY_OVERHEAD + totals->keyBytes +
+		totals->postings * VGRAM_POSTING_BYTES;
+
+	/*
+	 * Probability of V-gram to appear in the query is assumed to be
+	 * proportional to its frequency.
+	 */
+	if (totals->postings > 0.0 && totalCount > 0)
+		*scanFraction = totals->postingsSquares / totals->postings /
+			(double) totalCount;
+	else
+		*scanFraction = 0.0;
+}
+
+/**
+ * Account q-grams hash in the estimates of all the candidate frequency
+ * limits.
+ *
+ * @param qgramsHash Hash of q-grams
+ * @param contextHash Hash of prefixes of q-grams owned by other partitions,
+ *		which together with qgramsHash contains all prefixes of its q-grams
+ * @param totals Array of candidate sums
+ * @param ntotals Number of candidates
+ */
+static void
+accumulateCandidates(HTAB *qgramsHash, HTAB *contextHash,
+					 QGramCostTotals *totals, int ntotals)
+{
+	QGramCostItem *items;
+	HASH_SEQ_STATUS scanStatus;
+	QGramHashValue *item;
+	int			nitems,
+				pass,
+				i;
+
+	nitems = (int) (hash_get_num_entries(qgramsHash) +
+					hash_get_num_entries(contextHash));
+	items = (QGramCostItem *) palloc(sizeof(QGramCostItem) * Max(nitems, 1));
+
+	i = 0;
+	for (pass = 0; pass < 2; pass++)
+	{
+		hash_seq_init(&scanStatus, pass ? contextHash : qgramsHash);
+		while ((item = (QGramHashValue *) hash_seq_search(&scanStatus)) != NULL)
+		{
+			items[i].qgram = item->key.qgram;
+			items[i].count = item->count;
+			items[i].parent = -1;
+			items[i].context = (pass == 1);
+			i++;
+		}
+	}
+	qsort(items, nitems, sizeof(QGramCostItem), qgramCostItemCmp);
+
+	for (i = 0; i < nitems; i++)
+	{
+		const char *p = items[i].qgram,
+				   *prev = NULL;
+		int			len = 0;
+
+		while (*p)
+		{
+			prev = p;
+			len++;
+			p += pg_mblen(p);
+		}
+		if (len > minQ)
+			items[i].parent = findCostItem(items, nitems, items[i].qgram,
+										   prev - items[i].qgram);
+	}
+
+	for (i = 0; i < ntotals; i++)
+		accumulateIndexCost(items, nitems, &totals[i]);
+
+	pfree(items);
+}
+
+/**
+ * Choose minimal count of frequent q-gram.  When neither of
+ * vgram.target_index_size and vgram.target_scan_fraction is set, then
+ * VGRAM_LIMIT_RATIO is used.  Otherwise, candidate ratios between
+ * VGRAM_COST_MIN_RATIO and VGRAM_COST_MAX_RATIO are evaluated.  When scan
+ * fraction target is set, the smallest index meeting targets is chosen,
+ * otherwise the cheapest to scan index fitting target size is chosen.
+ * Spilled q-grams are accounted partition by partition.
+ *
+ * @param state Q-grams statistics collection state
+ * @param indexSize Receives estimated index size in bytes
+ * @return Minimal count of frequent q-gram
+ */
+static int64
+chooseLimitCount(QGramStatState *state, double *indexSize, double *keys)
+{
+	QGramCostTotals *totals;
+	int			ntotals,
+				nparts,
 				i;
+	int64		bestLimitCount = -1;
+	double		bestIndexSize = 0.0,
+				bestKeys = 0.0,
+				bestObjective = 0.0,
+				scanFraction,
+				targetSize = (double) vgramTargetIndexSize * 1024.0;
+	bool		bestFeasible = false,
+				useTargets;
+
+	useTargets = (vgramTargetIndexSize > 0 || vgramTargetScanFraction > 0.0);
+	ntotals = useTargets ? VGRAM_COST_STEPS : 1;
+	totals = (QGramCostTotals *) palloc0(sizeof(QGramCostTotals) * ntotals);
+
+	if (!useTargets)
+		totals[0].limitCount = (int64) (state->totalCount * VGRAM_LIMIT_RATIO);
+	for (i = 0; useTargets && i < VGRAM_COST_STEPS; i++)
+	{
+		double		ratio;
 
-	result = SPI_execute(query, true, 0);
-
-	if (result != SPI_OK_SELECT)
-		elog(ERROR, "Can't read table qgram_stat;");
-	if (SPI_tuptable->tupdesc->natts != 2)
-		elog(ERROR, "qgram_stat table must have 2 columns.");
-	if (SPI_gettypeid(SPI_tuptable->tupdesc, 1) != TEXTOID)
-		elog(ERROR, "1st column of qgram_stat table must be text.");
-	if (SPI_gettypeid(SPI_tuptable->tupdesc, 2) != FLOAT4OID)
-		elog(ERROR, "2nd column of qgram_stat table must be float4.");
+		ratio = VGRAM_COST_MIN_RATIO *
+			exp(log(VGRAM_COST_MAX_RATIO / VGRAM_COST_MIN_RATIO) *
+				i / (VGRAM_COST_STEPS - 1));
+		totals[i].limitCount = Max((int64) (state->totalCount * ratio), 1);
+	}
 
-	if (SPI_processed == 0)
+	nparts = beginStatsPartitions(state);
+	for (i = 0; i < nparts; i++)
 	{
-		*table = NULL;
-		*size = 0;
-		return;
+		loadStatsPartition(state, i);
+		accumulateCandidates(state->qgramsHash, state->contextHash, totals, ntotals);
 	}
+	endStatsPartitions(state);
 
-	*table = MemoryContextAlloc(TopMemoryContext, sizeof(QGramTableElement) * SPI_processed);
-	for (i = 0; i < SPI_processed; i++)
+	if (!useTargets)
 	{
-		bool		isnullfreq,
-					isnullqgram;
-		text	   *qgram;
-		MemoryContext oldContext;
+		bestLimitCount = totals[0].limitCount;
+		bestKeys = totals[0].keys;
+		estimateIndexCost(&totals[0], state->totalCount,
+						  &bestIndexSize, &scanFraction);
+	}
+	else
+	{
+		for (i = 0; i < ntotals; i++)
+		{
+			double		size,
+						objective;
+			int64		limitCount = totals[i].limitCount;
+			bool		feasible;
+
+			if (limitCount == bestLimitCount)
+				continue;
+
+			estimateIndexCost(&totals[i], state->totalCount,
+							  &size, &scanFraction);
+
+			feasible = true;
+			if (vgramTargetIndexSize > 0 && size > targetSize)
+				feasible = false;
+			if (vgramTargetScanFraction > 0.0 &&
+				scanFraction > vgramTargetScanFraction)
+				feasible = false;
+
+			/*
+			 * Feasible candidates are compared by objective, infeasible ones
+			 * by the violation of the target.
+			 */
+			if (feasible)
+				objective = (vgramTargetScanFraction > 0.0) ? size : scanFraction;
+			else if (vgramTargetScanFraction > 0.0)
+				objective = scanFraction / vgramTargetScanFraction;
+			else
+				objective = size / targetSize;
 
-		qgram = DatumGetTextP(SPI_getbinval(SPI_tuptable->vals[i], SPI_tuptable->tupdesc, 1, &isnullqgram));
-		if (isnullqgram)
-			elog(ERROR, "qgram value must be not null.");
+			if (bestLimitCount < 0 ||
+				(feasible && !bestFeasible) ||
+				(feasible == bestFeasible && objective < bestObjective))
+			{
+				bestLimitCount = limitCount;
+				bestIndexSize = size;
+				bestKeys = totals[i].keys;
+				bestObjective = objective;
+				bestFeasible = feasible;
+			}
+		}
 
-		oldContext = MemoryContextSwitchTo(TopMemoryContext);
-		(*table)[i].qgram = text_to_cstring(qgram);
-		MemoryContextSwitchTo(oldContext);
-		(*table)[i].frequency = DatumGetFloat4(SPI_getbinval(SPI_tuptable->vals[i], SPI_tuptable->tupdesc, 2, &isnullfreq));
-		if (isnullfreq)
-			elog(ERROR, "qgram value must be not null.");
+		if (!bestFeasible)
+			elog(WARNING, "V-gram index targets can't be met, closest frequent q-grams set is chosen.");
 	}
-	*size = SPI_processed;
 
-	qsort(*table, *size, sizeof(QGramTableElement), qgramTableElementCmp);
+	pfree(totals);
+
+	*indexSize = bestIndexSize;
+	*keys = bestKeys;
+	return bestLimitCount;
 }
 
-void
-loadStats(void)
+/**
+ * Create empty count-min sketch.  Overestimation of count-min sketch is
+ * proportional to the number of q-grams per cell, so width grows with the
+ * number of V-grams the index is expected to have.
+ *
+ * @param keys Expected number of distinct V-grams
+ * @return Sketch
+ */
+static QGramSketch *
+createSketch(double keys)
 {
-	int			result;
-	bool		isnull;
-
-	if (qgramTableLoaded)
-		return;
-
-	SPI_connect();
-
-	loadTable("SELECT * FROM qgram_stat WHERE length(qgram) > 1;",
-			  &qgramTable, &qgramTableSize);
-	loadTable("SELECT * FROM qgram_stat WHERE length(qgram) = 1;",
-			  &characterTable, &characterTableSize);
-
-	result = SPI_execute("SELECT frequency FROM qgram_stat WHERE qgram IS NULL", true, 0);
-
-	if (result != SPI_OK_SELECT)
-		elog(ERROR, "Can't read table qgram_stat;");
-	if (SPI_tuptable->tupdesc->natts != 1 ||
-		SPI_gettypeid(SPI_tuptable->tupdesc, 1) != FLOAT4OID)
-		elog(ERROR, "frequency column of qgram_stat table must be float4.");
+	QGramSketch *sketch;
+	int32		width = VGRAM_SKETCH_MIN_WIDTH;
 
-	if (SPI_processed == 0)
-		avgCharactersCount = 25.0f;
+	while (width < keys && width < VGRAM_SKETCH_MAX_WIDTH)
+		width *= 2;
 
-	avgCharactersCount = DatumGetFloat4(SPI_getbinval(SPI_tuptable->vals[0], SPI_tuptable->tupdesc, 1, &isnull));
+	sketch = (QGramSketch *) palloc0(QGramSketchSize(VGRAM_SKETCH_DEPTH, width));
+	sketch->depth = VGRAM_SKETCH_DEPTH;
+	sketch->width = width;
+	return sketch;
+}
 
-	SPI_finish();
+/**
+ * Serialize count-min sketch in network byte order.
+ *
+ * @param sketch Sketch
+ * @return Bytea to be stored in qgram_stat_sketch table
+ */
+static bytea *
+writeSketch(QGramSketch *sketch)
+{
+	StringInfoData buf;
+	int			i;
 
-	qgramTableLoaded = true;
+	pq_begintypsend(&buf);
+	pq_sendint(&buf, QGRAM_SKETCH_MAGIC, 4);
+	pq_sendint(&buf, sketch->depth, 4);
+	pq_sendint(&buf, sketch->width, 4);
+	for (i = 0; i < sketch->depth * sketch->width; i++)
+		pq_sendfloat4(&buf, sketch->frequencies[i]);
+	return pq_endtypsend(&buf);
 }
 
-static int
-qgramTableElementCmp(const void *a1, const void *a2)
+/**
+ * Add frequencies of q-grams held in memory, which are less frequent than
+ * limit, to count-min sketch.
+ *
+ * @param sketch Sketch
+ * @param state Q-grams statistics collection state
+ * @param limitCount Minimal count of frequent q-gram
+ */
+static void
+addToSketch(QGramSketch *sketch, QGramStatState *state, int64 limitCount)
 {
-	const QGramTableElement *e1 = (const QGramTableElement *) a1;
-	const QGramTableElement *e2 = (const QGramTableElement *) a2;
+	HASH_SEQ_STATUS scanStatus;
+	QGramHashValue *item;
 
-	return strcmp(e1->qgram, e2->qgram);
+	hash_seq_init(&scanStatus, state->qgramsHash);
+	while ((item = (QGramHashValue *) hash_seq_search(&scanStatus)) != NULL)
+	{
+		int			row;
+
+		if (item->count >= limitCount)
+			continue;
+
+		for (row = 0; row < sketch->depth; row++)
+			sketch->frequencies[sketchPosition(item->key.qgram, row, sketch->width)] +=
+				(float) item->count / (float) state->totalCount;
+	}
 }
 
-Datum
-qgram_stat_finalfn(PG_FUNCTION_ARGS)
+/**
+ * Write collected statistics into qgram_stat and qgram_stat_sketch tables and
+ * release the state.
+ *
+ * @param state Statistics collection state
+ */
+static void
+storeStats(QGramStatState *state)
 {
-	QGramStatState *state;
-	int				limitCount,
-					spiResult;
+	int64			limitCount;
+	int				spiResult;
+	double			indexSize,
+					keys;
 	HASH_SEQ_STATUS scanStatus;
 	QGramHashValue *item;
 	MemoryContext	oldcontext;
 	SPIPlanPtr		plan;
-	Oid				argTypes[2] = {TEXTOID, FLOAT4OID};
-	Datum			values[2];
-
-	state = PG_ARGISNULL(0) ? NULL : (QGramStatState *) PG_GETARG_POINTER(0);
-
-	if (!state)
-		PG_RETURN_NULL();
+	QGramSketch	   *sketch;
+	Oid				argTypes[2] = {TEXTOID, FLOAT4OID},
+					sketchArgType[1] = {BYTEAOID};
+	Datum			values[2],
+					sketchArg[1];
+	float4			limitFrequency = 2.0f;
+	int				nparts,
+					i;
 
+	reportStatsProgress(state, VGRAM_PROGRESS_FILTERING, true);
 	oldcontext = MemoryContextSwitchTo(state->context);
-	limitCount = (int) (state->totalCount * VGRAM_LIMIT_RATIO);
+	limitCount = chooseLimitCount(state, &indexSize, &keys);
+	elog(NOTICE, "frequent q-gram limit %ld of %ld rows, predicted index size %.0f kB",
+		 (long) limitCount, (long) state->totalCount, indexSize / 1024.0);
 
+	reportStatsProgress(state, VGRAM_PROGRESS_WRITING, true);
 	SPI_connect();
+
+	/* Keep previous statistics for index migration */
+	spiResult = SPI_execute("TRUNCATE qgram_stat_prev;", false, 0);
+	if (spiResult != SPI_OK_UTILITY)
+		elog(ERROR, "Error truncating table qgram_stat_prev.");
+	spiResult = SPI_execute("INSERT INTO qgram_stat_prev SELECT * FROM qgram_stat;", false, 0);
+	if (spiResult != SPI_OK_INSERT)
+		elog(ERROR, "Error copying table qgram_stat into qgram_stat_prev.");
+
 	spiResult = SPI_execute("TRUNCATE qgram_stat;", false, 0);
 	if (spiResult != SPI_OK_UTILITY)
 		elog(ERROR, "Error truncating table qgram_stat.");
 	plan = SPI_prepare("INSERT INTO qgram_stat (qgram, frequency) VALUES ($1, $2);", 2, argTypes);
 
-	hash_seq_init(&scanStatus, state->qgramsHash);
-	while ((item = (QGramHashValue *) hash_seq_search(&scanStatus)) != NULL)
+	sketch = createSketch(keys);
+	nparts = beginStatsPartitions(state);
+	for (i = 0; i < nparts; i++)
 	{
-		if (item->count >= limitCount)
+		loadStatsPartition(state, i);
+		hash_seq_init(&scanStatus, state->qgramsHash);
+		while ((item = (QGramHashValue *) hash_seq_search(&scanStatus)) != NULL)
 		{
-			values[0] = PointerGetDatum(cstring_to_text(item->key.qgram));
-			values[1] = Float4GetDatum((float) item->count / (float) state->totalCount);
-			spiResult = SPI_execute_plan(plan, values, NULL, false, 0);
-			if (spiResult != SPI_OK_INSERT)
-				elog(ERROR, "Error inserting record into table qgram_stat.");
+			if (item->count >= limitCount)
+			{
+				values[0] = PointerGetDatum(cstring_to_text(item->key.qgram));
+				values[1] = Float4GetDatum((float) item->count / (float) state->totalCount);
+				limitFrequency = Min(limitFrequency, DatumGetFloat4(values[1]));
+				spiResult = SPI_execute_plan(plan, values, NULL, false, 0);
+				if (spiResult != SPI_OK_INSERT)
+					elog(ERROR, "Error inserting record into table qgram_stat.");
+			}
 		}
+		addToSketch(sketch, state, limitCount);
 	}
+	freeStatsPartitions(state);
 
 	hash_seq_init(&scanStatus, state->charactersHash);
 	while ((item = (QGramHashValue *) hash_seq_search(&scanStatus)) != NULL)
@@ -835,6 +2752,30 @@ qgram_stat_finalfn(PG_FUNCTION_ARGS)
 	if (spiResult != SPI_OK_INSERT)
 		elog(ERROR, "Error inserting record into table qgram_stat.");
 
+	/*
+	 * Lowest frequency of frequent q-grams is stored in the row of empty
+	 * q-gram, so lazy statistics reads it by index.  Its xmin serves as
+	 * version of statistics.
+	 */
+	if (limitFrequency <= 1.0f)
+	{
+		values[0] = PointerGetDatum(cstring_to_text(""));
+		values[1] = Float4GetDatum(limitFrequency);
+		spiResult = SPI_execute_plan(plan, values, NULL, false, 0);
+		if (spiResult != SPI_OK_INSERT)
+			elog(ERROR, "Error inserting record into table qgram_stat.");
+	}
+
+	spiResult = SPI_execute("TRUNCATE qgram_stat_sketch;", false, 0);
+	if (spiResult != SPI_OK_UTILITY)
+		elog(ERROR, "Error truncating table qgram_stat_sketch.");
+	sketchArg[0] = PointerGetDatum(writeSketch(sketch));
+	spiResult = SPI_execute_with_args("INSERT INTO qgram_stat_sketch (sketch) VALUES ($1);",
+									  1, sketchArgType, sketchArg, NULL,
+									  false, 0);
+	if (spiResult != SPI_OK_INSERT)
+		elog(ERROR, "Error inserting record into table qgram_stat_sketch.");
+
 	SPI_finish();
 
 	hash_destroy(state->qgramsHash);
@@ -843,9 +2784,442 @@ qgram_stat_finalfn(PG_FUNCTION_ARGS)
 	MemoryContextDelete(state->tmpContext);
 	MemoryContextDelete(state->context);
 	freeStats();
+	resultCacheInvalidate();
+	progressEnd();
+}
+
+Datum
+qgram_stat_finalfn(PG_FUNCTION_ARGS)
+{
+	QGramStatState *state;
+
+	state = PG_ARGISNULL(0) ? NULL : (QGramStatState *) PG_GETARG_POINTER(0);
+
+	if (state)
+		storeStats(state);
 	PG_RETURN_NULL();
 }
 
+/*
+ * Heap block sampled by progressive statistics collection.
+ */
+typedef struct
+{
+	BlockNumber		blkno;
+	int				round;
+} SampledBlock;
+
+/*
+ * Get confidence bound of frequency estimate of q-gram having limit frequency.
+ */
+static double
+getConfidenceBound(int64 totalCount)
+{
+	return VGRAM_PROGRESSIVE_CONFIDENCE *
+		sqrt(VGRAM_LIMIT_RATIO * (1.0 - VGRAM_LIMIT_RATIO) / totalCount);
+}
+
+static bool
+isFrequentCount(int64 count, int64 totalCount)
+{
+	return count >= Max((int64) (totalCount * VGRAM_LIMIT_RATIO), 1);
+}
+
+/**
+ * Take snapshot of frequent q-grams set of the statistics collected so far.
+ * Snapshot also contains infrequent q-grams within confidence bound of the
+ * limit frequency.
+ *
+ * @param state Statistics collection state
+ * @param context Memory context for the snapshot
+ * @return Hash of frequent q-grams and their counts
+ */
+static HTAB *
+frequentQGramsSnapshot(QGramStatState *state, MemoryContext context)
+{
+	HASHCTL			qgramsHashCtl;
+	HTAB		   *snapshot;
+	HASH_SEQ_STATUS	scanStatus;
+	QGramHashValue *item;
+	double			minCount;
+	int				nparts,
+					i;
+
+	qgramsHashCtl.keysize = sizeof(QGramHashKey);
+	qgramsHashCtl.entrysize = sizeof(QGramHashValue);
+	qgramsHashCtl.hcxt = context;
+	qgramsHashCtl.hash = qgram_key_hash;
+	qgramsHashCtl.match = qgram_key_match;
+	snapshot = hash_create("frequent qgrams snapshot",
+						   1024,
+						   &qgramsHashCtl,
+						   HASH_ELEM | HASH_CONTEXT
+						   | HASH_FUNCTION | HASH_COMPARE);
+
+	minCount = (VGRAM_LIMIT_RATIO - getConfidenceBound(state->totalCount)) *
+		state->totalCount;
+	nparts = beginStatsPartitions(state);
+	for (i = 0; i < nparts; i++)
+	{
+		loadStatsPartition(state, i);
+		hash_seq_init(&scanStatus, state->qgramsHash);
+		while ((item = (QGramHashValue *) hash_seq_search(&scanStatus)) != NULL)
+		{
+			QGramHashValue *value;
+
+			if ((double) item->count < minCount)
+				continue;
+			value = (QGramHashValue *) hash_search(snapshot,
+												   (const void *) &item->key,
+												   HASH_ENTER, NULL);
+			value->key.qgram = MemoryContextStrdup(context, item->key.qgram);
+			value->count = item->count;
+		}
+	}
+	endStatsPartitions(state);
+	return snapshot;
+}
+
+/**
+ * Check if frequent q-grams set has converged between two sampling rounds.
+ * Set is converged when all q-grams changing their status have frequency
+ * within confidence bound of the limit frequency, and frequencies of
+ * q-grams frequent in both rounds changed by at most tolerance.
+ *
+ * @param prev Snapshot of previous round
+ * @param prevCount Number of rows sampled till previous round
+ * @param cur Snapshot of current round
+ * @param curCount Number of rows sampled till current round
+ * @param tolerance Maximal relative change of frequent q-gram frequency
+ * @param changed Receives number of q-grams changed their status
+ * @param maxChange Receives maximal relative change of frequency
+ */
+static bool
+isStatsConverged(HTAB *prev, int64 prevCount, HTAB *cur, int64 curCount,
+				 float4 tolerance, int *changed, double *maxChange)
+{
+	HASH_SEQ_STATUS	scanStatus;
+	QGramHashValue *item,
+				   *other;
+	double			bound = getConfidenceBound(curCount);
+	bool			result = true;
+
+	*changed = 0;
+	*maxChange = 0.0;
+
+	hash_seq_init(&scanStatus, cur);
+	while ((item = (QGramHashValue *) hash_seq_search(&scanStatus)) != NULL)
+	{
+		double		frequency = (double) item->count / curCount;
+
+		if (!isFrequentCount(item->count, curCount))
+			continue;
+
+		other = (QGramHashValue *) hash_search(prev, (const void *) &item->key,
+											   HASH_FIND, NULL);
+		if (other && isFrequentCount(other->count, prevCount))
+		{
+			double		prevFrequency = (double) other->count / prevCount;
+
+			*maxChange = Max(*maxChange,
+							 fabs(frequency - prevFrequency) / prevFrequency);
+		}
+		else
+		{
+			(*changed)++;
+			if (frequency - VGRAM_LIMIT_RATIO > bound)
+				result = false;
+		}
+	}
+
+	/* Snapshot contains all q-grams within bound below the limit */
+	hash_seq_init(&scanStatus, prev);
+	while ((item = (QGramHashValue *) hash_seq_search(&scanStatus)) != NULL)
+	{
+		if (!isFrequentCount(item->count, prevCount))
+			continue;
+
+		other = (QGramHashValue *) hash_search(cur, (const void *) &item->key,
+											   HASH_FIND, NULL);
+		if (other && isFrequentCount(other->count, curCount))
+			continue;
+
+		(*changed)++;
+		if (!other)
+			result = false;
+	}
+
+	return result && *maxChange <= tolerance;
+}
+
+/*
+ * Collect statistics over growing random samples of table column until
+ * frequent q-grams set converges.  Each round samples twice as many blocks
+ * using the same seed, so sample of the round contains samples of all the
+ * previous rounds, and only new blocks are processed.  Statistics is stored
+ * into qgram_stat table like qgram_stat() aggregate does.  Returns percent
+ * of the table sampled.
+ */
+Datum
+qgram_stat_progressive(PG_FUNCTION_ARGS)
+{
+	Oid				relid = PG_GETARG_OID(0);
+	text		   *attname = PG_GETARG_TEXT_PP(1);
+	float4			tolerance = PG_GETARG_FLOAT4(2);
+	float4			percent = PG_GETARG_FLOAT4(3);
+	QGramStatState *state;
+	MemoryContext	snapshotContext;
+	HASHCTL			blocksHashCtl;
+	HTAB		   *blocksHash,
+				   *prev = NULL,
+				   *cur;
+	int64			prevCount = 0;
+	int				seed = (int) random(),
+					round;
+	char		   *relname,
+				   *query;
+	float4			relTuples;
+	bool			isnull;
+
+	if (percent <= 0.0f || percent > 100.0f)
+		elog(ERROR, "initial percent must be in (0, 100] range.");
+	if (tolerance <= 0.0f)
+		elog(ERROR, "tolerance must be positive.");
+
+	relname = quote_qualified_identifier(get_namespace_name(get_rel_namespace(relid)),
+										 get_rel_name(relid));
+	state = createQGramStatState(CurrentMemoryContext);
+	snapshotContext = AllocSetContextCreate(CurrentMemoryContext,
+											"qgram_stat snapshot",
+											ALLOCSET_DEFAULT_MINSIZE,
+											ALLOCSET_DEFAULT_INITSIZE,
+											ALLOCSET_DEFAULT_MAXSIZE);
+
+	blocksHashCtl.keysize = sizeof(BlockNumber);
+	blocksHashCtl.entrysize = sizeof(SampledBlock);
+	blocksHashCtl.hcxt = state->context;
+	blocksHash = hash_create("sampled blocks hash",
+							 1024,
+							 &blocksHashCtl,
+							 HASH_ELEM | HASH_CONTEXT | HASH_BLOBS);
+
+	SPI_connect();
+	query = psprintf("SELECT reltuples FROM pg_class WHERE oid = %u", relid);
+	if (SPI_execute(query, true, 1) != SPI_OK_SELECT || SPI_processed != 1)
+		elog(ERROR, "Can't read pg_class entry of relation %u.", relid);
+	relTuples = DatumGetFloat4(SPI_getbinval(SPI_tuptable->vals[0],
+											 SPI_tuptable->tupdesc, 1,
+											 &isnull));
+	SPI_finish();
+
+	for (round = 0;; round++)
+	{
+		SPIPlanPtr	plan;
+		Portal		portal;
+		int			changed = 0;
+		double		maxChange = 0.0;
+		bool		converged = false;
+
+		query = psprintf("SELECT ctid, %s FROM %s TABLESAMPLE SYSTEM (%g) REPEATABLE (%d)",
+						 quote_identifier(text_to_cstring(attname)), relname,
+						 (double) percent, seed);
+
+		progressSetTotal(relTuples > 0.0f ?
+						 (int64) (relTuples * percent / 100.0f) : -1);
+
+		SPI_connect();
+		plan = SPI_prepare(query, 0, NULL);
+		if (!plan)
+			elog(ERROR, "Can't prepare sampling query \"%s\".", query);
+		portal = SPI_cursor_open(NULL, plan, NULL, NULL, true);
+
+		for (;;)
+		{
+			int			i;
+
+			SPI_cursor_fetch(portal, true, 1000);
+			if (SPI_processed == 0)
+				break;
+
+			if (SPI_gettypeid(SPI_tuptable->tupdesc, 2) != TEXTOID)
+				elog(ERROR, "Sampled column must be text.");
+
+			for (i = 0; i < SPI_processed; i++)
+			{
+				ItemPointer	ctid;
+				SampledBlock *block;
+				BlockNumber	blkno;
+				Datum		value;
+				bool		found;
+
+				CHECK_FOR_INTERRUPTS();
+
+				ctid = DatumGetItemPointer(SPI_getbinval(SPI_tuptable->vals[i],
+														 SPI_tuptable->tupdesc, 1,
+														 &isnull));
+				blkno = ItemPointerGetBlockNumber(ctid);
+				block = (SampledBlock *) hash_search(blocksHash,
+													 (const void *) &blkno,
+													 HASH_ENTER, &found);
+				if (!found)
+					block->round = round;
+				else if (block->round < round)
+					continue;
+
+				value = SPI_getbinval(SPI_tuptable->vals[i],
+									  SPI_tuptable->tupdesc, 2, &isnull);
+				state->totalCount++;
+				if (!isnull)
+					collectStatsRow(state, DatumGetTextPP(value));
+				reportStatsProgress(state, VGRAM_PROGRESS_COUNTING, false);
+			}
+			SPI_freetuptable(SPI_tuptable);
+		}
+		SPI_cursor_close(portal);
+		SPI_finish();
+
+		if (state->totalCount == 0)
+		{
+			if (percent >= 100.0f)
+				elog(ERROR, "Can't collect statistics of empty table.");
+			percent = Min(percent * 2.0f, 100.0f);
+			continue;
+		}
+
+		cur = frequentQGramsSnapshot(state, snapshotContext);
+		if (prev)
+		{
+			converged = isStatsConverged(prev, prevCount, cur,
+										 state->totalCount, tolerance,
+										 &changed, &maxChange);
+			hash_destroy(prev);
+		}
+		elog(NOTICE, "sampled %g%% of table, %ld rows, %d changed frequent q-grams, maximal frequency change %.4f",
+			 (double) percent, (long) state->totalCount, changed, maxChange);
+
+		prev = cur;
+		prevCount = state->totalCount;
+		if (converged || percent >= 100.0f)
+			break;
+		percent = Min(percent * 2.0f, 100.0f);
+	}
+
+	MemoryContextDelete(snapshotContext);
+	storeStats(state);
+	PG_RETURN_FLOAT4(percent);
+}
+
+/*
+ * Refresh statistics using existing V-gram index.  Document frequencies of
+ * V-grams are read from posting lists of the index, while frequencies of
+ * frequent q-grams, which aren't indexed, and characters are taken from the
+ * sample of the table scaled to the whole table.  V-gram isn't indexed for
+ * documents where it's a part of longer minimal V-gram, so index counts are
+ * lower bounds of sampled estimates.  Returns number of index keys read.
+ */
+Datum
+qgram_stat_from_index(PG_FUNCTION_ARGS)
+{
+	Oid				indexOid = PG_GETARG_OID(0);
+	float4			percent = PG_GETARG_FLOAT4(1);
+	Relation		indexRel;
+	QGramStatState *state;
+	HTAB		   *indexCounts;
+	HASH_SEQ_STATUS	scanStatus;
+	QGramHashValue *item;
+	SPIPlanPtr		plan;
+	Portal			portal;
+	char		   *relname,
+				   *attname,
+				   *query;
+	float4			relTuples;
+	double			totalRows;
+	int64			maxIndexCount = 0,
+					nkeys;
+	bool			isnull;
+
+	if (percent <= 0.0f || percent > 100.0f)
+		elog(ERROR, "sample percent must be in (0, 100] range.");
+
+	state = createQGramStatState(CurrentMemoryContext);
+
+	indexRel = index_open(indexOid, AccessShareLock);
+	getIndexedColumn(indexRel, &relname, &attname);
+	indexCounts = getIndexKeyCounts(indexRel, state->context);
+	index_close(indexRel, AccessShareLock);
+
+	nkeys = hash_get_num_entries(indexCounts);
+	hash_seq_init(&scanStatus, indexCounts);
+	while ((item = (QGramHashValue *) hash_seq_search(&scanStatus)) != NULL)
+		maxIndexCount = Max(maxIndexCount, item->count);
+
+	SPI_connect();
+	query = psprintf("SELECT reltuples FROM pg_class WHERE oid = %u",
+					 IndexGetRelation(indexOid, false));
+	if (SPI_execute(query, true, 1) != SPI_OK_SELECT || SPI_processed != 1)
+		elog(ERROR, "Can't read pg_class entry of table indexed by %u.", indexOid);
+	relTuples = DatumGetFloat4(SPI_getbinval(SPI_tuptable->vals[0],
+											 SPI_tuptable->tupdesc, 1,
+											 &isnull));
+
+	query = psprintf("SELECT %s FROM %s TABLESAMPLE SYSTEM (%g)",
+					 attname, relname, (double) percent);
+	plan = SPI_prepare(query, 0, NULL);
+	if (!plan)
+		elog(ERROR, "Can't prepare sampling query \"%s\".", query);
+	portal = SPI_cursor_open(NULL, plan, NULL, NULL, true);
+
+	for (;;)
+	{
+		int			i;
+
+		SPI_cursor_fetch(portal, true, 1000);
+		if (SPI_processed == 0)
+			break;
+
+		if (SPI_gettypeid(SPI_tuptable->tupdesc, 1) != TEXTOID)
+			elog(ERROR, "Sampled column must be text.");
+
+		for (i = 0; i < SPI_processed; i++)
+		{
+			Datum		value;
+
+			CHECK_FOR_INTERRUPTS();
+
+			value = SPI_getbinval(SPI_tuptable->vals[i],
+								  SPI_tuptable->tupdesc, 1, &isnull);
+			state->totalCount++;
+			if (!isnull)
+				collectStatsRow(state, DatumGetTextPP(value));
+			reportStatsProgress(state, VGRAM_PROGRESS_COUNTING, false);
+		}
+		SPI_freetuptable(SPI_tuptable);
+	}
+	SPI_cursor_close(portal);
+	SPI_finish();
+
+	if (state->totalCount == 0)
+		elog(ERROR, "Sample of the table is empty, increase sample percent.");
+
+	/* Table was never analyzed, extrapolate the sample */
+	totalRows = (relTuples > 0.0f) ? relTuples :
+		state->totalCount * 100.0 / percent;
+	totalRows = Max(totalRows, (double) maxIndexCount);
+
+	/* Scale the sample to the whole table */
+	flushDenseCounters(state);
+	state->countScale = totalRows / state->totalCount;
+	state->countOverrides = indexCounts;
+	hash_seq_init(&scanStatus, state->charactersHash);
+	while ((item = (QGramHashValue *) hash_seq_search(&scanStatus)) != NULL)
+		item->count = (int64) (item->count * state->countScale + 0.5);
+	state->totalLength = (int64) (state->totalLength * state->countScale + 0.5);
+	state->totalCount = (int64) (totalRows + 0.5);
+
+	storeStats(state);
+	PG_RETURN_INT64(nkeys);
+}
+
 Datum
 print_qgram_stat(PG_FUNCTION_ARGS)
 {
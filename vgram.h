@@ -14,24 +14,164 @@
 #define _V_GRAM_H_
 
 #include "tsearch/ts_locale.h"
+#include "access/htup.h"
+#include "access/skey.h"
+#include "nodes/tidbitmap.h"
+#include "utils/hsearch.h"
+#include "utils/relcache.h"
+#include "utils/snapshot.h"
+
+#include "vgram_core.h"
 
 /*
  * V-gram parameters
  */
-#define minQ						(2)
-#define maxQ						(5)
+#define minQ						VGRAM_MIN_Q
+#define maxQ						VGRAM_MAX_Q
 #define isExtractable(c)			(t_isalpha(c) || t_isdigit(c))
 #define VGRAM_LIMIT_RATIO			(0.005)
 #define DEFAULT_CHARACTER_FREQUENCY	(0.001)
-#define EMPTY_CHARACTER				('$')
+#define EMPTY_CHARACTER				VGRAM_EMPTY_CHARACTER
+
+/*
+ * Cost model parameters used to choose the frequent q-grams set.  Sizes are
+ * rough averages for GIN: entry tuple header plus alignment per key, and
+ * varbyte-compressed item pointer per posting.
+ */
+#define VGRAM_ENTRY_OVERHEAD		(16)
+#define VGRAM_POSTING_BYTES			(2.0)
+#define VGRAM_COST_MIN_RATIO		(0.0001)
+#define VGRAM_COST_MAX_RATIO		(0.1)
+#define VGRAM_COST_STEPS			(24)
+
+/*
+ * Size of count-min sketch of infrequent q-grams frequencies.  Width is
+ * power of two between the limits, which is at least the number of V-grams.
+ */
+#define VGRAM_SKETCH_DEPTH			(4)
+#define VGRAM_SKETCH_MIN_WIDTH		(4096)
+#define VGRAM_SKETCH_MAX_WIDTH		(262144)
+
+/*
+ * Patterns whose most selective V-gram is estimated to be at least that
+ * frequent are searched by streaming the table instead of the index.
+ */
+#define VGRAM_STREAM_SELECTIVITY	(0.001)
+
+/* Number of candidate documents fetched at once by pattern join */
+#define VGRAM_JOIN_BATCH_SIZE		(1000)
+
+/* Maximal number of hash functions of MinHash signature */
+#define VGRAM_MINHASH_MAX_K			(1024)
+
+/*
+ * Minimal selectivity used for IDF weights of ranked search.
+ */
+#define VGRAM_RANK_MIN_SELECTIVITY	(1.0e-9f)
+
+/* Length in bytes of vgramvector signature in GiST index */
+#define VGRAM_SIGLEN				(128)
+
+/* Number of entries and maximal pattern length of shared result cache */
+#define VGRAM_RESULT_CACHE_ENTRIES	(1024)
+#define VGRAM_RESULT_CACHE_PATTERN_LEN (128)
+
+/* Estimated time of inserting single posting during GIN build, in seconds */
+#define VGRAM_BUILD_POSTING_TIME	(0.0000005)
+
+/*
+ * Progressive sampling stops when q-grams changing their frequent status are
+ * within this number of standard errors from the limit frequency.
+ */
+#define VGRAM_PROGRESSIVE_CONFIDENCE (1.96)
+
+/*
+ * Dense counting of short q-grams during statistics collection: q-grams not
+ * longer than VGRAM_DENSE_MAXQ (at least minQ) consisting of the
+ * VGRAM_DENSE_ALPHABET most frequent characters of the first
+ * VGRAM_DENSE_SEED_ROWS rows are counted in arrays.
+ */
+#define VGRAM_DENSE_MAXQ			(3)
+#define VGRAM_DENSE_ALPHABET		(96)
+#define VGRAM_DENSE_SEED_ROWS		(1000)
+
+/* Number of partitions q-grams are spilled to during statistics collection */
+#define VGRAM_SPILL_PARTITIONS		(64)
+
+/* Maximal number of concurrent statistics collections reporting progress */
+#define VGRAM_PROGRESS_SLOTS		(64)
+
+/* Number of rows between progress reports of statistics collection */
+#define VGRAM_PROGRESS_INTERVAL		(1024)
 
 /* strategy numbers */
 #define LikeStrategyNumber			3
 #define ILikeStrategyNumber			4
+#define KeysMatchStrategyNumber		5
+#define LikeAnyStrategyNumber		6
+#define ILikeAnyStrategyNumber		7
+
+/* strategy numbers of index over patterns */
+#define PatternLikeStrategyNumber	1
+#define PatternILikeStrategyNumber	2
 
+/* strategy numbers of vgramvector opclasses */
+#define VGramVectorOverlapStrategyNumber	3
+#define VGramVectorContainsStrategyNumber	7
+#define VGramVectorContainedStrategyNumber	8
 
-typedef void (*WordCallback) (const char *wordStart, const char *wordEnd, void *userData);
-typedef void (*VGramCallBack) (char *vgram, void *userData);
+
+/*
+ * Element of q-grams statistics table sorted by q-gram.
+ */
+typedef VGramQGram QGramTableElement;
+
+/*
+ * Built-in q-grams statistics, see vgram_dict.c.
+ */
+typedef enum
+{
+	VGRAM_DICTIONARY_NONE = 0,
+	VGRAM_DICTIONARY_ENGLISH,
+	VGRAM_DICTIONARY_RUSSIAN,
+	VGRAM_DICTIONARY_CODE
+} VGramDictionary;
+
+/* Phases of statistics collection reported in vgram_stat_progress view */
+typedef enum
+{
+	VGRAM_PROGRESS_COUNTING = 0,
+	VGRAM_PROGRESS_FILTERING,
+	VGRAM_PROGRESS_WRITING
+} VGramProgressPhase;
+
+typedef struct
+{
+	const char *name;
+	const QGramTableElement *qgrams;
+	int			qgramsCount;
+	const QGramTableElement *characters;
+	int			charactersCount;
+	float4		avgCharactersCount;
+	bool		requiresUTF8;
+} BuiltinDictionary;
+
+/*
+ * Entry of hash counting q-grams.
+ */
+typedef struct
+{
+	char		   *qgram;
+} QGramHashKey;
+
+typedef struct
+{
+	QGramHashKey	key;
+	int64			count;
+} QGramHashValue;
+
+typedef VGramWordCallback WordCallback;
+typedef VGramCallback VGramCallBack;
 
 typedef struct
 {
@@ -39,11 +179,60 @@ typedef struct
 	void		   *userData;
 } ExtractVGramsInfo;
 
+/*
+ * Extraction with parameters overriding compiled ones: V-grams are limited
+ * to maxLength characters, and only q-grams with frequency at least
+ * limitFrequency are considered frequent.
+ */
+typedef struct
+{
+	ExtractVGramsInfo info;
+	int				maxLength;
+	float4			limitFrequency;
+} LimitedExtractVGramsInfo;
+
+extern uint32 statsGeneration;
+extern int	vgramTargetIndexSize;
+extern double vgramTargetScanFraction;
+extern int	vgramStatsMemoryLimit;
+extern int	vgramQueryCacheSize;
+extern int	vgramDefaultDictionary;
+extern bool vgramLazyStats;
+extern bool lazyStatsStale;
+extern bool vgramContinuousScripts;
+extern const VGramLookup lazyStatsLookup;
+
+extern uint32 qgram_key_hash(const void *key, Size keysize);
+extern int	qgram_key_match(const void *key1, const void *key2, Size keysize);
 extern void loadStats(void);
 extern float4 estimateVGramSelectivilty(const char *vgram);
 extern void extractMinimalVGramsWord(const char *wordStart, const char *wordEnd, void *userData);
+extern void extractMinimalVGramsWordLimited(const char *wordStart, const char *wordEnd, void *userData);
+extern float4 getStatsLimitFrequency(void);
 extern void extractWords(const char *string, size_t len, WordCallback callback, void *userData);
 extern void extractVGramsWord(const char *wordStart, const char *wordEnd, void *userData);
+extern bool isContinuousChar(const char *c);
 extern Datum *extractQueryLike(int32 *nentries, text *pattern);
+extern bool isExactPattern(text *pattern, Datum *entries, int32 nentries);
+extern char *getRarestVGram(text *pattern);
+extern const BuiltinDictionary *getBuiltinDictionary(int dictionary);
+extern void resultCacheInit(void);
+extern void progressInit(void);
+extern void progressStart(int64 totalRows);
+extern void progressSetTotal(int64 totalRows);
+extern void progressUpdate(VGramProgressPhase phase, int64 rows, int64 distinct, int64 memory);
+extern void progressEnd(void);
+extern void lazyStatsInit(void);
+extern void lazyStatsReset(void);
+extern void lazyStatsSetVersion(TransactionId version);
+extern void resultCacheInvalidate(void);
+extern void resultCacheInvalidateAtEOXact(void);
+extern TIDBitmap *getIndexBitmap(Relation indexRel, StrategyNumber strategy, text *pattern);
+extern void getIndexedColumn(Relation indexRel, char **relname, char **attname);
+extern void checkIndexedTableSelect(Relation indexRel);
+extern HeapTuple getVisibleTuple(Relation heapRel, ItemPointer tid, Snapshot snapshot);
+extern HTAB *getIndexKeyCounts(Relation indexRel, MemoryContext context);
+extern int64 getIndexKeyCount(Relation indexRel, const char *key);
+extern int64 getIndexPendingTuples(Relation indexRel);
 
 #endif /* _V_GRAM_H_ */
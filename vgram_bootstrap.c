@@ -0,0 +1,313 @@
+/*-------------------------------------------------------------------------
+ *
+ * vgram_bootstrap.c
+ *		Routines for reading document frequencies of V-grams from the entry
+ *		tree of existing V-gram index.
+ *
+ * Copyright (c) 2011-2017, Alexander Korotkov
+ *
+ * IDENTIFICATION
+ *	  contrib/vgram/vgram_bootstrap.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+#include "fmgr.h"
+#include "access/gin_private.h"
+#include "catalog/pg_am.h"
+#include "catalog/pg_type.h"
+#include "miscadmin.h"
+#include "storage/bufmgr.h"
+#include "utils/builtins.h"
+#include "utils/lsyscache.h"
+#include "utils/memutils.h"
+#include "utils/rel.h"
+#include "utils/snapmgr.h"
+
+#include "vgram.h"
+
+/*
+ * Entry having its postings in the posting tree, which is counted after
+ * entry page is released.
+ */
+typedef struct
+{
+	char	   *key;
+	BlockNumber root;
+} PostingTreeRoot;
+
+/*
+ * Count items of the posting tree by descending to the leftmost leaf and
+ * walking leaf level by right links.
+ */
+static int64
+countPostingTree(Relation indexRel, BlockNumber blkno)
+{
+	Buffer		buffer;
+	Page		page;
+	int64		count = 0;
+
+	for (;;)
+	{
+		buffer = ReadBuffer(indexRel, blkno);
+		LockBuffer(buffer, GIN_SHARE);
+		page = BufferGetPage(buffer);
+		if (GinPageIsLeaf(page))
+			break;
+		blkno = PostingItemGetBlockNumber(GinDataPageGetPostingItem(page,
+																	FirstOffsetNumber));
+		UnlockReleaseBuffer(buffer);
+	}
+
+	for (;;)
+	{
+		ItemPointer items;
+		ItemPointerData minItem;
+		int			nitems;
+		bool		rightmost;
+
+		CHECK_FOR_INTERRUPTS();
+
+		if (!GinPageIsDeleted(page))
+		{
+			ItemPointerSetMin(&minItem);
+			items = GinDataLeafPageGetItems(page, &nitems, minItem);
+			count += nitems;
+			if (items)
+				pfree(items);
+		}
+
+		rightmost = GinPageRightMost(page);
+		blkno = GinPageGetOpaque(page)->rightlink;
+		UnlockReleaseBuffer(buffer);
+		if (rightmost)
+			break;
+
+		buffer = ReadBuffer(indexRel, blkno);
+		LockBuffer(buffer, GIN_SHARE);
+		page = BufferGetPage(buffer);
+	}
+
+	return count;
+}
+
+/**
+ * Read document frequency of a single key of V-gram index by descending the
+ * entry tree.  Entries still in the pending list aren't counted.
+ *
+ * @param indexRel Opened V-gram index
+ * @param key V-gram to look up
+ * @return Number of items in the posting list of key
+ */
+int64
+getIndexKeyCount(Relation indexRel, const char *key)
+{
+	GinState	ginState;
+	GinBtreeData btree;
+	GinBtreeStack *stack;
+	BlockNumber postingRoot = InvalidBlockNumber;
+	int64		count = 0;
+
+	initGinState(&ginState, indexRel);
+	ginPrepareEntryScan(&btree, FirstOffsetNumber, CStringGetTextDatum(key),
+						GIN_CAT_NORM_KEY, &ginState);
+	stack = ginFindLeafPage(&btree, true
+#if PG_VERSION_NUM >= 110000
+							, false, GetActiveSnapshot()
+#endif
+		);
+
+	if (btree.findItem(&btree, stack))
+	{
+		Page		page = BufferGetPage(stack->buffer);
+		IndexTuple	itup;
+
+		itup = (IndexTuple) PageGetItem(page, PageGetItemId(page, stack->off));
+		if (GinIsPostingTree(itup))
+			postingRoot = GinGetPostingTree(itup);
+		else
+			count = GinGetNPosting(itup);
+	}
+	LockBuffer(stack->buffer, GIN_UNLOCK);
+	freeGinBtreeStack(stack);
+
+	/* Posting tree is read after entry page is released */
+	if (BlockNumberIsValid(postingRoot))
+		count = countPostingTree(indexRel, postingRoot);
+
+	return count;
+}
+
+/**
+ * Get number of heap tuples whose entries are in the pending list of V-gram
+ * index.
+ *
+ * @param indexRel Opened V-gram index
+ * @return Number of heap tuples in the pending list
+ */
+int64
+getIndexPendingTuples(Relation indexRel)
+{
+	Buffer		buffer;
+	int64		result;
+
+	buffer = ReadBuffer(indexRel, GIN_METAPAGE_BLKNO);
+	LockBuffer(buffer, GIN_SHARE);
+	result = GinPageGetMeta(BufferGetPage(buffer))->nPendingHeapTuples;
+	UnlockReleaseBuffer(buffer);
+
+	return result;
+}
+
+/**
+ * Read document frequencies of all the keys of V-gram index.  Posting list
+ * size of key is the number of documents it was extracted from.  Entries
+ * still in the pending list aren't counted.
+ *
+ * @param indexRel Opened V-gram index
+ * @param context Memory context for the result
+ * @return Hash of V-grams and their document counts
+ */
+HTAB *
+getIndexKeyCounts(Relation indexRel, MemoryContext context)
+{
+	GinState	ginState;
+	HASHCTL		keysHashCtl;
+	HTAB	   *keysHash;
+	PostingTreeRoot *roots;
+	int			nroots = 0,
+				allocated = 16,
+				i;
+	BlockNumber blkno;
+	Buffer		buffer;
+	Page		page;
+	GinMetaPageData *metadata;
+
+	/* Only V-gram opclass has keys match operator, gin_trgm_ops hasn't */
+	if (indexRel->rd_rel->relam != GIN_AM_OID ||
+		indexRel->rd_opcintype[0] != TEXTOID ||
+		!OidIsValid(get_opfamily_member(indexRel->rd_opfamily[0], TEXTOID,
+										TEXTARRAYOID, KeysMatchStrategyNumber)))
+		elog(ERROR, "Index \"%s\" isn't V-gram index.",
+			 RelationGetRelationName(indexRel));
+
+	buffer = ReadBuffer(indexRel, GIN_METAPAGE_BLKNO);
+	LockBuffer(buffer, GIN_SHARE);
+	metadata = GinPageGetMeta(BufferGetPage(buffer));
+	if (metadata->nPendingPages > 0)
+		elog(WARNING, "Pending list of index \"%s\" isn't counted, VACUUM index to count it.",
+			 RelationGetRelationName(indexRel));
+	UnlockReleaseBuffer(buffer);
+
+	initGinState(&ginState, indexRel);
+
+	keysHashCtl.keysize = sizeof(QGramHashKey);
+	keysHashCtl.entrysize = sizeof(QGramHashValue);
+	keysHashCtl.hcxt = context;
+	keysHashCtl.hash = qgram_key_hash;
+	keysHashCtl.match = qgram_key_match;
+	keysHash = hash_create("index keys hash",
+						   1024,
+						   &keysHashCtl,
+						   HASH_ELEM | HASH_CONTEXT
+						   | HASH_FUNCTION | HASH_COMPARE);
+
+	roots = (PostingTreeRoot *) palloc(sizeof(PostingTreeRoot) * allocated);
+
+	/*
+	 * Descend to the leftmost leaf of entry tree and walk leaf level by right
+	 * links.  Right link is taken under lock, so items moved right by
+	 * concurrent split of already read page aren't counted twice.
+	 */
+	blkno = GIN_ROOT_BLKNO;
+	for (;;)
+	{
+		IndexTuple	itup;
+
+		buffer = ReadBuffer(indexRel, blkno);
+		LockBuffer(buffer, GIN_SHARE);
+		page = BufferGetPage(buffer);
+		if (GinPageIsLeaf(page))
+			break;
+		itup = (IndexTuple) PageGetItem(page, PageGetItemId(page,
+															FirstOffsetNumber));
+		blkno = GinGetDownlink(itup);
+		UnlockReleaseBuffer(buffer);
+	}
+
+	for (;;)
+	{
+		OffsetNumber offnum,
+					maxoff;
+		bool		rightmost;
+
+		CHECK_FOR_INTERRUPTS();
+
+		maxoff = PageGetMaxOffsetNumber(page);
+		for (offnum = FirstOffsetNumber; offnum <= maxoff; offnum++)
+		{
+			IndexTuple	itup;
+			GinNullCategory category;
+			Datum		key;
+			char	   *keyString;
+			QGramHashKey hashKey;
+			QGramHashValue *value;
+			bool		found;
+
+			itup = (IndexTuple) PageGetItem(page, PageGetItemId(page, offnum));
+			key = gintuple_get_key(&ginState, itup, &category);
+			if (category != GIN_CAT_NORM_KEY)
+				continue;
+
+			keyString = MemoryContextStrdup(context, TextDatumGetCString(key));
+			hashKey.qgram = keyString;
+			value = (QGramHashValue *) hash_search(keysHash,
+												   (const void *) &hashKey,
+												   HASH_ENTER, &found);
+			if (!found)
+				value->count = 0;
+			else
+				pfree(keyString);
+
+			if (GinIsPostingTree(itup))
+			{
+				if (nroots >= allocated)
+				{
+					allocated *= 2;
+					roots = (PostingTreeRoot *) repalloc(roots,
+														 sizeof(PostingTreeRoot) * allocated);
+				}
+				roots[nroots].key = value->key.qgram;
+				roots[nroots].root = GinGetPostingTree(itup);
+				nroots++;
+			}
+			else
+				value->count += GinGetNPosting(itup);
+		}
+
+		rightmost = GinPageRightMost(page);
+		blkno = GinPageGetOpaque(page)->rightlink;
+		UnlockReleaseBuffer(buffer);
+		if (rightmost)
+			break;
+
+		buffer = ReadBuffer(indexRel, blkno);
+		LockBuffer(buffer, GIN_SHARE);
+		page = BufferGetPage(buffer);
+	}
+
+	for (i = 0; i < nroots; i++)
+	{
+		QGramHashKey hashKey;
+		QGramHashValue *value;
+
+		hashKey.qgram = roots[i].key;
+		value = (QGramHashValue *) hash_search(keysHash,
+											   (const void *) &hashKey,
+											   HASH_FIND, NULL);
+		value->count += countPostingTree(indexRel, roots[i].root);
+	}
+	pfree(roots);
+
+	return keysHash;
+}
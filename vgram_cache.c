@@ -0,0 +1,534 @@
+/*-------------------------------------------------------------------------
+ *
+ * vgram_cache.c
+ *		Shared memory cache of candidate TIDs found by V-gram index for
+ *		hot like/ilike patterns.
+ *
+ * Copyright (c) 2011-2017, Alexander Korotkov
+ *
+ * IDENTIFICATION
+ *	  contrib/vgram/vgram_cache.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include <limits.h>
+
+#include "fmgr.h"
+#include "funcapi.h"
+#include "miscadmin.h"
+#include "access/genam.h"
+#include "access/heapam.h"
+#include "access/htup_details.h"
+#include "access/relscan.h"
+#include "access/skey.h"
+#include "access/xact.h"
+#include "catalog/pg_collation.h"
+#include "nodes/tidbitmap.h"
+#include "port/atomics.h"
+#include "storage/ipc.h"
+#include "storage/itemptr.h"
+#include "storage/lwlock.h"
+#include "storage/shmem.h"
+#include "utils/builtins.h"
+#include "utils/fmgroids.h"
+#include "utils/guc.h"
+#include "utils/rel.h"
+#include "utils/snapmgr.h"
+
+#include "vgram.h"
+
+Datum		vgram_like_candidates(PG_FUNCTION_ARGS);
+
+PG_FUNCTION_INFO_V1(vgram_like_candidates);
+
+/*
+ * Cache entry describes candidate TIDs of the pattern, which are stored in
+ * the shared arena.  Entry is valid only while changes counter is the same
+ * as it was when entry was filled.
+ */
+typedef struct
+{
+	bool		used;
+	Oid			dbid;
+	Oid			indexOid;
+	StrategyNumber strategy;
+	int			patternLen;
+	char		pattern[VGRAM_RESULT_CACHE_PATTERN_LEN];
+	uint64		changeCount;
+	uint64		lastUsed;
+	int64		offset;
+	int64		ntids;
+} ResultCacheEntry;
+
+typedef struct
+{
+	LWLock	   *lock;
+	pg_atomic_uint64 changeCount;
+	uint64		clock;
+	int64		usedTids,
+				capacity;
+	ResultCacheEntry entries[VGRAM_RESULT_CACHE_ENTRIES];
+	ItemPointerData tids[FLEXIBLE_ARRAY_MEMBER];
+} ResultCacheShared;
+
+/* Size of the cache in kB, zero disables the cache */
+static int	vgramResultCacheSize = 0;
+
+static ResultCacheShared *resultCache = NULL;
+
+/* Current transaction has inserted into V-gram index */
+static bool resultCacheInserted = false;
+
+#if PG_VERSION_NUM >= 150000
+static shmem_request_hook_type prev_shmem_request_hook = NULL;
+#endif
+static shmem_startup_hook_type prev_shmem_startup_hook = NULL;
+
+static Size
+resultCacheShmemSize(void)
+{
+	return Max(offsetof(ResultCacheShared, tids),
+			   (Size) vgramResultCacheSize * 1024);
+}
+
+#if PG_VERSION_NUM >= 150000
+static void
+resultCacheShmemRequest(void)
+{
+	if (prev_shmem_request_hook)
+		prev_shmem_request_hook();
+
+	RequestAddinShmemSpace(resultCacheShmemSize());
+	RequestNamedLWLockTranche("vgram", 1);
+}
+#endif
+
+static void
+resultCacheShmemStartup(void)
+{
+	bool		found;
+
+	if (prev_shmem_startup_hook)
+		prev_shmem_startup_hook();
+
+	LWLockAcquire(AddinShmemInitLock, LW_EXCLUSIVE);
+	resultCache = ShmemInitStruct("vgram result cache",
+								  resultCacheShmemSize(), &found);
+	if (!found)
+	{
+		memset(resultCache, 0, offsetof(ResultCacheShared, tids));
+		resultCache->lock = &(GetNamedLWLockTranche("vgram"))->lock;
+		pg_atomic_init_u64(&resultCache->changeCount, 0);
+		resultCache->capacity = (resultCacheShmemSize() -
+								 offsetof(ResultCacheShared, tids)) /
+			sizeof(ItemPointerData);
+	}
+	LWLockRelease(AddinShmemInitLock);
+}
+
+/*
+ * Entries inserted into the index are visible to index scans of other
+ * backends only after insertion is done, which is known for sure at the end
+ * of transaction.  Bumping changes counter earlier would let concurrent scan
+ * which missed the new entry store its result under the new counter value.
+ */
+static void
+resultCacheXactCallback(XactEvent event, void *arg)
+{
+	switch (event)
+	{
+		case XACT_EVENT_COMMIT:
+		case XACT_EVENT_PARALLEL_COMMIT:
+		case XACT_EVENT_ABORT:
+		case XACT_EVENT_PARALLEL_ABORT:
+		case XACT_EVENT_PREPARE:
+			if (resultCacheInserted)
+				resultCacheInvalidate();
+			resultCacheInserted = false;
+			break;
+		default:
+			break;
+	}
+}
+
+/*
+ * Define cache size parameter and request shared memory.  Cache is
+ * available only when vgram is loaded by shared_preload_libraries.
+ */
+void
+resultCacheInit(void)
+{
+	DefineCustomIntVariable("vgram.result_cache_size",
+							"Size of shared memory cache of candidate TIDs "
+							"for like/ilike patterns.",
+							"Zero disables the cache.",
+							&vgramResultCacheSize,
+							0, 0, INT_MAX / 1024,
+							PGC_POSTMASTER, GUC_UNIT_KB,
+							NULL, NULL, NULL);
+
+	if (!process_shared_preload_libraries_in_progress ||
+		vgramResultCacheSize <= 0)
+		return;
+
+#if PG_VERSION_NUM >= 150000
+	prev_shmem_request_hook = shmem_request_hook;
+	shmem_request_hook = resultCacheShmemRequest;
+#else
+	RequestAddinShmemSpace(resultCacheShmemSize());
+	RequestNamedLWLockTranche("vgram", 1);
+#endif
+	prev_shmem_startup_hook = shmem_startup_hook;
+	shmem_startup_hook = resultCacheShmemStartup;
+	RegisterXactCallback(resultCacheXactCallback, NULL);
+}
+
+/*
+ * Invalidate all the cached results.  Opclass support functions don't know
+ * the index they are called for, so changes counter is common for all V-gram
+ * indexes.  It's incremented on statistics change and at the end of every
+ * transaction inserting into V-gram index.  Vacuum only removes TIDs, so
+ * cached candidates become superset of actual ones, while reuse of removed
+ * TID implies insertion.
+ */
+void
+resultCacheInvalidate(void)
+{
+	if (resultCache)
+		pg_atomic_fetch_add_u64(&resultCache->changeCount, 1);
+}
+
+/*
+ * Invalidate all the cached results at the end of current transaction, which
+ * is going to insert into V-gram index.  Until then, current transaction
+ * doesn't use the cache, because cached results miss its own insertions.
+ */
+void
+resultCacheInvalidateAtEOXact(void)
+{
+	resultCacheInserted = true;
+}
+
+static ResultCacheEntry *
+resultCacheFind(Oid indexOid, StrategyNumber strategy, text *pattern,
+				uint64 changeCount)
+{
+	int			len = VARSIZE_ANY_EXHDR(pattern),
+				i;
+
+	for (i = 0; i < VGRAM_RESULT_CACHE_ENTRIES; i++)
+	{
+		ResultCacheEntry *entry = &resultCache->entries[i];
+
+		if (entry->used &&
+			entry->changeCount == changeCount &&
+			entry->dbid == MyDatabaseId &&
+			entry->indexOid == indexOid &&
+			entry->strategy == strategy &&
+			entry->patternLen == len &&
+			memcmp(entry->pattern, VARDATA_ANY(pattern), len) == 0)
+			return entry;
+	}
+	return NULL;
+}
+
+static int
+entryOffsetCmp(const void *a1, const void *a2)
+{
+	const ResultCacheEntry *e1 = *((ResultCacheEntry *const *) a1);
+	const ResultCacheEntry *e2 = *((ResultCacheEntry *const *) a2);
+
+	if (e1->offset < e2->offset)
+		return -1;
+	else if (e1->offset > e2->offset)
+		return 1;
+	return 0;
+}
+
+/*
+ * Move TIDs of live entries to the beginning of arena.  Caller must hold
+ * exclusive lock.
+ */
+static void
+resultCacheCompact(void)
+{
+	ResultCacheEntry *live[VGRAM_RESULT_CACHE_ENTRIES];
+	int			nlive = 0,
+				i;
+	int64		offset = 0;
+
+	for (i = 0; i < VGRAM_RESULT_CACHE_ENTRIES; i++)
+	{
+		if (resultCache->entries[i].used)
+			live[nlive++] = &resultCache->entries[i];
+	}
+	qsort(live, nlive, sizeof(ResultCacheEntry *), entryOffsetCmp);
+
+	for (i = 0; i < nlive; i++)
+	{
+		if (live[i]->offset != offset)
+			memmove(&resultCache->tids[offset],
+					&resultCache->tids[live[i]->offset],
+					sizeof(ItemPointerData) * live[i]->ntids);
+		live[i]->offset = offset;
+		offset += live[i]->ntids;
+	}
+	resultCache->usedTids = offset;
+}
+
+/*
+ * Put candidate TIDs into the cache evicting outdated and least recently
+ * used entries.
+ */
+static void
+resultCacheStore(Oid indexOid, StrategyNumber strategy, text *pattern,
+				 uint64 changeCount, ItemPointer tids, int64 ntids)
+{
+	ResultCacheEntry *entry = NULL;
+	int			len = VARSIZE_ANY_EXHDR(pattern),
+				i;
+	int64		liveTids = 0;
+	bool		compact = false;
+
+	if (len > VGRAM_RESULT_CACHE_PATTERN_LEN || ntids > resultCache->capacity)
+		return;
+
+	LWLockAcquire(resultCache->lock, LW_EXCLUSIVE);
+
+	if (resultCacheFind(indexOid, strategy, pattern, changeCount))
+	{
+		LWLockRelease(resultCache->lock);
+		return;
+	}
+
+	for (i = 0; i < VGRAM_RESULT_CACHE_ENTRIES; i++)
+	{
+		ResultCacheEntry *e = &resultCache->entries[i];
+
+		if (e->used &&
+			e->changeCount != pg_atomic_read_u64(&resultCache->changeCount))
+		{
+			e->used = false;
+			compact = true;
+		}
+		if (e->used)
+			liveTids += e->ntids;
+	}
+
+	for (;;)
+	{
+		ResultCacheEntry *victim = NULL;
+
+		entry = NULL;
+		for (i = 0; i < VGRAM_RESULT_CACHE_ENTRIES; i++)
+		{
+			ResultCacheEntry *e = &resultCache->entries[i];
+
+			if (!e->used)
+			{
+				if (!entry)
+					entry = e;
+			}
+			else if (!victim || e->lastUsed < victim->lastUsed)
+				victim = e;
+		}
+		if (entry && liveTids + ntids <= resultCache->capacity)
+			break;
+
+		Assert(victim);
+		victim->used = false;
+		liveTids -= victim->ntids;
+		compact = true;
+	}
+
+	if (compact || resultCache->usedTids + ntids > resultCache->capacity)
+		resultCacheCompact();
+
+	entry->used = true;
+	entry->dbid = MyDatabaseId;
+	entry->indexOid = indexOid;
+	entry->strategy = strategy;
+	entry->patternLen = len;
+	memcpy(entry->pattern, VARDATA_ANY(pattern), len);
+	entry->changeCount = changeCount;
+	entry->lastUsed = ++resultCache->clock;
+	entry->offset = resultCache->usedTids;
+	entry->ntids = ntids;
+	memcpy(&resultCache->tids[entry->offset], tids,
+		   sizeof(ItemPointerData) * ntids);
+	resultCache->usedTids += ntids;
+
+	LWLockRelease(resultCache->lock);
+}
+
+/*
+ * Run bitmap scan of V-gram index for like/ilike pattern.  Bitmap contains
+ * candidate TIDs, which still need recheck.
+ */
+TIDBitmap *
+getIndexBitmap(Relation indexRel, StrategyNumber strategy, text *pattern)
+{
+	IndexScanDesc scan;
+	ScanKeyData key;
+	TIDBitmap  *tbm;
+
+	ScanKeyEntryInitialize(&key, 0, 1, strategy, InvalidOid,
+						   DEFAULT_COLLATION_OID,
+						   strategy == LikeStrategyNumber ? F_TEXTLIKE : F_TEXTICLIKE,
+						   PointerGetDatum(pattern));
+
+#if PG_VERSION_NUM >= 100000
+	tbm = tbm_create(work_mem * 1024L, NULL);
+#else
+	tbm = tbm_create(work_mem * 1024L);
+#endif
+	scan = index_beginscan_bitmap(indexRel, GetActiveSnapshot(), 1);
+	index_rescan(scan, &key, 1, NULL, 0);
+	(void) index_getbitmap(scan, tbm);
+	index_endscan(scan);
+
+	return tbm;
+}
+
+/*
+ * Get candidate TIDs from the index bitmap scan.  Lossy pages are expanded
+ * to all possible offsets.
+ */
+static ItemPointer
+getCandidates(Relation indexRel, StrategyNumber strategy, text *pattern,
+			  int64 *ntids)
+{
+	TIDBitmap  *tbm;
+	TBMIterator *iterator;
+	TBMIterateResult *tbmres;
+	ItemPointer tids;
+	int64		count = 0,
+				allocated = 1024;
+
+	tbm = getIndexBitmap(indexRel, strategy, pattern);
+
+	tids = (ItemPointer) palloc(sizeof(ItemPointerData) * allocated);
+	iterator = tbm_begin_iterate(tbm);
+	while ((tbmres = tbm_iterate(iterator)) != NULL)
+	{
+		int			n = (tbmres->ntuples >= 0) ? tbmres->ntuples : MaxHeapTuplesPerPage,
+					i;
+
+		while (count + n > allocated)
+		{
+			allocated *= 2;
+			tids = (ItemPointer) repalloc(tids, sizeof(ItemPointerData) * allocated);
+		}
+		for (i = 0; i < n; i++)
+			ItemPointerSet(&tids[count++], tbmres->blockno,
+						   (tbmres->ntuples >= 0) ? tbmres->offsets[i] : i + 1);
+	}
+	tbm_end_iterate(iterator);
+	tbm_free(tbm);
+
+	*ntids = count;
+	return tids;
+}
+
+typedef struct
+{
+	Oid			heapOid;
+	ItemPointer tids;
+	int64		ntids,
+				next;
+} CandidatesState;
+
+/*
+ * Return candidate TIDs of rows matching like/ilike pattern according to the
+ * V-gram index.  Candidates still need recheck of the pattern.  Hot patterns
+ * are served from the shared memory cache without scanning the index.  Index
+ * and cache contain roots of HOT chains, which are resolved to the tuples
+ * visible to the current snapshot on return.
+ */
+Datum
+vgram_like_candidates(PG_FUNCTION_ARGS)
+{
+	FuncCallContext *funcctx;
+	CandidatesState *state;
+
+	if (SRF_IS_FIRSTCALL())
+	{
+		MemoryContext oldContext;
+		Oid			indexOid = PG_GETARG_OID(0);
+		text	   *pattern = PG_GETARG_TEXT_PP(1);
+		StrategyNumber strategy = PG_GETARG_BOOL(2) ? ILikeStrategyNumber :
+			LikeStrategyNumber;
+		Relation	indexRel;
+		ResultCacheEntry *entry = NULL;
+		uint64		changeCount = 0;
+
+		funcctx = SRF_FIRSTCALL_INIT();
+		oldContext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
+
+		state = (CandidatesState *) palloc(sizeof(CandidatesState));
+		funcctx->user_fctx = state;
+
+		indexRel = index_open(indexOid, AccessShareLock);
+		checkIndexedTableSelect(indexRel);
+		state->heapOid = indexRel->rd_index->indrelid;
+		state->next = 0;
+
+		if (resultCache && !resultCacheInserted)
+		{
+			changeCount = pg_atomic_read_u64(&resultCache->changeCount);
+			LWLockAcquire(resultCache->lock, LW_EXCLUSIVE);
+			entry = resultCacheFind(indexOid, strategy, pattern, changeCount);
+			if (entry)
+			{
+				entry->lastUsed = ++resultCache->clock;
+				state->ntids = entry->ntids;
+				state->tids = (ItemPointer) palloc(sizeof(ItemPointerData) *
+												   Max(entry->ntids, 1));
+				memcpy(state->tids, &resultCache->tids[entry->offset],
+					   sizeof(ItemPointerData) * entry->ntids);
+			}
+			LWLockRelease(resultCache->lock);
+		}
+
+		if (!entry)
+		{
+			state->tids = getCandidates(indexRel, strategy, pattern,
+										&state->ntids);
+			if (resultCache)
+				resultCacheStore(indexOid, strategy, pattern, changeCount,
+								 state->tids, state->ntids);
+		}
+
+		index_close(indexRel, AccessShareLock);
+		MemoryContextSwitchTo(oldContext);
+	}
+
+	funcctx = SRF_PERCALL_SETUP();
+	state = (CandidatesState *) funcctx->user_fctx;
+
+	if (state->next < state->ntids)
+	{
+		Relation	heapRel = relation_open(state->heapOid, AccessShareLock);
+
+		while (state->next < state->ntids)
+		{
+			ItemPointer tid = &state->tids[state->next++];
+			HeapTuple	tuple;
+
+			CHECK_FOR_INTERRUPTS();
+
+			tuple = getVisibleTuple(heapRel, tid, GetActiveSnapshot());
+			if (tuple)
+			{
+				heap_freetuple(tuple);
+				relation_close(heapRel, AccessShareLock);
+				SRF_RETURN_NEXT(funcctx, PointerGetDatum(tid));
+			}
+		}
+		relation_close(heapRel, AccessShareLock);
+	}
+
+	SRF_RETURN_DONE(funcctx);
+}
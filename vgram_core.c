@@ -0,0 +1,796 @@
+/*-------------------------------------------------------------------------
+ *
+ * vgram_core.c
+ *		Reentrant core of V-gram extraction: tokenizer, frequent q-grams
+ *		lookup and V-gram extraction.  Doesn't depend on PostgreSQL backend,
+ *		so the same code divides strings into V-grams in the server and in
+ *		client applications precomputing vgramvector values.
+ *
+ * Copyright (c) 2011-2017, Alexander Korotkov
+ *
+ * IDENTIFICATION
+ *	  contrib/vgram/vgram_core.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wctype.h>
+
+#include "vgram_core.h"
+
+/* FNV-1a parameters used for V-gram ids */
+#define FNV_OFFSET_BASIS	(2166136261u)
+#define FNV_PRIME			(16777619u)
+
+static void *
+mallocAlloc(size_t size, void *arg)
+{
+	return malloc(size);
+}
+
+static void
+mallocFree(void *ptr, void *arg)
+{
+	free(ptr);
+}
+
+const VGramAllocator vgramMallocAllocator = {mallocAlloc, mallocFree, NULL};
+
+static int
+utf8CharLength(const char *c)
+{
+	unsigned char b = (unsigned char) *c;
+
+	if (b < 0x80)
+		return 1;
+	else if ((b & 0xE0) == 0xC0)
+		return 2;
+	else if ((b & 0xF0) == 0xE0)
+		return 3;
+	else if ((b & 0xF8) == 0xF0)
+		return 4;
+	else
+		return 1;
+}
+
+static uint32_t
+utf8Decode(const char *c, int len)
+{
+	const unsigned char *p = (const unsigned char *) c;
+	uint32_t	result;
+	int			i;
+
+	switch (len)
+	{
+		case 2:
+			result = p[0] & 0x1F;
+			break;
+		case 3:
+			result = p[0] & 0x0F;
+			break;
+		case 4:
+			result = p[0] & 0x07;
+			break;
+		default:
+			return p[0];
+	}
+	for (i = 1; i < len; i++)
+		result = (result << 6) | (p[i] & 0x3F);
+	return result;
+}
+
+static int
+utf8Encode(uint32_t code, char *dst)
+{
+	unsigned char *p = (unsigned char *) dst;
+
+	if (code < 0x80)
+	{
+		p[0] = code;
+		return 1;
+	}
+	else if (code < 0x800)
+	{
+		p[0] = 0xC0 | (code >> 6);
+		p[1] = 0x80 | (code & 0x3F);
+		return 2;
+	}
+	else if (code < 0x10000)
+	{
+		p[0] = 0xE0 | (code >> 12);
+		p[1] = 0x80 | ((code >> 6) & 0x3F);
+		p[2] = 0x80 | (code & 0x3F);
+		return 3;
+	}
+	else
+	{
+		p[0] = 0xF0 | (code >> 18);
+		p[1] = 0x80 | ((code >> 12) & 0x3F);
+		p[2] = 0x80 | ((code >> 6) & 0x3F);
+		p[3] = 0x80 | (code & 0x3F);
+		return 4;
+	}
+}
+
+/*
+ * Letters and digits are extractable as in t_isalpha() and t_isdigit() of
+ * the server.  Classification of non-ASCII characters follows LC_CTYPE of
+ * the process, which must match the one of the database: compare
+ * vgramCharOpsFingerprint() with the server's vgram_charops_fingerprint().
+ */
+static int
+utf8IsExtractable(const char *c)
+{
+	int			len = utf8CharLength(c);
+	uint32_t	code;
+
+	if (len == 1)
+		return isalnum((unsigned char) *c) != 0;
+	code = utf8Decode(c, len);
+	return iswalpha((wint_t) code) || iswdigit((wint_t) code);
+}
+
+static char *
+utf8Lower(const char *str, size_t len, const VGramAllocator *allocator)
+{
+	const char *p,
+			   *end = str + len;
+	char	   *result,
+			   *r;
+
+	/* Lowercase character never takes more than twice bytes */
+	result = (char *) allocator->alloc(2 * len + 1, allocator->arg);
+	if (!result)
+		return NULL;
+
+	r = result;
+	for (p = str; p < end;)
+	{
+		int			charLen = utf8CharLength(p);
+
+		/*
+		 * Server lowercases UTF-8 by towlower() of all the characters
+		 * including ASCII ones, which might map outside of ASCII (e.g.
+		 * dotless i in Turkish locales).
+		 */
+		r += utf8Encode((uint32_t) towlower((wint_t) utf8Decode(p, charLen)), r);
+		p += charLen;
+	}
+	*r = '\0';
+	return result;
+}
+
+/**
+ * Check if character belongs to script written without spaces between words:
+ * Han ideographs, kana, Thai, Lao, Khmer and Myanmar.
+ *
+ * @param code Unicode code point
+ * @return Non-zero for continuous script
+ */
+int
+vgramIsContinuousCode(uint32_t code)
+{
+	return (code >= 0x0E00 && code <= 0x0EFF) ||	/* Thai, Lao */
+		(code >= 0x1000 && code <= 0x109F) ||	/* Myanmar */
+		(code >= 0x1780 && code <= 0x17FF) ||	/* Khmer */
+		(code >= 0x3040 && code <= 0x30FF) ||	/* Hiragana, Katakana */
+		(code >= 0x31F0 && code <= 0x31FF) ||	/* Katakana extensions */
+		(code >= 0x3400 && code <= 0x4DBF) ||	/* CJK extension A */
+		(code >= 0x4E00 && code <= 0x9FFF) ||	/* CJK unified ideographs */
+		(code >= 0xF900 && code <= 0xFAFF) ||	/* CJK compatibility */
+		(code >= 0xFF66 && code <= 0xFF9F) ||	/* Halfwidth Katakana */
+		(code >= 0x20000 && code <= 0x3FFFF);	/* CJK extensions B+ */
+}
+
+static int
+utf8IsContinuous(const char *c)
+{
+	int			len = utf8CharLength(c);
+
+	return len > 1 && vgramIsContinuousCode(utf8Decode(c, len));
+}
+
+const VGramCharOps vgramUTF8CharOps = {utf8CharLength, utf8IsExtractable,
+	utf8Lower, NULL};
+const VGramCharOps vgramUTF8ContinuousCharOps = {utf8CharLength,
+	utf8IsExtractable, utf8Lower, utf8IsContinuous};
+
+static int
+qgramCmp(const void *a1, const void *a2)
+{
+	const VGramQGram *e1 = (const VGramQGram *) a1;
+	const VGramQGram *e2 = (const VGramQGram *) a2;
+
+	return strcmp(e1->qgram, e2->qgram);
+}
+
+/**
+ * Initialize dictionary handle.  Q-grams are sorted in place, so they could
+ * be given in any order.
+ *
+ * @param dict Dictionary handle to initialize
+ * @param qgrams Frequent q-grams longer than one character
+ * @param qgramsCount Number of q-grams
+ * @param charOps Character handling of strings encoding
+ * @param allocator Allocator for V-grams and temporary buffers
+ */
+void
+vgramDictInit(VGramDict *dict, VGramQGram *qgrams, int qgramsCount,
+			  const VGramCharOps *charOps, const VGramAllocator *allocator)
+{
+	qsort(qgrams, qgramsCount, sizeof(VGramQGram), qgramCmp);
+	dict->qgrams = qgrams;
+	dict->qgramsCount = qgramsCount;
+	dict->lookup = NULL;
+	dict->charOps = charOps;
+	dict->allocator = allocator;
+}
+
+/**
+ * Search dictionary for given prefix. Initially lower and upper bounds
+ * should cover all indexes of dictionary. Resulting lower and upper bounds
+ * can be reused for search with longer prefix.
+ *
+ * @param dict Dictionary handle
+ * @param prefix Pointer to prefix
+ * @param len Length of prefix *in bytes*
+ * @param lower Pointer to current lower bound
+ * @param upper Pointer to current upper bound
+ * @return Index of found q-gram
+ */
+int
+vgramPrefixSearch(const VGramDict *dict, const char *prefix, int len,
+				  int *lower, int *upper)
+{
+	int			mid,
+				cmp;
+
+	while (*lower <= *upper)
+	{
+		mid = (*lower + *upper) / 2;
+		cmp = strncmp(dict->qgrams[mid].qgram, prefix, len);
+		if (cmp < 0)
+		{
+			*lower = mid + 1;
+		}
+		else if (cmp > 0)
+		{
+			*upper = mid - 1;
+		}
+		else
+		{
+			return mid;
+		}
+	}
+	return -1;
+}
+
+/**
+ * Check if some frequent q-gram starts with given prefix.  Bounds are used
+ * the same way as in vgramPrefixSearch(), but aren't touched when
+ * dictionary has its own lookup.
+ *
+ * @param dict Dictionary handle
+ * @param prefix Pointer to prefix
+ * @param len Length of prefix *in bytes*
+ * @param lower Pointer to current lower bound
+ * @param upper Pointer to current upper bound
+ * @return Non-zero if prefix of frequent q-gram
+ */
+int
+vgramHasPrefix(const VGramDict *dict, const char *prefix, int len,
+			   int *lower, int *upper)
+{
+	float		frequency;
+
+	if (dict->lookup)
+		return dict->lookup->lookup(prefix, len, &frequency,
+									dict->lookup->arg) != VGRAM_LOOKUP_NONE;
+	return vgramPrefixSearch(dict, prefix, len, lower, upper) >= 0;
+}
+
+/**
+ * Search dictionary for exact q-gram.
+ *
+ * @param dict Dictionary handle
+ * @param qgram Pointer to q-gram
+ * @param len Length of q-gram *in bytes*
+ * @return Frequency of q-gram or -1 if q-gram isn't frequent
+ */
+float
+vgramExactFrequency(const VGramDict *dict, const char *qgram, int len)
+{
+	int			mid,
+				cmp,
+				lower = 0,
+				upper = dict->qgramsCount - 1;
+	float		frequency;
+
+	if (dict->lookup)
+	{
+		if (dict->lookup->lookup(qgram, len, &frequency,
+								 dict->lookup->arg) == VGRAM_LOOKUP_EXACT)
+			return frequency;
+		return -1.0f;
+	}
+
+	while (lower <= upper)
+	{
+		mid = (lower + upper) / 2;
+		cmp = strncmp(dict->qgrams[mid].qgram, qgram, len);
+		if (cmp == 0 && dict->qgrams[mid].qgram[len] != '\0')
+			cmp = 1;
+		if (cmp < 0)
+			lower = mid + 1;
+		else if (cmp > 0)
+			upper = mid - 1;
+		else
+			return dict->qgrams[mid].frequency;
+	}
+	return -1.0f;
+}
+
+/*
+ * Pass copy of len bytes as V-gram to callback.
+ */
+static int
+emitVGram(const VGramDict *dict, const char *start, size_t len,
+		  VGramCallback callback, void *userData)
+{
+	char	   *vgram;
+
+	vgram = (char *) dict->allocator->alloc(len + 1, dict->allocator->arg);
+	if (!vgram)
+		return VGRAM_ERROR_MEMORY;
+	memcpy(vgram, start, len);
+	vgram[len] = '\0';
+	callback(vgram, userData);
+	return VGRAM_OK;
+}
+
+/**
+ * Lowercase word and surround it with empty characters in the buffer, which
+ * is grown when needed.  Segments of continuous scripts aren't surrounded,
+ * since their boundaries aren't word boundaries.
+ */
+static int
+prepareWord(const VGramDict *dict, const char *start, size_t len,
+			int continuous, char **buf, size_t *bufSize, size_t *wordLen)
+{
+	const VGramAllocator *allocator = dict->allocator;
+	char	   *lower;
+	size_t		lowerLen,
+				padding = continuous ? 0 : 1;
+
+	lower = dict->charOps->lower(start, len, allocator);
+	if (!lower)
+		return VGRAM_ERROR_MEMORY;
+	lowerLen = strlen(lower);
+
+	if (lowerLen + 2 > *bufSize)
+	{
+		allocator->free(*buf, allocator->arg);
+		*bufSize = lowerLen + 2;
+		*buf = (char *) allocator->alloc(*bufSize, allocator->arg);
+		if (!*buf)
+		{
+			allocator->free(lower, allocator->arg);
+			return VGRAM_ERROR_MEMORY;
+		}
+	}
+
+	(*buf)[0] = VGRAM_EMPTY_CHARACTER;
+	memcpy(*buf + padding, lower, lowerLen);
+	(*buf)[lowerLen + padding] = VGRAM_EMPTY_CHARACTER;
+	allocator->free(lower, allocator->arg);
+	*wordLen = lowerLen + 2 * padding;
+	return VGRAM_OK;
+}
+
+/**
+ * Extract words from given string add call callback function for each of
+ * them. Word is a continuous sequence of extractable characters. Surrounds
+ * each word with VGRAM_EMPTY_CHARACTER.  When encoding defines continuous
+ * scripts, which don't separate words by spaces, transition between
+ * continuous and other characters also ends word, and segments of
+ * continuous characters are passed without surrounding.
+ *
+ * @param dict Dictionary handle, only encoding and allocator are used
+ * @param string Pointer to the source string
+ * @param len Length of string *in bytes*
+ * @param callback Callback to be called for each word
+ * @param userData Some additional pointer to be passed to callback
+ * @return VGRAM_OK or error code
+ */
+int
+vgramExtractWords(const VGramDict *dict, const char *string, size_t len,
+				  VGramWordCallback callback, void *userData)
+{
+	const VGramCharOps *charOps = dict->charOps;
+	const char *p,
+			   *end = string + len,
+			   *firstExtractable = NULL;
+	char	   *buf;
+	size_t		bufSize = len + 2,
+				wordLen;
+	int			result = VGRAM_OK,
+				wordContinuous = 0;
+
+	buf = (char *) dict->allocator->alloc(bufSize, dict->allocator->arg);
+	if (!buf)
+		return VGRAM_ERROR_MEMORY;
+
+	for (p = string; p < end; p += charOps->charLength(p))
+	{
+		int			extractable = charOps->isExtractable(p),
+					continuous;
+
+		continuous = extractable && charOps->isContinuous &&
+			charOps->isContinuous(p);
+
+		if (firstExtractable && (!extractable || continuous != wordContinuous))
+		{
+			result = prepareWord(dict, firstExtractable, p - firstExtractable,
+								 wordContinuous, &buf, &bufSize, &wordLen);
+			if (result != VGRAM_OK)
+				break;
+			callback(buf, buf + wordLen, userData);
+			firstExtractable = NULL;
+		}
+		if (extractable && !firstExtractable)
+		{
+			firstExtractable = p;
+			wordContinuous = continuous;
+		}
+	}
+	if (result == VGRAM_OK && firstExtractable)
+	{
+		result = prepareWord(dict, firstExtractable, p - firstExtractable,
+							 wordContinuous, &buf, &bufSize, &wordLen);
+		if (result == VGRAM_OK)
+			callback(buf, buf + wordLen, userData);
+	}
+	if (buf)
+		dict->allocator->free(buf, dict->allocator->arg);
+	return result;
+}
+
+/**
+ * Extract all the V-grams from the word: for each position the shortest
+ * infrequent q-gram starting from it.
+ *
+ * @param dict Dictionary handle
+ * @param wordStart Pointer to the first character of the word.
+ * @param wordEnd Pointer below to the last character of the word.
+ * @param callback Callback to be called for each V-gram.
+ * @param userData Some additional pointer to be passed to callback
+ * @return VGRAM_OK or error code
+ */
+int
+vgramExtractWordVGrams(const VGramDict *dict, const char *wordStart,
+					   const char *wordEnd, VGramCallback callback,
+					   void *userData)
+{
+	const char *p = wordStart;
+
+	while (p < wordEnd)
+	{
+		const char *r = p;
+		int			lower = 0,
+					upper = dict->qgramsCount - 1,
+					len = 0;
+
+		while (len < VGRAM_MAX_Q && r < wordEnd)
+		{
+			r += dict->charOps->charLength(r);
+			len++;
+			if (len >= VGRAM_MIN_Q &&
+				!vgramHasPrefix(dict, p, r - p, &lower, &upper))
+			{
+				if (emitVGram(dict, p, r - p, callback, userData) != VGRAM_OK)
+					return VGRAM_ERROR_MEMORY;
+				break;
+			}
+		}
+		p += dict->charOps->charLength(p);
+	}
+	return VGRAM_OK;
+}
+
+/**
+ * Extract minimal V-grams from the word.
+ *
+ * @param dict Dictionary handle
+ * @param wordStart Pointer to the first character of the word.
+ * @param wordEnd Pointer below to the last character of the word.
+ * @param maxLength Maximal length of V-gram, at most VGRAM_MAX_Q.
+ * @param limitFrequency Q-grams of dictionary less frequent than this are
+ *		  considered infrequent.  Zero means whole dictionary is used.
+ * @param callback Callback to be called for each V-gram.
+ * @param userData Some additional pointer to be passed to callback
+ * @return VGRAM_OK or error code
+ */
+int
+vgramExtractMinimalWordVGrams(const VGramDict *dict,
+							  const char *wordStart, const char *wordEnd,
+							  int maxLength, float limitFrequency,
+							  VGramCallback callback, void *userData)
+{
+	const char *p = wordStart,
+			   *prevR = NULL,
+			   *prevP = NULL;
+
+	while (p < wordEnd)
+	{
+		const char *r = p;
+		int			lower = 0,
+					upper = dict->qgramsCount - 1,
+					len = 0;
+
+		while (len < maxLength && r < wordEnd)
+		{
+			r += dict->charOps->charLength(r);
+			len++;
+			if (len >= VGRAM_MIN_Q &&
+				(!vgramHasPrefix(dict, p, r - p, &lower, &upper) ||
+				 (limitFrequency > 0.0f &&
+				  vgramExactFrequency(dict, p, r - p) < limitFrequency)))
+			{
+				if (prevR && prevP && prevR < r &&
+					emitVGram(dict, prevP, prevR - prevP,
+							  callback, userData) != VGRAM_OK)
+					return VGRAM_ERROR_MEMORY;
+				prevR = r;
+				prevP = p;
+				break;
+			}
+		}
+		p += dict->charOps->charLength(p);
+	}
+	if (prevR && prevP)
+		return emitVGram(dict, prevP, prevR - prevP, callback, userData);
+	return VGRAM_OK;
+}
+
+typedef struct
+{
+	const VGramDict *dict;
+	VGramCallback callback;
+	void	   *userData;
+	int			result;
+} ExtractState;
+
+static void
+extractWordCallback(const char *wordStart, const char *wordEnd, void *userData)
+{
+	ExtractState *state = (ExtractState *) userData;
+
+	if (state->result != VGRAM_OK)
+		return;
+	state->result = vgramExtractMinimalWordVGrams(state->dict,
+												  wordStart, wordEnd,
+												  VGRAM_MAX_Q, 0.0f,
+												  state->callback,
+												  state->userData);
+}
+
+/**
+ * Extract minimal V-grams of the string as V-gram index does.
+ *
+ * @param dict Dictionary handle
+ * @param string Pointer to the source string
+ * @param len Length of string *in bytes*
+ * @param callback Callback to be called for each V-gram, which takes
+ *		  ownership of V-gram allocated by dictionary allocator
+ * @param userData Some additional pointer to be passed to callback
+ * @return VGRAM_OK or error code
+ */
+int
+vgramExtract(const VGramDict *dict, const char *string, size_t len,
+			 VGramCallback callback, void *userData)
+{
+	ExtractState state;
+	int			result;
+
+	state.dict = dict;
+	state.callback = callback;
+	state.userData = userData;
+	state.result = VGRAM_OK;
+
+	result = vgramExtractWords(dict, string, len, extractWordCallback, &state);
+	if (result != VGRAM_OK)
+		return result;
+	return state.result;
+}
+
+/**
+ * Id of V-gram stored in vgramvector: FNV-1a hash of its bytes.
+ */
+uint32_t
+vgramId(const char *vgram)
+{
+	const unsigned char *p;
+	uint32_t	hash = FNV_OFFSET_BASIS;
+
+	for (p = (const unsigned char *) vgram; *p; p++)
+	{
+		hash ^= *p;
+		hash *= FNV_PRIME;
+	}
+	return hash;
+}
+
+typedef struct
+{
+	const VGramAllocator *allocator;
+	uint32_t   *ids;
+	int			nids,
+				allocated,
+				result;
+} IdsState;
+
+static void
+addId(char *vgram, void *userData)
+{
+	IdsState   *state = (IdsState *) userData;
+	const VGramAllocator *allocator = state->allocator;
+
+	if (state->result == VGRAM_OK && state->nids >= state->allocated)
+	{
+		uint32_t   *ids;
+
+		ids = (uint32_t *) allocator->alloc(sizeof(uint32_t) * state->allocated * 2,
+											allocator->arg);
+		if (ids)
+		{
+			memcpy(ids, state->ids, sizeof(uint32_t) * state->nids);
+			allocator->free(state->ids, allocator->arg);
+			state->ids = ids;
+			state->allocated *= 2;
+		}
+		else
+			state->result = VGRAM_ERROR_MEMORY;
+	}
+	if (state->result == VGRAM_OK)
+		state->ids[state->nids++] = vgramId(vgram);
+	allocator->free(vgram, allocator->arg);
+}
+
+static int
+idCmp(const void *a, const void *b)
+{
+	uint32_t	ia = *(const uint32_t *) a,
+				ib = *(const uint32_t *) b;
+
+	return (ia > ib) - (ia < ib);
+}
+
+/**
+ * Extract sorted unique ids of minimal V-grams of the string, i.e. contents
+ * of vgramvector.  Ids could be sent to server as vgramvector text
+ * representation: ids separated by spaces.
+ *
+ * @param dict Dictionary handle
+ * @param string Pointer to the source string
+ * @param len Length of string *in bytes*
+ * @param ids Resulting array of ids allocated by dictionary allocator
+ * @param nids Number of resulting ids
+ * @return VGRAM_OK or error code
+ */
+int
+vgramExtractIds(const VGramDict *dict, const char *string, size_t len,
+				uint32_t **ids, int *nids)
+{
+	IdsState	state;
+	int			result,
+				i,
+				j;
+
+	state.allocator = dict->allocator;
+	state.nids = 0;
+	state.allocated = 16;
+	state.result = VGRAM_OK;
+	state.ids = (uint32_t *) dict->allocator->alloc(sizeof(uint32_t) * state.allocated,
+													dict->allocator->arg);
+	if (!state.ids)
+		return VGRAM_ERROR_MEMORY;
+
+	result = vgramExtract(dict, string, len, addId, &state);
+	if (result == VGRAM_OK)
+		result = state.result;
+	if (result != VGRAM_OK)
+	{
+		dict->allocator->free(state.ids, dict->allocator->arg);
+		return result;
+	}
+
+	qsort(state.ids, state.nids, sizeof(uint32_t), idCmp);
+	for (i = 0, j = 0; i < state.nids; i++)
+	{
+		if (j == 0 || state.ids[j - 1] != state.ids[i])
+			state.ids[j++] = state.ids[i];
+	}
+
+	*ids = state.ids;
+	*nids = j;
+	return VGRAM_OK;
+}
+
+/*
+ * Ranges of code points probed by vgramCharOpsFingerprint(): ASCII, Latin,
+ * Greek, Cyrillic, Armenian, Hebrew, Arabic, Devanagari, Thai, Georgian,
+ * kana, CJK, Hangul and fullwidth forms, i.e. scripts whose classification
+ * and case mapping differ between locales.
+ */
+static const uint32_t fingerprintRanges[][2] = {
+	{0x0020, 0x007E},
+	{0x00A0, 0x024F},
+	{0x0370, 0x03FF},
+	{0x0400, 0x052F},
+	{0x0531, 0x058F},
+	{0x05D0, 0x05EA},
+	{0x0620, 0x064A},
+	{0x0900, 0x097F},
+	{0x0E00, 0x0E5B},
+	{0x10A0, 0x10FF},
+	{0x1E00, 0x1EFF},
+	{0x3040, 0x30FF},
+	{0x4E00, 0x4E3F},
+	{0xAC00, 0xAC3F},
+	{0xFF01, 0xFF9F},
+	{0x20000, 0x2003F}
+};
+
+/**
+ * Calculate fingerprint of character handling: FNV-1a hash of word
+ * membership, continuous script membership and lowercase form of probe
+ * characters.  Server returns fingerprint of its own handling from
+ * vgram_charops_fingerprint(), and client extracting V-grams by itself
+ * should check that its fingerprint is the same, otherwise it would produce
+ * V-grams different from the server ones.  Probe characters are UTF-8
+ * encoded.
+ *
+ * @param charOps Character handling to check
+ * @param allocator Allocator used for lowercasing
+ * @param fingerprint Resulting fingerprint
+ * @return VGRAM_OK or error code
+ */
+int
+vgramCharOpsFingerprint(const VGramCharOps *charOps,
+						const VGramAllocator *allocator,
+						uint32_t *fingerprint)
+{
+	uint32_t	hash = FNV_OFFSET_BASIS;
+	int			i;
+
+	for (i = 0; i < (int) (sizeof(fingerprintRanges) / sizeof(fingerprintRanges[0])); i++)
+	{
+		uint32_t	code;
+
+		for (code = fingerprintRanges[i][0]; code <= fingerprintRanges[i][1]; code++)
+		{
+			char		c[5];
+			char	   *lower;
+			unsigned char flags;
+			const unsigned char *p;
+
+			c[utf8Encode(code, c)] = '\0';
+			flags = (charOps->isExtractable(c) ? 1 : 0) |
+				((charOps->isContinuous && charOps->isContinuous(c)) ? 2 : 0);
+			hash = (hash ^ flags) * FNV_PRIME;
+
+			lower = charOps->lower(c, charOps->charLength(c), allocator);
+			if (!lower)
+				return VGRAM_ERROR_MEMORY;
+			for (p = (const unsigned char *) lower; *p; p++)
+				hash = (hash ^ *p) * FNV_PRIME;
+			hash = (hash ^ 0xFF) * FNV_PRIME;
+			allocator->free(lower, allocator->arg);
+		}
+	}
+
+	*fingerprint = hash;
+	return VGRAM_OK;
+}
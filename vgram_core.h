@@ -0,0 +1,135 @@
+/*-------------------------------------------------------------------------
+ *
+ * vgram_core.h
+ *		Header for reentrant V-gram extraction core, which doesn't depend
+ *		on PostgreSQL backend and could be linked into client applications.
+ *
+ * Copyright (c) 2011-2017, Alexander Korotkov
+ *
+ * IDENTIFICATION
+ *	  contrib/vgram/vgram_core.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef _V_GRAM_CORE_H_
+#define _V_GRAM_CORE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * V-gram lengths in characters and character surrounding each word.
+ */
+#define VGRAM_MIN_Q					(2)
+#define VGRAM_MAX_Q					(5)
+#define VGRAM_EMPTY_CHARACTER		('$')
+
+/* Result codes of core functions */
+#define VGRAM_OK					(0)
+#define VGRAM_ERROR_MEMORY			(-1)
+
+/*
+ * Memory allocator provided by caller.  Allocation might return NULL, then
+ * core function fails with VGRAM_ERROR_MEMORY.
+ */
+typedef struct
+{
+	void	   *(*alloc) (size_t size, void *arg);
+	void		(*free) (void *ptr, void *arg);
+	void	   *arg;
+} VGramAllocator;
+
+/*
+ * Character handling of the string encoding.  charLength returns length of
+ * character in bytes, isExtractable tells whether character belongs to word,
+ * lower returns lowercased copy of len bytes allocated by allocator.
+ * Optional isContinuous tells whether character belongs to script written
+ * without spaces between words.  Handling must match the server one, which
+ * is checked by vgramCharOpsFingerprint().
+ */
+typedef struct
+{
+	int			(*charLength) (const char *c);
+	int			(*isExtractable) (const char *c);
+	char	   *(*lower) (const char *str, size_t len,
+						  const VGramAllocator *allocator);
+	int			(*isContinuous) (const char *c);
+} VGramCharOps;
+
+/*
+ * Element of q-grams statistics table sorted by q-gram.
+ */
+typedef struct
+{
+	char	   *qgram;
+	float		frequency;
+} VGramQGram;
+
+/* Results of dictionary lookup */
+#define VGRAM_LOOKUP_NONE			(0)
+#define VGRAM_LOOKUP_PREFIX			(1)
+#define VGRAM_LOOKUP_EXACT			(2)
+
+/*
+ * Lookup of dictionary stored outside of memory.  Tells whether q-gram of
+ * len bytes is frequent itself (VGRAM_LOOKUP_EXACT), is only prefix of
+ * frequent q-grams (VGRAM_LOOKUP_PREFIX) or neither (VGRAM_LOOKUP_NONE).
+ * Frequency of the least by strcmp() frequent q-gram having given prefix is
+ * returned unless result is VGRAM_LOOKUP_NONE.
+ */
+typedef struct
+{
+	int			(*lookup) (const char *qgram, int len, float *frequency, void *arg);
+	void	   *arg;
+} VGramLookup;
+
+/*
+ * Dictionary handle: frequent q-grams longer than one character sorted by
+ * strcmp() or lookup of dictionary stored elsewhere, together with encoding
+ * and allocator used for extraction.  All the state of extraction lives in
+ * the handle and on the stack, so different handles could be used
+ * concurrently.
+ */
+typedef struct
+{
+	const VGramQGram *qgrams;
+	int			qgramsCount;
+	const VGramLookup *lookup;	/* overrides qgrams when set */
+	const VGramCharOps *charOps;
+	const VGramAllocator *allocator;
+} VGramDict;
+
+typedef void (*VGramWordCallback) (const char *wordStart, const char *wordEnd, void *userData);
+typedef void (*VGramCallback) (char *vgram, void *userData);
+
+extern const VGramAllocator vgramMallocAllocator;
+extern const VGramCharOps vgramUTF8CharOps;
+extern const VGramCharOps vgramUTF8ContinuousCharOps;
+
+extern void vgramDictInit(VGramDict *dict, VGramQGram *qgrams, int qgramsCount,
+			  const VGramCharOps *charOps, const VGramAllocator *allocator);
+extern int	vgramPrefixSearch(const VGramDict *dict, const char *prefix, int len,
+				  int *lower, int *upper);
+extern int	vgramHasPrefix(const VGramDict *dict, const char *prefix, int len,
+			   int *lower, int *upper);
+extern float vgramExactFrequency(const VGramDict *dict, const char *qgram, int len);
+extern int	vgramExtractWords(const VGramDict *dict, const char *string, size_t len,
+				  VGramWordCallback callback, void *userData);
+extern int	vgramExtractWordVGrams(const VGramDict *dict, const char *wordStart,
+					   const char *wordEnd, VGramCallback callback,
+					   void *userData);
+extern int	vgramExtractMinimalWordVGrams(const VGramDict *dict,
+							  const char *wordStart, const char *wordEnd,
+							  int maxLength, float limitFrequency,
+							  VGramCallback callback, void *userData);
+extern int	vgramExtract(const VGramDict *dict, const char *string, size_t len,
+			 VGramCallback callback, void *userData);
+extern int	vgramIsContinuousCode(uint32_t code);
+extern uint32_t vgramId(const char *vgram);
+extern int	vgramExtractIds(const VGramDict *dict, const char *string, size_t len,
+				uint32_t **ids, int *nids);
+extern int	vgramCharOpsFingerprint(const VGramCharOps *charOps,
+						const VGramAllocator *allocator,
+						uint32_t *fingerprint);
+
+#endif							/* _V_GRAM_CORE_H_ */
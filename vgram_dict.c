@@ -0,0 +1,3337 @@
+/*-------------------------------------------------------------------------
+ *
+ * vgram_dict.c
+ *		Built-in default q-gram statistics used when qgram_stat table is
+ *		empty.
+ *
+ * Tables are the output of qgram_stat() with default V-gram parameters over
+ * the corpora mentioned below, sorted by strcmp() as loadStats() would sort
+ * them.  Non-ASCII characters are UTF-8 encoded.
+ *
+ * Copyright (c) 2011-2017, Alexander Korotkov
+ *
+ * IDENTIFICATION
+ *	  contrib/vgram/vgram_dict.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+#include "mb/pg_wchar.h"
+
+#include "vgram.h"
+
+/* English: source messages of gettext catalogs of a Debian system, 34796 documents */
+static const QGramTableElement englishQGrams[] = {
+	{"$0", 0.0216404f}, {"$0$", 0.00715599f}, {"$0x", 0.010461f},
+	{"$0x$", 0.00988619f}, {"$1", 0.0151454f}, {"$1$", 0.00586274f},
+	{"$2", 0.0157202f}, {"$25", 0.00807564f}, {"$250", 0.00551788f},
+	{"$250s", 0.00543166f}, {"$3", 0.00827681f}, {"$6", 0.00574779f},
+	{"$a", 0.287102f}, {"$a$", 0.0615301f}, {"$ab", 0.0134498f},
+	{"$ac", 0.0134786f}, {"$acc", 0.00824807f}, {"$acce", 0.00571905f},
+	{"$ad", 0.0244281f}, {"$add", 0.0212381f}, {"$add$", 0.00511553f},
+	{"$addr", 0.0117255f}, {"$af", 0.00916772f}, {"$aft", 0.00755834f},
+	{"$afte", 0.00755834f}, {"$ag", 0.00505805f}, {"$al", 0.0451201f},
+	{"$ali", 0.00563283f}, {"$all", 0.0206058f}, {"$all$", 0.00902403f},
+	{"$allo", 0.0116105f}, {"$alr", 0.00525923f}, {"$alre", 0.00525923f},
+	{"$an", 0.0611565f}, {"$an$", 0.0156052f}, {"$and", 0.0374756f},
+	{"$and$", 0.036987f}, {"$any", 0.00678239f}, {"$any$", 0.00554661f},
+	{"$ap", 0.0137947f}, {"$app", 0.0113519f}, {"$appl", 0.00735717f},
+	{"$ar", 0.0535406f}, {"$arc", 0.0159214f}, {"$arch", 0.0156627f},
+	{"$are", 0.0150592f}, {"$are$", 0.014197f}, {"$arg", 0.013766f},
+	{"$argu", 0.0116967f}, {"$as", 0.0282791f}, {"$as$", 0.017502f},
+	{"$ass", 0.00790321f}, {"$at", 0.0229624f}, {"$at$", 0.0139096f},
+	{"$att", 0.00781699f}, {"$attr", 0.00497184f}, {"$au", 0.0151167f},
+	{"$aut", 0.0101161f}, {"$auth", 0.00609265f}, {"$av", 0.00617887f},
+	{"$b", 0.16545f}, {"$ba", 0.0287389f}, {"$bac", 0.00534544f},
+	{"$back", 0.00534544f}, {"$bad", 0.0102023f}, {"$bad$", 0.0095988f},
+	{"$bas", 0.00732843f}, {"$base", 0.00577653f}, {"$be", 0.0536556f},
+	{"$be$", 0.0339982f}, {"$bi", 0.0198586f}, {"$bit", 0.010461f},
+	{"$bit$", 0.00750086f}, {"$bl", 0.00615013f}, {"$bo", 0.00902403f},
+	{"$br", 0.0160651f}, {"$bra", 0.0114668f}, {"$bran", 0.00968502f},
+	{"$bu", 0.0206058f}, {"$but", 0.0090815f}, {"$but$", 0.00899529f},
+	{"$by", 0.0240832f}, {"$by$", 0.0161225f}, {"$byt", 0.00824807f},
+	{"$byte", 0.00824807f}, {"$c", 0.27164f}, {"$c$", 0.0114668f},
+	{"$ca", 0.0671629f}, {"$cal", 0.00537418f}, {"$can", 0.0453213f},
+	{"$can$", 0.0153179f}, {"$cann", 0.0275319f}, {"$ce", 0.0080469f},
+	{"$cer", 0.00666743f}, {"$cert", 0.00666743f}, {"$ch", 0.0438844f},
+	{"$cha", 0.0262674f}, {"$chan", 0.013536f}, {"$char", 0.0111507f},
+	{"$che", 0.0101736f}, {"$chec", 0.0081906f}, {"$cl", 0.0113519f},
+	{"$clo", 0.00560409f}, {"$co", 0.134125f}, {"$cod", 0.00977124f},
+	{"$code", 0.00977124f}, {"$com", 0.0449764f}, {"$comm", 0.0261237f},
+	{"$comp", 0.0165249f}, {"$con", 0.0516151f}, {"$conf", 0.0115531f},
+	{"$cons", 0.00738591f}, {"$cont", 0.02279f}, {"$cor", 0.0100586f},
+	{"$corr", 0.00727095f}, {"$cou", 0.0171859f}, {"$coul", 0.0131912f},
+	{"$cr", 0.0207783f}, {"$cre", 0.0161225f}, {"$crea", 0.0145132f},
+	{"$cu", 0.00890907f}, {"$cur", 0.00689734f}, {"$curr", 0.00643752f},
+	{"$d", 0.217123f}, {"$d$", 0.0400621f}, {"$da", 0.021353f},
+	{"$dat", 0.0163525f}, {"$data", 0.013651f}, {"$de", 0.0684274f},
+	{"$deb", 0.00790321f}, {"$debu", 0.00600644f}, {"$def", 0.0202609f},
+	{"$defa", 0.0127601f}, {"$defi", 0.00594896f}, {"$del", 0.00836303f},
+	{"$dep", 0.00640878f}, {"$des", 0.00939763f}, {"$det", 0.00566157f},
+	{"$di", 0.0502644f}, {"$dif", 0.00615013f}, {"$diff", 0.00615013f},
+	{"$dir", 0.0232211f}, {"$dire", 0.0210656f}, {"$dis", 0.0146569f},
+	{"$disa", 0.00554661f}, {"$disp", 0.00505805f}, {"$do", 0.0413266f},
+	{"$do$", 0.010346f}, {"$doe", 0.0133349f}, {"$does", 0.0133349f},
+	{"$don", 0.00554661f}, {"$du", 0.00957007f}, {"$e", 0.171686f},
+	{"$e$", 0.00764456f}, {"$ea", 0.00652374f}, {"$el", 0.00724221f},
+	{"$em", 0.00934015f}, {"$emp", 0.00548914f}, {"$empt", 0.00548914f},
+	{"$en", 0.0427348f}, {"$ena", 0.00505805f}, {"$enab", 0.00497184f},
+	{"$enc", 0.0075296f}, {"$end", 0.0118117f}, {"$end$", 0.00773077f},
+	{"$ent", 0.0133349f}, {"$entr", 0.00893781f}, {"$er", 0.0340844f},
+	{"$err", 0.0330785f}, {"$erro", 0.0323026f}, {"$ex", 0.0613289f},
+	{"$exc", 0.00528796f}, {"$exe", 0.00537418f}, {"$exec", 0.00534544f},
+	{"$exi", 0.0119267f}, {"$exis", 0.0076733f}, {"$exp", 0.0280205f},
+	{"$expe", 0.0124152f}, {"$expr", 0.00784573f}, {"$ext", 0.0104035f},
+	{"$exte", 0.00672491f}, {"$f", 0.249799f}, {"$f$", 0.0101736f},
+	{"$fa", 0.0325612f}, {"$fai", 0.0275032f}, {"$fail", 0.0275032f},
+	{"$fi", 0.10277f}, {"$fie", 0.00801816f}, {"$fiel", 0.00796069f},
+	{"$fil", 0.0787159f}, {"$file", 0.0767042f}, {"$fin", 0.00839177f},
+	{"$find", 0.00502931f}, {"$fir", 0.0053167f}, {"$firs", 0.00511553f},
+	{"$fl", 0.0106909f}, {"$fla", 0.00580526f}, {"$flag", 0.00508679f},
+	{"$fo", 0.0946086f}, {"$fol", 0.00594896f}, {"$foll", 0.00563283f},
+	{"$for", 0.0797218f}, {"$for$", 0.0642603f}, {"$form", 0.0128176f},
+	{"$fou", 0.00982872f}, {"$foun", 0.00957007f}, {"$fr", 0.0271296f},
+	{"$fro", 0.0188527f}, {"$from", 0.0185654f}, {"$fu", 0.00925394f},
+	{"$fun", 0.00505805f}, {"$func", 0.00500057f}, {"$g", 0.0839464f},
+	{"$ge", 0.020807f}, {"$gen", 0.0104035f}, {"$gene", 0.00985745f},
+	{"$get", 0.00629383f}, {"$gi", 0.0208357f}, {"$git", 0.0124727f},
+	{"$git$", 0.011783f}, {"$giv", 0.00586274f}, {"$give", 0.00525923f},
+	{"$go", 0.00569031f}, {"$gr", 0.0142258f}, {"$gro", 0.00810438f},
+	{"$grou", 0.00764456f}, {"$h", 0.0754972f}, {"$ha", 0.0322451f},
+	{"$han", 0.00525923f}, {"$has", 0.0145132f}, {"$has$", 0.0120129f},
+	{"$hav", 0.00606392f}, {"$have", 0.00574779f}, {"$he", 0.0201747f},
+	{"$hea", 0.0107484f}, {"$head", 0.0105185f}, {"$hel", 0.00540292f},
+	{"$hi", 0.00600644f}, {"$ho", 0.00807564f}, {"$i", 0.286326f},
+	{"$id", 0.0107771f}, {"$id$", 0.00638004f}, {"$if", 0.0109495f},
+	{"$if$", 0.0103173f}, {"$ig", 0.0124727f}, {"$ign", 0.0123003f},
+	{"$igno", 0.0121853f}, {"$im", 0.0183642f}, {"$ima", 0.00528796f},
+	{"$imag", 0.00523049f}, {"$imm", 0.00563283f}, {"$imme", 0.00508679f},
+	{"$imp", 0.00755834f}, {"$in", 0.18505f}, {"$in$", 0.0659271f},
+	{"$inc", 0.00816186f}, {"$ind", 0.0170134f}, {"$inde", 0.012214f},
+	{"$inf", 0.0126164f}, {"$info", 0.0121278f}, {"$inp", 0.0102885f},
+	{"$inpu", 0.0102598f}, {"$ins", 0.0320727f}, {"$inst", 0.0265548f},
+	{"$int", 0.0207208f}, {"$inte", 0.0155765f}, {"$inv", 0.0400908f},
+	{"$inva", 0.0390275f}, {"$is", 0.0756984f}, {"$is$", 0.0677664f},
+	{"$it", 0.0160651f}, {"$it$", 0.0109495f}, {"$j", 0.0132486f},
+	{"$k", 0.0494597f}, {"$ke", 0.0268134f}, {"$key", 0.0236809f},
+	{"$key$", 0.0165249f}, {"$keys", 0.00537418f}, {"$l", 0.157058f},
+	{"$la", 0.0303771f}, {"$lan", 0.0112082f}, {"$lang", 0.0106334f},
+	{"$ld", 0.0087079f}, {"$ld$", 0.00732843f}, {"$le", 0.0193413f},
+	{"$len", 0.00640878f}, {"$leng", 0.00566157f}, {"$li", 0.0546327f},
+	{"$lin", 0.0284228f}, {"$line", 0.0183354f}, {"$link", 0.0095988f},
+	{"$lis", 0.0135073f}, {"$list", 0.0132774f}, {"$lo", 0.0391424f},
+	{"$loc", 0.0154041f}, {"$loca", 0.0107196f}, {"$log", 0.00569031f},
+	{"$lon", 0.00528796f}, {"$long", 0.00525923f}, {"$lu", 0.00784573f},
+	{"$lu$", 0.00571905f}, {"$lx", 0.00603518f}, {"$lx$", 0.00603518f},
+	{"$m", 0.176371f}, {"$ma", 0.0617312f}, {"$mac", 0.00681113f},
+	{"$mak", 0.00563283f}, {"$man", 0.00833429f}, {"$mar", 0.00672491f},
+	{"$mat", 0.00844925f}, {"$matc", 0.00750086f}, {"$may", 0.00844925f},
+	{"$may$", 0.00770203f}, {"$me", 0.0319577f}, {"$mem", 0.00784573f},
+	{"$mer", 0.00686861f}, {"$merg", 0.00658122f}, {"$mes", 0.0063513f},
+	{"$mess", 0.00629383f}, {"$met", 0.00502931f}, {"$mi", 0.0250604f},
+	{"$mis", 0.0145706f}, {"$miss", 0.011783f}, {"$mo", 0.0326187f},
+	{"$mod", 0.0156915f}, {"$mode", 0.0108346f}, {"$mu", 0.0227612f},
+	{"$mul", 0.00773077f}, {"$mult", 0.00744338f}, {"$mus", 0.0143407f},
+	{"$must", 0.0140821f}, {"$n", 0.231348f}, {"$n$", 0.0103173f},
+	{"$na", 0.038194f}, {"$nam", 0.0344867f}, {"$name", 0.0339694f},
+	{"$ne", 0.0264973f}, {"$nee", 0.00520175f}, {"$need", 0.00517301f},
+	{"$new", 0.0123865f}, {"$new$", 0.00865042f}, {"$no", 0.149442f},
+	{"$no$", 0.0337108f}, {"$non", 0.0108921f}, {"$non$", 0.00770203f},
+	{"$nor", 0.00525923f}, {"$not", 0.0954995f}, {"$not$", 0.0879124f},
+	{"$note", 0.00612139f}, {"$nov", 0.00666743f}, {"$nova", 0.00632257f},
+	{"$nu", 0.0223589f}, {"$num", 0.0190827f}, {"$numb", 0.0163525f},
+	{"$o", 0.245373f}, {"$ob", 0.0179331f}, {"$obj", 0.0116967f},
+	{"$obje", 0.0115818f}, {"$of", 0.0899816f}, {"$of$", 0.0803541f},
+	{"$off", 0.0114668f}, {"$offs", 0.00896655f}, {"$ol", 0.00500057f},
+	{"$on", 0.0389987f}, {"$on$", 0.0167835f}, {"$one", 0.00790321f},
+	{"$one$", 0.00727095f}, {"$onl", 0.0158639f}, {"$only", 0.0156052f},
+	{"$op", 0.0619899f}, {"$ope", 0.0259225f}, {"$open", 0.0090815f},
+	{"$oper", 0.016841f}, {"$opt", 0.0303483f}, {"$opti", 0.0301471f},
+	{"$or", 0.0351765f}, {"$or$", 0.0293137f}, {"$ou", 0.0254914f},
+	{"$out", 0.0248304f}, {"$out$", 0.00994367f}, {"$outp", 0.0131912f},
+	{"$ov", 0.0106334f}, {"$ove", 0.0106334f}, {"$over", 0.0106334f},
+	{"$p", 0.207553f}, {"$p$", 0.0165536f}, {"$pa", 0.0656397f},
+	{"$pac", 0.0186516f}, {"$pack", 0.0185366f}, {"$par", 0.0134786f},
+	{"$pas", 0.00842051f}, {"$pass", 0.00764456f}, {"$pat", 0.0138234f},
+	{"$path", 0.00724221f}, {"$pb", 0.0198299f}, {"$pb$", 0.0197436f},
+	{"$pe", 0.0113806f}, {"$per", 0.00790321f}, {"$pi", 0.0101161f},
+	{"$pl", 0.0123003f}, {"$ple", 0.00592022f}, {"$plea", 0.00586274f},
+	{"$po", 0.0207208f}, {"$poi", 0.00502931f}, {"$poin", 0.00502931f},
+	{"$pos", 0.00678239f}, {"$pr", 0.0606679f}, {"$pre", 0.018163f},
+	{"$pri", 0.0127888f}, {"$prin", 0.00893781f}, {"$pro", 0.0307219f},
+	{"$proc", 0.00893781f}, {"$prog", 0.00569031f}, {"$pu", 0.00652374f},
+	{"$q", 0.0127026f}, {"$qu", 0.00781699f}, {"$r", 0.204765f},
+	{"$ra", 0.0158064f}, {"$ran", 0.011668f}, {"$rang", 0.0108633f},
+	{"$re", 0.16772f}, {"$rea", 0.0216404f}, {"$read", 0.0170422f},
+	{"$rec", 0.0125589f}, {"$reco", 0.00796069f}, {"$ref", 0.0128463f},
+	{"$refe", 0.00658122f}, {"$reg", 0.0254914f}, {"$regi", 0.0214105f},
+	{"$rel", 0.02279f}, {"$rela", 0.00580526f}, {"$relo", 0.0163525f},
+	{"$rem", 0.016841f}, {"$remo", 0.0152316f}, {"$rep", 0.0196287f},
+	{"$repo", 0.00669617f}, {"$repu", 0.00798942f}, {"$req", 0.0156627f},
+	{"$requ", 0.0155478f}, {"$res", 0.0151167f}, {"$ret", 0.00554661f},
+	{"$rev", 0.00574779f}, {"$ro", 0.00727095f}, {"$ru", 0.00977124f},
+	{"$run", 0.00609265f}, {"$s", 0.477785f}, {"$s$", 0.237067f},
+	{"$sa", 0.0198873f}, {"$sam", 0.00669617f}, {"$same", 0.00502931f},
+	{"$sc", 0.0101736f}, {"$se", 0.0835153f}, {"$sec", 0.0303771f},
+	{"$sect", 0.0236234f}, {"$sel", 0.00827681f}, {"$sele", 0.00609265f},
+	{"$ser", 0.00724221f}, {"$serv", 0.00554661f}, {"$set", 0.0217841f},
+	{"$set$", 0.0168985f}, {"$sh", 0.0268709f}, {"$sha", 0.00525923f},
+	{"$sho", 0.0134786f}, {"$show", 0.00706978f}, {"$si", 0.0378779f},
+	{"$sig", 0.0143695f}, {"$sign", 0.0139671f}, {"$siz", 0.0152604f},
+	{"$size", 0.0152604f}, {"$sk", 0.00560409f}, {"$so", 0.0250029f},
+	{"$sou", 0.0100011f}, {"$sour", 0.00793195f}, {"$sp", 0.0299747f},
+	{"$spa", 0.0054604f}, {"$spe", 0.0212668f}, {"$spec", 0.0206346f},
+	{"$st", 0.0585125f}, {"$sta", 0.0296011f}, {"$star", 0.0070123f},
+	{"$stat", 0.0125589f}, {"$sto", 0.005834f}, {"$str", 0.0151167f},
+	{"$stri", 0.00954133f}, {"$su", 0.0405219f}, {"$sub", 0.00939763f},
+	{"$sup", 0.0179331f}, {"$supp", 0.0172721f}, {"$sy", 0.038424f},
+	{"$sym", 0.0239108f}, {"$symb", 0.0209219f}, {"$syn", 0.00543166f},
+	{"$sys", 0.0085642f}, {"$syst", 0.00801816f}, {"$t", 0.29489f},
+	{"$t$", 0.0214392f}, {"$ta", 0.028509f}, {"$tab", 0.00741465f},
+	{"$tabl", 0.00600644f}, {"$tag", 0.00612139f}, {"$tar", 0.00911024f},
+	{"$targ", 0.00669617f}, {"$te", 0.0145994f}, {"$th", 0.112197f},
+	{"$tha", 0.0135073f}, {"$than", 0.00626509f}, {"$that", 0.00683987f},
+	{"$the", 0.0868203f}, {"$the$", 0.0816186f}, {"$thi", 0.0239108f},
+	{"$this", 0.0228475f}, {"$ti", 0.0113519f}, {"$tim", 0.00859294f},
+	{"$time", 0.00830555f}, {"$to", 0.127457f}, {"$to$", 0.107714f},
+	{"$too", 0.0133061f}, {"$too$", 0.0122428f}, {"$tr", 0.0256351f},
+	{"$tra", 0.00890907f}, {"$tre", 0.00543166f}, {"$tru", 0.00528796f},
+	{"$ty", 0.0202322f}, {"$typ", 0.0199448f}, {"$type", 0.0197436f},
+	{"$u", 0.167577f}, {"$u$", 0.0138522f}, {"$un", 0.0763881f},
+	{"$una", 0.0139096f}, {"$unab", 0.0125589f}, {"$und", 0.00505805f},
+	{"$une", 0.00589148f}, {"$unex", 0.00571905f}, {"$uni", 0.00623635f},
+	{"$unk", 0.015519f}, {"$unkn", 0.015519f}, {"$unr", 0.00686861f},
+	{"$unre", 0.00686861f}, {"$uns", 0.00842051f}, {"$unsu", 0.00523049f},
+	{"$up", 0.0140246f}, {"$upd", 0.00732843f}, {"$upda", 0.00732843f},
+	{"$ur", 0.00540292f}, {"$us", 0.0629095f}, {"$usa", 0.00603518f},
+	{"$usag", 0.00569031f}, {"$use", 0.0483389f}, {"$use$", 0.0236809f},
+	{"$used", 0.0108633f}, {"$user", 0.0118979f}, {"$usi", 0.00735717f},
+	{"$usin", 0.00735717f}, {"$v", 0.0710139f}, {"$va", 0.0316128f},
+	{"$val", 0.0268422f}, {"$vali", 0.00764456f}, {"$valu", 0.018709f},
+	{"$var", 0.00502931f}, {"$ve", 0.0233935f}, {"$ver", 0.0200023f},
+	{"$vers", 0.0150879f}, {"$vi", 0.00839177f}, {"$w", 0.119985f},
+	{"$wa", 0.0309518f}, {"$war", 0.0180768f}, {"$warn", 0.0162662f},
+	{"$was", 0.00577653f}, {"$was$", 0.00543166f}, {"$we", 0.00629383f},
+	{"$wh", 0.0193988f}, {"$whe", 0.0101736f}, {"$when", 0.00813312f},
+	{"$whi", 0.00807564f}, {"$wi", 0.0500345f}, {"$wil", 0.00629383f},
+	{"$will", 0.0059777f}, {"$wit", 0.0397747f}, {"$with", 0.0397747f},
+	{"$wo", 0.0108058f}, {"$wor", 0.00896655f}, {"$work", 0.00589148f},
+	{"$wr", 0.0137085f}, {"$wri", 0.0113231f}, {"$writ", 0.0112944f},
+	{"$x", 0.01618f}, {"$x$", 0.0111794f}, {"$y", 0.0241982f},
+	{"$yo", 0.0157777f}, {"$you", 0.0152891f}, {"$you$", 0.0123003f},
+	{"$z", 0.0133061f}, {"$ze", 0.00500057f}, {"0$", 0.0170709f},
+	{"00", 0.00543166f}, {"0s", 0.00609265f}, {"0s$", 0.00609265f},
+	{"0x", 0.0106909f}, {"0x$", 0.0100586f}, {"1$", 0.0112369f},
+	{"2$", 0.0142833f}, {"25", 0.00836303f}, {"250", 0.00557535f},
+	{"250s", 0.00543166f}, {"250s$", 0.00543166f}, {"3$", 0.0054604f},
+	{"32", 0.00571905f}, {"4$", 0.00853546f}, {"50", 0.00793195f},
+	{"50s", 0.00577653f}, {"50s$", 0.00577653f}, {"6$", 0.00773077f},
+	{"8$", 0.0059777f}, {"a$", 0.144097f}, {"ab", 0.0731406f},
+	{"abi", 0.00603518f}, {"abl", 0.0463559f}, {"able", 0.0447465f},
+	{"able$", 0.0410392f}, {"abo", 0.0053167f}, {"ac", 0.0889757f},
+	{"acc", 0.00850672f}, {"acce", 0.00589148f}, {"ace", 0.0122428f},
+	{"ace$", 0.00793195f}, {"ach", 0.014973f}, {"ach$", 0.00551788f},
+	{"ache", 0.00540292f}, {"ack", 0.0322738f}, {"ack$", 0.00844925f},
+	{"acka", 0.0149442f}, {"ackag", 0.0145706f}, {"act", 0.0191114f},
+	{"acte", 0.0102598f}, {"acter", 0.00994367f}, {"ad", 0.10073f},
+	{"ad$", 0.0394298f}, {"add", 0.0222439f}, {"add$", 0.00517301f},
+	{"addr", 0.0120129f}, {"addre", 0.0109495f}, {"ade", 0.0116393f},
+	{"ader", 0.00773077f}, {"ader$", 0.00660996f}, {"adi", 0.00793195f},
+	{"adin", 0.00617887f}, {"ading", 0.00589148f}, {"ads", 0.00801816f},
+	{"ads$", 0.00718473f}, {"ady", 0.00577653f}, {"ady$", 0.00566157f},
+	{"af", 0.0121278f}, {"aft", 0.00781699f}, {"afte", 0.00758708f},
+	{"after", 0.00755834f}, {"ag", 0.0726808f}, {"ag$", 0.00727095f},
+	{"aga", 0.00563283f}, {"age", 0.0495747f}, {"age$", 0.03259f},
+	{"ages", 0.0151742f}, {"ages$", 0.0150592f}, {"ai", 0.0688298f},
+	{"ail", 0.0381366f}, {"aile", 0.0258938f}, {"ailed", 0.025319f},
+	{"ain", 0.0219278f}, {"ain$", 0.0070123f}, {"ains", 0.00678239f},
+	{"aj", 0.00669617f}, {"ak", 0.0188815f}, {"ak$", 0.00500057f},
+	{"ake", 0.00732843f}, {"al", 0.195856f}, {"al$", 0.0513565f},
+	{"ala", 0.00528796f}, {"ali", 0.0606104f}, {"alid", 0.0463559f},
+	{"alid$", 0.0452926f}, {"all", 0.0439993f}, {"all$", 0.0166398f},
+	{"alle", 0.00632257f}, {"allo", 0.0133636f}, {"allow", 0.00994367f},
+	{"ally", 0.00640878f}, {"ally$", 0.00640878f}, {"alr", 0.00528796f},
+	{"alre", 0.00525923f}, {"alrea", 0.00525923f}, {"alt", 0.00603518f},
+	{"alu", 0.0198011f}, {"alue", 0.0187378f}, {"alue$", 0.0163525f},
+	{"am", 0.0851535f}, {"am$", 0.0121566f}, {"ame", 0.0537418f},
+	{"ame$", 0.0417289f}, {"ames", 0.00686861f}, {"ames$", 0.00586274f},
+	{"ami", 0.00672491f}, {"an", 0.252816f}, {"an$", 0.0724796f},
+	{"anc", 0.0148006f}, {"anch", 0.0103173f}, {"anch$", 0.0081906f},
+	{"and", 0.0795494f}, {"and$", 0.0594896f}, {"anda", 0.005834f},
+	{"andl", 0.00551788f}, {"ands", 0.00810438f}, {"ands$", 0.00790321f},
+	{"ang", 0.0412116f}, {"ange", 0.0243994f}, {"ange$", 0.016956f},
+	{"angu", 0.0113231f}, {"angua", 0.0106909f}, {"ani", 0.00905276f},
+	{"ann", 0.0297448f}, {"anno", 0.0280492f}, {"annot", 0.0279342f},
+	{"ans", 0.00594896f}, {"ant", 0.0133636f}, {"ant$", 0.00876538f},
+	{"any", 0.0106909f}, {"any$", 0.00925394f}, {"ap", 0.0322451f},
+	{"app", 0.0140246f}, {"appl", 0.0075296f}, {"appli", 0.00500057f},
+	{"ar", 0.180912f}, {"ar$", 0.013766f}, {"ara", 0.0223014f},
+	{"arac", 0.0101736f}, {"aract", 0.00994367f}, {"arc", 0.0207495f},
+	{"arch", 0.0191976f}, {"archi", 0.0151742f}, {"ard", 0.013536f},
+	{"ard$", 0.0097425f}, {"are", 0.0274169f}, {"are$", 0.0211231f},
+	{"arg", 0.0254052f}, {"arge", 0.0111507f}, {"arget", 0.00660996f},
+	{"argu", 0.0117542f}, {"argum", 0.0116967f}, {"ari", 0.0127313f},
+	{"aria", 0.0059777f}, {"arn", 0.0171859f}, {"arni", 0.0149442f},
+	{"arnin", 0.0148868f}, {"ars", 0.00689734f}, {"art", 0.0123577f},
+	{"art$", 0.00672491f}, {"ary", 0.0122715f}, {"ary$", 0.012214f},
+	{"as", 0.104696f}, {"as$", 0.0407805f}, {"ase", 0.0206058f},
+	{"ase$", 0.0176744f}, {"ash", 0.00853546f}, {"ash$", 0.00594896f},
+	{"ass", 0.0188815f}, {"ast", 0.0144557f}, {"ast$", 0.0118117f},
+	{"at", 0.232441f}, {"at$", 0.0400046f}, {"ata", 0.0197724f},
+	{"ata$", 0.0136223f}, {"atc", 0.014858f}, {"atch", 0.014858f},
+	{"atch$", 0.00913898f}, {"ate", 0.0737154f}, {"ate$", 0.0487125f},
+	{"ated", 0.0156915f}, {"ated$", 0.015634f}, {"ath", 0.00911024f},
+	{"ath$", 0.00609265f}, {"ati", 0.0758708f}, {"atin", 0.00948385f},
+	{"ating", 0.00787447f}, {"atio", 0.0538568f}, {"ation", 0.0537705f},
+	{"ativ", 0.00704104f}, {"ative", 0.00683987f}, {"ato", 0.00554661f},
+	{"att", 0.0121566f}, {"atte", 0.00617887f}, {"attr", 0.00517301f},
+	{"atu", 0.0144269f}, {"atur", 0.00879411f}, {"ature", 0.00844925f},
+	{"atus", 0.00514427f}, {"atus$", 0.00511553f}, {"au", 0.0375905f},
+	{"aul", 0.0135648f}, {"ault", 0.0131337f}, {"ault$", 0.0120991f},
+	{"aus", 0.00505805f}, {"aut", 0.0113231f}, {"auth", 0.00617887f},
+	{"authe", 0.00517301f}, {"av", 0.0228475f}, {"ava", 0.00643752f},
+	{"ave", 0.0100874f}, {"ave$", 0.00833429f}, {"aw", 0.00502931f},
+	{"ax", 0.010461f}, {"ax$", 0.00738591f}, {"ay", 0.0269284f},
+	{"ay$", 0.0184791f}, {"b$", 0.0376193f}, {"ba", 0.0444304f},
+	{"bac", 0.00620761f}, {"back", 0.00600644f}, {"bad", 0.0105185f},
+	{"bad$", 0.00977124f}, {"bas", 0.0113519f}, {"base", 0.00942637f},
+	{"base$", 0.00764456f}, {"be", 0.0780262f}, {"be$", 0.0350902f},
+	{"bel", 0.00586274f}, {"ber", 0.022014f}, {"ber$", 0.017502f},
+	{"bi", 0.037102f}, {"bin", 0.00781699f}, {"bit", 0.0127601f},
+	{"bit$", 0.00879411f}, {"bj", 0.0122715f}, {"bje", 0.0120704f},
+	{"bjec", 0.0120129f}, {"bject", 0.0120129f}, {"bl", 0.0802104f},
+	{"bla", 0.00620761f}, {"ble", 0.0554087f}, {"ble$", 0.0478216f},
+	{"bli", 0.0125589f}, {"blic", 0.00951259f}, {"blic$", 0.00939763f},
+	{"bo", 0.0408955f}, {"bol", 0.0219565f}, {"bol$", 0.0147718f},
+	{"br", 0.0229624f}, {"bra", 0.0148868f}, {"bran", 0.00979998f},
+	{"branc", 0.0095988f}, {"bs", 0.0106047f}, {"bu", 0.0352914f},
+	{"bug", 0.00778825f}, {"bug$", 0.00589148f}, {"but", 0.0148006f},
+	{"but$", 0.00905276f}, {"bute", 0.0054604f}, {"by", 0.0258076f},
+	{"by$", 0.0163812f}, {"byt", 0.00885159f}, {"byte", 0.00885159f},
+	{"c$", 0.0711001f}, {"ca", 0.127342f}, {"cal", 0.018278f},
+	{"cal$", 0.00773077f}, {"call", 0.00663869f}, {"can", 0.048109f},
+	{"can$", 0.0171859f}, {"cann", 0.0277906f}, {"canno", 0.0275319f},
+	{"car", 0.00517301f}, {"cat", 0.0471893f}, {"cate", 0.0191401f},
+	{"cate$", 0.0117542f}, {"cati", 0.0277618f}, {"catio", 0.0264973f},
+	{"cc", 0.0132199f}, {"cce", 0.00770203f}, {"ce", 0.0809001f},
+	{"ce$", 0.0365272f}, {"ced", 0.00520175f}, {"cer", 0.0070123f},
+	{"cert", 0.00675365f}, {"certi", 0.00609265f}, {"ces", 0.0204046f},
+	{"ces$", 0.00606392f}, {"cess", 0.0137085f}, {"cess$", 0.00750086f},
+	{"ch", 0.117255f}, {"ch$", 0.0388263f}, {"cha", 0.0296586f},
+	{"chan", 0.0144557f}, {"chang", 0.0135935f}, {"char", 0.0114668f},
+	{"chara", 0.00994367f}, {"che", 0.0240545f}, {"chec", 0.00824807f},
+	{"check", 0.00807564f}, {"chi", 0.025319f}, {"chin", 0.00724221f},
+	{"chit", 0.00520175f}, {"chite", 0.00520175f}, {"chiv", 0.00957007f},
+	{"chive", 0.00957007f}, {"ci", 0.0344867f}, {"cif", 0.0179618f},
+	{"cifi", 0.0137085f}, {"cifie", 0.0095988f}, {"ck", 0.0549201f},
+	{"ck$", 0.0211231f}, {"cka", 0.0150592f}, {"ckag", 0.0145706f},
+	{"ckage", 0.0143695f}, {"cke", 0.00738591f}, {"cl", 0.0188527f},
+	{"clo", 0.0059777f}, {"clu", 0.00508679f}, {"co", 0.168813f},
+	{"cod", 0.0181917f}, {"code", 0.0166111f}, {"code$", 0.0140533f},
+	{"cog", 0.00609265f}, {"cogn", 0.00606392f}, {"cogni", 0.00606392f},
+	{"col", 0.0063513f}, {"com", 0.0496609f}, {"comm", 0.0279342f},
+	{"comma", 0.0140246f}, {"commi", 0.00899529f}, {"comp", 0.0191114f},
+	{"compa", 0.00540292f}, {"con", 0.0570468f}, {"cond", 0.0063513f},
+	{"conf", 0.0120416f}, {"confi", 0.00678239f}, {"cons", 0.00839177f},
+	{"const", 0.00514427f}, {"cont", 0.0230486f}, {"conta", 0.00850672f},
+	{"conte", 0.0081906f}, {"contr", 0.00497184f}, {"cop", 0.00508679f},
+	{"cor", 0.0176744f}, {"cord", 0.00566157f}, {"corr", 0.00844925f},
+	{"corru", 0.00508679f}, {"cou", 0.0205196f}, {"coul", 0.0131912f},
+	{"could", 0.0131912f}, {"coun", 0.00712726f}, {"count", 0.00712726f},
+	{"cr", 0.0400046f}, {"cre", 0.0208932f}, {"crea", 0.0151167f},
+	{"creat", 0.0146281f}, {"cri", 0.00727095f}, {"crip", 0.00574779f},
+	{"cript", 0.00574779f}, {"cs", 0.00658122f}, {"ct", 0.145821f},
+	{"ct$", 0.0261812f}, {"cte", 0.0317853f}, {"cted", 0.0223302f},
+	{"cted$", 0.0218703f}, {"cter", 0.00997241f}, {"cter$", 0.00629383f},
+	{"cti", 0.0609265f}, {"ctio", 0.0503506f}, {"ction", 0.0503506f},
+	{"ctiv", 0.00686861f}, {"ctive", 0.00623635f}, {"cto", 0.0184791f},
+	{"ctor", 0.0183067f}, {"ctory", 0.0141396f}, {"cts", 0.00632257f},
+	{"cts$", 0.00626509f}, {"ctu", 0.00727095f}, {"ctur", 0.00655248f},
+	{"cture", 0.00643752f}, {"cu", 0.0257213f}, {"cum", 0.00528796f},
+	{"cur", 0.012444f}, {"curr", 0.00689734f}, {"curre", 0.00686861f},
+	{"cut", 0.00523049f}, {"d$", 0.417749f}, {"da", 0.047994f},
+	{"dar", 0.00606392f}, {"dat", 0.0274744f}, {"data", 0.0158639f},
+	{"data$", 0.0131337f}, {"date", 0.0102311f}, {"date$", 0.00732843f},
+	{"dd", 0.0254627f}, {"dd$", 0.00617887f}, {"ddr", 0.0120129f},
+	{"ddre", 0.0109495f}, {"ddres", 0.0109495f}, {"de", 0.150707f},
+	{"de$", 0.0383665f}, {"deb", 0.00830555f}, {"debu", 0.00612139f},
+	{"debug", 0.00609265f}, {"ded", 0.0123003f}, {"ded$", 0.0120991f},
+	{"def", 0.0240545f}, {"defa", 0.0127601f}, {"defau", 0.0127601f},
+	{"defi", 0.00945511f}, {"defin", 0.00945511f}, {"del", 0.00968502f},
+	{"den", 0.0100011f}, {"dep", 0.00747212f}, {"der", 0.0174445f},
+	{"der$", 0.0116105f}, {"des", 0.0142833f}, {"det", 0.00586274f},
+	{"dex", 0.0114956f}, {"dex$", 0.0100874f}, {"di", 0.101678f},
+	{"dia", 0.0115818f}, {"diat", 0.00543166f}, {"diate", 0.00537418f},
+	{"dif", 0.00916772f}, {"diff", 0.00626509f}, {"din", 0.020146f},
+	{"ding", 0.0166686f}, {"ding$", 0.0164387f}, {"dir", 0.0275606f},
+	{"dire", 0.0242557f}, {"direc", 0.0241694f}, {"dis", 0.0165536f},
+	{"disa", 0.00554661f}, {"disp", 0.00525923f}, {"dit", 0.00787447f},
+	{"dl", 0.0115818f}, {"dle", 0.00678239f}, {"do", 0.0537131f},
+	{"do$", 0.0135935f}, {"doe", 0.0133349f}, {"does", 0.0133349f},
+	{"does$", 0.0109208f}, {"don", 0.00761582f}, {"dow", 0.00517301f},
+	{"dr", 0.0173008f}, {"dre", 0.0116393f}, {"dres", 0.0109495f},
+	{"dress", 0.0109495f}, {"ds", 0.0308944f}, {"ds$", 0.0266123f},
+	{"du", 0.0191689f}, {"dy", 0.0102598f}, {"dy$", 0.00643752f},
+	{"e$", 0.506294f}, {"ea", 0.0975399f}, {"eac", 0.0054604f},
+	{"each", 0.00537418f}, {"ead", 0.0416427f}, {"ead$", 0.0225026f},
+	{"eade", 0.00750086f}, {"eader", 0.00741465f}, {"eady", 0.00563283f},
+	{"eady$", 0.00563283f}, {"eam", 0.00520175f}, {"ean", 0.00523049f},
+	{"ear", 0.00589148f}, {"eas", 0.011783f}, {"ease", 0.00747212f},
+	{"ease$", 0.00718473f}, {"eat", 0.0194275f}, {"eate", 0.0134211f},
+	{"eate$", 0.00954133f}, {"eb", 0.0140821f}, {"ebu", 0.00640878f},
+	{"ebug", 0.00609265f}, {"ebug$", 0.00497184f}, {"ec", 0.166686f},
+	{"eci", 0.0228475f}, {"ecif", 0.0178469f}, {"ecifi", 0.013651f},
+	{"eck", 0.0085642f}, {"eco", 0.0181343f}, {"ecog", 0.00606392f},
+	{"ecogn", 0.00606392f}, {"ecor", 0.00500057f}, {"ect", 0.101219f},
+	{"ect$", 0.0210369f}, {"ecte", 0.0215255f}, {"ected", 0.0215255f},
+	{"ecti", 0.0353202f}, {"ectio", 0.0279342f}, {"ecto", 0.0178181f},
+	{"ector", 0.0178181f}, {"ectu", 0.00523049f}, {"ectur", 0.00520175f},
+	{"ecu", 0.00971376f}, {"ed", 0.242068f}, {"ed$", 0.224997f},
+	{"ede", 0.00557535f}, {"edi", 0.0139384f}, {"edia", 0.00704104f},
+	{"ediat", 0.00540292f}, {"ee", 0.0334521f}, {"ee$", 0.0102311f},
+	{"eed", 0.00865042f}, {"een", 0.00663869f}, {"een$", 0.0059777f},
+	{"ef", 0.0506955f}, {"efa", 0.0128176f}, {"efau", 0.0127601f},
+	{"efaul", 0.0127601f}, {"efe", 0.00913898f}, {"efer", 0.00899529f},
+	{"efere", 0.0075296f}, {"efi", 0.0133636f}, {"efin", 0.00951259f},
+	{"efine", 0.00724221f}, {"efo", 0.00537418f}, {"efor", 0.00537418f},
+	{"efore", 0.00508679f}, {"eg", 0.0437981f}, {"ega", 0.00632257f},
+	{"egi", 0.023336f}, {"egis", 0.0198873f}, {"egist", 0.0198873f},
+	{"ei", 0.00934015f}, {"el", 0.0885447f}, {"el$", 0.0140246f},
+	{"ela", 0.00896655f}, {"eld", 0.00842051f}, {"eld$", 0.0075296f},
+	{"ele", 0.0168123f}, {"elec", 0.00643752f}, {"elect", 0.00643752f},
+	{"eli", 0.00528796f}, {"ell", 0.00580526f}, {"elo", 0.0191114f},
+	{"eloc", 0.0164961f}, {"eloca", 0.0118404f}, {"em", 0.0751523f},
+	{"em$", 0.0141396f}, {"ema", 0.0070123f}, {"emb", 0.00729969f},
+	{"eme", 0.0107484f}, {"emen", 0.00931142f}, {"ement", 0.00905276f},
+	{"emo", 0.0223014f}, {"emov", 0.0113519f}, {"emove", 0.00859294f},
+	{"emp", 0.0125877f}, {"empt", 0.00781699f}, {"empty", 0.00560409f},
+	{"en", 0.199477f}, {"en$", 0.038309f}, {"ena", 0.0123865f},
+	{"enab", 0.00500057f}, {"enabl", 0.00500057f}, {"enam", 0.00580526f},
+	{"ename", 0.00543166f}, {"enc", 0.0236521f}, {"ence", 0.0109783f},
+	{"ence$", 0.00744338f}, {"end", 0.0268709f}, {"end$", 0.0133061f},
+	{"ende", 0.00721347f}, {"ene", 0.0126451f}, {"ener", 0.00994367f},
+	{"enera", 0.00925394f}, {"eng", 0.00954133f}, {"engt", 0.00566157f},
+	{"ength", 0.00566157f}, {"ens", 0.00764456f}, {"ent", 0.0842051f},
+	{"ent$", 0.0473618f}, {"ente", 0.00520175f}, {"enti", 0.0095988f},
+	{"entic", 0.00540292f}, {"entr", 0.0102311f}, {"entry", 0.00724221f},
+	{"ents", 0.0102311f}, {"ents$", 0.0097425f}, {"eo", 0.00833429f},
+	{"ep", 0.0392574f}, {"epe", 0.00571905f}, {"epo", 0.00735717f},
+	{"epu", 0.0080469f}, {"epub", 0.00798942f}, {"epubl", 0.00798942f},
+	{"eq", 0.0202897f}, {"equ", 0.0199161f}, {"equi", 0.0142258f},
+	{"equir", 0.0127888f}, {"er", 0.287705f}, {"er$", 0.117858f},
+	{"era", 0.0320727f}, {"eran", 0.0131912f}, {"erand", 0.0129038f},
+	{"erat", 0.0129325f}, {"erate", 0.00727095f}, {"ere", 0.0229624f},
+	{"ere$", 0.00675365f}, {"eren", 0.0103748f}, {"erenc", 0.00793195f},
+	{"erf", 0.00606392f}, {"erg", 0.00790321f}, {"erge", 0.00672491f},
+	{"erge$", 0.00528796f}, {"eri", 0.0106334f}, {"erm", 0.0115818f},
+	{"ermi", 0.00793195f}, {"ern", 0.0174733f}, {"ern$", 0.00534544f},
+	{"erna", 0.00934015f}, {"ernal", 0.00643752f}, {"ero", 0.00675365f},
+	{"err", 0.0407518f}, {"erro", 0.0324463f}, {"error", 0.0323026f},
+	{"ers", 0.0380216f}, {"ers$", 0.0170134f}, {"ersi", 0.0170709f},
+	{"ersio", 0.0165536f}, {"ert", 0.016956f}, {"erti", 0.00750086f},
+	{"ertif", 0.00609265f}, {"erv", 0.00913898f}, {"erve", 0.00747212f},
+	{"erver", 0.00554661f}, {"es", 0.202006f}, {"es$", 0.116048f},
+	{"esc", 0.00609265f}, {"ese", 0.012875f}, {"ese$", 0.00577653f},
+	{"eso", 0.00617887f}, {"esp", 0.0053167f}, {"ess", 0.0495172f},
+	{"ess$", 0.0224164f}, {"essa", 0.00689734f}, {"essag", 0.00617887f},
+	{"esse", 0.00566157f}, {"essi", 0.0139384f}, {"essio", 0.00965628f},
+	{"est", 0.018824f}, {"est$", 0.00586274f}, {"et", 0.0973675f},
+	{"et$", 0.0492011f}, {"eta", 0.00681113f}, {"ete", 0.0139096f},
+	{"ett", 0.00704104f}, {"ev", 0.0256926f}, {"eve", 0.0126739f},
+	{"evi", 0.00790321f}, {"ew", 0.0163525f}, {"ew$", 0.0100011f},
+	{"ex", 0.0891482f}, {"ex$", 0.0133923f}, {"exc", 0.00528796f},
+	{"exe", 0.00683987f}, {"exec", 0.00543166f}, {"exi", 0.0127026f},
+	{"exis", 0.00781699f}, {"exist", 0.00781699f}, {"exp", 0.033682f},
+	{"expe", 0.0177607f}, {"expec", 0.0174445f}, {"expr", 0.00787447f},
+	{"expre", 0.00758708f}, {"ext", 0.018278f}, {"ext$", 0.00787447f},
+	{"exte", 0.00689734f}, {"exten", 0.00600644f}, {"ey", 0.0280492f},
+	{"ey$", 0.0190827f}, {"eys", 0.00571905f}, {"f$", 0.115502f},
+	{"fa", 0.0478503f}, {"fai", 0.0275032f}, {"fail", 0.0275032f},
+	{"faile", 0.0250316f}, {"fau", 0.0130762f}, {"faul", 0.0130762f},
+	{"fault", 0.0130762f}, {"fe", 0.0232498f}, {"fer", 0.0147431f},
+	{"fere", 0.0104322f}, {"feren", 0.0101161f}, {"ff", 0.028509f},
+	{"ff$", 0.00672491f}, {"ffe", 0.00695482f}, {"ffer", 0.00514427f},
+	{"ffi", 0.00502931f}, {"ffs", 0.00925394f}, {"ffse", 0.00893781f},
+	{"ffset", 0.00893781f}, {"fi", 0.145879f}, {"fic", 0.0131624f},
+	{"fica", 0.00911024f}, {"ficat", 0.00888033f}, {"fie", 0.0212093f},
+	{"fied", 0.011007f}, {"fied$", 0.011007f}, {"fiel", 0.00807564f},
+	{"field", 0.00807564f}, {"fig", 0.00672491f}, {"fil", 0.0816186f},
+	{"file", 0.0793769f}, {"file$", 0.0635705f}, {"files", 0.015519f},
+	{"fin", 0.018709f}, {"find", 0.00505805f}, {"fine", 0.00727095f},
+	{"fined", 0.00580526f}, {"fir", 0.00557535f}, {"firs", 0.00511553f},
+	{"first", 0.00511553f}, {"fix", 0.00928268f}, {"fix$", 0.0059777f},
+	{"fl", 0.0190827f}, {"fla", 0.00620761f}, {"flag", 0.0053167f},
+	{"flo", 0.00764456f}, {"fo", 0.114122f}, {"fo$", 0.00741465f},
+	{"fol", 0.00615013f}, {"foll", 0.00563283f}, {"follo", 0.00563283f},
+	{"for", 0.0938901f}, {"for$", 0.0642603f}, {"fore", 0.00554661f},
+	{"fore$", 0.00508679f}, {"form", 0.0243131f}, {"forma", 0.0185366f},
+	{"fou", 0.00988619f}, {"foun", 0.00962754f}, {"found", 0.00962754f},
+	{"fr", 0.02917f}, {"fro", 0.0190252f}, {"from", 0.0185654f},
+	{"from$", 0.0185654f}, {"fs", 0.0127026f}, {"fse", 0.00899529f},
+	{"fset", 0.00893781f}, {"fset$", 0.00853546f}, {"ft", 0.0179618f},
+	{"ft$", 0.00502931f}, {"fte", 0.00787447f}, {"fter", 0.00758708f},
+	{"fter$", 0.00758708f}, {"fu", 0.0130762f}, {"fun", 0.00551788f},
+	{"func", 0.0054604f}, {"fy", 0.00744338f}, {"fy$", 0.00643752f},
+	{"g$", 0.182147f}, {"ga", 0.0243419f}, {"ge", 0.121738f},
+	{"ge$", 0.0587424f}, {"ged", 0.00615013f}, {"ged$", 0.00600644f},
+	{"gen", 0.011668f}, {"gene", 0.00988619f}, {"gener", 0.00982872f},
+	{"ger", 0.0114956f}, {"ger$", 0.00603518f}, {"ges", 0.0216117f},
+	{"ges$", 0.020031f}, {"get", 0.0147143f}, {"get$", 0.0103173f},
+	{"gg", 0.00669617f}, {"gh", 0.00965628f}, {"gi", 0.0589723f},
+	{"gin", 0.0110358f}, {"gis", 0.0200885f}, {"gist", 0.0199161f},
+	{"giste", 0.0197436f}, {"git", 0.0143695f}, {"git$", 0.012329f},
+	{"giv", 0.00586274f}, {"give", 0.00525923f}, {"gl", 0.00979998f},
+	{"gn", 0.0452351f}, {"gna", 0.0108921f}, {"gnat", 0.00729969f},
+	{"gnatu", 0.00692608f}, {"gni", 0.00695482f}, {"gniz", 0.00511553f},
+	{"gnize", 0.00502931f}, {"gno", 0.0127026f}, {"gnor", 0.0122428f},
+	{"gnore", 0.00896655f}, {"gnu", 0.00502931f}, {"go", 0.01618f},
+	{"gr", 0.0267847f}, {"gra", 0.0108058f}, {"gram", 0.00523049f},
+	{"gro", 0.00885159f}, {"grou", 0.0081906f}, {"group", 0.00770203f},
+	{"gs", 0.0139096f}, {"gs$", 0.0108633f}, {"gt", 0.00678239f},
+	{"gth", 0.00569031f}, {"gth$", 0.00554661f}, {"gu", 0.0379929f},
+	{"gua", 0.0125589f}, {"guag", 0.0106909f}, {"guage", 0.0106909f},
+	{"gum", 0.0118117f}, {"gume", 0.0116967f}, {"gumen", 0.0116967f},
+	{"h$", 0.114237f}, {"ha", 0.0876538f}, {"han", 0.0290551f},
+	{"han$", 0.00715599f}, {"hand", 0.00592022f}, {"handl", 0.00543166f},
+	{"hang", 0.014197f}, {"hange", 0.0127888f}, {"har", 0.0181917f},
+	{"hara", 0.0103173f}, {"harac", 0.00994367f}, {"has", 0.0149155f},
+	{"has$", 0.0120416f}, {"hat", 0.00862168f}, {"hat$", 0.00833429f},
+	{"hav", 0.00706978f}, {"have", 0.00580526f}, {"have$", 0.00571905f},
+	{"he", 0.144729f}, {"he$", 0.084981f}, {"hea", 0.0110645f},
+	{"head", 0.0108346f}, {"heade", 0.00712726f}, {"hec", 0.00824807f},
+	{"heck", 0.00807564f}, {"hed", 0.00514427f}, {"hel", 0.00830555f},
+	{"hen", 0.0160363f}, {"hen$", 0.00988619f}, {"hent", 0.00534544f},
+	{"henti", 0.00517301f}, {"her", 0.0199448f}, {"her$", 0.00905276f},
+	{"here", 0.00646626f}, {"here$", 0.00569031f}, {"hes", 0.00560409f},
+	{"hi", 0.0761007f}, {"hic", 0.00511553f}, {"hil", 0.00655248f},
+	{"hin", 0.0142833f}, {"hing", 0.00793195f}, {"hing$", 0.00775951f},
+	{"his", 0.0239108f}, {"his$", 0.0228762f}, {"hit", 0.00686861f},
+	{"hite", 0.00620761f}, {"hitec", 0.00520175f}, {"hiv", 0.00971376f},
+	{"hive", 0.00965628f}, {"hive$", 0.0087079f}, {"ho", 0.0391712f},
+	{"hou", 0.0104897f}, {"hout", 0.00589148f}, {"hout$", 0.00586274f},
+	{"how", 0.00844925f}, {"how$", 0.0076733f}, {"hr", 0.00643752f},
+	{"ht", 0.00683987f}, {"hu", 0.00982872f}, {"i$", 0.0360961f},
+	{"ia", 0.057018f}, {"ia$", 0.0114956f}, {"ial", 0.00839177f},
+	{"ial$", 0.00511553f}, {"ian", 0.0214967f}, {"ian$", 0.0196f},
+	{"iat", 0.00850672f}, {"iate", 0.00741465f}, {"iate$", 0.00514427f},
+	{"ib", 0.023451f}, {"ibl", 0.00511553f}, {"ibu", 0.00594896f},
+	{"ibut", 0.005834f}, {"ibute", 0.00540292f}, {"ic", 0.0893494f},
+	{"ic$", 0.0343718f}, {"ica", 0.0283941f}, {"icat", 0.0217554f},
+	{"icate", 0.0106047f}, {"icati", 0.0113519f}, {"ice", 0.00793195f},
+	{"ice$", 0.00543166f}, {"ich", 0.00511553f}, {"ict", 0.00678239f},
+	{"id", 0.0817048f}, {"id$", 0.0571043f}, {"ide", 0.0149155f},
+	{"ide$", 0.00744338f}, {"ie", 0.0462409f}, {"ied", 0.0138234f},
+	{"ied$", 0.0136797f}, {"iel", 0.00839177f}, {"ield", 0.00810438f},
+	{"ield$", 0.00727095f}, {"ies", 0.0111507f}, {"ies$", 0.0110358f},
+	{"if", 0.0495459f}, {"if$", 0.0108058f}, {"iff", 0.00652374f},
+	{"ifi", 0.0250316f}, {"ific", 0.0118117f}, {"ifica", 0.00911024f},
+	{"ifie", 0.0132199f}, {"ified", 0.0109495f}, {"ify", 0.00712726f},
+	{"ify$", 0.00612139f}, {"ig", 0.0572767f}, {"ig$", 0.00660996f},
+	{"ign", 0.0333946f}, {"igna", 0.0102311f}, {"ignat", 0.00724221f},
+	{"igno", 0.0122428f}, {"ignor", 0.0122428f}, {"igu", 0.00615013f},
+	{"ik", 0.00660996f}, {"il", 0.148293f}, {"ila", 0.00603518f},
+	{"ild", 0.00508679f}, {"ile", 0.107656f}, {"ile$", 0.0674503f},
+	{"iled", 0.0265548f}, {"iled$", 0.0264973f}, {"iles", 0.0156052f},
+	{"iles$", 0.0149155f}, {"ili", 0.00692608f}, {"ill", 0.014312f},
+	{"ill$", 0.00830555f}, {"im", 0.0446603f}, {"ima", 0.00873664f},
+	{"imag", 0.0053167f}, {"image", 0.0053167f}, {"ime", 0.0115531f},
+	{"ime$", 0.00718473f}, {"imi", 0.00525923f}, {"imm", 0.00569031f},
+	{"imme", 0.00508679f}, {"immed", 0.00508679f}, {"imp", 0.00899529f},
+	{"in", 0.385878f}, {"in$", 0.0868203f}, {"ina", 0.0164387f},
+	{"inat", 0.00672491f}, {"inc", 0.0102598f}, {"ind", 0.028509f},
+	{"ind$", 0.00747212f}, {"inde", 0.0125589f}, {"index", 0.0113806f},
+	{"indi", 0.00609265f}, {"ine", 0.0398896f}, {"ine$", 0.0248879f},
+	{"ined", 0.0075296f}, {"ined$", 0.0075296f}, {"ines", 0.00560409f},
+	{"inf", 0.0145994f}, {"info", 0.0141108f}, {"info$", 0.00712726f},
+	{"infor", 0.00718473f}, {"ing", 0.154127f}, {"ing$", 0.144959f},
+	{"ini", 0.0118692f}, {"init", 0.00514427f}, {"ink", 0.0132774f},
+	{"ink$", 0.00787447f}, {"inp", 0.0104035f}, {"inpu", 0.0103173f},
+	{"input", 0.0103173f}, {"ins", 0.0412404f}, {"ins$", 0.00520175f},
+	{"inst", 0.0299747f}, {"insta", 0.00712726f}, {"inste", 0.00520175f},
+	{"instr", 0.0149155f}, {"int", 0.0409242f}, {"int$", 0.0153179f},
+	{"inte", 0.0179331f}, {"inter", 0.0136797f}, {"inv", 0.0401196f},
+	{"inva", 0.0390275f}, {"inval", 0.0390275f}, {"io", 0.17571f},
+	{"ion", 0.16795f}, {"ion$", 0.139499f}, {"iona", 0.00586274f},
+	{"ional", 0.00548914f}, {"ions", 0.0313542f}, {"ions$", 0.031268f},
+	{"ip", 0.0296873f}, {"ip$", 0.00557535f}, {"ipl", 0.00606392f},
+	{"iple", 0.00534544f}, {"iple$", 0.00502931f}, {"ipt", 0.005834f},
+	{"ir", 0.063628f}, {"ir$", 0.00612139f}, {"ire", 0.0431946f},
+	{"ire$", 0.00560409f}, {"irec", 0.0241694f}, {"irect", 0.0241694f},
+	{"ired", 0.00888033f}, {"ired$", 0.00879411f}, {"irs", 0.00592022f},
+	{"irst", 0.00523049f}, {"irst$", 0.00511553f}, {"is", 0.17321f},
+	{"is$", 0.0851535f}, {"isa", 0.00775951f}, {"ish", 0.00911024f},
+	{"ish$", 0.00773077f}, {"isp", 0.00548914f}, {"ispl", 0.00497184f},
+	{"ispla", 0.00497184f}, {"iss", 0.0158352f}, {"issi", 0.013536f},
+	{"issin", 0.0116393f}, {"ist", 0.0473043f}, {"ist$", 0.0149155f},
+	{"iste", 0.0223014f}, {"ister", 0.0198011f}, {"it", 0.155909f},
+	{"it$", 0.0522761f}, {"ite", 0.0222439f}, {"ite$", 0.00842051f},
+	{"itec", 0.00586274f}, {"itect", 0.00520175f}, {"ith", 0.044258f},
+	{"ith$", 0.0334809f}, {"itho", 0.00586274f}, {"ithou", 0.00586274f},
+	{"iti", 0.0202897f}, {"itin", 0.0054604f}, {"iting", 0.00534544f},
+	{"itio", 0.00867916f}, {"ition", 0.00867916f}, {"ito", 0.00580526f},
+	{"itor", 0.00525923f}, {"its", 0.0085642f}, {"its$", 0.00761582f},
+	{"itt", 0.0063513f}, {"ity", 0.0087079f}, {"ity$", 0.0085642f},
+	{"iv", 0.0410392f}, {"ive", 0.0347454f}, {"ive$", 0.0252903f},
+	{"ix", 0.0127313f}, {"ix$", 0.00847799f}, {"iz", 0.0271296f},
+	{"ize", 0.0241982f}, {"ize$", 0.0173583f}, {"ized", 0.00620761f},
+	{"ized$", 0.00620761f}, {"ja", 0.0113519f}, {"ja$", 0.00543166f},
+	{"je", 0.0147718f}, {"jec", 0.0138522f}, {"ject", 0.0138522f},
+	{"ject$", 0.0100011f}, {"k$", 0.0548052f}, {"ka", 0.0320439f},
+	{"ka$", 0.00560409f}, {"kag", 0.0154041f}, {"kage", 0.0147718f},
+	{"kage$", 0.0103748f}, {"ke", 0.052506f}, {"ke$", 0.00830555f},
+	{"ked", 0.00683987f}, {"ked$", 0.00683987f}, {"key", 0.0247442f},
+	{"key$", 0.0173871f}, {"keys", 0.00571905f}, {"ki", 0.0261524f},
+	{"kin", 0.0118692f}, {"king", 0.0108346f}, {"king$", 0.00954133f},
+	{"kn", 0.0175882f}, {"kno", 0.0169847f}, {"know", 0.0169847f},
+	{"known", 0.0165536f}, {"ko", 0.00695482f}, {"kr", 0.00528796f},
+	{"ks", 0.0101736f}, {"ks$", 0.0059777f}, {"ku", 0.00660996f},
+	{"l$", 0.131596f}, {"la", 0.0972526f}, {"lab", 0.00816186f},
+	{"lac", 0.00543166f}, {"lag", 0.00592022f}, {"lan", 0.0191114f},
+	{"land", 0.00540292f}, {"lang", 0.0109208f}, {"langu", 0.0106909f},
+	{"lar", 0.0107484f}, {"las", 0.012214f}, {"last", 0.00827681f},
+	{"last$", 0.00801816f}, {"lat", 0.0155765f}, {"late", 0.00508679f},
+	{"lati", 0.00853546f}, {"lay", 0.00744338f}, {"ld", 0.0475055f},
+	{"ld$", 0.0401196f}, {"le", 0.233159f}, {"le$", 0.130705f},
+	{"lea", 0.0134211f}, {"leas", 0.00879411f}, {"lease", 0.00729969f},
+	{"lec", 0.00698356f}, {"lect", 0.00678239f}, {"led", 0.0365559f},
+	{"led$", 0.036326f}, {"lem", 0.00885159f}, {"leme", 0.00554661f},
+	{"lemen", 0.00520175f}, {"len", 0.0120704f}, {"leng", 0.00574779f},
+	{"lengt", 0.00566157f}, {"les", 0.0256064f}, {"les$", 0.0204621f},
+	{"let", 0.00934015f}, {"lete", 0.00620761f}, {"lf", 0.00747212f},
+	{"li", 0.165939f}, {"lib", 0.00517301f}, {"lic", 0.0261524f},
+	{"lic$", 0.0121278f}, {"lica", 0.006495f}, {"licat", 0.00617887f},
+	{"lid", 0.0467008f}, {"lid$", 0.0454363f}, {"lig", 0.00551788f},
+	{"lin", 0.0446603f}, {"line", 0.0224451f}, {"line$", 0.0182205f},
+	{"ling", 0.00738591f}, {"ling$", 0.00655248f}, {"link", 0.0127888f},
+	{"link$", 0.00778825f}, {"lis", 0.0185366f}, {"list", 0.0146281f},
+	{"list$", 0.0119554f}, {"lit", 0.00850672f}, {"ll", 0.0748649f},
+	{"ll$", 0.0329061f}, {"lle", 0.0118692f}, {"llo", 0.0193126f},
+	{"llow", 0.0154903f}, {"llow$", 0.00580526f}, {"llowe", 0.00615013f},
+	{"lly", 0.0070123f}, {"lly$", 0.0070123f}, {"lo", 0.10507f},
+	{"loa", 0.0109208f}, {"load", 0.00741465f}, {"loc", 0.0393723f},
+	{"loc$", 0.00528796f}, {"loca", 0.0252328f}, {"local", 0.0070123f},
+	{"locat", 0.0185366f}, {"lock", 0.00885159f}, {"lock$", 0.00706978f},
+	{"log", 0.00847799f}, {"lon", 0.00865042f}, {"long", 0.00592022f},
+	{"low", 0.0216979f}, {"low$", 0.0102311f}, {"lowe", 0.00761582f},
+	{"lowed", 0.00617887f}, {"lp", 0.00686861f}, {"lr", 0.00643752f},
+	{"lre", 0.00534544f}, {"lrea", 0.00525923f}, {"lread", 0.00525923f},
+	{"ls", 0.0192838f}, {"ls$", 0.0137372f}, {"lt", 0.0354638f},
+	{"lt$", 0.0186803f}, {"lti", 0.00951259f}, {"ltip", 0.00600644f},
+	{"ltipl", 0.00589148f}, {"lu", 0.0425049f}, {"lu$", 0.00638004f},
+	{"lue", 0.0188527f}, {"lue$", 0.0164674f}, {"lx", 0.00816186f},
+	{"lx$", 0.00816186f}, {"ly", 0.0401483f}, {"ly$", 0.0378492f},
+	{"m$", 0.0704966f}, {"ma", 0.126997f}, {"ma$", 0.00626509f},
+	{"mac", 0.00738591f}, {"mag", 0.00672491f}, {"mage", 0.00540292f},
+	{"mage$", 0.00523049f}, {"mai", 0.00603518f}, {"mak", 0.00646626f},
+	{"make", 0.00508679f}, {"mal", 0.0102885f}, {"man", 0.0259225f},
+	{"mand", 0.0126739f}, {"mand$", 0.00991493f}, {"mar", 0.0100586f},
+	{"mat", 0.0323313f}, {"mat$", 0.0102885f}, {"matc", 0.010461f},
+	{"match", 0.010461f}, {"mati", 0.00919646f}, {"matio", 0.00747212f},
+	{"may", 0.00859294f}, {"may$", 0.00770203f}, {"mb", 0.0525923f},
+	{"mbe", 0.0200023f}, {"mber", 0.0194563f}, {"mber$", 0.0168123f},
+	{"mbo", 0.022129f}, {"mbol", 0.0210944f}, {"mbol$", 0.0147431f},
+	{"me", 0.144471f}, {"me$", 0.0542878f}, {"med", 0.0135935f},
+	{"med$", 0.00638004f}, {"medi", 0.00727095f}, {"media", 0.00698356f},
+	{"mem", 0.00824807f}, {"men", 0.0374181f}, {"ment", 0.0335958f},
+	{"ment$", 0.0254627f}, {"ments", 0.00514427f}, {"mer", 0.0131337f},
+	{"merg", 0.00724221f}, {"merge", 0.00666743f}, {"mes", 0.0161513f},
+	{"mes$", 0.00712726f}, {"mess", 0.00632257f}, {"messa", 0.00617887f},
+	{"met", 0.00888033f}, {"mi", 0.0602943f}, {"mic", 0.00563283f},
+	{"min", 0.0123577f}, {"mis", 0.016956f}, {"miss", 0.0136223f},
+	{"missi", 0.0134498f}, {"mit", 0.0152891f}, {"mit$", 0.0100874f},
+	{"ml", 0.00511553f}, {"mm", 0.0377917f}, {"mma", 0.0154903f},
+	{"mman", 0.0119267f}, {"mmand", 0.0119267f}, {"mme", 0.00790321f},
+	{"mmed", 0.00511553f}, {"mmedi", 0.00511553f}, {"mmi", 0.00951259f},
+	{"mmit", 0.00899529f}, {"mmit$", 0.00727095f}, {"mn", 0.00560409f},
+	{"mo", 0.0656972f}, {"mod", 0.018824f}, {"mode", 0.0112082f},
+	{"mode$", 0.0095988f}, {"mon", 0.00936889f}, {"mor", 0.0115243f},
+	{"mov", 0.0139671f}, {"move", 0.0101448f}, {"move$", 0.00758708f},
+	{"mp", 0.0495747f}, {"mp$", 0.00520175f}, {"mpa", 0.00574779f},
+	{"mpl", 0.0104035f}, {"mple", 0.00652374f}, {"mpo", 0.0109495f},
+	{"mpor", 0.00577653f}, {"mpt", 0.00879411f}, {"mpty", 0.00563283f},
+	{"mpty$", 0.00557535f}, {"ms", 0.0085642f}, {"ms$", 0.00523049f},
+	{"mu", 0.0286815f}, {"mul", 0.00977124f}, {"mult", 0.00773077f},
+	{"multi", 0.00744338f}, {"mus", 0.0143695f}, {"must", 0.0140821f},
+	{"must$", 0.0140246f}, {"n$", 0.346965f}, {"na", 0.115933f},
+	{"na$", 0.00525923f}, {"nab", 0.0177894f}, {"nabl", 0.0177032f},
+	{"nable", 0.0172434f}, {"nal", 0.0192263f}, {"nal$", 0.0166398f},
+	{"nam", 0.0468732f}, {"name", 0.0423037f}, {"name$", 0.0353776f},
+	{"names", 0.00589148f}, {"nar", 0.00511553f}, {"nat", 0.0175595f},
+	{"nati", 0.00615013f}, {"natu", 0.00721347f}, {"natur", 0.00721347f},
+	{"nc", 0.0599207f}, {"nce", 0.0171284f}, {"nce$", 0.011668f},
+	{"nch", 0.013766f}, {"nch$", 0.0102311f}, {"nco", 0.00968502f},
+	{"nct", 0.00514427f}, {"nd", 0.153466f}, {"nd$", 0.0907576f},
+	{"nda", 0.00873664f}, {"ndar", 0.0053167f}, {"nde", 0.0260375f},
+	{"ndex", 0.0113806f}, {"ndex$", 0.0100011f}, {"ndi", 0.0151454f},
+	{"ndl", 0.00709852f}, {"ndle", 0.00540292f}, {"nds", 0.0114094f},
+	{"nds$", 0.0110358f}, {"ne", 0.11806f}, {"ne$", 0.0399471f},
+	{"ned", 0.0142258f}, {"ned$", 0.0141108f}, {"nee", 0.00554661f},
+	{"need", 0.00525923f}, {"nen", 0.0054604f}, {"ner", 0.0138809f},
+	{"nera", 0.00928268f}, {"nerat", 0.00784573f}, {"nes", 0.0114381f},
+	{"nes$", 0.00629383f}, {"new", 0.0125014f}, {"new$", 0.00876538f},
+	{"nex", 0.00683987f}, {"nexp", 0.00566157f}, {"nexpe", 0.00557535f},
+	{"nf", 0.0272445f}, {"nfi", 0.00729969f}, {"nfig", 0.00655248f},
+	{"nfo", 0.0145132f}, {"nfo$", 0.00715599f}, {"nfor", 0.0075296f},
+	{"nform", 0.00729969f}, {"ng", 0.208788f}, {"ng$", 0.152345f},
+	{"nge", 0.0264973f}, {"nge$", 0.0170709f}, {"ngl", 0.00592022f},
+	{"ngt", 0.00609265f}, {"ngth", 0.00566157f}, {"ngth$", 0.00554661f},
+	{"ngu", 0.0122428f}, {"ngua", 0.0107771f}, {"nguag", 0.0106909f},
+	{"ni", 0.0623348f}, {"nia", 0.00569031f}, {"nin", 0.0227038f},
+	{"ning", 0.0219565f}, {"ning$", 0.0205196f}, {"nis", 0.00497184f},
+	{"nit", 0.00968502f}, {"niz", 0.00548914f}, {"nize", 0.00520175f},
+	{"nized", 0.00502931f}, {"nk", 0.0332222f}, {"nk$", 0.0109783f},
+	{"nkn", 0.0155478f}, {"nkno", 0.0155478f}, {"nknow", 0.0155478f},
+	{"nl", 0.0233935f}, {"nly", 0.0165249f}, {"nly$", 0.0164961f},
+	{"nm", 0.0070123f}, {"nn", 0.0375905f}, {"nne", 0.00554661f},
+	{"nno", 0.0282791f}, {"nnot", 0.0279342f}, {"nnot$", 0.0275319f},
+	{"no", 0.211835f}, {"no$", 0.0382515f}, {"non", 0.0125302f},
+	{"non$", 0.00813312f}, {"nor", 0.0187953f}, {"nore", 0.00913898f},
+	{"nored", 0.00594896f}, {"not", 0.123721f}, {"not$", 0.114525f},
+	{"note", 0.00632257f}, {"nov", 0.00718473f}, {"nova", 0.00638004f},
+	{"novad", 0.00620761f}, {"now", 0.0179044f}, {"nown", 0.0165536f},
+	{"nown$", 0.0165536f}, {"np", 0.0142258f}, {"npu", 0.0103173f},
+	{"nput", 0.0103173f}, {"nput$", 0.0101448f}, {"nr", 0.0076733f},
+	{"nre", 0.00712726f}, {"nrec", 0.00514427f}, {"nreco", 0.00514427f},
+	{"ns", 0.0975687f}, {"ns$", 0.0417577f}, {"nse", 0.00543166f},
+	{"nsi", 0.00911024f}, {"nst", 0.0358375f}, {"nsta", 0.0118692f},
+	{"nstal", 0.00689734f}, {"nste", 0.00537418f}, {"nstea", 0.00508679f},
+	{"nstr", 0.0158064f}, {"nstru", 0.015519f}, {"nsu", 0.00574779f},
+	{"nsup", 0.00520175f}, {"nsupp", 0.00520175f}, {"nt", 0.164904f},
+	{"nt$", 0.076503f}, {"nta", 0.0174445f}, {"ntai", 0.00876538f},
+	{"ntain", 0.00867916f}, {"nte", 0.0351765f}, {"nten", 0.00615013f},
+	{"nter", 0.0195137f}, {"ntern", 0.00652374f}, {"nti", 0.0148293f},
+	{"ntic", 0.00560409f}, {"ntica", 0.00537418f}, {"nto", 0.00612139f},
+	{"ntr", 0.0175595f}, {"ntro", 0.00534544f}, {"ntry", 0.00732843f},
+	{"ntry$", 0.00724221f}, {"nts", 0.0127313f}, {"nts$", 0.0121278f},
+	{"nu", 0.0366996f}, {"nu$", 0.0053167f}, {"num", 0.0208645f},
+	{"numb", 0.0164387f}, {"numbe", 0.0164387f}, {"nv", 0.0450339f},
+	{"nva", 0.0390275f}, {"nval", 0.0390275f}, {"nvali", 0.0390275f},
+	{"ny", 0.0136223f}, {"ny$", 0.00982872f}, {"o$", 0.20419f},
+	{"oa", 0.0133636f}, {"oad", 0.00764456f}, {"ob", 0.0279917f},
+	{"obj", 0.0117255f}, {"obje", 0.0115818f}, {"objec", 0.0115818f},
+	{"obl", 0.00741465f}, {"oc", 0.066272f}, {"oc$", 0.00681113f},
+	{"oca", 0.0268996f}, {"ocal", 0.00706978f}, {"ocal$", 0.00528796f},
+	{"ocat", 0.0197149f}, {"ocati", 0.0158639f}, {"oce", 0.00934015f},
+	{"oces", 0.00836303f}, {"ocess", 0.00833429f}, {"ock", 0.0118979f},
+	{"ock$", 0.00724221f}, {"od", 0.0456087f}, {"ode", 0.028624f},
+	{"ode$", 0.0240545f}, {"odi", 0.00500057f}, {"odu", 0.00589148f},
+	{"oe", 0.0142833f}, {"oes", 0.013651f}, {"oes$", 0.0110645f},
+	{"of", 0.0997816f}, {"of$", 0.0817623f}, {"off", 0.0140533f},
+	{"offs", 0.00896655f}, {"offse", 0.00893781f}, {"oft", 0.00523049f},
+	{"og", 0.0248017f}, {"ogn", 0.00623635f}, {"ogni", 0.00606392f},
+	{"ogniz", 0.00511553f}, {"ogr", 0.00678239f}, {"ogra", 0.00528796f},
+	{"oi", 0.0106047f}, {"oin", 0.0075296f}, {"oint", 0.00623635f},
+	{"ok", 0.0128463f}, {"oke", 0.00500057f}, {"ol", 0.0643752f},
+	{"ol$", 0.0221577f}, {"old", 0.00592022f}, {"oli", 0.00540292f},
+	{"oll", 0.0080469f}, {"ollo", 0.00563283f}, {"ollow", 0.00563283f},
+	{"ols", 0.0054604f}, {"ols$", 0.00517301f}, {"olu", 0.00551788f},
+	{"om", 0.082452f}, {"om$", 0.0227325f}, {"ome", 0.00514427f},
+	{"omm", 0.0281067f}, {"omma", 0.0140246f}, {"omman", 0.0119267f},
+	{"ommi", 0.00899529f}, {"ommit", 0.00899529f}, {"omp", 0.0199736f},
+	{"ompa", 0.00540292f}, {"on", 0.276152f}, {"on$", 0.169703f},
+	{"ona", 0.00790321f}, {"onal", 0.00609265f}, {"ond", 0.00905276f},
+	{"one", 0.0206346f}, {"one$", 0.0126164f}, {"onf", 0.0120704f},
+	{"onfi", 0.00678239f}, {"onfig", 0.00655248f}, {"ong", 0.0114381f},
+	{"ong$", 0.00681113f}, {"onl", 0.016295f}, {"only", 0.0159501f},
+	{"only$", 0.0159214f}, {"ons", 0.0410679f}, {"ons$", 0.0317565f},
+	{"onst", 0.00520175f}, {"ont", 0.0273882f}, {"onta", 0.00902403f},
+	{"ontai", 0.00816186f}, {"onte", 0.00890907f}, {"onten", 0.00520175f},
+	{"ontr", 0.00497184f}, {"oo", 0.0266697f}, {"oo$", 0.0125302f},
+	{"op", 0.0816473f}, {"op$", 0.00816186f}, {"ope", 0.0303771f},
+	{"open", 0.00948385f}, {"open$", 0.00681113f}, {"oper", 0.0201173f},
+	{"opera", 0.0169272f}, {"opt", 0.0306357f}, {"opti", 0.0303483f},
+	{"optio", 0.02917f}, {"or", 0.268364f}, {"or$", 0.130992f},
+	{"ora", 0.00600644f}, {"ord", 0.0183354f}, {"ord$", 0.0115531f},
+	{"ore", 0.0271008f}, {"ore$", 0.0180193f}, {"ored", 0.0070123f},
+	{"ored$", 0.0070123f}, {"ori", 0.0133923f}, {"ork", 0.00842051f},
+	{"orm", 0.025865f}, {"orma", 0.0198873f}, {"ormat", 0.0179618f},
+	{"orr", 0.00913898f}, {"orru", 0.00508679f}, {"orrup", 0.00508679f},
+	{"ort", 0.0405219f}, {"ort$", 0.0164961f}, {"orte", 0.0168985f},
+	{"orted", 0.0161225f}, {"ory", 0.0251753f}, {"ory$", 0.0251466f},
+	{"os", 0.0347741f}, {"ose", 0.00787447f}, {"ose$", 0.0053167f},
+	{"osi", 0.00925394f}, {"osit", 0.00643752f}, {"ost", 0.00640878f},
+	{"ot", 0.148781f}, {"ot$", 0.121623f}, {"ote", 0.0134211f},
+	{"ote$", 0.00867916f}, {"oth", 0.0104035f}, {"othe", 0.00557535f},
+	{"other", 0.00557535f}, {"ou", 0.117341f}, {"ou$", 0.0130187f},
+	{"oul", 0.0188527f}, {"ould", 0.0185079f}, {"ould$", 0.0170134f},
+	{"oun", 0.0216979f}, {"ound", 0.0125877f}, {"ound$", 0.0111507f},
+	{"ount", 0.00896655f}, {"ount$", 0.00520175f}, {"oup", 0.00790321f},
+	{"oup$", 0.00672491f}, {"our", 0.0164387f}, {"our$", 0.00508679f},
+	{"ourc", 0.00988619f}, {"ource", 0.00988619f}, {"ous", 0.005834f},
+	{"ous$", 0.00523049f}, {"out", 0.0385677f}, {"out$", 0.0215829f},
+	{"outp", 0.0131912f}, {"outpu", 0.0131912f}, {"ov", 0.0394586f},
+	{"ova", 0.00844925f}, {"ovad", 0.00620761f}, {"ovads", 0.00620761f},
+	{"ove", 0.0227325f}, {"ove$", 0.00807564f}, {"over", 0.0118692f},
+	{"ovi", 0.0054604f}, {"ow", 0.0571617f}, {"ow$", 0.0201747f},
+	{"owe", 0.00988619f}, {"owed", 0.00620761f}, {"owed$", 0.00620761f},
+	{"own", 0.0225026f}, {"own$", 0.0179906f}, {"p$", 0.0687435f},
+	{"pa", 0.0893206f}, {"pa$", 0.00508679f}, {"pac", 0.0251753f},
+	{"pace", 0.00505805f}, {"pack", 0.0195137f}, {"packa", 0.0149442f},
+	{"par", 0.0197149f}, {"para", 0.00686861f}, {"pas", 0.00893781f},
+	{"pass", 0.00793195f}, {"pat", 0.0172721f}, {"path", 0.00750086f},
+	{"path$", 0.00569031f}, {"pb", 0.0198873f}, {"pb$", 0.0197724f},
+	{"pc", 0.0106909f}, {"pd", 0.00893781f}, {"pda", 0.00747212f},
+	{"pdat", 0.00747212f}, {"pdate", 0.00652374f}, {"pe", 0.118749f},
+	{"pe$", 0.0242269f}, {"pec", 0.0400333f}, {"peci", 0.0199736f},
+	{"pecif", 0.0178469f}, {"pect", 0.0179331f}, {"pecte", 0.0153753f},
+	{"pen", 0.0163525f}, {"pen$", 0.00712726f}, {"pend", 0.00617887f},
+	{"per", 0.0312392f}, {"pera", 0.0172434f}, {"peran", 0.0131624f},
+	{"ph", 0.00982872f}, {"pi", 0.025319f}, {"pin", 0.00689734f},
+	{"pl", 0.0503794f}, {"pla", 0.0118404f}, {"ple", 0.018939f},
+	{"ple$", 0.00732843f}, {"plea", 0.00617887f}, {"pleas", 0.00617887f},
+	{"pli", 0.0132774f}, {"plic", 0.00813312f}, {"plica", 0.00632257f},
+	{"po", 0.067479f}, {"poi", 0.00623635f}, {"poin", 0.00623635f},
+	{"point", 0.00623635f}, {"pon", 0.00663869f}, {"por", 0.0346017f},
+	{"port", 0.0317565f}, {"port$", 0.01299f}, {"porte", 0.015519f},
+	{"pos", 0.0121853f}, {"posi", 0.00741465f}, {"posit", 0.00640878f},
+	{"pp", 0.0435395f}, {"ppe", 0.00686861f}, {"ppl", 0.00844925f},
+	{"ppli", 0.00563283f}, {"ppo", 0.0207783f}, {"ppor", 0.0205196f},
+	{"pport", 0.0205196f}, {"pr", 0.081791f}, {"pre", 0.0354064f},
+	{"pres", 0.0170997f}, {"press", 0.0131624f}, {"pri", 0.0143982f},
+	{"prin", 0.0100874f}, {"print", 0.0097425f}, {"pro", 0.0332797f},
+	{"proc", 0.0102598f}, {"proce", 0.0092252f}, {"prog", 0.00569031f},
+	{"progr", 0.00557535f}, {"ps", 0.0154903f}, {"ps$", 0.0080469f},
+	{"pt", 0.0606104f}, {"pt$", 0.0169272f}, {"pti", 0.0342568f},
+	{"ptio", 0.0321589f}, {"ption", 0.0321589f}, {"pty", 0.00566157f},
+	{"pty$", 0.00557535f}, {"pu", 0.0458099f}, {"pub", 0.0110932f},
+	{"publ", 0.0109783f}, {"publi", 0.0109783f}, {"put", 0.0227038f},
+	{"put$", 0.0215542f}, {"q$", 0.00523049f}, {"qu", 0.0306644f},
+	{"que", 0.00816186f}, {"qui", 0.0184217f}, {"quir", 0.0134786f},
+	{"quire", 0.0131624f}, {"r$", 0.253966f}, {"ra", 0.131279f},
+	{"ra$", 0.00540292f}, {"rac", 0.0176744f}, {"ract", 0.0127601f},
+	{"racte", 0.0102311f}, {"ral", 0.00681113f}, {"ram", 0.0103173f},
+	{"ram$", 0.00528796f}, {"ran", 0.0412404f}, {"ranc", 0.010346f},
+	{"ranch", 0.00965628f}, {"rand", 0.0142258f}, {"rand$", 0.0105472f},
+	{"rang", 0.0112369f}, {"range", 0.0110358f}, {"rar", 0.00620761f},
+	{"rat", 0.0246293f}, {"rate", 0.0110358f}, {"rate$", 0.00787447f},
+	{"rati", 0.00945511f}, {"ratio", 0.00712726f}, {"rb", 0.00666743f},
+	{"rc", 0.0367284f}, {"rce", 0.0134211f}, {"rce$", 0.0112657f},
+	{"rch", 0.0195712f}, {"rchi", 0.0151742f}, {"rchit", 0.00520175f},
+	{"rchiv", 0.00957007f}, {"rd", 0.0353489f}, {"rd$", 0.02279f},
+	{"re", 0.327969f}, {"re$", 0.0671054f}, {"rea", 0.0529946f},
+	{"read", 0.0237671f}, {"read$", 0.0122428f}, {"ready", 0.00563283f},
+	{"ream", 0.00511553f}, {"reat", 0.0169272f}, {"reate", 0.01299f},
+	{"rec", 0.0479365f}, {"reco", 0.0132199f}, {"recog", 0.00606392f},
+	{"rect", 0.026641f}, {"recti", 0.00525923f}, {"recto", 0.0160076f},
+	{"red", 0.0310381f}, {"red$", 0.025434f}, {"ree", 0.00942637f},
+	{"ree$", 0.00669617f}, {"ref", 0.0186228f}, {"refe", 0.00888033f},
+	{"refer", 0.00873664f}, {"reg", 0.0262674f}, {"regi", 0.021468f},
+	{"regis", 0.0198873f}, {"rel", 0.0254052f}, {"rela", 0.00615013f},
+	{"relo", 0.0168698f}, {"reloc", 0.0164674f}, {"rem", 0.018939f},
+	{"remo", 0.0154328f}, {"remov", 0.0113519f}, {"ren", 0.0245143f},
+	{"renc", 0.00979998f}, {"rence", 0.0080469f}, {"rent", 0.0105472f},
+	{"rent$", 0.00824807f}, {"rep", 0.0216117f}, {"repo", 0.00672491f},
+	{"repu", 0.00798942f}, {"repub", 0.00798942f}, {"req", 0.0164961f},
+	{"requ", 0.016295f}, {"requi", 0.0134211f}, {"res", 0.0539142f},
+	{"res$", 0.00755834f}, {"rese", 0.00658122f}, {"reso", 0.00563283f},
+	{"ress", 0.0251466f}, {"ress$", 0.0113519f}, {"ressi", 0.0107484f},
+	{"ret", 0.00925394f}, {"rev", 0.0102598f}, {"rf", 0.00919646f},
+	{"rg", 0.0378204f}, {"rge", 0.018824f}, {"rge$", 0.00928268f},
+	{"rget", 0.0070123f}, {"rget$", 0.00560409f}, {"rgu", 0.0117542f},
+	{"rgum", 0.0116967f}, {"rgume", 0.0116967f}, {"ri", 0.111565f},
+	{"ria", 0.0104897f}, {"rib", 0.00698356f}, {"ribu", 0.005834f},
+	{"ribut", 0.005834f}, {"ric", 0.00620761f}, {"rie", 0.00934015f},
+	{"ries", 0.00681113f}, {"ries$", 0.00675365f}, {"rig", 0.00638004f},
+	{"rin", 0.027848f}, {"ring", 0.0170134f}, {"ring$", 0.0155478f},
+	{"rint", 0.00977124f}, {"rint$", 0.00816186f}, {"rip", 0.00747212f},
+	{"ript", 0.00574779f}, {"rit", 0.022129f}, {"rite", 0.00801816f},
+	{"rite$", 0.00706978f}, {"rk", 0.0151454f}, {"rk$", 0.00589148f},
+	{"rl", 0.0120416f}, {"rl$", 0.00574779f}, {"rm", 0.0431659f},
+	{"rm$", 0.00557535f}, {"rma", 0.0227038f}, {"rmat", 0.0180481f},
+	{"rmat$", 0.0102885f}, {"rmati", 0.00735717f}, {"rmi", 0.00830555f},
+	{"rmin", 0.00523049f}, {"rn", 0.0400046f}, {"rn$", 0.0101736f},
+	{"rna", 0.0095988f}, {"rnal", 0.00643752f}, {"rnal$", 0.00626509f},
+	{"rni", 0.0155765f}, {"rnin", 0.0150305f}, {"rning", 0.0150305f},
+	{"ro", 0.1226f}, {"ro$", 0.0085642f}, {"roc", 0.011007f},
+	{"roce", 0.0092252f}, {"roces", 0.00836303f}, {"rog", 0.00586274f},
+	{"rogr", 0.00557535f}, {"rol", 0.00663869f}, {"rom", 0.022129f},
+	{"rom$", 0.0196287f}, {"ron", 0.00600644f}, {"rop", 0.00500057f},
+	{"ror", 0.0328199f}, {"ror$", 0.0313542f}, {"rou", 0.0114094f},
+	{"roup", 0.00770203f}, {"roup$", 0.00672491f}, {"rp", 0.00600644f},
+	{"rr", 0.0593459f}, {"rre", 0.011668f}, {"rren", 0.00666743f},
+	{"rrent", 0.00643752f}, {"rro", 0.0333946f}, {"rror", 0.0327049f},
+	{"rror$", 0.0312967f}, {"rru", 0.00589148f}, {"rrup", 0.00589148f},
+	{"rrupt", 0.00589148f}, {"rs", 0.0579952f}, {"rs$", 0.022129f},
+	{"rse", 0.0059777f}, {"rsi", 0.0197436f}, {"rsio", 0.016841f},
+	{"rsion", 0.016841f}, {"rst", 0.00569031f}, {"rst$", 0.00511553f},
+	{"rt", 0.0710714f}, {"rt$", 0.0273595f}, {"rte", 0.0185941f},
+	{"rted", 0.0172721f}, {"rted$", 0.0172721f}, {"rti", 0.012214f},
+	{"rtif", 0.0063513f}, {"rtifi", 0.00620761f}, {"ru", 0.044689f},
+	{"ruc", 0.0169272f}, {"ruct", 0.0168698f}, {"ructi", 0.014973f},
+	{"run", 0.00942637f}, {"rup", 0.00629383f}, {"rupt", 0.00589148f},
+	{"rus", 0.00528796f}, {"rv", 0.0109495f}, {"rve", 0.00773077f},
+	{"rver", 0.00554661f}, {"rver$", 0.00520175f}, {"rw", 0.00537418f},
+	{"ry", 0.0542304f}, {"ry$", 0.0495459f}, {"s$", 0.511812f},
+	{"sa", 0.0472755f}, {"sab", 0.00612139f}, {"sabl", 0.00569031f},
+	{"sable", 0.0053167f}, {"sag", 0.0120129f}, {"sage", 0.0119267f},
+	{"sage$", 0.0112369f}, {"sam", 0.00698356f}, {"same", 0.00517301f},
+	{"sc", 0.0232498f}, {"sca", 0.00563283f}, {"scr", 0.00796069f},
+	{"scri", 0.00646626f}, {"scrip", 0.00574779f}, {"se", 0.190884f},
+	{"se$", 0.0620474f}, {"sec", 0.0327336f}, {"sect", 0.0250604f},
+	{"secti", 0.0237671f}, {"sed", 0.0194563f}, {"sed$", 0.0193126f},
+	{"see", 0.00502931f}, {"sel", 0.0102311f}, {"sele", 0.00663869f},
+	{"selec", 0.00638004f}, {"sen", 0.00764456f}, {"ser", 0.025204f},
+	{"ser$", 0.0110645f}, {"serv", 0.00893781f}, {"serve", 0.00747212f},
+	{"ses", 0.00718473f}, {"ses$", 0.00632257f}, {"set", 0.0342568f},
+	{"set$", 0.0282791f}, {"sh", 0.0554949f}, {"sh$", 0.018939f},
+	{"sha", 0.00660996f}, {"she", 0.00609265f}, {"shi", 0.0075296f},
+	{"sho", 0.0144557f}, {"show", 0.00709852f}, {"show$", 0.00669617f},
+	{"si", 0.121365f}, {"sid", 0.00511553f}, {"sig", 0.0166686f},
+	{"sign", 0.0161225f}, {"signa", 0.0101736f}, {"sin", 0.0306932f},
+	{"sing", 0.0283079f}, {"sing$", 0.0261237f}, {"sio", 0.0341993f},
+	{"sion", 0.0339119f}, {"sion$", 0.0304345f}, {"sit", 0.00807564f},
+	{"siz", 0.0162088f}, {"size", 0.0160938f}, {"size$", 0.0152604f},
+	{"sk", 0.0207783f}, {"ska", 0.0063513f}, {"ski", 0.00729969f},
+	{"sl", 0.0119841f}, {"sla", 0.00658122f}, {"sm", 0.0063513f},
+	{"sn", 0.00663869f}, {"sn$", 0.00502931f}, {"so", 0.0435395f},
+	{"sof", 0.00534544f}, {"soft", 0.00511553f}, {"sol", 0.00741465f},
+	{"sor", 0.00523049f}, {"sou", 0.0121278f}, {"sour", 0.0100011f},
+	{"sourc", 0.00988619f}, {"sp", 0.0468157f}, {"spa", 0.00706978f},
+	{"spac", 0.00502931f}, {"space", 0.00502931f}, {"spe", 0.023997f},
+	{"spec", 0.0226175f}, {"speci", 0.0199736f}, {"spl", 0.0063513f},
+	{"spla", 0.00497184f}, {"ss", 0.089608f}, {"ss$", 0.0267272f},
+	{"ssa", 0.00824807f}, {"ssag", 0.00620761f}, {"ssage", 0.00617887f},
+	{"sse", 0.0109495f}, {"ssi", 0.0320439f}, {"ssin", 0.0155765f},
+	{"ssing", 0.015519f}, {"ssio", 0.0114094f}, {"ssion", 0.0114094f},
+	{"st", 0.195942f}, {"st$", 0.0580239f}, {"sta", 0.0474767f},
+	{"stal", 0.00718473f}, {"stall", 0.0070123f}, {"stan", 0.0108633f},
+	{"star", 0.00761582f}, {"start", 0.00715599f}, {"stat", 0.0140533f},
+	{"statu", 0.00514427f}, {"ste", 0.0432808f}, {"stea", 0.00511553f},
+	{"stead", 0.00508679f}, {"stem", 0.00893781f}, {"stem$", 0.00839177f},
+	{"ster", 0.0223302f}, {"ster$", 0.0177894f}, {"sti", 0.011007f},
+	{"stin", 0.00718473f}, {"sto", 0.0101448f}, {"stor", 0.00577653f},
+	{"str", 0.0382228f}, {"stre", 0.00511553f}, {"strea", 0.00500057f},
+	{"stri", 0.0118117f}, {"strin", 0.00798942f}, {"stru", 0.0168985f},
+	{"struc", 0.0168698f}, {"su", 0.0554087f}, {"sub", 0.00948385f},
+	{"sum", 0.00563283f}, {"sup", 0.0231348f}, {"supp", 0.0224738f},
+	{"suppo", 0.0204046f}, {"sw", 0.00885159f}, {"sy", 0.0405506f},
+	{"sym", 0.0241694f}, {"symb", 0.0210369f}, {"symbo", 0.0210369f},
+	{"syn", 0.00571905f}, {"sys", 0.00942637f}, {"syst", 0.00882285f},
+	{"syste", 0.00882285f}, {"t$", 0.400132f}, {"ta", 0.125043f},
+	{"ta$", 0.0168985f}, {"tab", 0.0174733f}, {"tabl", 0.0122715f},
+	{"table", 0.0120129f}, {"tag", 0.00801816f}, {"tai", 0.0129325f},
+	{"tain", 0.0103748f}, {"tal", 0.0131624f}, {"tall", 0.00718473f},
+	{"tan", 0.013766f}, {"tar", 0.0179618f}, {"targ", 0.00669617f},
+	{"targe", 0.00660996f}, {"tart", 0.00727095f}, {"tat", 0.0180768f},
+	{"tatu", 0.00514427f}, {"tatus", 0.00514427f}, {"tc", 0.0215829f},
+	{"tch", 0.018824f}, {"tch$", 0.0119841f}, {"td", 0.00508679f},
+	{"te", 0.260432f}, {"te$", 0.0816473f}, {"tea", 0.00525923f},
+	{"tead", 0.00508679f}, {"tead$", 0.00505805f}, {"tec", 0.00942637f},
+	{"tect", 0.00833429f}, {"tectu", 0.00520175f}, {"ted", 0.0719048f},
+	{"ted$", 0.0713875f}, {"teg", 0.00502931f}, {"tem", 0.0183067f},
+	{"tem$", 0.00945511f}, {"temp", 0.00686861f}, {"ten", 0.0185941f},
+	{"tent", 0.00606392f}, {"ter", 0.0782561f}, {"ter$", 0.0419876f},
+	{"term", 0.0059777f}, {"termi", 0.00500057f}, {"tern", 0.0135935f},
+	{"terna", 0.00830555f}, {"ters", 0.00873664f}, {"ters$", 0.00839177f},
+	{"tes", 0.0164099f}, {"tes$", 0.0142833f}, {"tex", 0.00741465f},
+	{"text", 0.00692608f}, {"text$", 0.00660996f}, {"th", 0.175336f},
+	{"th$", 0.0539142f}, {"tha", 0.0141683f}, {"than", 0.00646626f},
+	{"than$", 0.00626509f}, {"that", 0.00683987f}, {"that$", 0.00683987f},
+	{"the", 0.0978561f}, {"the$", 0.0817335f}, {"then", 0.00672491f},
+	{"thent", 0.00517301f}, {"ther", 0.0131624f}, {"ther$", 0.00784573f},
+	{"thi", 0.0287964f}, {"this", 0.0228762f}, {"this$", 0.0228762f},
+	{"tho", 0.00965628f}, {"thou", 0.00606392f}, {"thout", 0.00586274f},
+	{"ti", 0.224911f}, {"tia", 0.00600644f}, {"tic", 0.0143982f},
+	{"tic$", 0.00592022f}, {"tica", 0.00724221f}, {"ticat", 0.00517301f},
+	{"tif", 0.0081906f}, {"tifi", 0.00741465f}, {"tific", 0.00620761f},
+	{"tim", 0.012444f}, {"time", 0.010461f}, {"time$", 0.00678239f},
+	{"tin", 0.0427923f}, {"ting", 0.0346879f}, {"ting$", 0.0329923f},
+	{"tio", 0.137918f}, {"tion", 0.137774f}, {"tion$", 0.111622f},
+	{"tiona", 0.005834f}, {"tions", 0.0277906f}, {"tip", 0.00629383f},
+	{"tipl", 0.00592022f}, {"tiple", 0.0053167f}, {"tiv", 0.0153753f},
+	{"tive", 0.0145132f}, {"tive$", 0.0136223f}, {"tl", 0.0114956f},
+	{"to", 0.172319f}, {"to$", 0.115588f}, {"too", 0.0137085f},
+	{"too$", 0.0122428f}, {"top", 0.00500057f}, {"tor", 0.0350902f},
+	{"tor$", 0.00775951f}, {"tory", 0.0184791f}, {"tory$", 0.0184791f},
+	{"tp", 0.016956f}, {"tpu", 0.0132486f}, {"tput", 0.0131912f},
+	{"tput$", 0.0130762f}, {"tr", 0.0933441f}, {"tra", 0.018163f},
+	{"trac", 0.00566157f}, {"tre", 0.0124727f}, {"trea", 0.00638004f},
+	{"tream", 0.00500057f}, {"tree", 0.00528796f}, {"tri", 0.024112f},
+	{"trib", 0.00586274f}, {"tribu", 0.005834f}, {"trin", 0.0081906f},
+	{"tring", 0.00798942f}, {"tro", 0.0070123f}, {"tru", 0.0226175f},
+	{"truc", 0.0168698f}, {"truct", 0.0168698f}, {"try", 0.0108058f},
+	{"try$", 0.00977124f}, {"ts", 0.043482f}, {"ts$", 0.0376193f},
+	{"tt", 0.0300034f}, {"tte", 0.011783f}, {"tti", 0.00617887f},
+	{"ttin", 0.00574779f}, {"tting", 0.00574779f}, {"ttr", 0.00520175f},
+	{"tu", 0.0362111f}, {"tur", 0.0213243f}, {"ture", 0.0154041f},
+	{"ture$", 0.012875f}, {"tus", 0.00534544f}, {"tus$", 0.00525923f},
+	{"tw", 0.00997241f}, {"ty", 0.0426198f}, {"ty$", 0.0193413f},
+	{"typ", 0.0212093f}, {"type", 0.0209507f}, {"type$", 0.0197149f},
+	{"u$", 0.052075f}, {"ua", 0.023451f}, {"uag", 0.0107484f},
+	{"uage", 0.0106909f}, {"uages", 0.00977124f}, {"ual", 0.00589148f},
+	{"ub", 0.0270433f}, {"ubl", 0.0128176f}, {"ubli", 0.0110358f},
+	{"ublic", 0.00945511f}, {"uc", 0.0261524f}, {"uct", 0.0172146f},
+	{"ucti", 0.0150305f}, {"uctio", 0.0149442f}, {"ud", 0.0115818f},
+	{"ue", 0.0354064f}, {"ue$", 0.0225313f}, {"ues", 0.00712726f},
+	{"ug", 0.0156915f}, {"ug$", 0.00781699f}, {"ui", 0.0276756f},
+	{"uir", 0.0135935f}, {"uire", 0.0131624f}, {"uired", 0.0075296f},
+	{"ul", 0.0632257f}, {"ula", 0.00548914f}, {"uld", 0.018709f},
+	{"uld$", 0.0170134f}, {"ule", 0.00609265f}, {"ull", 0.00528796f},
+	{"ult", 0.0232498f}, {"ult$", 0.0135073f}, {"ulti", 0.00830555f},
+	{"ultip", 0.00594896f}, {"um", 0.0550925f}, {"um$", 0.00796069f},
+	{"umb", 0.0185079f}, {"umbe", 0.0164961f}, {"umber", 0.0164674f},
+	{"ume", 0.0214967f}, {"umen", 0.0164387f}, {"ument", 0.016295f},
+	{"un", 0.120416f}, {"un$", 0.00537418f}, {"una", 0.0146569f},
+	{"unab", 0.0125589f}, {"unabl", 0.0125589f}, {"unc", 0.00942637f},
+	{"und", 0.0206058f}, {"und$", 0.0112082f}, {"unde", 0.00508679f},
+	{"une", 0.00715599f}, {"unex", 0.00571905f}, {"unexp", 0.00566157f},
+	{"uni", 0.00715599f}, {"unk", 0.0180768f}, {"unkn", 0.015519f},
+	{"unkno", 0.015519f}, {"unr", 0.00686861f}, {"unre", 0.00686861f},
+	{"unrec", 0.00514427f}, {"uns", 0.0087079f}, {"unsu", 0.00523049f},
+	{"unsup", 0.00520175f}, {"unt", 0.0130187f}, {"unt$", 0.00520175f},
+	{"up", 0.061099f}, {"up$", 0.014973f}, {"upd", 0.00735717f},
+	{"upda", 0.00735717f}, {"updat", 0.00735717f}, {"upp", 0.0235659f},
+	{"uppo", 0.0204046f}, {"uppor", 0.0203184f}, {"upt", 0.00589148f},
+	{"ur", 0.0717899f}, {"ur$", 0.00724221f}, {"urc", 0.0102598f},
+	{"urce", 0.00988619f}, {"urce$", 0.00888033f}, {"ure", 0.0218416f},
+	{"ure$", 0.0174445f}, {"uri", 0.00698356f}, {"urr", 0.00715599f},
+	{"urre", 0.00692608f}, {"urren", 0.00663869f}, {"us", 0.106851f},
+	{"us$", 0.0150879f}, {"usa", 0.00675365f}, {"usag", 0.00569031f},
+	{"usage", 0.00569031f}, {"use", 0.0532532f}, {"use$", 0.0270433f},
+	{"used", 0.0118979f}, {"used$", 0.0118117f}, {"user", 0.012214f},
+	{"user$", 0.0105185f}, {"usi", 0.00936889f}, {"usin", 0.00801816f},
+	{"using", 0.00798942f}, {"ust", 0.0211231f}, {"ust$", 0.0166111f},
+	{"ut", 0.0848948f}, {"ut$", 0.0515577f}, {"ute", 0.0114381f},
+	{"ute$", 0.00824807f}, {"uth", 0.0081906f}, {"uthe", 0.00566157f},
+	{"uthen", 0.00523049f}, {"uti", 0.00502931f}, {"utp", 0.0131912f},
+	{"utpu", 0.0131912f}, {"utput", 0.0131912f}, {"v$", 0.00879411f},
+	{"va", 0.0879411f}, {"vad", 0.00652374f}, {"vads", 0.00620761f},
+	{"vads$", 0.00620761f}, {"val", 0.0656972f}, {"vali", 0.0463559f},
+	{"valid", 0.0463559f}, {"valu", 0.0192263f}, {"value", 0.0187378f},
+	{"var", 0.00569031f}, {"ve", 0.110875f}, {"ve$", 0.0439131f},
+	{"ved", 0.00603518f}, {"ved$", 0.0059777f}, {"vel", 0.00554661f},
+	{"ven", 0.00994367f}, {"ven$", 0.00712726f}, {"ver", 0.0475342f},
+	{"ver$", 0.00865042f}, {"vers", 0.0183929f}, {"versi", 0.0166398f},
+	{"vi", 0.0327336f}, {"vin", 0.00577653f}, {"ving", 0.00497184f},
+	{"vo", 0.00902403f}, {"w$", 0.036441f}, {"wa", 0.045465f},
+	{"war", 0.0259225f}, {"ware", 0.0053167f}, {"ware$", 0.0053167f},
+	{"warn", 0.016295f}, {"warni", 0.0148868f}, {"was", 0.00577653f},
+	{"was$", 0.00543166f}, {"we", 0.0229049f}, {"wed", 0.0070123f},
+	{"wed$", 0.00623635f}, {"wer", 0.00683987f}, {"wh", 0.0196574f},
+	{"whe", 0.0102885f}, {"when", 0.00813312f}, {"when$", 0.00807564f},
+	{"whi", 0.00807564f}, {"wi", 0.05857f}, {"wil", 0.00629383f},
+	{"will", 0.0059777f}, {"will$", 0.0059777f}, {"win", 0.00821934f},
+	{"wit", 0.0413553f}, {"with", 0.0398034f}, {"with$", 0.0333659f},
+	{"witho", 0.00586274f}, {"wn", 0.0229624f}, {"wn$", 0.0182492f},
+	{"wo", 0.020146f}, {"wor", 0.0158064f}, {"word", 0.00810438f},
+	{"word$", 0.00729969f}, {"work", 0.00744338f}, {"wr", 0.0164387f},
+	{"wri", 0.0136223f}, {"writ", 0.0135935f}, {"write", 0.00778825f},
+	{"x$", 0.0587999f}, {"xc", 0.00571905f}, {"xe", 0.00982872f},
+	{"xec", 0.00543166f}, {"xi", 0.0157489f}, {"xis", 0.00781699f},
+	{"xist", 0.00781699f}, {"xp", 0.0339119f}, {"xpe", 0.0177894f},
+	{"xpec", 0.0174445f}, {"xpect", 0.0174445f}, {"xpr", 0.00790321f},
+	{"xpre", 0.00761582f}, {"xpres", 0.00761582f}, {"xt", 0.0191401f},
+	{"xt$", 0.00821934f}, {"xte", 0.00712726f}, {"xten", 0.00623635f},
+	{"y$", 0.170882f}, {"ya", 0.00577653f}, {"ym", 0.0257501f},
+	{"ymb", 0.0210944f}, {"ymbo", 0.0210369f}, {"ymbol", 0.0210369f},
+	{"yn", 0.0103173f}, {"yo", 0.0180768f}, {"you", 0.0159788f},
+	{"you$", 0.012329f}, {"yp", 0.025865f}, {"ype", 0.0211519f},
+	{"ype$", 0.0197149f}, {"ys", 0.0189102f}, {"ys$", 0.0076733f},
+	{"yst", 0.00899529f}, {"yste", 0.00882285f}, {"ystem", 0.00882285f},
+	{"yt", 0.00997241f}, {"yte", 0.00888033f}, {"z$", 0.00646626f},
+	{"za", 0.00626509f}, {"ze", 0.031699f}, {"ze$", 0.017617f},
+	{"zed", 0.00623635f}, {"zed$", 0.00620761f}, {"zer", 0.00577653f}
+};
+
+static const QGramTableElement englishCharacters[] = {
+	{"$", 0.172894f}, {"0", 0.00202133f}, {"1", 0.00106226f},
+	{"2", 0.00125719f}, {"3", 0.000635556f}, {"4", 0.000524989f},
+	{"5", 0.000696163f}, {"6", 0.000558568f}, {"7", 0.00020803f},
+	{"8", 0.000471753f}, {"9", 0.00016626f}, {"a", 0.0620879f},
+	{"b", 0.0145801f}, {"c", 0.0313429f}, {"d", 0.0343257f},
+	{"e", 0.0940729f}, {"f", 0.0200339f}, {"g", 0.0192018f},
+	{"h", 0.0185613f}, {"i", 0.0629184f}, {"j", 0.00141034f},
+	{"k", 0.00756688f}, {"l", 0.0364101f}, {"m", 0.0227612f},
+	{"n", 0.0630117f}, {"o", 0.0607136f}, {"p", 0.024527f},
+	{"q", 0.00120477f}, {"r", 0.0545865f}, {"s", 0.0604146f},
+	{"t", 0.0665671f}, {"u", 0.0266483f}, {"v", 0.00885109f},
+	{"w", 0.00800669f}, {"x", 0.00558732f}, {"y", 0.010947f},
+	{"z", 0.00186735f}
+};
+
+#define ENGLISH_AVG_CHARACTERS (35.0896f)
+
+/* Russian: Russian translations of gettext catalogs of a Debian system, 34165 documents */
+static const QGramTableElement russianQGrams[] = {
+	{"$0", 0.0206352f}, {"$0$", 0.00725889f}, {"$0x", 0.00977609f},
+	{"$0x$", 0.00919069f}, {"$1", 0.0150154f}, {"$1$", 0.0063808f},
+	{"$2", 0.0152788f}, {"$25", 0.00813698f}, {"$250", 0.00559052f},
+	{"$250s", 0.00559052f}, {"$3", 0.00790282f}, {"$6", 0.00550271f},
+	{"$a", 0.0366164f}, {"$a$", 0.00538563f}, {"$al", 0.00617591f},
+	{"$ar", 0.00550271f}, {"$b", 0.0205473f}, {"$c", 0.0427045f},
+	{"$c$", 0.011503f}, {"$co", 0.0143422f}, {"$con", 0.00582467f},
+	{"$d", 0.0708035f}, {"$d$", 0.0399824f}, {"$de", 0.0128787f},
+	{"$di", 0.00632226f}, {"$e", 0.0267818f}, {"$e$", 0.00594175f},
+	{"$en", 0.00588321f}, {"$ex", 0.00503439f}, {"$f", 0.0341285f},
+	{"$f$", 0.0102151f}, {"$fi", 0.00758086f}, {"$fil", 0.00497585f},
+	{"$g", 0.0361774f}, {"$gi", 0.0142836f}, {"$git", 0.0125274f},
+	{"$git$", 0.011942f}, {"$h", 0.0182643f}, {"$he", 0.00725889f},
+	{"$i", 0.0269574f}, {"$in", 0.0102737f}, {"$l", 0.0442851f},
+	{"$ld", 0.00875165f}, {"$ld$", 0.00740524f}, {"$li", 0.00728816f},
+	{"$lo", 0.00799063f}, {"$lu", 0.00597102f}, {"$lu$", 0.00585394f},
+	{"$lx", 0.00591248f}, {"$lx$", 0.00591248f}, {"$m", 0.0372604f},
+	{"$ma", 0.00974682f}, {"$me", 0.00523928f}, {"$n", 0.0322845f},
+	{"$n$", 0.00924923f}, {"$no", 0.012264f}, {"$no$", 0.00620518f},
+	{"$o", 0.0178545f}, {"$p", 0.0685497f}, {"$p$", 0.0168008f},
+	{"$pa", 0.011064f}, {"$pb", 0.0201376f}, {"$pb$", 0.020079f},
+	{"$pr", 0.00813698f}, {"$q", 0.00699546f}, {"$r", 0.0299722f},
+	{"$re", 0.016713f}, {"$s", 0.27376f}, {"$s$", 0.233631f},
+	{"$se", 0.00813698f}, {"$sh", 0.00500512f}, {"$st", 0.0138446f},
+	{"$sta", 0.00661496f}, {"$t", 0.0270745f}, {"$ta", 0.00538563f},
+	{"$u", 0.0281867f}, {"$u$", 0.0131421f}, {"$v", 0.0130836f},
+	{"$w", 0.0118835f}, {"$x", 0.0155422f}, {"$x$", 0.0111225f},
+	{"$y", 0.00532709f}, {"$z", 0.0057076f}, {"$\320\260", 0.100102f},
+	{"$\320\260\320\262", 0.00787355f}, {"$\320\260\320\262\321\202", 0.00602956f}, {"$\320\260\320\262\321\202\320\276", 0.00602956f},
+	{"$\320\260\320\264", 0.0152203f}, {"$\320\260\320\264\321\200", 0.0136104f}, {"$\320\260\320\264\321\200\320\265", 0.0134641f},
+	{"$\320\260\320\273", 0.00778575f}, {"$\320\260\321\200", 0.0328114f}, {"$\320\260\321\200\320\263", 0.0129372f},
+	{"$\320\260\321\200\320\263\321\203", 0.0123226f}, {"$\320\260\321\200\321\205", 0.0154544f}, {"$\320\260\321\200\321\205\320\270", 0.0153373f},
+	{"$\320\260\321\202", 0.00585394f}, {"$\320\260\321\202\321\200", 0.00503439f}, {"$\320\260\321\202\321\200\320\270", 0.00503439f},
+	{"$\320\260\321\203", 0.007054f}, {"$\320\261", 0.112425f}, {"$\320\261\320\260", 0.0210742f},
+	{"$\320\261\320\260\320\267", 0.00567833f}, {"$\320\261\320\260\320\271", 0.00960047f}, {"$\320\261\320\260\320\271\321\202", 0.00936631f},
+	{"$\320\261\320\265", 0.0179131f}, {"$\320\261\320\265\320\267", 0.0127909f}, {"$\320\261\320\265\320\267$", 0.00942485f},
+	{"$\320\261\320\270", 0.0156008f}, {"$\320\261\320\270\321\202", 0.0105956f}, {"$\320\261\320\270\321\202\320\275", 0.00714181f},
+	{"$\320\261\320\273", 0.00892726f}, {"$\320\261\320\273\320\276", 0.00796136f}, {"$\320\261\320\273\320\276\320\272", 0.0076394f},
+	{"$\320\261\320\276", 0.0120299f}, {"$\320\261\320\276\320\273", 0.0106834f}, {"$\320\261\320\276\320\273\321\214", 0.00679058f},
+	{"$\320\261\321\203", 0.0143714f}, {"$\320\261\321\203\320\264", 0.00819552f}, {"$\320\261\321\203\320\264\320\265", 0.00535636f},
+	{"$\320\261\321\213", 0.0268696f}, {"$\320\261\321\213\320\273", 0.00614664f}, {"$\320\261\321\213\321\202", 0.0192595f},
+	{"$\320\261\321\213\321\202\321\214", 0.0192009f}, {"$\320\262", 0.276248f}, {"$\320\262$", 0.113098f},
+	{"$\320\262\320\260", 0.0102151f}, {"$\320\262\320\262", 0.00872238f}, {"$\320\262\320\262\320\276", 0.00559052f},
+	{"$\320\262\320\262\320\276\320\264", 0.00559052f}, {"$\320\262\320\265", 0.0369677f}, {"$\320\262\320\265\321\200", 0.0202546f},
+	{"$\320\262\320\265\321\200\321\201", 0.0154251f}, {"$\320\262\320\265\321\202", 0.0100981f}, {"$\320\262\320\265\321\202\320\272", 0.00567833f},
+	{"$\320\262\320\270", 0.00784429f}, {"$\320\262\320\272", 0.00696619f}, {"$\320\262\320\272\320\273", 0.00696619f},
+	{"$\320\262\320\272\320\273\321\216", 0.00693692f}, {"$\320\262\320\274", 0.00559052f}, {"$\320\262\320\274\320\265", 0.00559052f},
+	{"$\320\262\320\274\320\265\321\201", 0.00547344f}, {"$\320\262\320\275", 0.0195229f}, {"$\320\262\320\275\320\265", 0.00878092f},
+	{"$\320\262\320\275\320\265$", 0.00538563f}, {"$\320\262\320\275\321\203", 0.00766867f}, {"$\320\262\320\275\321\203\321\202", 0.00766867f},
+	{"$\320\262\320\276", 0.01964f}, {"$\320\262\320\276\320\267", 0.00936631f}, {"$\320\262\320\276\320\267\320\274", 0.00518074f},
+	{"$\320\262\321\200", 0.0132006f}, {"$\320\262\321\200\320\265", 0.0120299f}, {"$\320\262\321\200\320\265\320\274", 0.0120006f},
+	{"$\320\262\321\201", 0.0158935f}, {"$\320\262\321\201\320\265", 0.0108005f}, {"$\320\262\321\201\320\265$", 0.00652715f},
+	{"$\320\262\321\205", 0.00828333f}, {"$\320\262\321\205\320\276", 0.00828333f}, {"$\320\262\321\205\320\276\320\264", 0.00816625f},
+	{"$\320\262\321\213", 0.0794966f}, {"$\320\262\321\213$", 0.00676131f}, {"$\320\262\321\213\320\261", 0.00693692f},
+	{"$\320\262\321\213\320\262", 0.0176789f}, {"$\320\262\321\213\320\262\320\276", 0.0147812f}, {"$\320\262\321\213\320\267", 0.00605883f},
+	{"$\320\262\321\213\320\277", 0.0157471f}, {"$\320\262\321\213\320\277\320\276", 0.0148983f}, {"$\320\262\321\213\321\200", 0.0129372f},
+	{"$\320\262\321\213\321\200\320\260", 0.0116493f}, {"$\320\262\321\213\321\205", 0.00766867f}, {"$\320\262\321\213\321\205\320\276", 0.00746378f},
+	{"$\320\263", 0.0373482f}, {"$\320\263\320\265", 0.00752232f}, {"$\320\263\320\265\320\275", 0.00535636f},
+	{"$\320\263\320\265\320\275\320\265", 0.00529782f}, {"$\320\263\321\200", 0.0134055f}, {"$\320\263\321\200\321\203", 0.00807844f},
+	{"$\320\263\321\200\321\203\320\277", 0.00761013f}, {"$\320\264", 0.213025f}, {"$\320\264\320\260", 0.0284502f},
+	{"$\320\264\320\260\320\275", 0.0194936f}, {"$\320\264\320\260\320\275\320\275", 0.0190839f}, {"$\320\264\320\262", 0.00936631f},
+	{"$\320\264\320\262\320\276", 0.00605883f}, {"$\320\264\320\265", 0.0194936f}, {"$\320\264\320\265\320\271", 0.00749305f},
+	{"$\320\264\320\265\320\271\321\201", 0.00743451f}, {"$\320\264\320\270", 0.0228011f}, {"$\320\264\320\270\320\260", 0.0117957f},
+	{"$\320\264\320\270\320\260\320\277", 0.0108298f}, {"$\320\264\320\273", 0.0876628f}, {"$\320\264\320\273\320\270", 0.00998097f},
+	{"$\320\264\320\273\320\270\320\275", 0.00992244f}, {"$\320\264\320\273\321\217", 0.0789404f}, {"$\320\264\320\273\321\217$", 0.0789112f},
+	{"$\320\264\320\276", 0.0626372f}, {"$\320\264\320\276$", 0.00503439f}, {"$\320\264\320\276\320\261", 0.00837114f},
+	{"$\320\264\320\276\320\261\320\260", 0.00816625f}, {"$\320\264\320\276\320\273", 0.0195814f}, {"$\320\264\320\276\320\273\320\266", 0.0186741f},
+	{"$\320\264\320\276\320\277", 0.011181f}, {"$\320\264\320\276\320\277\321\203", 0.00743451f}, {"$\320\264\320\276\321\201", 0.00974682f},
+	{"$\320\264\320\276\321\201\321\202", 0.00974682f}, {"$\320\264\321\200", 0.00711254f}, {"$\320\264\321\200\321\203", 0.00605883f},
+	{"$\320\264\321\200\321\203\320\263", 0.00597102f}, {"$\320\265", 0.0230645f}, {"$\320\265\321\201", 0.0143129f},
+	{"$\320\265\321\201\320\273", 0.0119713f}, {"$\320\265\321\201\320\273\320\270", 0.0119713f}, {"$\320\266", 0.00611737f},
+	{"$\320\267", 0.134202f}, {"$\320\267\320\260", 0.109498f}, {"$\320\267\320\260$", 0.00863457f},
+	{"$\320\267\320\260\320\262", 0.0128787f}, {"$\320\267\320\260\320\262\320\265", 0.00869311f}, {"$\320\267\320\260\320\263", 0.0156593f},
+	{"$\320\267\320\260\320\263\320\276", 0.00758086f}, {"$\320\267\320\260\320\263\321\200", 0.00649788f}, {"$\320\267\320\260\320\264", 0.0173862f},
+	{"$\320\267\320\260\320\264\320\260", 0.0162154f}, {"$\320\267\320\260\320\272", 0.00749305f}, {"$\320\267\320\260\320\274", 0.00892726f},
+	{"$\320\267\320\260\320\274\320\265", 0.0086053f}, {"$\320\267\320\260\320\277", 0.0373189f}, {"$\320\267\320\260\320\277\320\270", 0.0180301f},
+	{"$\320\267\320\260\320\277\321\200", 0.00696619f}, {"$\320\267\320\260\320\277\321\203", 0.00559052f}, {"$\320\267\320\275", 0.0273086f},
+	{"$\320\267\320\275\320\260", 0.0272501f}, {"$\320\267\320\275\320\260\321\207", 0.0258744f}, {"$\320\270", 0.241826f},
+	{"$\320\270$", 0.0405093f}, {"$\320\270\320\263", 0.0114445f}, {"$\320\270\320\263\320\275", 0.0110347f},
+	{"$\320\270\320\263\320\275\320\276", 0.0110054f}, {"$\320\270\320\264", 0.00752232f}, {"$\320\270\320\264\320\265", 0.00696619f},
+	{"$\320\270\320\264\320\265\320\275", 0.00690765f}, {"$\320\270\320\267", 0.0470364f}, {"$\320\270\320\267$", 0.0217767f},
+	{"$\320\270\320\267\320\274", 0.0181472f}, {"$\320\270\320\267\320\274\320\265", 0.0181472f}, {"$\320\270\320\273", 0.029299f},
+	{"$\320\270\320\273\320\270", 0.0288892f}, {"$\320\270\320\273\320\270$", 0.0288892f}, {"$\320\270\320\274", 0.0433192f},
+	{"$\320\270\320\274\320\265", 0.0196985f}, {"$\320\270\320\274\320\265\320\265", 0.00556125f}, {"$\320\270\320\274\320\265\320\275", 0.0120591f},
+	{"$\320\270\320\274\321\217", 0.0206937f}, {"$\320\270\320\274\321\217$", 0.0206644f}, {"$\320\270\320\275", 0.0484121f},
+	{"$\320\270\320\275\320\264", 0.0135519f}, {"$\320\270\320\275\320\264\320\265", 0.0121469f}, {"$\320\270\320\275\321\201", 0.0171521f},
+	{"$\320\270\320\275\321\201\321\202", 0.0171521f}, {"$\320\270\320\275\321\204", 0.0119713f}, {"$\320\270\320\275\321\204\320\276", 0.0117664f},
+	{"$\320\270\321\201", 0.0666179f}, {"$\320\270\321\201\320\277", 0.0521294f}, {"$\320\270\321\201\320\277\320\276", 0.0497293f},
+	{"$\320\270\321\201\321\202", 0.00620518f}, {"$\320\272", 0.209103f}, {"$\320\272$", 0.0101273f},
+	{"$\320\272\320\260", 0.0580126f}, {"$\320\272\320\260\320\272", 0.0164203f}, {"$\320\272\320\260\320\272$", 0.0152203f},
+	{"$\320\272\320\260\321\202", 0.0215132f}, {"$\320\272\320\260\321\202\320\260", 0.0210449f}, {"$\320\272\320\273", 0.0278355f},
+	{"$\320\272\320\273\320\260", 0.00597102f}, {"$\320\272\320\273\321\216", 0.0201668f}, {"$\320\272\320\273\321\216\321\207", 0.0201668f},
+	{"$\320\272\320\276", 0.102883f}, {"$\320\272\320\276\320\264", 0.018557f}, {"$\320\272\320\276\320\264$", 0.00930777f},
+	{"$\320\272\320\276\320\273", 0.0060881f}, {"$\320\272\320\276\320\274", 0.034509f}, {"$\320\272\320\276\320\274\320\260", 0.0145763f},
+	{"$\320\272\320\276\320\274\320\274", 0.00930777f}, {"$\320\272\320\276\320\274\320\277", 0.00936631f}, {"$\320\272\320\276\320\275", 0.0254061f},
+	{"$\320\272\320\276\320\275\321\202", 0.00658569f}, {"$\320\272\320\276\321\200", 0.00725889f}, {"$\320\272\320\276\321\202", 0.00863457f},
+	{"$\320\272\320\276\321\202\320\276", 0.00822479f}, {"$\320\272\321\200", 0.0137568f}, {"$\320\272\321\200\320\260", 0.00983463f},
+	{"$\320\272\321\200\320\260\320\271", 0.00793209f}, {"$\320\273", 0.0316698f}, {"$\320\273\320\260", 0.00509293f},
+	{"$\320\273\320\270", 0.00883946f}, {"$\320\273\320\276", 0.00892726f}, {"$\320\273\320\276\320\272", 0.0057954f},
+	{"$\320\273\320\276\320\272\320\260", 0.00573687f}, {"$\320\274", 0.0867555f}, {"$\320\274\320\260", 0.0241475f},
+	{"$\320\274\320\260\320\272", 0.00506366f}, {"$\320\274\320\265", 0.0216889f}, {"$\320\274\320\265\321\202", 0.00954193f},
+	{"$\320\274\320\265\321\202\320\272", 0.00532709f}, {"$\320\274\320\276", 0.0287429f}, {"$\320\274\320\276\320\264", 0.00503439f},
+	{"$\320\274\320\276\320\266", 0.01443f}, {"$\320\274\320\276\320\266\320\265", 0.0118542f}, {"$\320\275", 0.388146f},
+	{"$\320\275\320\260", 0.0759257f}, {"$\320\275\320\260$", 0.0289185f}, {"$\320\275\320\260\320\267", 0.0076394f},
+	{"$\320\275\320\260\320\271", 0.0136104f}, {"$\320\275\320\260\320\271\320\264", 0.00921996f}, {"$\320\275\320\260\321\201", 0.00740524f},
+	{"$\320\275\320\260\321\201\321\202", 0.00693692f}, {"$\320\275\320\260\321\207", 0.00787355f}, {"$\320\275\320\265", 0.320094f},
+	{"$\320\275\320\265$", 0.150359f}, {"$\320\275\320\265\320\262", 0.0429972f}, {"$\320\275\320\265\320\262\320\265", 0.020401f},
+	{"$\320\275\320\265\320\262\320\276", 0.0215425f}, {"$\320\275\320\265\320\264", 0.0180301f}, {"$\320\275\320\265\320\264\320\276", 0.0166837f},
+	{"$\320\275\320\265\320\270", 0.0177375f}, {"$\320\275\320\265\320\270\320\267", 0.0168594f}, {"$\320\275\320\265\320\272", 0.0166837f},
+	{"$\320\275\320\265\320\272\320\276", 0.016391f}, {"$\320\275\320\265\320\273", 0.00684911f}, {"$\320\275\320\265\320\273\321\214", 0.00684911f},
+	{"$\320\275\320\265\320\276", 0.0192009f}, {"$\320\275\320\265\320\276\320\261", 0.00878092f}, {"$\320\275\320\265\320\276\320\266", 0.00523928f},
+	{"$\320\275\320\265\320\277", 0.0235914f}, {"$\320\275\320\265\320\277\320\276", 0.00980536f}, {"$\320\275\320\265\320\277\321\200", 0.0120884f},
+	{"$\320\275\320\265\321\200", 0.00632226f}, {"$\320\275\320\265\321\200\320\260", 0.00573687f}, {"$\320\275\320\265\321\201", 0.00954193f},
+	{"$\320\275\320\265\321\202", 0.0131421f}, {"$\320\275\320\265\321\202$", 0.0128494f}, {"$\320\275\320\270", 0.00951266f},
+	{"$\320\275\320\276", 0.0337773f}, {"$\320\275\320\276$", 0.00919069f}, {"$\320\275\320\276\320\262", 0.0115615f},
+	{"$\320\275\320\276\320\274", 0.0098639f}, {"$\320\275\320\276\320\274\320\265", 0.00974682f}, {"$\320\275\321\203", 0.00684911f},
+	{"$\320\276", 0.247651f}, {"$\320\276$", 0.0080199f}, {"$\320\276\320\261", 0.0664715f},
+	{"$\320\276\320\261\320\273", 0.0076394f}, {"$\320\276\320\261\320\273\320\260", 0.00749305f}, {"$\320\276\320\261\320\275", 0.0126738f},
+	{"$\320\276\320\261\320\275\320\276", 0.00813698f}, {"$\320\276\320\261\321\200", 0.0160105f}, {"$\320\276\320\261\321\200\320\260", 0.0145763f},
+	{"$\320\276\320\261\321\211", 0.00521001f}, {"$\320\276\320\261\321\212", 0.0153373f}, {"$\320\276\320\261\321\212\320\265", 0.0145178f},
+	{"$\320\276\320\264", 0.0135812f}, {"$\320\276\320\264\320\270", 0.00497585f}, {"$\320\276\320\264\320\275", 0.00863457f},
+	{"$\320\276\320\264\320\275\320\276", 0.00661496f}, {"$\320\276\320\266", 0.0141665f}, {"$\320\276\320\266\320\270", 0.0141665f},
+	{"$\320\276\320\266\320\270\320\264", 0.0141665f}, {"$\320\276\320\272", 0.0066735f}, {"$\320\276\320\275", 0.00611737f},
+	{"$\320\276\320\277", 0.0420606f}, {"$\320\276\320\277\320\265", 0.0212205f}, {"$\320\276\320\277\320\265\321\200", 0.0212205f},
+	{"$\320\276\320\277\321\200", 0.0107713f}, {"$\320\276\320\277\321\200\320\265", 0.0105078f}, {"$\320\276\320\277\321\206", 0.00529782f},
+	{"$\320\276\320\277\321\206\320\270", 0.00529782f}, {"$\320\276\321\201", 0.0142544f}, {"$\320\276\321\201\321\202", 0.00819552f},
+	{"$\320\276\321\201\321\202\320\260", 0.00547344f}, {"$\320\276\321\202", 0.0619055f}, {"$\320\276\321\202$", 0.00500512f},
+	{"$\320\276\321\202\320\272", 0.01443f}, {"$\320\276\321\202\320\272\321\200", 0.00904434f}, {"$\320\276\321\202\320\273", 0.00538563f},
+	{"$\320\276\321\202\321\201", 0.0152788f}, {"$\320\276\321\202\321\201\321\203", 0.0132006f}, {"$\320\276\321\210", 0.0419728f},
+	{"$\320\276\321\210\320\270", 0.0419435f}, {"$\320\276\321\210\320\270\320\261", 0.0419435f}, {"$\320\277", 0.372486f},
+	{"$\320\277\320\260", 0.0695741f}, {"$\320\277\320\260\320\272", 0.0188497f}, {"$\320\277\320\260\320\272\320\265", 0.0183814f},
+	{"$\320\277\320\260\320\274", 0.00582467f}, {"$\320\277\320\260\320\274\321\217", 0.00564906f}, {"$\320\277\320\260\321\200", 0.0392214f},
+	{"$\320\277\320\260\321\200\320\260", 0.0318162f}, {"$\320\277\320\260\321\200\320\276", 0.00614664f}, {"$\320\277\320\265", 0.0620811f},
+	{"$\320\277\320\265\321\200", 0.0575735f}, {"$\320\277\320\265\321\200\320\262", 0.00617591f}, {"$\320\277\320\265\321\200\320\265", 0.050461f},
+	{"$\320\277\320\273", 0.00699546f}, {"$\320\277\320\276", 0.163764f}, {"$\320\277\320\276$", 0.0240304f},
+	{"$\320\277\320\276\320\262", 0.0121177f}, {"$\320\277\320\276\320\262\321\200", 0.00547344f}, {"$\320\277\320\276\320\262\321\202", 0.00518074f},
+	{"$\320\277\320\276\320\264", 0.0455437f}, {"$\320\277\320\276\320\264\320\264", 0.0173569f}, {"$\320\277\320\276\320\264\320\277", 0.0101273f},
+	{"$\320\277\320\276\320\272", 0.0103908f}, {"$\320\277\320\276\320\272\320\260", 0.0100688f}, {"$\320\277\320\276\320\273", 0.0400117f},
+	{"$\320\277\320\276\320\273\320\265", 0.00591248f}, {"$\320\277\320\276\320\273\321\203", 0.0128201f}, {"$\320\277\320\276\320\273\321\214", 0.0132885f},
+	{"$\320\277\320\276\320\274", 0.00819552f}, {"$\320\277\320\276\320\277", 0.00556125f}, {"$\320\277\320\276\321\200", 0.00567833f},
+	{"$\320\277\320\276\321\201", 0.0187034f}, {"$\320\277\320\276\321\201\320\273", 0.0162154f}, {"$\320\277\320\276\321\202", 0.00526855f},
+	{"$\320\277\321\200", 0.145705f}, {"$\320\277\321\200\320\260", 0.00758086f}, {"$\320\277\321\200\320\260\320\262", 0.00687838f},
+	{"$\320\277\321\200\320\265", 0.0420313f}, {"$\320\277\321\200\320\265\320\264", 0.0310552f}, {"$\320\277\321\200\320\270", 0.0458364f},
+	{"$\320\277\321\200\320\270$", 0.0235914f}, {"$\320\277\321\200\320\270\320\274", 0.00564906f}, {"$\320\277\321\200\320\270\320\275", 0.00567833f},
+	{"$\320\277\321\200\320\276", 0.063808f}, {"$\320\277\321\200\320\276\320\261", 0.00523928f}, {"$\320\277\321\200\320\276\320\262", 0.00901507f},
+	{"$\320\277\321\200\320\276\320\263", 0.00921996f}, {"$\320\277\321\200\320\276\320\270", 0.00588321f}, {"$\320\277\321\200\320\276\320\277", 0.00743451f},
+	{"$\320\277\321\200\320\276\321\206", 0.0083126f}, {"$\320\277\321\200\320\276\321\207", 0.00620518f}, {"$\320\277\321\203", 0.0151617f},
+	{"$\320\277\321\203\321\201", 0.00643934f}, {"$\320\277\321\203\321\201\321\202", 0.00643934f}, {"$\320\277\321\203\321\202", 0.00717108f},
+	{"$\321\200", 0.158466f}, {"$\321\200\320\260", 0.0902971f}, {"$\321\200\320\260\320\261", 0.0108591f},
+	{"$\321\200\320\260\320\261\320\276", 0.0106834f}, {"$\321\200\320\260\320\262", 0.0051222f}, {"$\321\200\320\260\320\267", 0.0562857f},
+	{"$\321\200\320\260\320\267\320\264", 0.0264306f}, {"$\321\200\320\260\320\267\320\274", 0.0157471f}, {"$\321\200\320\260\320\267\321\200", 0.00652715f},
+	{"$\321\200\320\260\321\201", 0.0152203f}, {"$\321\200\320\260\321\201\320\277", 0.00515147f}, {"$\321\200\320\260\321\201\321\210", 0.00632226f},
+	{"$\321\200\320\265", 0.0624616f}, {"$\321\200\320\265\320\263", 0.0231523f}, {"$\321\200\320\265\320\263\320\270", 0.02084f},
+	{"$\321\200\320\265\320\266", 0.0107127f}, {"$\321\200\320\265\320\266\320\270", 0.0107127f}, {"$\321\200\320\265\320\277", 0.00526855f},
+	{"$\321\200\320\265\320\277\320\276", 0.00526855f}, {"$\321\200\320\265\321\201", 0.0112396f}, {"$\321\200\320\265\321\201\320\277", 0.00930777f},
+	{"$\321\201", 0.333324f}, {"$\321\201$", 0.048617f}, {"$\321\201\320\260", 0.0106249f},
+	{"$\321\201\320\261", 0.0105371f}, {"$\321\201\320\261\320\276", 0.00819552f}, {"$\321\201\320\261\320\276\320\271", 0.0063808f},
+	{"$\321\201\320\262", 0.00769794f}, {"$\321\201\320\265", 0.0312015f}, {"$\321\201\320\265\321\200", 0.0148105f},
+	{"$\321\201\320\265\321\200\320\262", 0.00600029f}, {"$\321\201\320\265\321\200\321\202", 0.00737597f}, {"$\321\201\320\270", 0.0580419f},
+	{"$\321\201\320\270\320\274", 0.0366164f}, {"$\321\201\320\270\320\274\320\262", 0.0361774f}, {"$\321\201\320\270\320\275", 0.00684911f},
+	{"$\321\201\320\270\321\201", 0.00916142f}, {"$\321\201\320\270\321\201\321\202", 0.00904434f}, {"$\321\201\320\272", 0.00796136f},
+	{"$\321\201\320\273", 0.0316698f}, {"$\321\201\320\273\320\265", 0.00559052f}, {"$\321\201\320\273\320\265\320\264", 0.00526855f},
+	{"$\321\201\320\273\320\270", 0.0174155f}, {"$\321\201\320\273\320\270\321\210", 0.0119713f}, {"$\321\201\320\273\320\276", 0.00559052f},
+	{"$\321\201\320\274", 0.0151032f}, {"$\321\201\320\274\320\265", 0.0112396f}, {"$\321\201\320\274\320\265\321\211", 0.00878092f},
+	{"$\321\201\320\276", 0.0780331f}, {"$\321\201\320\276\320\262", 0.00799063f}, {"$\321\201\320\276\320\264", 0.0150739f},
+	{"$\321\201\320\276\320\264\320\265", 0.0148983f}, {"$\321\201\320\276\320\267", 0.0192302f}, {"$\321\201\320\276\320\267\320\264", 0.0192302f},
+	{"$\321\201\320\276\320\276", 0.0123226f}, {"$\321\201\320\276\320\276\320\261", 0.00842968f}, {"$\321\201\320\276\321\201", 0.00646861f},
+	{"$\321\201\320\276\321\201\321\202", 0.0063808f}, {"$\321\201\320\277", 0.0256695f}, {"$\321\201\320\277\320\265", 0.00796136f},
+	{"$\321\201\320\277\320\265\321\206", 0.00787355f}, {"$\321\201\320\277\320\270", 0.0128787f}, {"$\321\201\320\277\320\270\321\201", 0.0127616f},
+	{"$\321\201\321\200", 0.00626372f}, {"$\321\201\321\201", 0.015513f}, {"$\321\201\321\201\321\213", 0.0152788f},
+	{"$\321\201\321\201\321\213\320\273", 0.0152788f}, {"$\321\201\321\202", 0.0497293f}, {"$\321\201\321\202\320\260", 0.0130836f},
+	{"$\321\201\321\202\320\260\320\275", 0.00523928f}, {"$\321\201\321\202\320\260\321\200", 0.00515147f}, {"$\321\201\321\202\321\200", 0.0310552f},
+	{"$\321\201\321\202\321\200\320\276", 0.0268696f}, {"$\321\201\321\203", 0.0158056f}, {"$\321\201\321\203\321\211", 0.00778575f},
+	{"$\321\201\321\203\321\211\320\265", 0.00769794f}, {"$\321\202", 0.106161f}, {"$\321\202\320\260", 0.0228597f},
+	{"$\321\202\320\260\320\261", 0.00919069f}, {"$\321\202\320\260\320\261\320\273", 0.00781502f}, {"$\321\202\320\260\320\272", 0.00807844f},
+	{"$\321\202\320\265", 0.017474f}, {"$\321\202\320\265\320\272", 0.00840041f}, {"$\321\202\320\265\320\272\321\203", 0.00529782f},
+	{"$\321\202\320\270", 0.0200205f}, {"$\321\202\320\270\320\277", 0.0179423f}, {"$\321\202\320\270\320\277$", 0.0123226f},
+	{"$\321\202\320\276", 0.0318747f}, {"$\321\202\320\276$", 0.00567833f}, {"$\321\202\320\276\320\273", 0.0165959f},
+	{"$\321\202\320\276\320\273\321\214", 0.0165374f}, {"$\321\202\320\276\321\207", 0.00503439f}, {"$\321\202\321\200", 0.0165374f},
+	{"$\321\202\321\200\320\265", 0.0120006f}, {"$\321\202\321\200\320\265\320\261", 0.0112688f}, {"$\321\203", 0.152407f},
+	{"$\321\203$", 0.00547344f}, {"$\321\203\320\264", 0.0632226f}, {"$\321\203\320\264\320\260", 0.0619347f},
+	{"$\321\203\320\264\320\260\320\273", 0.0591248f}, {"$\321\203\320\266", 0.0063808f}, {"$\321\203\320\266\320\265", 0.0063808f},
+	{"$\321\203\320\266\320\265$", 0.0063808f}, {"$\321\203\320\272", 0.0268403f}, {"$\321\203\320\272\320\260", 0.0261671f},
+	{"$\321\203\320\272\320\260\320\267", 0.0247036f}, {"$\321\203\320\274", 0.0135226f}, {"$\321\203\320\274\320\276", 0.0120884f},
+	{"$\321\203\320\274\320\276\320\273", 0.0120884f}, {"$\321\203\320\277", 0.00816625f}, {"$\321\203\320\277\321\200", 0.00538563f},
+	{"$\321\203\320\277\321\200\320\260", 0.00526855f}, {"$\321\203\321\201", 0.0275135f}, {"$\321\203\321\201\321\202", 0.0220108f},
+	{"$\321\203\321\201\321\202\320\260", 0.0192595f}, {"$\321\204", 0.118279f}, {"$\321\204\320\260", 0.0837992f},
+	{"$\321\204\320\260\320\271", 0.0828333f}, {"$\321\204\320\260\320\271\320\273", 0.0827162f}, {"$\321\204\320\276", 0.016391f},
+	{"$\321\204\320\276\321\200", 0.0139031f}, {"$\321\204\320\276\321\200\320\274", 0.0135812f}, {"$\321\204\321\200", 0.00526855f},
+	{"$\321\204\321\203", 0.00749305f}, {"$\321\204\321\203\320\275", 0.00681984f}, {"$\321\204\321\203\320\275\320\272", 0.00652715f},
+	{"$\321\205", 0.0167423f}, {"$\321\205\320\276", 0.00532709f}, {"$\321\206", 0.0165374f},
+	{"$\321\206\320\265", 0.0105664f}, {"$\321\206\320\265\320\273", 0.00875165f}, {"$\321\207", 0.0510464f},
+	{"$\321\207\320\260", 0.00629299f}, {"$\321\207\320\260\321\201", 0.00529782f}, {"$\321\207\320\265", 0.00869311f},
+	{"$\321\207\320\270", 0.0118835f}, {"$\321\207\320\270\321\201", 0.00916142f}, {"$\321\207\320\270\321\201\320\273", 0.00837114f},
+	{"$\321\207\321\202", 0.0231816f}, {"$\321\207\321\202\320\265", 0.00743451f}, {"$\321\207\321\202\320\265\320\275", 0.00743451f},
+	{"$\321\207\321\202\320\276", 0.0157471f}, {"$\321\207\321\202\320\276$", 0.00875165f}, {"$\321\207\321\202\320\276\320\261", 0.00752232f},
+	{"$\321\210", 0.0167715f}, {"$\321\210\320\260", 0.00605883f}, {"$\321\210\320\270", 0.00500512f},
+	{"$\321\215", 0.0481487f}, {"$\321\215\320\272", 0.0057076f}, {"$\321\215\320\273", 0.0134641f},
+	{"$\321\215\320\273\320\265", 0.0115615f}, {"$\321\215\320\273\320\265\320\274", 0.0100395f}, {"$\321\215\321\202", 0.0228597f},
+	{"$\321\215\321\202\320\276", 0.0192302f}, {"$\321\215\321\202\320\276$", 0.00766867f}, {"$\321\217", 0.0262549f},
+	{"$\321\217\320\262", 0.011064f}, {"$\321\217\320\262\320\273", 0.0100981f}, {"$\321\217\320\262\320\273\321\217", 0.0100981f},
+	{"$\321\217\320\267", 0.0113859f}, {"$\321\217\320\267\321\213", 0.0113859f}, {"$\321\217\320\267\321\213\320\272", 0.0113859f},
+	{"0$", 0.0158056f}, {"0s", 0.00620518f}, {"0s$", 0.00620518f},
+	{"0x", 0.00998097f}, {"0x$", 0.00933704f}, {"1$", 0.011503f},
+	{"2$", 0.0150154f}, {"25", 0.00834187f}, {"250", 0.00561979f},
+	{"250s", 0.00559052f}, {"250s$", 0.00559052f}, {"3$", 0.00594175f},
+	{"32", 0.00564906f}, {"4$", 0.00901507f}, {"50", 0.00775648f},
+	{"50s", 0.00591248f}, {"50s$", 0.00591248f}, {"6$", 0.00775648f},
+	{"8$", 0.0057954f}, {"a$", 0.0208108f}, {"ab", 0.00933704f},
+	{"ac", 0.0117664f}, {"ad", 0.0115323f}, {"ad$", 0.00506366f},
+	{"ag", 0.00564906f}, {"al", 0.017796f}, {"all", 0.00591248f},
+	{"am", 0.0113274f}, {"ame", 0.0060881f}, {"an", 0.0103908f},
+	{"ap", 0.00945412f}, {"ar", 0.0215425f}, {"as", 0.0122933f},
+	{"at", 0.0208108f}, {"at$", 0.00576613f}, {"b$", 0.0315235f},
+	{"ba", 0.00500512f}, {"bi", 0.00769794f}, {"bl", 0.00515147f},
+	{"bu", 0.00679058f}, {"c$", 0.0322845f}, {"ca", 0.00933704f},
+	{"ce", 0.0089858f}, {"ce$", 0.00655642f}, {"ch", 0.013347f},
+	{"ch$", 0.00538563f}, {"ck", 0.0100102f}, {"ck$", 0.00614664f},
+	{"co", 0.0187619f}, {"com", 0.00506366f}, {"con", 0.00693692f},
+	{"cr", 0.00673204f}, {"ct", 0.0108298f}, {"d$", 0.0797893f},
+	{"da", 0.00714181f}, {"de", 0.023328f}, {"deb", 0.0051222f},
+	{"di", 0.0132885f}, {"do", 0.00521001f}, {"e$", 0.0661496f},
+	{"ea", 0.0112981f}, {"ead", 0.00564906f}, {"eb", 0.00722962f},
+	{"ec", 0.0128787f}, {"ect", 0.0063808f}, {"ed", 0.00813698f},
+	{"ed$", 0.00573687f}, {"ef", 0.00904434f}, {"el", 0.0170935f},
+	{"em", 0.00708327f}, {"en", 0.019318f}, {"ent", 0.00600029f},
+	{"er", 0.0295624f}, {"er$", 0.00968828f}, {"es", 0.017474f},
+	{"es$", 0.00883946f}, {"et", 0.0134348f}, {"et$", 0.00661496f},
+	{"ex", 0.0107127f}, {"f$", 0.0268696f}, {"ff", 0.00740524f},
+	{"fi", 0.0139909f}, {"fil", 0.00673204f}, {"file", 0.00632226f},
+	{"file$", 0.00497585f}, {"fo", 0.00842968f}, {"g$", 0.0217181f},
+	{"ge", 0.00992244f}, {"gi", 0.017474f}, {"git", 0.0127323f},
+	{"git$", 0.0120006f}, {"gn", 0.00895653f}, {"h$", 0.0197278f},
+	{"he", 0.0123811f}, {"i$", 0.0142544f}, {"ic", 0.0106834f},
+	{"id", 0.0100688f}, {"id$", 0.00696619f}, {"if", 0.00526855f},
+	{"ig", 0.00790282f}, {"il", 0.0116786f}, {"ile", 0.00711254f},
+	{"ile$", 0.00518074f}, {"im", 0.00641007f}, {"in", 0.0355627f},
+	{"in$", 0.00681984f}, {"int", 0.00547344f}, {"io", 0.00983463f},
+	{"ion", 0.00837114f}, {"ion$", 0.00652715f}, {"ip", 0.00617591f},
+	{"ir", 0.00588321f}, {"is", 0.00919069f}, {"it", 0.0232402f},
+	{"it$", 0.0169179f}, {"ix", 0.00497585f}, {"k$", 0.0139909f},
+	{"ke", 0.00535636f}, {"l$", 0.0329577f}, {"la", 0.00807844f},
+	{"ld", 0.0113274f}, {"ld$", 0.00936631f}, {"le", 0.0189082f},
+	{"le$", 0.0109761f}, {"li", 0.0172399f}, {"lin", 0.00641007f},
+	{"ll", 0.0112688f}, {"ll$", 0.00749305f}, {"lo", 0.0162154f},
+	{"loc", 0.00652715f}, {"ls", 0.00652715f}, {"lt", 0.00623445f},
+	{"lu", 0.00901507f}, {"lu$", 0.00617591f}, {"lx", 0.0080199f},
+	{"lx$", 0.0080199f}, {"m$", 0.0176204f}, {"ma", 0.0161569f},
+	{"mb", 0.00532709f}, {"me", 0.0158349f}, {"me$", 0.00614664f},
+	{"mi", 0.00881019f}, {"mm", 0.00535636f}, {"mo", 0.00755159f},
+	{"mp", 0.00737597f}, {"n$", 0.0351529f}, {"na", 0.0086053f},
+	{"nc", 0.00696619f}, {"nd", 0.0126152f}, {"ne", 0.0103908f},
+	{"nf", 0.00529782f}, {"ng", 0.00793209f}, {"no", 0.0171813f},
+	{"no$", 0.00761013f}, {"ns", 0.00749305f}, {"nt", 0.0184107f},
+	{"nt$", 0.00810771f}, {"nu", 0.0105078f}, {"o$", 0.0231816f},
+	{"oc", 0.0118542f}, {"od", 0.00629299f}, {"of", 0.00576613f},
+	{"ol", 0.00673204f}, {"om", 0.00825406f}, {"on", 0.0221572f},
+	{"on$", 0.0100688f}, {"op", 0.00939558f}, {"or", 0.0211913f},
+	{"os", 0.00655642f}, {"ot", 0.00755159f}, {"ou", 0.00737597f},
+	{"ow", 0.00591248f}, {"p$", 0.0413288f}, {"pa", 0.0161862f},
+	{"pb", 0.0201961f}, {"pb$", 0.0201083f}, {"pc", 0.00626372f},
+	{"pe", 0.0110054f}, {"pi", 0.00749305f}, {"pl", 0.00684911f},
+	{"po", 0.0066735f}, {"pr", 0.0117664f}, {"ps", 0.00822479f},
+	{"pt", 0.00646861f}, {"pu", 0.00670277f}, {"r$", 0.0300893f},
+	{"ra", 0.0112688f}, {"rc", 0.00746378f}, {"re", 0.0367042f},
+	{"re$", 0.0063808f}, {"ri", 0.0122933f}, {"rl", 0.00559052f},
+	{"rm", 0.0076394f}, {"ro", 0.0127031f}, {"rs", 0.00778575f},
+	{"rt", 0.00913215f}, {"rt$", 0.00521001f}, {"s$", 0.273848f},
+	{"sa", 0.00588321f}, {"sc", 0.00632226f}, {"se", 0.0218938f},
+	{"se$", 0.00728816f}, {"sh", 0.00992244f}, {"si", 0.0115615f},
+	{"so", 0.00564906f}, {"sp", 0.00766867f}, {"ss", 0.00863457f},
+	{"st", 0.0278355f}, {"st$", 0.00518074f}, {"sta", 0.00913215f},
+	{"str", 0.00503439f}, {"sy", 0.00561979f}, {"t$", 0.0657983f},
+	{"ta", 0.0205473f}, {"te", 0.0201961f}, {"te$", 0.0066735f},
+	{"th", 0.00681984f}, {"ti", 0.013025f}, {"to", 0.0121177f},
+	{"tr", 0.0139031f}, {"tt", 0.00564906f}, {"ty", 0.00687838f},
+	{"u$", 0.0296795f}, {"ul", 0.00573687f}, {"un", 0.0103615f},
+	{"up", 0.00500512f}, {"ur", 0.00775648f}, {"us", 0.00775648f},
+	{"ut", 0.00813698f}, {"v$", 0.00714181f}, {"ve", 0.0132885f},
+	{"ver", 0.00749305f}, {"w$", 0.00840041f}, {"wa", 0.00547344f},
+	{"x$", 0.0373774f}, {"y$", 0.0173569f}, {"\320\260$", 0.342866f},
+	{"\320\260\320\261", 0.0486755f}, {"\320\260\320\261\320\273", 0.015191f}, {"\320\260\320\261\320\273\320\270", 0.00772721f},
+	{"\320\260\320\261\320\273\320\270\321\206", 0.0076394f}, {"\320\260\320\261\320\273\320\276", 0.00567833f}, {"\320\260\320\261\320\276", 0.02084f},
+	{"\320\260\320\261\320\276\321\202", 0.013669f}, {"\320\260\320\261\320\276\321\202\320\260", 0.00646861f}, {"\320\260\320\261\320\276\321\207", 0.00506366f},
+	{"\320\260\320\262", 0.0957413f}, {"\320\260\320\262\320\260", 0.0113567f}, {"\320\260\320\262\320\265", 0.0118542f},
+	{"\320\260\320\262\320\265\321\200", 0.00968828f}, {"\320\260\320\262\320\265\321\200\321\210", 0.00910288f}, {"\320\260\320\262\320\270", 0.029738f},
+	{"\320\260\320\262\320\270\320\273", 0.0123518f}, {"\320\260\320\262\320\270\320\273\321\214", 0.0099517f}, {"\320\260\320\262\320\270\321\202", 0.00670277f},
+	{"\320\260\320\262\320\270\321\202\321\214", 0.00602956f}, {"\320\260\320\262\320\273", 0.0201083f}, {"\320\260\320\262\320\273\320\265", 0.00977609f},
+	{"\320\260\320\262\320\273\320\265\320\275", 0.00977609f}, {"\320\260\320\262\320\273\321\217", 0.00819552f}, {"\320\260\320\262\320\275", 0.0100395f},
+	{"\320\260\320\262\321\202", 0.0060881f}, {"\320\260\320\262\321\202\320\276", 0.00605883f}, {"\320\260\320\263", 0.0301185f},
+	{"\320\260\320\263\320\276", 0.00936631f}, {"\320\260\320\263\320\276\320\273", 0.00749305f}, {"\320\260\320\263\320\276\320\273\320\276", 0.00740524f},
+	{"\320\260\320\263\321\200", 0.00758086f}, {"\320\260\320\263\321\200\321\203", 0.00687838f}, {"\320\260\320\263\321\200\321\203\320\267", 0.00521001f},
+	{"\320\260\320\264", 0.0584809f}, {"\320\260\320\264\320\260", 0.0231231f}, {"\320\260\320\264\320\260\320\275", 0.011503f},
+	{"\320\260\320\264\320\265", 0.00559052f}, {"\320\260\320\264\321\200", 0.0147227f}, {"\320\260\320\264\321\200\320\265", 0.0137275f},
+	{"\320\260\320\264\321\200\320\265\321\201", 0.0135812f}, {"\320\260\320\265", 0.0682277f}, {"\320\260\320\265\320\274", 0.0151617f},
+	{"\320\260\320\265\320\274\321\213", 0.00892726f}, {"\320\260\320\265\321\202", 0.0529782f}, {"\320\260\320\265\321\202$", 0.021484f},
+	{"\320\260\320\265\321\202\321\201", 0.0321089f}, {"\320\260\320\265\321\202\321\201\321\217", 0.0321089f}, {"\320\260\320\266", 0.0238256f},
+	{"\320\260\320\266\320\265", 0.0146641f}, {"\320\260\320\266\320\265\320\275", 0.0127323f}, {"\320\260\320\266\320\265\320\275\320\270", 0.0125274f},
+	{"\320\260\320\267", 0.124074f}, {"\320\260\320\267\320\260", 0.0316698f}, {"\320\260\320\267\320\260\320\275", 0.0166545f},
+	{"\320\260\320\267\320\260\320\275\320\275", 0.00602956f}, {"\320\260\320\267\320\260\321\202", 0.0108298f}, {"\320\260\320\267\320\260\321\202\321\214", 0.00816625f},
+	{"\320\260\320\267\320\264", 0.0265769f}, {"\320\260\320\267\320\264\320\265", 0.0265476f}, {"\320\260\320\267\320\264\320\265\320\273", 0.0265476f},
+	{"\320\260\320\267\320\274", 0.0158056f}, {"\320\260\320\267\320\274\320\265", 0.0152495f}, {"\320\260\320\267\320\274\320\265\321\200", 0.0144885f},
+	{"\320\260\320\267\320\275", 0.00670277f}, {"\320\260\320\267\320\275\320\260", 0.0054149f}, {"\320\260\320\267\320\275\320\260\321\207", 0.0054149f},
+	{"\320\260\320\267\320\276", 0.0198741f}, {"\320\260\320\267\320\276\320\262", 0.00635153f}, {"\320\260\320\267\320\276\320\275", 0.0108298f},
+	{"\320\260\320\267\320\276\320\275\320\260", 0.00717108f}, {"\320\260\320\267\321\200", 0.00746378f}, {"\320\260\320\267\321\200\320\265", 0.00673204f},
+	{"\320\260\320\267\321\200\320\265\321\210", 0.00643934f}, {"\320\260\320\267\321\213", 0.00796136f}, {"\320\260\320\267\321\213\320\262", 0.00614664f},
+	{"\320\260\320\267\321\213\320\262\320\260", 0.00614664f}, {"\320\260\320\271", 0.128084f}, {"\320\260\320\271$", 0.00886873f},
+	{"\320\260\320\271\320\264", 0.0103615f}, {"\320\260\320\271\320\264\320\265", 0.0092785f}, {"\320\260\320\271\320\264\320\265\320\275", 0.00921996f},
+	{"\320\260\320\271\320\273", 0.0835651f}, {"\320\260\320\271\320\273$", 0.0353286f}, {"\320\260\320\271\320\273\320\260", 0.025933f},
+	{"\320\260\320\271\320\273\320\260$", 0.023767f}, {"\320\260\320\271\320\273\320\265", 0.00556125f}, {"\320\260\320\271\320\273\320\265$", 0.00529782f},
+	{"\320\260\320\271\320\273\320\276", 0.0154544f}, {"\320\260\320\271\320\273\320\276\320\262", 0.0135226f}, {"\320\260\320\271\320\273\321\213", 0.0076394f},
+	{"\320\260\320\271\320\273\321\213$", 0.0076394f}, {"\320\260\320\271\321\202", 0.0161276f}, {"\320\260\320\271\321\202$", 0.0057076f},
+	{"\320\260\320\272", 0.0740817f}, {"\320\260\320\272$", 0.0185863f}, {"\320\260\320\272\320\265", 0.0189082f},
+	{"\320\260\320\272\320\265\321\202", 0.0184692f}, {"\320\260\320\272\320\265\321\202$", 0.0057076f}, {"\320\260\320\272\320\265\321\202\320\260", 0.00582467f},
+	{"\320\260\320\272\320\276", 0.01042f}, {"\320\260\320\272\321\200", 0.00582467f}, {"\320\260\320\272\321\201", 0.00778575f},
+	{"\320\260\320\272\321\201\320\270", 0.00632226f}, {"\320\260\320\273", 0.149246f}, {"\320\260\320\273$", 0.00629299f},
+	{"\320\260\320\273\320\260", 0.00834187f}, {"\320\260\320\273\320\265", 0.0119128f}, {"\320\260\320\273\320\265\320\275", 0.00857603f},
+	{"\320\260\320\273\320\270", 0.0191131f}, {"\320\260\320\273\320\270\320\267", 0.0057076f}, {"\320\260\320\273\320\270\321\202", 0.00737597f},
+	{"\320\260\320\273\320\270\321\202\321\214", 0.00670277f}, {"\320\260\320\273\320\276", 0.0663545f}, {"\320\260\320\273\320\276\320\263", 0.0212791f},
+	{"\320\260\320\273\320\276\320\263$", 0.0111225f}, {"\320\260\320\273\320\276\321\201", 0.0444022f}, {"\320\260\320\273\320\276\321\201\321\214", 0.0444022f},
+	{"\320\260\320\273\321\214", 0.031143f}, {"\320\260\320\273\321\214\320\275", 0.021923f}, {"\320\260\320\273\321\214\320\275\320\276", 0.00799063f},
+	{"\320\260\320\273\321\214\320\275\321\213", 0.0117664f}, {"\320\260\320\274", 0.084531f}, {"\320\260\320\274$", 0.00597102f},
+	{"\320\260\320\274\320\265", 0.0389873f}, {"\320\260\320\274\320\265\321\202", 0.0321967f}, {"\320\260\320\274\320\265\321\202\321\200", 0.0294453f},
+	{"\320\260\320\274\320\270", 0.0171228f}, {"\320\260\320\274\320\270$", 0.0129372f}, {"\320\260\320\274\320\274", 0.00989317f},
+	{"\320\260\320\274\321\217", 0.0057076f}, {"\320\260\320\274\321\217\321\202", 0.00564906f}, {"\320\260\320\275", 0.250256f},
+	{"\320\260\320\275$", 0.0227426f}, {"\320\260\320\275\320\260", 0.0146934f}, {"\320\260\320\275\320\260$", 0.00796136f},
+	{"\320\260\320\275\320\263", 0.00553198f}, {"\320\260\320\275\320\264", 0.0402166f}, {"\320\260\320\275\320\264$", 0.00878092f},
+	{"\320\260\320\275\320\264\320\260", 0.0138446f}, {"\320\260\320\275\320\264\320\260$", 0.00787355f}, {"\320\260\320\275\320\264\320\260\321\200", 0.00535636f},
+	{"\320\260\320\275\320\264\321\213", 0.00559052f}, {"\320\260\320\275\320\264\321\213$", 0.00559052f}, {"\320\260\320\275\320\270", 0.0760427f},
+	{"\320\260\320\275\320\270\320\265", 0.0283624f}, {"\320\260\320\275\320\270\320\265$", 0.0273379f}, {"\320\260\320\275\320\270\320\270", 0.00547344f},
+	{"\320\260\320\275\320\270\320\270$", 0.00547344f}, {"\320\260\320\275\320\270\321\216", 0.0129958f}, {"\320\260\320\275\320\270\321\216$", 0.0129958f},
+	{"\320\260\320\275\320\270\321\217", 0.0197863f}, {"\320\260\320\275\320\270\321\217$", 0.0194351f}, {"\320\260\320\275\320\275", 0.0588321f},
+	{"\320\260\320\275\320\275\320\276", 0.0128201f}, {"\320\260\320\275\320\275\321\213", 0.0423533f}, {"\320\260\320\275\320\275\321\213\320\265", 0.0113859f},
+	{"\320\260\320\275\320\275\321\213\320\271", 0.0146056f}, {"\320\260\320\275\320\275\321\213\321\205", 0.0152203f}, {"\320\260\320\275\320\276", 0.0305283f},
+	{"\320\260\320\275\320\276$", 0.00883946f}, {"\320\260\320\275\320\276\320\262", 0.0210449f}, {"\320\260\320\275\320\276\320\262\320\270", 0.00752232f},
+	{"\320\260\320\275\320\276\320\262\320\272", 0.00679058f}, {"\320\260\320\275\320\276\320\262\320\273", 0.00614664f}, {"\320\260\320\275\321\201", 0.0120884f},
+	{"\320\260\320\275\321\201\320\272", 0.00825406f}, {"\320\260\320\275\321\201\320\272\320\270", 0.00564906f}, {"\320\260\320\275\321\202", 0.00901507f},
+	{"\320\260\320\277", 0.0584809f}, {"\320\260\320\277\320\260", 0.0130836f}, {"\320\260\320\277\320\260\320\267", 0.0108298f},
+	{"\320\260\320\277\320\260\320\267\320\276", 0.0108298f}, {"\320\260\320\277\320\270", 0.0203425f}, {"\320\260\320\277\320\270\321\201", 0.0199912f},
+	{"\320\260\320\277\320\270\321\201\320\270", 0.00807844f}, {"\320\260\320\277\320\270\321\201\321\214", 0.00655642f}, {"\320\260\320\277\321\200", 0.0102151f},
+	{"\320\260\320\277\321\203", 0.00652715f}, {"\320\260\320\277\321\203\321\201", 0.00526855f}, {"\320\260\321\200", 0.12144f},
+	{"\320\260\321\200\320\260", 0.0403337f}, {"\320\260\321\200\320\260\320\274", 0.0295917f}, {"\320\260\321\200\320\260\320\274\320\265", 0.0295917f},
+	{"\320\260\321\200\320\263", 0.013347f}, {"\320\260\321\200\320\263\321\203", 0.0123811f}, {"\320\260\321\200\320\263\321\203\320\274", 0.0123226f},
+	{"\320\260\321\200\320\265", 0.0060881f}, {"\320\260\321\200\320\270", 0.00916142f}, {"\320\260\321\200\320\276", 0.00992244f},
+	{"\320\260\321\200\320\276\320\273", 0.0060881f}, {"\320\260\321\200\321\202", 0.00904434f}, {"\320\260\321\200\321\202\320\275", 0.00518074f},
+	{"\320\260\321\200\321\203", 0.00602956f}, {"\320\260\321\200\321\205", 0.0158642f}, {"\320\260\321\200\321\205\320\270", 0.0154544f},
+	{"\320\260\321\200\321\205\320\270\320\262", 0.00962974f}, {"\320\260\321\200\321\205\320\270\321\202", 0.00576613f}, {"\320\260\321\201", 0.0672911f},
+	{"\320\260\321\201\320\275", 0.00518074f}, {"\320\260\321\201\320\277", 0.00965901f}, {"\320\260\321\201\320\277\320\276", 0.00743451f},
+	{"\320\260\321\201\320\277\320\276\320\267", 0.0057954f}, {"\320\260\321\201\321\201", 0.00892726f}, {"\320\260\321\201\321\202", 0.0219816f},
+	{"\320\260\321\201\321\202\321\200", 0.007054f}, {"\320\260\321\201\321\202\321\200\320\276", 0.00673204f}, {"\320\260\321\201\321\202\321\214", 0.00790282f},
+	{"\320\260\321\201\321\202\321\214$", 0.00746378f}, {"\320\260\321\201\321\210", 0.00687838f}, {"\320\260\321\201\321\210\320\270", 0.00635153f},
+	{"\320\260\321\201\321\210\320\270\321\200", 0.00591248f}, {"\320\260\321\202", 0.208957f}, {"\320\260\321\202$", 0.0135519f},
+	{"\320\260\321\202\320\260", 0.03407f}, {"\320\260\321\202\320\260$", 0.00711254f}, {"\320\260\321\202\320\260\320\273", 0.0209864f},
+	{"\320\260\321\202\320\260\320\273\320\276", 0.0206937f}, {"\320\260\321\202\320\265", 0.031582f}, {"\320\260\321\202\320\265\320\273", 0.0249378f},
+	{"\320\260\321\202\320\265\320\273\321\214", 0.012586f}, {"\320\260\321\202\320\265\320\273\321\217", 0.00939558f}, {"\320\260\321\202\320\270", 0.0145178f},
+	{"\320\260\321\202\320\275", 0.0057076f}, {"\320\260\321\202\320\276", 0.0175911f}, {"\320\260\321\202\320\276\321\200", 0.0114445f},
+	{"\320\260\321\202\320\276\321\200$", 0.00567833f}, {"\320\260\321\202\321\200", 0.00600029f}, {"\320\260\321\202\321\200\320\270", 0.00559052f},
+	{"\320\260\321\202\321\200\320\270\320\261", 0.00503439f}, {"\320\260\321\202\321\213", 0.00594175f}, {"\320\260\321\202\321\214", 0.104112f},
+	{"\320\260\321\202\321\214$", 0.0989609f}, {"\320\260\321\202\321\214\321\201", 0.00600029f}, {"\320\260\321\202\321\214\321\201\321\217", 0.00600029f},
+	{"\320\260\321\203", 0.0119713f}, {"\320\260\321\203\321\202", 0.00532709f}, {"\320\260\321\205", 0.0150154f},
+	{"\320\260\321\205$", 0.00881019f}, {"\320\260\321\206", 0.0384897f}, {"\320\260\321\206\320\270", 0.0376116f},
+	{"\320\260\321\206\320\270\320\270", 0.0157764f}, {"\320\260\321\206\320\270\320\270$", 0.0157764f}, {"\320\260\321\206\320\270\321\216", 0.00910288f},
+	{"\320\260\321\206\320\270\321\216$", 0.00910288f}, {"\320\260\321\206\320\270\321\217", 0.00960047f}, {"\320\260\321\206\320\270\321\217$", 0.00930777f},
+	{"\320\260\321\207", 0.0497585f}, {"\320\260\321\207\320\260", 0.00822479f}, {"\320\260\321\207\320\260\320\273", 0.00526855f},
+	{"\320\260\321\207\320\265", 0.0325187f}, {"\320\260\321\207\320\265\320\275", 0.0295331f}, {"\320\260\321\207\320\265\320\275\320\270", 0.0288307f},
+	{"\320\260\321\207\320\270", 0.00567833f}, {"\320\260\321\210", 0.0119128f}, {"\320\260\321\210\320\270", 0.00582467f},
+	{"\320\260\321\211", 0.00605883f}, {"\320\260\321\216", 0.0180594f}, {"\320\260\321\216\321\202", 0.00699546f},
+	{"\320\260\321\216\321\211", 0.01042f}, {"\320\260\321\217", 0.0840626f}, {"\320\260\321\217$", 0.0827162f},
+	{"\320\261$", 0.00588321f}, {"\320\261\320\260", 0.04048f}, {"\320\261\320\260\320\262", 0.00825406f},
+	{"\320\261\320\260\320\267", 0.00573687f}, {"\320\261\320\260\320\271", 0.0109761f}, {"\320\261\320\260\320\271\321\202", 0.00992244f},
+	{"\320\261\320\260\320\271\321\202$", 0.0057076f}, {"\320\261\320\265", 0.0286843f}, {"\320\261\320\265\320\267", 0.0137568f},
+	{"\320\261\320\265\320\267$", 0.00942485f}, {"\320\261\320\270", 0.0236499f}, {"\320\261\320\270\321\202", 0.0115615f},
+	{"\320\261\320\270\321\202\320\275", 0.00714181f}, {"\320\261\320\272", 0.0410361f}, {"\320\261\320\272\320\260", 0.0358847f},
+	{"\320\261\320\272\320\260$", 0.0345968f}, {"\320\261\320\273", 0.0511635f}, {"\320\261\320\273\320\260", 0.00784429f},
+	{"\320\261\320\273\320\260\321\201", 0.00749305f}, {"\320\261\320\273\320\260\321\201\321\202", 0.00749305f}, {"\320\261\320\273\320\265", 0.00594175f},
+	{"\320\261\320\273\320\270", 0.0225377f}, {"\320\261\320\273\320\270\320\272", 0.00945412f}, {"\320\261\320\273\320\270\320\272\320\260", 0.00939558f},
+	{"\320\261\320\273\320\270\321\206", 0.0076394f}, {"\320\261\320\273\320\276", 0.01443f}, {"\320\261\320\273\320\276\320\272", 0.00930777f},
+	{"\320\261\320\273\320\276\320\272\320\270", 0.00547344f}, {"\320\261\320\275", 0.0158935f}, {"\320\261\320\275\320\276", 0.0100395f},
+	{"\320\261\320\275\320\276\320\262", 0.00837114f}, {"\320\261\320\275\320\276\320\262\320\273", 0.0060881f}, {"\320\261\320\276", 0.0535929f},
+	{"\320\261\320\276\320\271", 0.00720035f}, {"\320\261\320\276\320\271$", 0.007054f}, {"\320\261\320\276\320\273", 0.0121469f},
+	{"\320\261\320\276\320\273\321\214", 0.00696619f}, {"\320\261\320\276\320\273\321\214\321\210", 0.00684911f}, {"\320\261\320\276\321\200", 0.00702473f},
+	{"\320\261\320\276\321\202", 0.0139324f}, {"\320\261\320\276\321\202\320\260", 0.00652715f}, {"\320\261\320\276\321\207", 0.00582467f},
+	{"\320\261\321\200", 0.0434655f}, {"\320\261\321\200\320\260", 0.0355334f}, {"\320\261\321\200\320\260\320\261", 0.0089858f},
+	{"\320\261\321\200\320\260\320\261\320\276", 0.0076394f}, {"\320\261\321\200\320\260\320\267", 0.00863457f}, {"\320\261\321\200\320\260\321\202", 0.0076394f},
+	{"\320\261\321\201", 0.00521001f}, {"\320\261\321\203", 0.0360018f}, {"\320\261\321\203\320\264", 0.00840041f},
+	{"\320\261\321\203\320\264\320\265", 0.00535636f}, {"\320\261\321\203\320\264\320\265\321\202", 0.00529782f}, {"\320\261\321\203\320\265", 0.00983463f},
+	{"\320\261\321\203\320\265\321\202", 0.00910288f}, {"\320\261\321\203\320\265\321\202\321\201", 0.00769794f}, {"\320\261\321\203\321\202", 0.00561979f},
+	{"\320\261\321\205", 0.00687838f}, {"\320\261\321\205\320\276", 0.00649788f}, {"\320\261\321\205\320\276\320\264", 0.00643934f},
+	{"\320\261\321\205\320\276\320\264\320\270", 0.00611737f}, {"\320\261\321\211", 0.0137275f}, {"\320\261\321\211\320\265", 0.00933704f},
+	{"\320\261\321\211\320\265\320\275", 0.00699546f}, {"\320\261\321\211\320\265\320\275\320\270", 0.00690765f}, {"\320\261\321\212", 0.01563f},
+	{"\320\261\321\212\320\265", 0.0148105f}, {"\320\261\321\212\320\265\320\272", 0.0122347f}, {"\320\261\321\212\320\265\320\272\321\202", 0.0122347f},
+	{"\320\261\321\213", 0.038958f}, {"\320\261\321\213$", 0.00886873f}, {"\320\261\321\213\320\273", 0.00635153f},
+	{"\320\261\321\213\321\202", 0.0199034f}, {"\320\261\321\213\321\202\321\214", 0.0192302f}, {"\320\261\321\213\321\202\321\214$", 0.0192302f},
+	{"\320\262$", 0.168067f}, {"\320\262\320\260", 0.190487f}, {"\320\262\320\260$", 0.0218938f},
+	{"\320\262\320\260\320\265", 0.0298258f}, {"\320\262\320\260\320\265\320\274", 0.00954193f}, {"\320\262\320\260\320\265\320\274\321\213", 0.00602956f},
+	{"\320\262\320\260\320\265\321\202", 0.020401f}, {"\320\262\320\260\320\265\321\202$", 0.00804917f}, {"\320\262\320\260\320\265\321\202\321\201", 0.0123811f},
+	{"\320\262\320\260\320\275", 0.0573687f}, {"\320\262\320\260\320\275$", 0.00649788f}, {"\320\262\320\260\320\275\320\270", 0.0312308f},
+	{"\320\262\320\260\320\275\320\270\320\265", 0.0177082f}, {"\320\262\320\260\320\275\320\270\321\217", 0.0104786f}, {"\320\262\320\260\320\275\320\275", 0.0129372f},
+	{"\320\262\320\260\320\275\320\275\321\213", 0.00886873f}, {"\320\262\320\260\321\202", 0.0685204f}, {"\320\262\320\260\321\202\320\265", 0.0155715f},
+	{"\320\262\320\260\321\202\320\265\320\273", 0.0153373f}, {"\320\262\320\260\321\202\321\214", 0.051544f}, {"\320\262\320\260\321\202\321\214$", 0.0480316f},
+	{"\320\262\320\260\321\216", 0.00854676f}, {"\320\262\320\260\321\216\321\211", 0.00588321f}, {"\320\262\320\262", 0.00872238f},
+	{"\320\262\320\262\320\276", 0.00559052f}, {"\320\262\320\262\320\276\320\264", 0.00559052f}, {"\320\262\320\265", 0.143685f},
+	{"\320\262\320\265$", 0.00717108f}, {"\320\262\320\265\320\264", 0.00658569f}, {"\320\262\320\265\320\275", 0.0128787f},
+	{"\320\262\320\265\320\275\320\275", 0.0073467f}, {"\320\262\320\265\321\200", 0.0737304f}, {"\320\262\320\265\321\200\320\272", 0.00500512f},
+	{"\320\262\320\265\321\200\320\275", 0.0250256f}, {"\320\262\320\265\321\200\320\275\320\276", 0.00720035f}, {"\320\262\320\265\321\200\320\275\321\213", 0.0120884f},
+	{"\320\262\320\265\321\200\321\201", 0.0158056f}, {"\320\262\320\265\321\200\321\201\320\270", 0.0154837f}, {"\320\262\320\265\321\200\321\210", 0.0092785f},
+	{"\320\262\320\265\321\201", 0.022245f}, {"\320\262\320\265\321\201\321\202", 0.0218645f}, {"\320\262\320\265\321\201\321\202\320\275", 0.0166252f},
+	{"\320\262\320\265\321\202", 0.0174448f}, {"\320\262\320\265\321\202\320\272", 0.00567833f}, {"\320\262\320\270", 0.06934f},
+	{"\320\262\320\270\320\264", 0.00547344f}, {"\320\262\320\270\320\273", 0.0136982f}, {"\320\262\320\270\320\273\321\214", 0.0101859f},
+	{"\320\262\320\270\320\273\321\214\320\275", 0.0099517f}, {"\320\262\320\270\321\201", 0.00550271f}, {"\320\262\320\270\321\202", 0.0199327f},
+	{"\320\262\320\270\321\202\321\214", 0.0153373f}, {"\320\262\320\270\321\202\321\214$", 0.0152495f}, {"\320\262\320\272", 0.0301771f},
+	{"\320\262\320\272\320\260", 0.0089858f}, {"\320\262\320\272\320\260$", 0.00845895f}, {"\320\262\320\272\320\270", 0.0083126f},
+	{"\320\262\320\272\320\270$", 0.0083126f}, {"\320\262\320\272\320\273", 0.00699546f}, {"\320\262\320\272\320\273\321\216", 0.00696619f},
+	{"\320\262\320\272\320\273\321\216\321\207", 0.00696619f}, {"\320\262\320\273", 0.0509879f}, {"\320\262\320\273\320\265", 0.0272794f},
+	{"\320\262\320\273\320\265\320\275", 0.0244988f}, {"\320\262\320\273\320\265\320\275\320\270", 0.0158056f}, {"\320\262\320\273\321\217", 0.0191717f},
+	{"\320\262\320\273\321\217\320\265", 0.0115908f}, {"\320\262\320\273\321\217\320\265\321\202", 0.0110054f}, {"\320\262\320\274", 0.00945412f},
+	{"\320\262\320\274\320\265", 0.00939558f}, {"\320\262\320\274\320\265\321\201", 0.00916142f}, {"\320\262\320\274\320\265\321\201\321\202", 0.00916142f},
+	{"\320\262\320\275", 0.0443729f}, {"\320\262\320\275\320\265", 0.0129079f}, {"\320\262\320\275\320\265$", 0.00559052f},
+	{"\320\262\320\275\320\270", 0.007054f}, {"\320\262\320\275\320\276", 0.00977609f}, {"\320\262\320\275\321\203", 0.00842968f},
+	{"\320\262\320\275\321\203\321\202", 0.00769794f}, {"\320\262\320\275\321\203\321\202\321\200", 0.00769794f}, {"\320\262\320\275\321\213", 0.00544417f},
+	{"\320\262\320\276", 0.136163f}, {"\320\262\320\276$", 0.0157471f}, {"\320\262\320\276\320\263", 0.00588321f},
+	{"\320\262\320\276\320\263\320\276", 0.00559052f}, {"\320\262\320\276\320\263\320\276$", 0.00559052f}, {"\320\262\320\276\320\264", 0.0232402f},
+	{"\320\262\320\276\320\264$", 0.0083126f}, {"\320\262\320\276\320\264\320\260", 0.0057076f}, {"\320\262\320\276\320\264\320\260$", 0.00567833f},
+	{"\320\262\320\276\320\264\320\270", 0.0073467f}, {"\320\262\320\276\320\264\320\270\321\202", 0.0063808f}, {"\320\262\320\276\320\265", 0.00556125f},
+	{"\320\262\320\276\320\267", 0.0307332f}, {"\320\262\320\276\320\267\320\274", 0.0266062f}, {"\320\262\320\276\320\267\320\274\320\276", 0.0266062f},
+	{"\320\262\320\276\320\271", 0.0125567f}, {"\320\262\320\276\320\271$", 0.00933704f}, {"\320\262\320\276\320\273", 0.0380214f},
+	{"\320\262\320\276\320\273$", 0.0121762f}, {"\320\262\320\276\320\273\320\260", 0.00681984f}, {"\320\262\320\276\320\273\320\260$", 0.00594175f},
+	{"\320\262\320\276\320\273\320\276", 0.00796136f}, {"\320\262\320\276\320\273\320\276\320\262", 0.00617591f}, {"\320\262\320\276\320\273\321\213", 0.0057076f},
+	{"\320\262\320\276\320\273\321\213$", 0.00564906f}, {"\320\262\320\276\321\201", 0.00506366f}, {"\320\262\320\277", 0.00588321f},
+	{"\320\262\320\277\320\260", 0.00550271f}, {"\320\262\320\277\320\260\320\264", 0.00526855f}, {"\320\262\321\200", 0.0256988f},
+	{"\320\262\321\200\320\265", 0.0202839f}, {"\320\262\321\200\320\265\320\266", 0.00538563f}, {"\320\262\321\200\320\265\320\266\320\264", 0.00538563f},
+	{"\320\262\321\200\320\265\320\274", 0.0145471f}, {"\320\262\321\200\320\265\320\274\320\265", 0.00951266f}, {"\320\262\321\200\320\265\320\274\321\217", 0.00523928f},
+	{"\320\262\321\201", 0.0212791f}, {"\320\262\321\201\320\265", 0.0109176f}, {"\320\262\321\201\320\265$", 0.00655642f},
+	{"\320\262\321\201\321\202", 0.00497585f}, {"\320\262\321\202", 0.0135812f}, {"\320\262\321\202\320\276", 0.0135226f},
+	{"\320\262\321\202\320\276\321\200", 0.0100688f}, {"\320\262\321\203", 0.030382f}, {"\320\262\321\203\320\265", 0.0178253f},
+	{"\320\262\321\203\320\265\321\202", 0.0178253f}, {"\320\262\321\203\320\265\321\202$", 0.0177375f}, {"\320\262\321\203\321\216", 0.00921996f},
+	{"\320\262\321\203\321\216\321\211", 0.00591248f}, {"\320\262\321\205", 0.00828333f}, {"\320\262\321\205\320\276", 0.00828333f},
+	{"\320\262\321\205\320\276\320\264", 0.00816625f}, {"\320\262\321\205\320\276\320\264\320\275", 0.00620518f}, {"\320\262\321\213", 0.102444f},
+	{"\320\262\321\213$", 0.0101859f}, {"\320\262\321\213\320\261", 0.00693692f}, {"\320\262\321\213\320\262", 0.0192887f},
+	{"\320\262\321\213\320\262\320\276", 0.0147812f}, {"\320\262\321\213\320\262\320\276\320\264", 0.0147812f}, {"\320\262\321\213\320\267", 0.0060881f},
+	{"\320\262\321\213\320\271", 0.0102737f}, {"\320\262\321\213\320\271$", 0.00930777f}, {"\320\262\321\213\320\277", 0.0158056f},
+	{"\320\262\321\213\320\277\320\276", 0.0149276f}, {"\320\262\321\213\320\277\320\276\320\273", 0.0149276f}, {"\320\262\321\213\321\200", 0.0134641f},
+	{"\320\262\321\213\321\200\320\260", 0.0116786f}, {"\320\262\321\213\321\200\320\260\320\266", 0.00851749f}, {"\320\262\321\213\321\205", 0.0102151f},
+	{"\320\262\321\213\321\205\320\276", 0.00746378f}, {"\320\262\321\213\321\205\320\276\320\264", 0.00746378f}, {"\320\263$", 0.0221279f},
+	{"\320\263\320\260", 0.0252598f}, {"\320\263\320\260$", 0.00816625f}, {"\320\263\320\265", 0.0167715f},
+	{"\320\263\320\265\320\275", 0.00758086f}, {"\320\263\320\265\320\275\320\265", 0.00673204f}, {"\320\263\320\265\320\275\320\265\321\200", 0.0066735f},
+	{"\320\263\320\270", 0.0357091f}, {"\320\263\320\270\321\201", 0.0218352f}, {"\320\263\320\270\321\201\321\202", 0.0217767f},
+	{"\320\263\320\270\321\201\321\202\321\200", 0.0212205f}, {"\320\263\320\273", 0.0108591f}, {"\320\263\320\275", 0.0161569f},
+	{"\320\263\320\275\320\276", 0.0121177f}, {"\320\263\320\275\320\276\321\200", 0.011825f}, {"\320\263\320\275\320\276\321\200\320\270", 0.0117957f},
+	{"\320\263\320\276", 0.0949217f}, {"\320\263\320\276$", 0.0702473f}, {"\320\263\320\276\320\273", 0.0092785f},
+	{"\320\263\320\276\320\273\320\276", 0.0076394f}, {"\320\263\320\276\320\273\320\276\320\262", 0.00749305f}, {"\320\263\321\200", 0.0359432f},
+	{"\320\263\321\200\320\260", 0.0172984f}, {"\320\263\321\200\320\260\320\274", 0.00992244f}, {"\320\263\321\200\320\260\320\274\320\274", 0.00977609f},
+	{"\320\263\321\200\321\203", 0.0149861f}, {"\320\263\321\200\321\203\320\267", 0.00564906f}, {"\320\263\321\200\321\203\320\277", 0.00761013f},
+	{"\320\263\321\200\321\203\320\277\320\277", 0.00761013f}, {"\320\263\321\203", 0.0244402f}, {"\320\263\321\203\320\274", 0.0124396f},
+	{"\320\263\321\203\320\274\320\265", 0.0123226f}, {"\320\263\321\203\320\274\320\265\320\275", 0.0123226f}, {"\320\264$", 0.0443144f},
+	{"\320\264\320\260", 0.177111f}, {"\320\264\320\260$", 0.0264306f}, {"\320\264\320\260\320\265", 0.0134641f},
+	{"\320\264\320\260\320\265\321\202", 0.0124689f}, {"\320\264\320\260\320\265\321\202\321\201", 0.00954193f}, {"\320\264\320\260\320\273", 0.0643056f},
+	{"\320\264\320\260\320\273\320\265", 0.00819552f}, {"\320\264\320\260\320\273\320\265\320\275", 0.00687838f}, {"\320\264\320\260\320\273\320\270", 0.00749305f},
+	{"\320\264\320\260\320\273\320\270\321\202", 0.00731743f}, {"\320\264\320\260\320\273\320\276", 0.043846f}, {"\320\264\320\260\320\273\320\276\321\201", 0.043846f},
+	{"\320\264\320\260\320\275", 0.0459827f}, {"\320\264\320\260\320\275\320\270", 0.00960047f}, {"\320\264\320\260\320\275\320\275", 0.0289185f},
+	{"\320\264\320\260\320\275\320\275\321\213", 0.0230353f}, {"\320\264\320\260\321\200", 0.007054f}, {"\320\264\320\260\321\200\321\202", 0.00518074f},
+	{"\320\264\320\260\321\200\321\202\320\275", 0.00500512f}, {"\320\264\320\260\321\202", 0.0192302f}, {"\320\264\320\260\321\202\321\214", 0.0154251f},
+	{"\320\264\320\260\321\202\321\214$", 0.0153666f}, {"\320\264\320\262", 0.0128787f}, {"\320\264\320\262\320\276", 0.00614664f},
+	{"\320\264\320\264", 0.0222157f}, {"\320\264\320\264\320\265", 0.0217181f}, {"\320\264\320\264\320\265\321\200", 0.0216011f},
+	{"\320\264\320\264\320\265\321\200\320\266", 0.0215132f}, {"\320\264\320\265", 0.161452f}, {"\320\264\320\265$", 0.00790282f},
+	{"\320\264\320\265\320\271", 0.00954193f}, {"\320\264\320\265\320\271\321\201", 0.00901507f}, {"\320\264\320\265\320\271\321\201\321\202", 0.00892726f},
+	{"\320\264\320\265\320\272", 0.0140202f}, {"\320\264\320\265\320\272\321\201", 0.0124396f}, {"\320\264\320\265\320\272\321\201$", 0.0057076f},
+	{"\320\264\320\265\320\273", 0.0558759f}, {"\320\264\320\265\320\273$", 0.00942485f}, {"\320\264\320\265\320\273\320\260", 0.01563f},
+	{"\320\264\320\265\320\273\320\260$", 0.0083126f}, {"\320\264\320\265\320\273\320\265", 0.0136982f}, {"\320\264\320\265\320\273\320\265\320\275", 0.00942485f},
+	{"\320\264\320\265\320\273\320\270", 0.0066735f}, {"\320\264\320\265\320\273\320\270\321\202", 0.00605883f}, {"\320\264\320\265\320\275", 0.037114f},
+	{"\320\264\320\265\320\275$", 0.00561979f}, {"\320\264\320\265\320\275\320\270", 0.0169764f}, {"\320\264\320\265\320\275\320\270\320\265", 0.0136397f},
+	{"\320\264\320\265\320\275\321\202", 0.0073467f}, {"\320\264\320\265\320\275\321\202\320\270", 0.007054f}, {"\320\264\320\265\321\200", 0.0403337f},
+	{"\320\264\320\265\321\200\320\266", 0.0368798f}, {"\320\264\320\265\321\200\320\266\320\270", 0.0305283f}, {"\320\264\320\265\321\202", 0.00597102f},
+	{"\320\264\320\265\321\202$", 0.00547344f}, {"\320\264\320\266", 0.00875165f}, {"\320\264\320\270", 0.0708913f},
+	{"\320\264\320\270\320\260", 0.0120884f}, {"\320\264\320\270\320\260\320\277", 0.0108298f}, {"\320\264\320\270\320\260\320\277\320\260", 0.0108298f},
+	{"\320\264\320\270\320\274", 0.00752232f}, {"\320\264\320\270\320\274\320\276", 0.00559052f}, {"\320\264\320\270\320\275", 0.0171228f},
+	{"\320\264\320\270\321\200", 0.00816625f}, {"\320\264\320\270\321\202", 0.0160105f}, {"\320\264\320\270\321\202\320\265", 0.00605883f},
+	{"\320\264\320\270\321\202\321\214", 0.00561979f}, {"\320\264\320\270\321\202\321\214$", 0.00538563f}, {"\320\264\320\272", 0.00965901f},
+	{"\320\264\320\273", 0.0903556f}, {"\320\264\320\273\320\270", 0.0104786f}, {"\320\264\320\273\320\270\320\275", 0.0103908f},
+	{"\320\264\320\273\321\217", 0.0790282f}, {"\320\264\320\273\321\217$", 0.0789404f}, {"\320\264\320\275", 0.0352993f},
+	{"\320\264\320\275\320\276", 0.0180301f}, {"\320\264\320\275\320\276\320\263", 0.00576613f}, {"\320\264\320\275\320\276\320\263\320\276", 0.0057076f},
+	{"\320\264\320\275\320\276\320\271", 0.00629299f}, {"\320\264\320\275\320\276\320\271$", 0.00629299f}, {"\320\264\320\275\321\213", 0.00828333f},
+	{"\320\264\320\276", 0.103556f}, {"\320\264\320\276$", 0.00629299f}, {"\320\264\320\276\320\261", 0.00916142f},
+	{"\320\264\320\276\320\261\320\260", 0.00819552f}, {"\320\264\320\276\320\261\320\260\320\262", 0.00816625f}, {"\320\264\320\276\320\262", 0.0098639f},
+	{"\320\264\320\276\320\272", 0.00547344f}, {"\320\264\320\276\320\273", 0.0215718f}, {"\320\264\320\276\320\273\320\266", 0.0204595f},
+	{"\320\264\320\276\320\273\320\266\320\265", 0.00901507f}, {"\320\264\320\276\320\273\320\266\320\275", 0.0102151f}, {"\320\264\320\276\320\274", 0.00664423f},
+	{"\320\264\320\276\320\277", 0.0237377f}, {"\320\264\320\276\320\277\321\203", 0.0199619f}, {"\320\264\320\276\320\277\321\203\321\201", 0.0199619f},
+	{"\320\264\320\276\321\201", 0.0159813f}, {"\320\264\320\276\321\201\321\202", 0.0157764f}, {"\320\264\320\276\321\201\321\202\321\203", 0.0102444f},
+	{"\320\264\320\277", 0.0143129f}, {"\320\264\320\277\320\270", 0.00962974f}, {"\320\264\320\277\320\270\321\201", 0.00962974f},
+	{"\320\264\321\200", 0.0268111f}, {"\320\264\321\200\320\265", 0.0143129f}, {"\320\264\321\200\320\265\321\201", 0.0136397f},
+	{"\320\264\321\200\320\265\321\201\320\260", 0.00532709f}, {"\320\264\321\200\321\203", 0.00646861f}, {"\320\264\321\200\321\203\320\263", 0.00597102f},
+	{"\320\264\321\201", 0.0165667f}, {"\320\264\321\201\320\272", 0.007054f}, {"\320\264\321\201\321\202", 0.00895653f},
+	{"\320\264\321\201\321\202\320\262", 0.00664423f}, {"\320\264\321\203", 0.0382848f}, {"\320\264\321\203$", 0.00535636f},
+	{"\320\264\321\203\320\273", 0.00526855f}, {"\320\264\321\203\320\277", 0.0135812f}, {"\320\264\321\203\320\277\321\200", 0.0134933f},
+	{"\320\264\321\203\320\277\321\200\320\265", 0.0134933f}, {"\320\264\321\213", 0.0110347f}, {"\320\264\321\213$", 0.00746378f},
+	{"\320\265$", 0.406761f}, {"\320\265\320\261", 0.01563f}, {"\320\265\320\261\321\203", 0.0109176f},
+	{"\320\265\320\261\321\203\320\265", 0.00980536f}, {"\320\265\320\261\321\203\320\265\321\202", 0.00907361f}, {"\320\265\320\262", 0.0707449f},
+	{"\320\265\320\262\320\265", 0.0239719f}, {"\320\265\320\262\320\265\321\200", 0.0228597f}, {"\320\265\320\262\320\265\321\200\320\275", 0.0220401f},
+	{"\320\265\320\262\320\276", 0.0292697f}, {"\320\265\320\262\320\276\320\267", 0.0214547f}, {"\320\265\320\262\320\276\320\267\320\274", 0.0214547f},
+	{"\320\265\320\263", 0.0499634f}, {"\320\265\320\263\320\270", 0.0230938f}, {"\320\265\320\263\320\270\321\201", 0.0212205f},
+	{"\320\265\320\263\320\270\321\201\321\202", 0.0212205f}, {"\320\265\320\263\320\276", 0.0191717f}, {"\320\265\320\263\320\276$", 0.017796f},
+	{"\320\265\320\264", 0.101917f}, {"\320\265\320\264\320\260", 0.00535636f}, {"\320\265\320\264\320\265", 0.0234158f},
+	{"\320\265\320\264\320\265\320\273", 0.0192887f}, {"\320\265\320\264\320\265\320\273\320\265", 0.00693692f}, {"\320\265\320\264\320\270", 0.0119128f},
+	{"\320\265\320\264\320\270\320\275", 0.00714181f}, {"\320\265\320\264\320\276", 0.0232402f}, {"\320\265\320\264\320\276\320\277", 0.0126738f},
+	{"\320\265\320\264\320\276\320\277\321\203", 0.0126738f}, {"\320\265\320\264\320\276\321\201", 0.00585394f}, {"\320\265\320\264\320\276\321\201\321\202", 0.00585394f},
+	{"\320\265\320\264\321\201", 0.00784429f}, {"\320\265\320\264\321\201\321\202", 0.00632226f}, {"\320\265\320\264\321\201\321\202\320\262", 0.00497585f},
+	{"\320\265\320\264\321\203", 0.0191424f}, {"\320\265\320\264\321\203\320\277", 0.0135519f}, {"\320\265\320\264\321\203\320\277\321\200", 0.0134933f},
+	{"\320\265\320\265", 0.0172106f}, {"\320\265\320\265$", 0.0112396f}, {"\320\265\320\265\321\202", 0.00556125f},
+	{"\320\265\320\265\321\202$", 0.00506366f}, {"\320\265\320\266", 0.0379628f}, {"\320\265\320\266\320\264", 0.0215425f},
+	{"\320\265\320\266\320\264\320\265", 0.0143422f}, {"\320\265\320\266\320\264\320\265\320\275", 0.0138738f}, {"\320\265\320\266\320\270", 0.0138153f},
+	{"\320\265\320\266\320\270\320\274", 0.0107127f}, {"\320\265\320\266\320\270\320\274$", 0.0054149f}, {"\320\265\320\267", 0.0293283f},
+	{"\320\265\320\267$", 0.0115615f}, {"\320\265\320\267\320\260", 0.00582467f}, {"\320\265\320\270", 0.02084f},
+	{"\320\265\320\270\320\267", 0.0168594f}, {"\320\265\320\270\320\267\320\262", 0.0166837f}, {"\320\265\320\270\320\267\320\262\320\265", 0.0166545f},
+	{"\320\265\320\271", 0.048178f}, {"\320\265\320\271$", 0.0277184f}, {"\320\265\320\271\321\201", 0.0122933f},
+	{"\320\265\320\271\321\201\321\202", 0.00913215f}, {"\320\265\320\271\321\201\321\202\320\262", 0.00913215f}, {"\320\265\320\272", 0.0903849f},
+	{"\320\265\320\272\320\276", 0.0204888f}, {"\320\265\320\272\320\276\321\200", 0.0150154f}, {"\320\265\320\272\320\276\321\200\321\200", 0.0148983f},
+	{"\320\265\320\272\321\201", 0.0212498f}, {"\320\265\320\272\321\201$", 0.00594175f}, {"\320\265\320\272\321\201\321\202", 0.00629299f},
+	{"\320\265\320\272\321\202", 0.0425289f}, {"\320\265\320\272\321\202\320\275", 0.0177375f}, {"\320\265\320\272\321\202\320\275\320\276", 0.00567833f},
+	{"\320\265\320\272\321\202\320\275\321\213", 0.0101273f}, {"\320\265\320\272\321\202\321\203", 0.00597102f}, {"\320\265\320\272\321\202\321\203\321\200", 0.00576613f},
+	{"\320\265\320\272\321\203", 0.00869311f}, {"\320\265\320\272\321\203\321\211", 0.00532709f}, {"\320\265\320\273", 0.124718f},
+	{"\320\265\320\273$", 0.011942f}, {"\320\265\320\273\320\260", 0.0172106f}, {"\320\265\320\273\320\260$", 0.008898f},
+	{"\320\265\320\273\320\265", 0.0198741f}, {"\320\265\320\273\320\265\320\275", 0.00998097f}, {"\320\265\320\273\320\265\320\275\320\270", 0.0057954f},
+	{"\320\265\320\273\320\270", 0.014108f}, {"\320\265\320\273\320\270\321\202", 0.00611737f}, {"\320\265\320\273\320\276", 0.00670277f},
+	{"\320\265\320\273\321\214", 0.0457486f}, {"\320\265\320\273\321\214$", 0.0104786f}, {"\320\265\320\273\321\214\320\267", 0.00679058f},
+	{"\320\265\320\273\321\214\320\267\321\217", 0.00679058f}, {"\320\265\320\273\321\214\320\275", 0.0236207f}, {"\320\265\320\273\321\214\320\275\320\276", 0.0129079f},
+	{"\320\265\320\273\321\214\320\275\321\213", 0.00872238f}, {"\320\265\320\273\321\217", 0.0129665f}, {"\320\265\320\273\321\217$", 0.0098639f},
+	{"\320\265\320\274", 0.107888f}, {"\320\265\320\274$", 0.0210742f}, {"\320\265\320\274\320\260", 0.00711254f},
+	{"\320\265\320\274\320\265", 0.0453973f}, {"\320\265\320\274\320\265\320\275", 0.0233572f}, {"\320\265\320\274\320\265\320\275\320\275", 0.00965901f},
+	{"\320\265\320\274\320\265\320\275\321\202", 0.0102444f}, {"\320\265\320\274\320\265\321\211", 0.0174155f}, {"\320\265\320\274\320\265\321\211\320\265", 0.0160691f},
+	{"\320\265\320\274\320\276", 0.00840041f}, {"\320\265\320\274\321\213", 0.0185277f}, {"\320\265\320\274\321\213\320\271", 0.00661496f},
+	{"\320\265\320\274\321\213\320\271$", 0.00661496f}, {"\320\265\320\274\321\217", 0.00523928f}, {"\320\265\320\274\321\217$", 0.00523928f},
+	{"\320\265\320\275", 0.333616f}, {"\320\265\320\275$", 0.0369384f}, {"\320\265\320\275\320\260", 0.0206352f},
+	{"\320\265\320\275\320\260$", 0.0151617f}, {"\320\265\320\275\320\265", 0.024528f}, {"\320\265\320\275\320\265\320\275", 0.0123518f},
+	{"\320\265\320\275\320\265\320\275\320\270", 0.0103615f}, {"\320\265\320\275\320\265\321\200", 0.00684911f}, {"\320\265\320\275\320\265\321\200\320\270", 0.00588321f},
+	{"\320\265\320\275\320\270", 0.182819f}, {"\320\265\320\275\320\270$", 0.00916142f}, {"\320\265\320\275\320\270\320\265", 0.096151f},
+	{"\320\265\320\275\320\270\320\265$", 0.0926094f}, {"\320\265\320\275\320\270\320\270", 0.0107127f}, {"\320\265\320\275\320\270\320\270$", 0.0107127f},
+	{"\320\265\320\275\320\270\320\271", 0.0123226f}, {"\320\265\320\275\320\270\320\271$", 0.0122933f}, {"\320\265\320\275\320\270\321\202", 0.00670277f},
+	{"\320\265\320\275\320\270\321\202\321\214", 0.00614664f}, {"\320\265\320\275\320\270\321\217", 0.064247f}, {"\320\265\320\275\320\270\321\217$", 0.062403f},
+	{"\320\265\320\275\320\275", 0.0438168f}, {"\320\265\320\275\320\275\320\276", 0.0151617f}, {"\320\265\320\275\320\275\321\213", 0.0189082f},
+	{"\320\265\320\275\320\275\321\213\320\265", 0.0051222f}, {"\320\265\320\275\320\275\321\213\320\271", 0.008898f}, {"\320\265\320\275\320\276", 0.0189375f},
+	{"\320\265\320\275\320\276$", 0.0142544f}, {"\320\265\320\275\321\202", 0.0531831f}, {"\320\265\320\275\321\202$", 0.0195229f},
+	{"\320\265\320\275\321\202\320\260", 0.00845895f}, {"\320\265\320\275\321\202\320\260$", 0.0060881f}, {"\320\265\320\275\321\202\320\270", 0.0123518f},
+	{"\320\265\320\275\321\202\320\270\321\204", 0.0116493f}, {"\320\265\320\275\321\202\320\276", 0.00523928f}, {"\320\265\320\275\321\202\321\213", 0.00518074f},
+	{"\320\265\320\275\321\202\321\213$", 0.00518074f}, {"\320\265\320\275\321\213", 0.00837114f}, {"\320\265\320\275\321\213$", 0.00834187f},
+	{"\320\265\320\275\321\214", 0.00550271f}, {"\320\265\320\276", 0.0275721f}, {"\320\265\320\276\320\261", 0.0130836f},
+	{"\320\265\320\276\320\261\321\200", 0.00602956f}, {"\320\265\320\276\320\261\321\200\320\260", 0.00602956f}, {"\320\265\320\276\320\261\321\205", 0.00588321f},
+	{"\320\265\320\276\320\261\321\205\320\276", 0.00588321f}, {"\320\265\320\276\320\266", 0.00523928f}, {"\320\265\320\276\320\266\320\270", 0.00523928f},
+	{"\320\265\320\276\320\266\320\270\320\264", 0.00523928f}, {"\320\265\320\277", 0.03527f}, {"\320\265\320\277\320\276", 0.0187326f},
+	{"\320\265\320\277\320\276\320\267", 0.00526855f}, {"\320\265\320\277\320\276\320\267\320\270", 0.00526855f}, {"\320\265\320\277\321\200", 0.0123811f},
+	{"\320\265\320\277\321\200\320\260", 0.0092785f}, {"\320\265\320\277\321\200\320\260\320\262", 0.0092785f}, {"\320\265\321\200", 0.252451f},
+	{"\320\265\321\200$", 0.0271623f}, {"\320\265\321\200\320\260", 0.0439046f}, {"\320\265\321\200\320\260$", 0.0108883f},
+	{"\320\265\321\200\320\260\320\275", 0.0134641f}, {"\320\265\321\200\320\260\320\275\320\264", 0.0130836f}, {"\320\265\321\200\320\260\321\206", 0.00951266f},
+	{"\320\265\321\200\320\260\321\206\320\270", 0.00951266f}, {"\320\265\321\200\320\262", 0.0151324f}, {"\320\265\321\200\320\262\320\265", 0.00591248f},
+	{"\320\265\321\200\320\262\320\265\321\200", 0.00585394f}, {"\320\265\321\200\320\265", 0.0620811f}, {"\320\265\321\200\320\265\320\264", 0.00711254f},
+	{"\320\265\321\200\320\265\320\274", 0.023006f}, {"\320\265\321\200\320\265\320\274\320\265", 0.0223035f}, {"\320\265\321\200\320\265\320\275", 0.00515147f},
+	{"\320\265\321\200\320\266", 0.0376994f}, {"\320\265\321\200\320\266\320\270", 0.0307039f}, {"\320\265\321\200\320\266\320\270\320\262", 0.0191717f},
+	{"\320\265\321\200\320\266\320\270\321\202", 0.0073467f}, {"\320\265\321\200\320\270", 0.0150154f}, {"\320\265\321\200\320\270\321\200", 0.00588321f},
+	{"\320\265\321\200\320\270\321\200\320\276", 0.00567833f}, {"\320\265\321\200\320\272", 0.00564906f}, {"\320\265\321\200\320\275", 0.0304405f},
+	{"\320\265\321\200\320\275\320\260", 0.00585394f}, {"\320\265\321\200\320\275\320\276", 0.00863457f}, {"\320\265\321\200\320\275\320\276\320\265", 0.00497585f},
+	{"\320\265\321\200\320\275\321\213", 0.012586f}, {"\320\265\321\200\320\275\321\213\320\271", 0.0111225f}, {"\320\265\321\200\320\276", 0.0063808f},
+	{"\320\265\321\200\321\201", 0.0194936f}, {"\320\265\321\200\321\201\320\270", 0.0160983f}, {"\320\265\321\200\321\201\320\270\320\270", 0.00679058f},
+	{"\320\265\321\200\321\201\320\270\321\217", 0.00576613f}, {"\320\265\321\200\321\202", 0.00968828f}, {"\320\265\321\200\321\202\320\270", 0.00769794f},
+	{"\320\265\321\200\321\202\320\270\321\204", 0.00737597f}, {"\320\265\321\200\321\210", 0.00951266f}, {"\320\265\321\201", 0.131919f},
+	{"\320\265\321\201$", 0.00611737f}, {"\320\265\321\201\320\260", 0.00556125f}, {"\320\265\321\201\320\272", 0.0231523f},
+	{"\320\265\321\201\320\272\320\260", 0.00585394f}, {"\320\265\321\201\320\272\320\260\321\217", 0.00573687f}, {"\320\265\321\201\320\272\320\270", 0.00684911f},
+	{"\320\265\321\201\320\272\320\276", 0.00848822f}, {"\320\265\321\201\320\273", 0.0120591f}, {"\320\265\321\201\320\273\320\270", 0.0120006f},
+	{"\320\265\321\201\320\273\320\270$", 0.0119713f}, {"\320\265\321\201\320\276", 0.00509293f}, {"\320\265\321\201\320\277", 0.0109469f},
+	{"\320\265\321\201\320\277\321\203", 0.00930777f}, {"\320\265\321\201\320\277\321\203\320\261", 0.00919069f}, {"\320\265\321\201\321\201", 0.00977609f},
+	{"\320\265\321\201\321\202", 0.0602078f}, {"\320\265\321\201\321\202\320\262", 0.0169179f}, {"\320\265\321\201\321\202\320\262\321\203", 0.00878092f},
+	{"\320\265\321\201\321\202\320\270", 0.00965901f}, {"\320\265\321\201\321\202\320\275", 0.0186741f}, {"\320\265\321\201\321\202\320\275\320\276", 0.00523928f},
+	{"\320\265\321\201\321\202\320\275\321\213", 0.00895653f}, {"\320\265\321\201\321\202\320\276", 0.00714181f}, {"\320\265\321\202", 0.216215f},
+	{"\320\265\321\202$", 0.08497f}, {"\320\265\321\202\320\260", 0.0108591f}, {"\320\265\321\202\320\260$", 0.00740524f},
+	{"\320\265\321\202\320\270", 0.00550271f}, {"\320\265\321\202\320\272", 0.0139617f}, {"\320\265\321\202\320\272\320\270", 0.0060881f},
+	{"\320\265\321\202\320\272\320\270$", 0.0060881f}, {"\320\265\321\202\320\276", 0.008898f}, {"\320\265\321\202\321\200", 0.03006f},
+	{"\320\265\321\202\321\200$", 0.0134348f}, {"\320\265\321\202\321\200\321\213", 0.00907361f}, {"\320\265\321\202\321\200\321\213$", 0.00907361f},
+	{"\320\265\321\202\321\201", 0.0750476f}, {"\320\265\321\202\321\201\321\217", 0.0698668f}, {"\320\265\321\202\321\201\321\217$", 0.069779f},
+	{"\320\265\321\205", 0.00535636f}, {"\320\265\321\206", 0.0154837f}, {"\320\265\321\206\320\270", 0.00617591f},
+	{"\320\265\321\207", 0.0210449f}, {"\320\265\321\207\320\260", 0.00878092f}, {"\320\265\321\207\320\260\321\202", 0.00576613f},
+	{"\320\265\321\207\320\265", 0.00652715f}, {"\320\265\321\207\320\265\320\275", 0.00529782f}, {"\320\265\321\210", 0.0158935f},
+	{"\320\265\321\211", 0.0324601f}, {"\320\265\321\211\320\265", 0.0268989f}, {"\320\265\321\211\320\265\320\275", 0.0258452f},
+	{"\320\265\321\211\320\265\320\275\320\270", 0.0247622f}, {"\320\266\320\260", 0.0151324f}, {"\320\266\320\260\321\202", 0.00752232f},
+	{"\320\266\320\264", 0.027777f}, {"\320\266\320\264\320\265", 0.0153373f}, {"\320\266\320\264\320\265\320\275", 0.0148105f},
+	{"\320\266\320\264\320\265\320\275\320\270", 0.0132006f}, {"\320\266\320\265", 0.0675545f}, {"\320\266\320\265$", 0.0142251f},
+	{"\320\266\320\265\320\275", 0.0406849f}, {"\320\266\320\265\320\275$", 0.0108005f}, {"\320\266\320\265\320\275\320\270", 0.0249378f},
+	{"\320\266\320\265\320\275\320\270\320\265", 0.0126445f}, {"\320\266\320\265\320\275\320\270\321\217", 0.00971755f}, {"\320\266\320\265\321\202", 0.0121762f},
+	{"\320\266\320\265\321\202$", 0.01042f}, {"\320\266\320\270", 0.07054f}, {"\320\266\320\270\320\262", 0.0217181f},
+	{"\320\266\320\270\320\262\320\260", 0.0217181f}, {"\320\266\320\270\320\262\320\260\320\265", 0.0197863f}, {"\320\266\320\270\320\264", 0.0194058f},
+	{"\320\266\320\270\320\264\320\260", 0.0192887f}, {"\320\266\320\270\320\264\320\260\320\265", 0.0101273f}, {"\320\266\320\270\320\264\320\260\320\275", 0.00652715f},
+	{"\320\266\320\270\320\274", 0.0161276f}, {"\320\266\320\270\320\274$", 0.00553198f}, {"\320\266\320\270\321\202", 0.0121469f},
+	{"\320\266\320\270\321\202$", 0.00749305f}, {"\320\266\320\275", 0.046451f}, {"\320\266\320\275\320\276", 0.0357969f},
+	{"\320\266\320\275\320\276$", 0.0327821f}, {"\320\266\320\275\321\213", 0.00684911f}, {"\320\267$", 0.0380506f},
+	{"\320\267\320\260", 0.147315f}, {"\320\267\320\260$", 0.0124396f}, {"\320\267\320\260\320\262", 0.0144007f},
+	{"\320\267\320\260\320\262\320\265", 0.00954193f}, {"\320\267\320\260\320\262\320\265\321\200", 0.00954193f}, {"\320\267\320\260\320\263", 0.0160983f},
+	{"\320\267\320\260\320\263\320\276", 0.00758086f}, {"\320\267\320\260\320\263\320\276\320\273", 0.00743451f}, {"\320\267\320\260\320\263\321\200", 0.00696619f},
+	{"\320\267\320\260\320\263\321\200\321\203", 0.00684911f}, {"\320\267\320\260\320\264", 0.0178545f}, {"\320\267\320\260\320\264\320\260", 0.0162447f},
+	{"\320\267\320\260\320\264\320\260\320\275", 0.00960047f}, {"\320\267\320\260\320\272", 0.00828333f}, {"\320\267\320\260\320\274", 0.0092785f},
+	{"\320\267\320\260\320\274\320\265", 0.00869311f}, {"\320\267\320\260\320\275", 0.0196693f}, {"\320\267\320\260\320\275\320\275", 0.00679058f},
+	{"\320\267\320\260\320\277", 0.0394556f}, {"\320\267\320\260\320\277\320\270", 0.0198449f}, {"\320\267\320\260\320\277\320\270\321\201", 0.0198156f},
+	{"\320\267\320\260\320\277\321\200", 0.00696619f}, {"\320\267\320\260\320\277\321\203", 0.00591248f}, {"\320\267\320\260\320\277\321\203\321\201", 0.00526855f},
+	{"\320\267\320\260\321\202", 0.0138446f}, {"\320\267\320\260\321\202\321\214", 0.00863457f}, {"\320\267\320\260\321\202\321\214$", 0.0086053f},
+	{"\320\267\320\262", 0.0321382f}, {"\320\267\320\262\320\260", 0.00620518f}, {"\320\267\320\262\320\260\320\275", 0.00529782f},
+	{"\320\267\320\262\320\265", 0.0179423f}, {"\320\267\320\262\320\265\321\201", 0.0172691f}, {"\320\267\320\262\320\265\321\201\321\202", 0.0172691f},
+	{"\320\267\320\264", 0.0473877f}, {"\320\267\320\264\320\260", 0.020401f}, {"\320\267\320\264\320\260\320\275", 0.00784429f},
+	{"\320\267\320\264\320\260\320\275\320\270", 0.00544417f}, {"\320\267\320\264\320\260\321\202", 0.0092785f}, {"\320\267\320\264\320\260\321\202\321\214", 0.00837114f},
+	{"\320\267\320\264\320\265", 0.0278062f}, {"\320\267\320\264\320\265\320\273", 0.0266354f}, {"\320\267\320\264\320\265\320\273$", 0.00886873f},
+	{"\320\267\320\264\320\265\320\273\320\260", 0.00848822f}, {"\320\267\320\265", 0.00681984f}, {"\320\267\320\270", 0.0176789f},
+	{"\320\267\320\270\321\202", 0.00755159f}, {"\320\267\320\270\321\202\320\276", 0.00529782f}, {"\320\267\320\270\321\202\320\276\321\200", 0.00529782f},
+	{"\320\267\320\272", 0.0054149f}, {"\320\267\320\274", 0.0590078f}, {"\320\267\320\274\320\265", 0.0331333f},
+	{"\320\267\320\274\320\265\320\275", 0.0180009f}, {"\320\267\320\274\320\265\320\275\320\265", 0.0110054f}, {"\320\267\320\274\320\265\321\200", 0.0147812f},
+	{"\320\267\320\274\320\265\321\200$", 0.0111518f}, {"\320\267\320\274\320\276", 0.0267818f}, {"\320\267\320\274\320\276\320\266", 0.0266062f},
+	{"\320\267\320\274\320\276\320\266\320\275", 0.0262842f}, {"\320\267\320\275", 0.0441973f}, {"\320\267\320\275\320\260", 0.0410361f},
+	{"\320\267\320\275\320\260\320\275", 0.00573687f}, {"\320\267\320\275\320\260\321\207", 0.0330162f}, {"\320\267\320\275\320\260\321\207\320\265", 0.0295039f},
+	{"\320\267\320\276", 0.0753403f}, {"\320\267\320\276\320\261", 0.00550271f}, {"\320\267\320\276\320\261\321\200", 0.00526855f},
+	{"\320\267\320\276\320\261\321\200\320\260", 0.00526855f}, {"\320\267\320\276\320\262", 0.0521001f}, {"\320\267\320\276\320\262\320\260", 0.0466267f},
+	{"\320\267\320\276\320\262\320\260\320\275", 0.0149861f}, {"\320\267\320\276\320\262\320\260\321\202", 0.031143f}, {"\320\267\320\276\320\275", 0.0113567f},
+	{"\320\267\320\276\320\275\320\260", 0.0073467f}, {"\320\267\320\276\320\275\320\260$", 0.0073467f}, {"\320\267\321\200", 0.00828333f},
+	{"\320\267\321\200\320\265", 0.00684911f}, {"\320\267\321\200\320\265\321\210", 0.00643934f}, {"\320\267\321\203", 0.0280697f},
+	{"\320\267\321\203\320\265", 0.0134641f}, {"\320\267\321\203\320\265\321\202", 0.0104786f}, {"\320\267\321\203\320\265\321\202\321\201", 0.00878092f},
+	{"\320\267\321\203\320\271", 0.00623445f}, {"\320\267\321\203\320\271\321\202", 0.00623445f}, {"\320\267\321\203\320\271\321\202\320\265", 0.00623445f},
+	{"\320\267\321\213", 0.0233572f}, {"\320\267\321\213\320\262", 0.00936631f}, {"\320\267\321\213\320\262\320\260", 0.00919069f},
+	{"\320\267\321\213\320\272", 0.0117372f}, {"\320\267\321\213\320\272\320\270", 0.0101273f}, {"\320\267\321\213\320\272\320\270$", 0.0101273f},
+	{"\320\267\321\217", 0.00722962f}, {"\320\267\321\217$", 0.00679058f}, {"\320\270$", 0.262608f},
+	{"\320\270\320\260", 0.0220986f}, {"\320\270\320\260\320\273", 0.00576613f}, {"\320\270\320\260\320\277", 0.0108298f},
+	{"\320\270\320\260\320\277\320\260", 0.0108298f}, {"\320\270\320\260\320\277\320\260\320\267", 0.0108298f}, {"\320\270\320\261", 0.0540904f},
+	{"\320\270\320\261\320\272", 0.0401581f}, {"\320\270\320\261\320\272\320\260", 0.0355334f}, {"\320\270\320\261\320\272\320\260$", 0.0343919f},
+	{"\320\270\320\261\321\203", 0.00547344f}, {"\320\270\320\261\321\203\321\202", 0.00538563f}, {"\320\270\320\262", 0.0612323f},
+	{"\320\270\320\262\320\260", 0.0414752f}, {"\320\270\320\262\320\260$", 0.00690765f}, {"\320\270\320\262\320\260\320\265", 0.0226548f},
+	{"\320\270\320\262\320\260\320\265\320\274", 0.00766867f}, {"\320\270\320\262\320\260\320\265\321\202", 0.0150154f}, {"\320\270\320\262\320\275", 0.00600029f},
+	{"\320\270\320\263", 0.0255525f}, {"\320\270\320\263\320\275", 0.0154837f}, {"\320\270\320\263\320\275\320\276", 0.011825f},
+	{"\320\270\320\263\320\275\320\276\321\200", 0.011825f}, {"\320\270\320\264", 0.0362359f}, {"\320\270\320\264\320\260", 0.0206059f},
+	{"\320\270\320\264\320\260\320\265", 0.0101566f}, {"\320\270\320\264\320\260\320\265\321\202", 0.00916142f}, {"\320\270\320\264\320\260\320\275", 0.00661496f},
+	{"\320\270\320\264\320\265", 0.0110932f}, {"\320\270\320\264\320\265\320\275", 0.00781502f}, {"\320\270\320\264\320\265\320\275\321\202", 0.00728816f},
+	{"\320\270\320\265", 0.158203f}, {"\320\270\320\265$", 0.147256f}, {"\320\270\320\265\320\274", 0.00702473f},
+	{"\320\270\320\265\320\274$", 0.00670277f}, {"\320\270\320\267", 0.0790868f}, {"\320\270\320\267$", 0.0221864f},
+	{"\320\270\320\267\320\262", 0.0218645f}, {"\320\270\320\267\320\262\320\265", 0.0176204f}, {"\320\270\320\267\320\262\320\265\321\201", 0.0172691f},
+	{"\320\270\320\267\320\274", 0.0184692f}, {"\320\270\320\267\320\274\320\265", 0.0182643f}, {"\320\270\320\267\320\274\320\265\320\275", 0.0180009f},
+	{"\320\270\320\267\320\276", 0.00778575f}, {"\320\270\320\270", 0.0634568f}, {"\320\270\320\270$", 0.0632811f},
+	{"\320\270\320\271", 0.0877506f}, {"\320\270\320\271$", 0.0808722f}, {"\320\270\320\271\321\201", 0.00875165f},
+	{"\320\270\320\271\321\201\320\272", 0.00787355f}, {"\320\270\320\272", 0.0688717f}, {"\320\270\320\272$", 0.00693692f},
+	{"\320\270\320\272\320\260", 0.0410069f}, {"\320\270\320\272\320\260$", 0.0148983f}, {"\320\270\320\272\320\260\321\202", 0.0166837f},
+	{"\320\270\320\272\320\260\321\202\320\276", 0.0108591f}, {"\320\270\320\272\320\260\321\206", 0.00679058f}, {"\320\270\320\272\320\260\321\206\320\270", 0.00679058f},
+	{"\320\270\320\272\320\276", 0.00532709f}, {"\320\270\320\272\321\201", 0.00641007f}, {"\320\270\320\273", 0.066735f},
+	{"\320\270\320\273\320\270", 0.0355627f}, {"\320\270\320\273\320\270$", 0.0302064f}, {"\320\270\320\273\320\276", 0.00649788f},
+	{"\320\270\320\273\321\214", 0.0140787f}, {"\320\270\320\273\321\214\320\275", 0.0100688f}, {"\320\270\320\274", 0.144124f},
+	{"\320\270\320\274$", 0.0150154f}, {"\320\270\320\274\320\260", 0.0153373f}, {"\320\270\320\274\320\262", 0.0363823f},
+	{"\320\270\320\274\320\262\320\276", 0.0362359f}, {"\320\270\320\274\320\262\320\276\320\273", 0.0362359f}, {"\320\270\320\274\320\265", 0.0326357f},
+	{"\320\270\320\274\320\265\320\265", 0.00556125f}, {"\320\270\320\274\320\265\320\265\321\202", 0.00553198f}, {"\320\270\320\274\320\265\320\275", 0.0190253f},
+	{"\320\270\320\274\320\265\320\275\320\270", 0.00720035f}, {"\320\270\320\274\320\276", 0.0224791f}, {"\320\270\320\274\320\276$", 0.00632226f},
+	{"\320\270\320\274\320\276\320\265", 0.00714181f}, {"\320\270\320\274\320\276\320\265$", 0.00714181f}, {"\320\270\320\274\320\276\321\201", 0.0051222f},
+	{"\320\270\320\274\320\276\321\201\321\202", 0.00506366f}, {"\320\270\320\274\321\213", 0.0121762f}, {"\320\270\320\274\321\213\320\271", 0.00623445f},
+	{"\320\270\320\274\321\213\320\271$", 0.00623445f}, {"\320\270\320\274\321\217", 0.0206937f}, {"\320\270\320\274\321\217$", 0.0206644f},
+	{"\320\270\320\275", 0.122465f}, {"\320\270\320\275$", 0.00629299f}, {"\320\270\320\275\320\260", 0.0222157f},
+	{"\320\270\320\275\320\260$", 0.00761013f}, {"\320\270\320\275\320\264", 0.0153373f}, {"\320\270\320\275\320\264\320\265", 0.0128201f},
+	{"\320\270\320\275\320\264\320\265\320\272", 0.0124396f}, {"\320\270\320\275\320\265", 0.0051222f}, {"\320\270\320\275\320\270", 0.0099517f},
+	{"\320\270\320\275\320\275", 0.00523928f}, {"\320\270\320\275\321\201", 0.0249963f}, {"\320\270\320\275\321\201\320\272", 0.00676131f},
+	{"\320\270\320\275\321\201\321\202", 0.0177375f}, {"\320\270\320\275\321\201\321\202\321\200", 0.0172691f}, {"\320\270\320\275\321\202", 0.00804917f},
+	{"\320\270\320\275\321\204", 0.0122933f}, {"\320\270\320\275\321\204\320\276", 0.0120884f}, {"\320\270\320\275\321\204\320\276\321\200", 0.0115615f},
+	{"\320\270\320\276", 0.0105078f}, {"\320\270\320\277", 0.0239134f}, {"\320\270\320\277$", 0.0126445f},
+	{"\320\270\321\200", 0.0781209f}, {"\320\270\321\200\320\265", 0.0101566f}, {"\320\270\321\200\320\265\320\275", 0.00553198f},
+	{"\320\270\321\200\320\276", 0.0432606f}, {"\320\270\321\200\320\276\320\262", 0.0423826f}, {"\320\270\321\200\320\276\320\262\320\260", 0.0366164f},
+	{"\320\270\321\200\320\276\320\262\320\272", 0.00553198f}, {"\320\270\321\200\321\203", 0.0138738f}, {"\320\270\321\200\321\203\320\265", 0.0106834f},
+	{"\320\270\321\200\321\203\320\265\321\202", 0.00842968f}, {"\320\270\321\201", 0.165374f}, {"\320\270\321\201\320\260", 0.0105956f},
+	{"\320\270\321\201\320\270", 0.0158935f}, {"\320\270\321\201\320\270$", 0.0111518f}, {"\320\270\321\201\320\272", 0.0158935f},
+	{"\320\270\321\201\320\272\320\260", 0.00693692f}, {"\320\270\321\201\320\272\320\260$", 0.0057076f}, {"\320\270\321\201\320\273", 0.0123226f},
+	{"\320\270\321\201\320\273\320\276", 0.00699546f}, {"\320\270\321\201\320\276", 0.00755159f}, {"\320\270\321\201\320\276\320\272", 0.00676131f},
+	{"\320\270\321\201\320\276\320\272$", 0.00676131f}, {"\320\270\321\201\320\277", 0.053066f}, {"\320\270\321\201\320\277\320\276", 0.0501683f},
+	{"\320\270\321\201\320\277\320\276\320\273", 0.0500805f}, {"\320\270\321\201\321\202", 0.0424996f}, {"\320\270\321\201\321\202\320\265", 0.0105664f},
+	{"\320\270\321\201\321\202\320\265\320\274", 0.00924923f}, {"\320\270\321\201\321\202\320\276", 0.00515147f}, {"\320\270\321\201\321\202\321\200", 0.0225377f},
+	{"\320\270\321\201\321\202\321\200$", 0.00936631f}, {"\320\270\321\201\321\202\321\200\320\260", 0.00559052f}, {"\320\270\321\201\321\202\321\200\320\276", 0.0060881f},
+	{"\320\270\321\201\321\214", 0.0116201f}, {"\320\270\321\201\321\214$", 0.0103908f}, {"\320\270\321\202", 0.166164f},
+	{"\320\270\321\202$", 0.0180887f}, {"\320\270\321\202\320\260", 0.0183814f}, {"\320\270\321\202\320\260\321\202", 0.00819552f},
+	{"\320\270\321\202\320\260\321\202\321\214", 0.00819552f}, {"\320\270\321\202\320\265", 0.0386068f}, {"\320\270\321\202\320\265$", 0.0125567f},
+	{"\320\270\321\202\320\265\320\272", 0.00576613f}, {"\320\270\321\202\320\265\320\272\321\202", 0.00576613f}, {"\320\270\321\202\320\265\320\273", 0.0189082f},
+	{"\320\270\321\202\320\265\320\273\321\214", 0.0165374f}, {"\320\270\321\202\320\275", 0.00752232f}, {"\320\270\321\202\320\276", 0.00971755f},
+	{"\320\270\321\202\320\276\321\200", 0.00635153f}, {"\320\270\321\202\320\276\321\200\320\270", 0.00597102f}, {"\320\270\321\202\321\214", 0.0777989f},
+	{"\320\270\321\202\321\214$", 0.0759549f}, {"\320\270\321\204", 0.0298258f}, {"\320\270\321\204\320\270", 0.023328f},
+	{"\320\270\321\204\320\270\320\272", 0.021923f}, {"\320\270\321\204\320\270\320\272\320\260", 0.021923f}, {"\320\270\321\205", 0.0148983f},
+	{"\320\270\321\205$", 0.0132885f}, {"\320\270\321\206", 0.0205766f}, {"\320\270\321\206\320\260", 0.00702473f},
+	{"\320\270\321\206\320\260$", 0.00509293f}, {"\320\270\321\207", 0.0390458f}, {"\320\270\321\207\320\265", 0.0242646f},
+	{"\320\270\321\207\320\265\321\201", 0.0199619f}, {"\320\270\321\207\320\265\321\201\320\272", 0.0157764f}, {"\320\270\321\207\320\275", 0.0100102f},
+	{"\320\270\321\207\320\275\321\213", 0.0054149f}, {"\320\270\321\210", 0.0190253f}, {"\320\270\321\210\320\272", 0.0122933f},
+	{"\320\270\321\210\320\272\320\276", 0.0120591f}, {"\320\270\321\210\320\272\320\276\320\274", 0.0120006f}, {"\320\270\321\216", 0.029621f},
+	{"\320\270\321\216$", 0.0295039f}, {"\320\270\321\217", 0.129723f}, {"\320\270\321\217$", 0.123752f},
+	{"\320\271$", 0.256842f}, {"\320\271\320\264", 0.011181f}, {"\320\271\320\264\320\265", 0.00968828f},
+	{"\320\271\320\264\320\265\320\275", 0.0095712f}, {"\320\271\320\273", 0.0840919f}, {"\320\271\320\273$", 0.0355334f},
+	{"\320\271\320\273\320\260", 0.0261086f}, {"\320\271\320\273\320\260$", 0.0238841f}, {"\320\271\320\273\320\265", 0.00556125f},
+	{"\320\271\320\273\320\265$", 0.00529782f}, {"\320\271\320\273\320\276", 0.0154837f}, {"\320\271\320\273\320\276\320\262", 0.0135226f},
+	{"\320\271\320\273\320\276\320\262$", 0.0104493f}, {"\320\271\320\273\321\213", 0.0076394f}, {"\320\271\320\273\321\213$", 0.0076394f},
+	{"\320\271\320\275", 0.00547344f}, {"\320\271\320\276", 0.00497585f}, {"\320\271\321\201", 0.0302942f},
+	{"\320\271\321\201\320\272", 0.0123811f}, {"\320\271\321\201\320\272\320\270", 0.00699546f}, {"\320\271\321\201\320\272\320\270\320\271", 0.00506366f},
+	{"\320\271\321\201\321\202", 0.0153081f}, {"\320\271\321\201\321\202\320\262", 0.0137275f}, {"\320\271\321\201\321\202\320\262\320\270", 0.00766867f},
+	{"\320\271\321\202", 0.0301771f}, {"\320\271\321\202$", 0.00623445f}, {"\320\271\321\202\320\265", 0.0102444f},
+	{"\320\271\321\202\320\265$", 0.0100102f}, {"\320\271\321\202\320\270", 0.00930777f}, {"\320\271\321\202\320\270$", 0.00924923f},
+	{"\320\272$", 0.0715059f}, {"\320\272\320\260", 0.25052f}, {"\320\272\320\260$", 0.102737f},
+	{"\320\272\320\260\320\265", 0.00509293f}, {"\320\272\320\260\320\266", 0.00614664f}, {"\320\272\320\260\320\267", 0.036353f},
+	{"\320\272\320\260\320\267\320\260", 0.0280989f}, {"\320\272\320\260\320\267\320\260\320\275", 0.0165959f}, {"\320\272\320\260\320\267\320\260\321\202", 0.0108298f},
+	{"\320\272\320\260\320\267\321\213", 0.00614664f}, {"\320\272\320\260\320\267\321\213\320\262", 0.0060881f}, {"\320\272\320\260\320\272", 0.0171813f},
+	{"\320\272\320\260\320\272$", 0.0152495f}, {"\320\272\320\260\320\273", 0.00872238f}, {"\320\272\320\260\320\273\321\214", 0.00620518f},
+	{"\320\272\320\260\320\273\321\214\320\275", 0.00564906f}, {"\320\272\320\260\320\275", 0.00690765f}, {"\320\272\320\260\321\200", 0.00535636f},
+	{"\320\272\320\260\321\202", 0.0403629f}, {"\320\272\320\260\321\202\320\260", 0.0240304f}, {"\320\272\320\260\321\202\320\260\320\273", 0.0208693f},
+	{"\320\272\320\260\321\202\320\276", 0.0108591f}, {"\320\272\320\260\321\202\320\276\321\200", 0.00863457f}, {"\320\272\320\260\321\206", 0.00681984f},
+	{"\320\272\320\260\321\206\320\270", 0.00681984f}, {"\320\272\320\260\321\217", 0.0353286f}, {"\320\272\320\260\321\217$", 0.0350944f},
+	{"\320\272\320\265", 0.041885f}, {"\320\272\320\265$", 0.0177082f}, {"\320\272\320\265\321\202", 0.020401f},
+	{"\320\272\320\265\321\202$", 0.00658569f}, {"\320\272\320\265\321\202\320\260", 0.00649788f}, {"\320\272\320\265\321\202\320\260$", 0.00605883f},
+	{"\320\272\320\270", 0.123752f}, {"\320\272\320\270$", 0.0635153f}, {"\320\272\320\270\320\265", 0.0132885f},
+	{"\320\272\320\270\320\265$", 0.0131128f}, {"\320\272\320\270\320\271", 0.042324f}, {"\320\272\320\270\320\271$", 0.0421777f},
+	{"\320\272\320\270\321\200", 0.00553198f}, {"\320\272\320\273", 0.0527733f}, {"\320\272\320\273\320\260", 0.008898f},
+	{"\320\272\320\273\320\260\320\262", 0.00506366f}, {"\320\272\320\273\320\260\320\262\320\270", 0.00506366f}, {"\320\272\320\273\321\216", 0.038519f},
+	{"\320\272\320\273\321\216\321\207", 0.0384604f}, {"\320\272\320\273\321\216\321\207$", 0.00895653f}, {"\320\272\320\273\321\216\321\207\320\260", 0.00954193f},
+	{"\320\272\320\273\321\216\321\207\320\265", 0.0104786f}, {"\320\272\320\273\321\216\321\207\320\270", 0.00919069f}, {"\320\272\320\276", 0.182848f},
+	{"\320\272\320\276$", 0.0257866f}, {"\320\272\320\276\320\262", 0.0112103f}, {"\320\272\320\276\320\263", 0.00509293f},
+	{"\320\272\320\276\320\264", 0.0202546f}, {"\320\272\320\276\320\264$", 0.00939558f}, {"\320\272\320\276\320\271", 0.00799063f},
+	{"\320\272\320\276\320\271$", 0.00787355f}, {"\320\272\320\276\320\273", 0.0128787f}, {"\320\272\320\276\320\273\321\214", 0.00506366f},
+	{"\320\272\320\276\320\274", 0.053505f}, {"\320\272\320\276\320\274$", 0.0160691f}, {"\320\272\320\276\320\274\320\260", 0.0149861f},
+	{"\320\272\320\276\320\274\320\260\320\275", 0.0148397f}, {"\320\272\320\276\320\274\320\274", 0.00980536f}, {"\320\272\320\276\320\274\320\274\320\270", 0.00886873f},
+	{"\320\272\320\276\320\274\320\277", 0.011181f}, {"\320\272\320\276\320\274\320\277\320\276", 0.0076394f}, {"\320\272\320\276\320\275", 0.0292697f},
+	{"\320\272\320\276\320\275\321\202", 0.00681984f}, {"\320\272\320\276\320\277", 0.00582467f}, {"\320\272\320\276\320\277\320\270", 0.0054149f},
+	{"\320\272\320\276\321\200", 0.0233572f}, {"\320\272\320\276\321\200\321\200", 0.0163325f}, {"\320\272\320\276\321\200\321\200\320\265", 0.0162154f},
+	{"\320\272\320\276\321\202", 0.01042f}, {"\320\272\320\276\321\202\320\276", 0.00933704f}, {"\320\272\320\276\321\202\320\276\321\200", 0.00933704f},
+	{"\320\272\321\200", 0.0432021f}, {"\320\272\321\200\320\260", 0.0136982f}, {"\320\272\321\200\320\260\320\271", 0.00793209f},
+	{"\320\272\321\200\320\260\320\271$", 0.00755159f}, {"\320\272\321\200\321\213", 0.015513f}, {"\320\272\321\200\321\213\321\202", 0.0127031f},
+	{"\320\272\321\200\321\213\321\202\321\214", 0.00641007f}, {"\320\272\321\201", 0.0415045f}, {"\320\272\321\201$", 0.00942485f},
+	{"\320\272\321\201\320\270", 0.0100395f}, {"\320\272\321\201\321\202", 0.00649788f}, {"\320\272\321\202", 0.053505f},
+	{"\320\272\321\202\320\260", 0.0051222f}, {"\320\272\321\202\320\270", 0.00828333f}, {"\320\272\321\202\320\270\320\262", 0.00646861f},
+	{"\320\272\321\202\320\275", 0.0184399f}, {"\320\272\321\202\320\275\320\276", 0.00594175f}, {"\320\272\321\202\320\275\321\213", 0.0105078f},
+	{"\320\272\321\202\320\275\321\213\320\271", 0.008898f}, {"\320\272\321\202\320\276", 0.00526855f}, {"\320\272\321\202\321\203", 0.00854676f},
+	{"\320\272\321\202\321\203\321\200", 0.00725889f}, {"\320\272\321\203", 0.0360603f}, {"\320\272\321\203$", 0.0182058f},
+	{"\320\272\321\203\320\274", 0.00518074f}, {"\320\272\321\203\321\211", 0.00532709f}, {"\320\272\321\206", 0.0256988f},
+	{"\320\272\321\206\320\270", 0.025611f}, {"\320\272\321\206\320\270\320\270", 0.0138446f}, {"\320\272\321\206\320\270\320\270$", 0.0138446f},
+	{"\320\272\321\206\320\270\321\217", 0.0066735f}, {"\320\272\321\206\320\270\321\217$", 0.00582467f}, {"\320\273$", 0.072706f},
+	{"\320\273\320\260", 0.117606f}, {"\320\273\320\260$", 0.0531245f}, {"\320\273\320\260\320\262", 0.0099517f},
+	{"\320\273\320\260\320\262\320\270", 0.00529782f}, {"\320\273\320\260\320\263", 0.0073467f}, {"\320\273\320\260\320\264", 0.00790282f},
+	{"\320\273\320\260\320\274", 0.00658569f}, {"\320\273\320\260\320\275", 0.00582467f}, {"\320\273\320\260\321\201", 0.014108f},
+	{"\320\273\320\260\321\201\321\202", 0.00749305f}, {"\320\273\320\260\321\201\321\202\321\214", 0.00602956f}, {"\320\273\320\260\321\202", 0.00623445f},
+	{"\320\273\320\265", 0.124718f}, {"\320\273\320\265$", 0.026372f}, {"\320\273\320\265\320\262", 0.00661496f},
+	{"\320\273\320\265\320\264", 0.0121762f}, {"\320\273\320\265\320\271", 0.00544417f}, {"\320\273\320\265\320\274", 0.0143714f},
+	{"\320\273\320\265\320\274\320\265", 0.0101859f}, {"\320\273\320\265\320\274\320\265\320\275", 0.0100395f}, {"\320\273\320\265\320\275", 0.0495536f},
+	{"\320\273\320\265\320\275\320\270", 0.0279819f}, {"\320\273\320\265\320\275\320\270\320\265", 0.0126738f}, {"\320\273\320\265\320\275\320\270\321\217", 0.0119713f},
+	{"\320\273\320\265\320\275\320\275", 0.00693692f}, {"\320\273\320\266", 0.0208108f}, {"\320\273\320\266\320\265", 0.00901507f},
+	{"\320\273\320\266\320\265\320\275", 0.00901507f}, {"\320\273\320\266\320\265\320\275$", 0.00848822f}, {"\320\273\320\266\320\275", 0.0102151f},
+	{"\320\273\320\270", 0.147197f}, {"\320\273\320\270$", 0.0473584f}, {"\320\273\320\270\320\267", 0.00629299f},
+	{"\320\273\320\270\320\272", 0.0159227f}, {"\320\273\320\270\320\272\320\260", 0.0100688f}, {"\320\273\320\270\320\272\320\260$", 0.00968828f},
+	{"\320\273\320\270\320\275", 0.0144007f}, {"\320\273\320\270\321\202", 0.0189668f}, {"\320\273\320\270\321\202\321\214", 0.011942f},
+	{"\320\273\320\270\321\202\321\214$", 0.0119128f}, {"\320\273\320\270\321\206", 0.00921996f}, {"\320\273\320\270\321\207", 0.00998097f},
+	{"\320\273\320\270\321\207\320\265", 0.00573687f}, {"\320\273\320\270\321\207\320\265\321\201", 0.00523928f}, {"\320\273\320\270\321\210", 0.0134933f},
+	{"\320\273\320\270\321\210\320\272", 0.0120591f}, {"\320\273\320\270\321\210\320\272\320\276", 0.0120006f}, {"\320\273\320\270\321\217", 0.00600029f},
+	{"\320\273\320\272", 0.013025f}, {"\320\273\320\273", 0.00588321f}, {"\320\273\320\275", 0.0274843f},
+	{"\320\273\320\275\320\265", 0.00965901f}, {"\320\273\320\275\320\265\320\275", 0.00965901f}, {"\320\273\320\275\320\265\320\275\320\270", 0.00842968f},
+	{"\320\273\320\275\320\270", 0.00954193f}, {"\320\273\320\275\320\270\321\202", 0.0092785f}, {"\320\273\320\275\320\270\321\202\321\214", 0.00594175f},
+	{"\320\273\320\275\321\217", 0.00623445f}, {"\320\273\320\276", 0.157003f}, {"\320\273\320\276$", 0.0116786f},
+	{"\320\273\320\276\320\262", 0.0399824f}, {"\320\273\320\276\320\262$", 0.0201083f}, {"\320\273\320\276\320\262\320\276", 0.00787355f},
+	{"\320\273\320\276\320\263", 0.0230645f}, {"\320\273\320\276\320\263$", 0.011181f}, {"\320\273\320\276\320\266", 0.0127909f},
+	{"\320\273\320\276\320\266\320\265", 0.0105664f}, {"\320\273\320\276\320\266\320\265\320\275", 0.0105664f}, {"\320\273\320\276\320\272", 0.0179131f},
+	{"\320\273\320\276\320\272\320\260", 0.00737597f}, {"\320\273\320\276\320\272\320\260\320\273", 0.00573687f}, {"\320\273\320\276\320\272\320\270", 0.00547344f},
+	{"\320\273\320\276\320\274", 0.00649788f}, {"\320\273\320\276\320\274$", 0.00523928f}, {"\320\273\320\276\320\275", 0.00854676f},
+	{"\320\273\320\276\321\201", 0.046012f}, {"\320\273\320\276\321\201\321\214", 0.0451339f}, {"\320\273\320\276\321\201\321\214$", 0.0451339f},
+	{"\320\273\321\203", 0.0269867f}, {"\320\273\321\203\321\207", 0.0146056f}, {"\320\273\321\203\321\207\320\265", 0.00649788f},
+	{"\320\273\321\203\321\207\320\265\320\275", 0.00649788f}, {"\320\273\321\203\321\207\320\270", 0.00553198f}, {"\320\273\321\203\321\207\320\270\321\202", 0.00521001f},
+	{"\320\273\321\207", 0.0121177f}, {"\320\273\321\207\320\260", 0.0121177f}, {"\320\273\321\207\320\260\320\275", 0.0120884f},
+	{"\320\273\321\207\320\260\320\275\320\270", 0.0120884f}, {"\320\273\321\213", 0.0169764f}, {"\320\273\321\213$", 0.0157178f},
+	{"\320\273\321\214", 0.173394f}, {"\320\273\321\214$", 0.0211035f}, {"\320\273\321\214\320\267", 0.0642763f},
+	{"\320\273\321\214\320\267\320\276", 0.0412118f}, {"\320\273\321\214\320\267\320\276\320\262", 0.0412118f}, {"\320\273\321\214\320\267\321\203", 0.0207522f},
+	{"\320\273\321\214\320\267\321\203\320\265", 0.0120299f}, {"\320\273\321\214\320\267\321\203\320\271", 0.00617591f}, {"\320\273\321\214\320\267\321\217", 0.00679058f},
+	{"\320\273\321\214\320\267\321\217$", 0.00679058f}, {"\320\273\321\214\320\272", 0.0210449f}, {"\320\273\321\214\320\272\320\276", 0.0201083f},
+	{"\320\273\321\214\320\272\320\276$", 0.0201083f}, {"\320\273\321\214\320\275", 0.0605591f}, {"\320\273\321\214\320\275\320\260", 0.0054149f},
+	{"\320\273\321\214\320\275\320\260\321\217", 0.00509293f}, {"\320\273\321\214\320\275\320\276", 0.0264891f}, {"\320\273\321\214\320\275\320\276$", 0.00690765f},
+	{"\320\273\321\214\320\275\320\276\320\265", 0.00684911f}, {"\320\273\321\214\320\275\321\213", 0.0272501f}, {"\320\273\321\214\320\275\321\213\320\265", 0.00635153f},
+	{"\320\273\321\214\320\275\321\213\320\271", 0.0140787f}, {"\320\273\321\214\321\201", 0.00799063f}, {"\320\273\321\214\321\201\320\272", 0.00740524f},
+	{"\320\273\321\214\321\202", 0.00740524f}, {"\320\273\321\214\321\210", 0.00728816f}, {"\320\273\321\216", 0.0445485f},
+	{"\320\273\321\216\321\207", 0.038519f}, {"\320\273\321\216\321\207$", 0.00895653f}, {"\320\273\321\216\321\207\320\260", 0.00954193f},
+	{"\320\273\321\216\321\207\320\260$", 0.00611737f}, {"\320\273\321\216\321\207\320\265", 0.0104786f}, {"\320\273\321\216\321\207\320\265\320\275", 0.00597102f},
+	{"\320\273\321\216\321\207\320\270", 0.00924923f}, {"\320\273\321\216\321\207\320\270\321\202", 0.00749305f}, {"\320\273\321\217", 0.121733f},
+	{"\320\273\321\217$", 0.0924923f}, {"\320\273\321\217\320\265", 0.01443f}, {"\320\273\321\217\320\265\321\202", 0.0130543f},
+	{"\320\273\321\217\320\265\321\202\321\201", 0.0111225f}, {"\320\273\321\217\321\202", 0.00523928f}, {"\320\273\321\217\321\216", 0.00544417f},
+	{"\320\273\321\221", 0.00758086f}, {"\320\273\321\221\320\275", 0.00711254f}, {"\320\274$", 0.101068f},
+	{"\320\274\320\260", 0.0975852f}, {"\320\274\320\260$", 0.0124104f}, {"\320\274\320\260\320\272", 0.00564906f},
+	{"\320\274\320\260\320\273", 0.00822479f}, {"\320\274\320\260\320\275", 0.0227718f}, {"\320\274\320\260\320\275\320\264", 0.0154544f},
+	{"\320\274\320\260\320\275\320\264\320\260", 0.00523928f}, {"\320\274\320\260\321\202", 0.0180594f}, {"\320\274\320\260\321\202$", 0.0063808f},
+	{"\320\274\320\260\321\206", 0.0116786f}, {"\320\274\320\260\321\206\320\270", 0.0116786f}, {"\320\274\320\260\321\217", 0.00544417f},
+	{"\320\274\320\260\321\217$", 0.00532709f}, {"\320\274\320\261", 0.00778575f}, {"\320\274\320\262", 0.0366164f},
+	{"\320\274\320\262\320\276", 0.0362359f}, {"\320\274\320\262\320\276\320\273", 0.0362359f}, {"\320\274\320\262\320\276\320\273$", 0.0121762f},
+	{"\320\274\320\262\320\276\320\273\320\260", 0.00664423f}, {"\320\274\320\262\320\276\320\273\320\276", 0.00772721f}, {"\320\274\320\262\320\276\320\273\321\213", 0.00564906f},
+	{"\320\274\320\265", 0.205532f}, {"\320\274\320\265$", 0.007054f}, {"\320\274\320\265\320\265", 0.00559052f},
+	{"\320\274\320\265\320\265\321\202", 0.00556125f}, {"\320\274\320\265\320\265\321\202$", 0.00506366f}, {"\320\274\320\265\320\275", 0.0894483f},
+	{"\320\274\320\265\320\275\320\260", 0.00503439f}, {"\320\274\320\265\320\275\320\265", 0.0160105f}, {"\320\274\320\265\320\275\320\265\320\275", 0.0123518f},
+	{"\320\274\320\265\320\275\320\270", 0.0166837f}, {"\320\274\320\265\320\275\320\270$", 0.00872238f}, {"\320\274\320\265\320\275\320\270\321\202", 0.00661496f},
+	{"\320\274\320\265\320\275\320\275", 0.0100395f}, {"\320\274\320\265\320\275\321\202", 0.0318162f}, {"\320\274\320\265\320\275\321\202$", 0.0153959f},
+	{"\320\274\320\265\320\275\321\202\320\260", 0.00620518f}, {"\320\274\320\265\321\200", 0.0312308f}, {"\320\274\320\265\321\200$", 0.0197863f},
+	{"\320\274\320\265\321\201", 0.0153666f}, {"\320\274\320\265\321\201\321\202", 0.0151032f}, {"\320\274\320\265\321\201\321\202\320\276", 0.0060881f},
+	{"\320\274\320\265\321\202", 0.0446071f}, {"\320\274\320\265\321\202\320\272", 0.00799063f}, {"\320\274\320\265\321\202\321\200", 0.0299137f},
+	{"\320\274\320\265\321\202\321\200$", 0.0134348f}, {"\320\274\320\265\321\202\321\200\321\213", 0.00907361f}, {"\320\274\320\265\321\211", 0.0280111f},
+	{"\320\274\320\265\321\211\320\265", 0.0249085f}, {"\320\274\320\265\321\211\320\265\320\275", 0.0249085f}, {"\320\274\320\270", 0.0450461f},
+	{"\320\274\320\270$", 0.0200498f}, {"\320\274\320\270\320\275", 0.00626372f}, {"\320\274\320\270\321\202", 0.00980536f},
+	{"\320\274\320\274", 0.0222157f}, {"\320\274\320\274\320\270", 0.00913215f}, {"\320\274\320\274\320\270\321\202", 0.00869311f},
+	{"\320\274\320\275", 0.0123811f}, {"\320\274\320\275\320\276", 0.00752232f}, {"\320\274\320\275\320\276\320\263", 0.0051222f},
+	{"\320\274\320\275\320\276\320\263\320\276", 0.0051222f}, {"\320\274\320\276", 0.105986f}, {"\320\274\320\276$", 0.00772721f},
+	{"\320\274\320\276\320\263", 0.0095712f}, {"\320\274\320\276\320\264", 0.0073467f}, {"\320\274\320\276\320\264\321\203", 0.00526855f},
+	{"\320\274\320\276\320\264\321\203\320\273", 0.00526855f}, {"\320\274\320\276\320\265", 0.00930777f}, {"\320\274\320\276\320\265$", 0.00924923f},
+	{"\320\274\320\276\320\266", 0.0406849f}, {"\320\274\320\276\320\266\320\265", 0.0123226f}, {"\320\274\320\276\320\266\320\265\321\202", 0.011942f},
+	{"\320\274\320\276\320\266\320\275", 0.0291234f}, {"\320\274\320\276\320\266\320\275\320\276", 0.0278062f}, {"\320\274\320\276\320\273", 0.0127909f},
+	{"\320\274\320\276\320\273\321\207", 0.0121177f}, {"\320\274\320\276\320\273\321\207\320\260", 0.0121177f}, {"\320\274\320\276\321\201", 0.00582467f},
+	{"\320\274\320\276\321\201\321\202", 0.00535636f}, {"\320\274\320\277", 0.016391f}, {"\320\274\320\277\320\276", 0.0104493f},
+	{"\320\274\320\277\320\276\320\275", 0.00755159f}, {"\320\274\321\203", 0.0173277f}, {"\320\274\321\203$", 0.0105078f},
+	{"\320\274\321\213", 0.0385775f}, {"\320\274\321\213$", 0.0104493f}, {"\320\274\321\213\320\265", 0.00602956f},
+	{"\320\274\321\213\320\265$", 0.00602956f}, {"\320\274\321\213\320\271", 0.0127616f}, {"\320\274\321\213\320\271$", 0.0127616f},
+	{"\320\274\321\217", 0.0322552f}, {"\320\274\321\217$", 0.0258744f}, {"\320\274\321\217\321\202", 0.00564906f},
+	{"\320\275$", 0.0910874f}, {"\320\275\320\260", 0.199473f}, {"\320\275\320\260$", 0.0723255f},
+	{"\320\275\320\260\320\267", 0.00822479f}, {"\320\275\320\260\320\267\320\275", 0.0054149f}, {"\320\275\320\260\320\267\320\275\320\260", 0.0054149f},
+	{"\320\275\320\260\320\271", 0.014108f}, {"\320\275\320\260\320\271\320\264", 0.0092785f}, {"\320\275\320\260\320\271\320\264\320\265", 0.00921996f},
+	{"\320\275\320\260\320\273", 0.0113274f}, {"\320\275\320\260\320\274", 0.00567833f}, {"\320\275\320\260\320\275", 0.00755159f},
+	{"\320\275\320\260\321\200", 0.0109176f}, {"\320\275\320\260\321\201", 0.00787355f}, {"\320\275\320\260\321\201\321\202", 0.00720035f},
+	{"\320\275\320\260\321\201\321\202\321\200", 0.00673204f}, {"\320\275\320\260\321\207", 0.041124f}, {"\320\275\320\260\321\207\320\260", 0.00690765f},
+	{"\320\275\320\260\321\207\320\260\320\273", 0.00515147f}, {"\320\275\320\260\321\207\320\265", 0.0297966f}, {"\320\275\320\260\321\207\320\265\320\275", 0.0295039f},
+	{"\320\275\320\260\321\217", 0.0330455f}, {"\320\275\320\260\321\217$", 0.032987f}, {"\320\275\320\263", 0.0154837f},
+	{"\320\275\320\264", 0.0640129f}, {"\320\275\320\264$", 0.0109761f}, {"\320\275\320\264\320\260", 0.0154251f},
+	{"\320\275\320\264\320\260$", 0.00869311f}, {"\320\275\320\264\320\260\321\200", 0.00547344f}, {"\320\275\320\264\320\260\321\200\321\202", 0.00518074f},
+	{"\320\275\320\264\320\265", 0.0151617f}, {"\320\275\320\264\320\265\320\272", 0.0124396f}, {"\320\275\320\264\320\265\320\272\321\201", 0.0124396f},
+	{"\320\275\320\264\321\213", 0.00594175f}, {"\320\275\320\264\321\213$", 0.00594175f}, {"\320\275\320\265", 0.370496f},
+	{"\320\275\320\265$", 0.158759f}, {"\320\275\320\265\320\262", 0.0448412f}, {"\320\275\320\265\320\262\320\265", 0.0206352f},
+	{"\320\275\320\265\320\262\320\265\321\200", 0.0204595f}, {"\320\275\320\265\320\262\320\276", 0.0225377f}, {"\320\275\320\265\320\262\320\276\320\267", 0.0214547f},
+	{"\320\275\320\265\320\264", 0.0184692f}, {"\320\275\320\265\320\264\320\276", 0.0166837f}, {"\320\275\320\265\320\264\320\276\320\277", 0.0126738f},
+	{"\320\275\320\265\320\270", 0.0180301f}, {"\320\275\320\265\320\270\320\267", 0.0168594f}, {"\320\275\320\265\320\270\320\267\320\262", 0.0166837f},
+	{"\320\275\320\265\320\272", 0.0167423f}, {"\320\275\320\265\320\272\320\276", 0.016391f}, {"\320\275\320\265\320\272\320\276\321\200", 0.0148983f},
+	{"\320\275\320\265\320\273", 0.00731743f}, {"\320\275\320\265\320\273\321\214", 0.00690765f}, {"\320\275\320\265\320\273\321\214\320\267", 0.00679058f},
+	{"\320\275\320\265\320\274", 0.0057954f}, {"\320\275\320\265\320\275", 0.0377579f}, {"\320\275\320\265\320\275\320\270", 0.0257574f},
+	{"\320\275\320\265\320\275\320\270\320\265", 0.00919069f}, {"\320\275\320\265\320\275\320\270\321\217", 0.0122055f}, {"\320\275\320\265\320\276", 0.0192595f},
+	{"\320\275\320\265\320\276\320\261", 0.00878092f}, {"\320\275\320\265\320\276\320\261\321\205", 0.00588321f}, {"\320\275\320\265\320\276\320\266", 0.00523928f},
+	{"\320\275\320\265\320\276\320\266\320\270", 0.00523928f}, {"\320\275\320\265\320\277", 0.0236792f}, {"\320\275\320\265\320\277\320\276", 0.00980536f},
+	{"\320\275\320\265\320\277\321\200", 0.0121469f}, {"\320\275\320\265\320\277\321\200\320\260", 0.0092785f}, {"\320\275\320\265\321\200", 0.0141373f},
+	{"\320\275\320\265\321\200\320\260", 0.007054f}, {"\320\275\320\265\321\200\320\270", 0.00588321f}, {"\320\275\320\265\321\200\320\270\321\200", 0.00582467f},
+	{"\320\275\320\265\321\201", 0.0108298f}, {"\320\275\320\265\321\202", 0.0148397f}, {"\320\275\320\265\321\202$", 0.0131128f},
+	{"\320\275\320\270", 0.282219f}, {"\320\275\320\270$", 0.0138446f}, {"\320\275\320\270\320\265", 0.127323f},
+	{"\320\275\320\270\320\265$", 0.122728f}, {"\320\275\320\270\320\265\320\274", 0.00605883f}, {"\320\275\320\270\320\265\320\274$", 0.00605883f},
+	{"\320\275\320\270\320\270", 0.0174155f}, {"\320\275\320\270\320\270$", 0.0173569f}, {"\320\275\320\270\320\271", 0.0179716f},
+	{"\320\275\320\270\320\271$", 0.0176496f}, {"\320\275\320\270\320\272", 0.0095712f}, {"\320\275\320\270\320\274", 0.0132592f},
+	{"\320\275\320\270\320\274\320\260", 0.007054f}, {"\320\275\320\270\321\202", 0.0204888f}, {"\320\275\320\270\321\202\321\214", 0.0147519f},
+	{"\320\275\320\270\321\202\321\214$", 0.0145471f}, {"\320\275\320\270\321\206", 0.00620518f}, {"\320\275\320\270\321\207", 0.00523928f},
+	{"\320\275\320\270\321\216", 0.0148397f}, {"\320\275\320\270\321\216$", 0.0148397f}, {"\320\275\320\270\321\217", 0.0852042f},
+	{"\320\275\320\270\321\217$", 0.083126f}, {"\320\275\320\272", 0.0118835f}, {"\320\275\320\272\321\206", 0.00661496f},
+	{"\320\275\320\272\321\206\320\270", 0.00658569f}, {"\320\275\320\275", 0.12103f}, {"\320\275\320\275\320\260", 0.0115615f},
+	{"\320\275\320\275\320\260\321\217", 0.0105371f}, {"\320\275\320\275\320\260\321\217$", 0.0105371f}, {"\320\275\320\275\320\276", 0.0356505f},
+	{"\320\275\320\275\320\276\320\263", 0.0095712f}, {"\320\275\320\275\320\276\320\263\320\276", 0.0095712f}, {"\320\275\320\275\320\276\320\265", 0.0103029f},
+	{"\320\275\320\275\320\276\320\265$", 0.0103029f}, {"\320\275\320\275\320\276\320\271", 0.00752232f}, {"\320\275\320\275\320\276\320\271$", 0.00752232f},
+	{"\320\275\320\275\321\213", 0.0699254f}, {"\320\275\320\275\321\213\320\265", 0.0184107f}, {"\320\275\320\275\321\213\320\265$", 0.0184107f},
+	{"\320\275\320\275\321\213\320\271", 0.0287429f}, {"\320\275\320\275\321\213\320\271$", 0.0287429f}, {"\320\275\320\275\321\213\321\205", 0.0206644f},
+	{"\320\275\320\275\321\213\321\205$", 0.0206644f}, {"\320\275\320\276", 0.248354f}, {"\320\275\320\276$", 0.0895068f},
+	{"\320\275\320\276\320\262", 0.052305f}, {"\320\275\320\276\320\262\320\260", 0.00591248f}, {"\320\275\320\276\320\262\320\270", 0.0100395f},
+	{"\320\275\320\276\320\262\320\270\321\202", 0.00960047f}, {"\320\275\320\276\320\262\320\272", 0.00854676f}, {"\320\275\320\276\320\262\320\273", 0.0119128f},
+	{"\320\275\320\276\320\262\320\273\320\265", 0.0108591f}, {"\320\275\320\276\320\262\320\276", 0.00506366f}, {"\320\275\320\276\320\262\321\213", 0.00547344f},
+	{"\320\275\320\276\320\263", 0.0351237f}, {"\320\275\320\276\320\263\320\276", 0.0348017f}, {"\320\275\320\276\320\263\320\276$", 0.0334553f},
+	{"\320\275\320\276\320\265", 0.0370847f}, {"\320\275\320\276\320\265$", 0.0370847f}, {"\320\275\320\276\320\271", 0.027455f},
+	{"\320\275\320\276\320\271$", 0.0273379f}, {"\320\275\320\276\320\274", 0.0217474f}, {"\320\275\320\276\320\274$", 0.00837114f},
+	{"\320\275\320\276\320\274\320\265", 0.00980536f}, {"\320\275\320\276\320\274\320\265\321\200", 0.00980536f}, {"\320\275\320\276\321\200", 0.0136982f},
+	{"\320\275\320\276\321\200\320\270", 0.0117957f}, {"\320\275\320\276\321\200\320\270\321\200", 0.0117957f}, {"\320\275\320\276\321\201", 0.0190546f},
+	{"\320\275\320\276\321\201\321\202", 0.0136982f}, {"\320\275\320\276\321\201\321\202\320\270", 0.00784429f}, {"\320\275\320\276\321\201\321\202\321\214", 0.00547344f},
+	{"\320\275\321\201", 0.0499634f}, {"\320\275\321\201\320\272", 0.0220986f}, {"\320\275\321\201\320\272\320\260", 0.00743451f},
+	{"\320\275\321\201\320\272\320\260\321\217", 0.00708327f}, {"\320\275\321\201\320\272\320\270", 0.013669f}, {"\320\275\321\201\320\272\320\270\320\271", 0.0108591f},
+	{"\320\275\321\201\321\202", 0.0240304f}, {"\320\275\321\201\321\202\321\200", 0.0177375f}, {"\320\275\321\201\321\202\321\200\321\203", 0.0177082f},
+	{"\320\275\321\202", 0.0777989f}, {"\320\275\321\202$", 0.0214254f}, {"\320\275\321\202\320\260", 0.0158349f},
+	{"\320\275\321\202\320\260$", 0.00810771f}, {"\320\275\321\202\320\265", 0.0098639f}, {"\320\275\321\202\320\270", 0.0148397f},
+	{"\320\275\321\202\320\270\321\204", 0.0117079f}, {"\320\275\321\202\320\270\321\204\320\270", 0.0116786f}, {"\320\275\321\202\320\276", 0.00714181f},
+	{"\320\275\321\202\321\213", 0.00585394f}, {"\320\275\321\202\321\213$", 0.00585394f}, {"\320\275\321\203", 0.0336016f},
+	{"\320\275\321\203\321\202", 0.0103029f}, {"\320\275\321\203\321\202\321\200", 0.00778575f}, {"\320\275\321\203\321\216", 0.0098639f},
+	{"\320\275\321\203\321\216$", 0.0098639f}, {"\320\275\321\204", 0.0171813f}, {"\320\275\321\204\320\276", 0.0120884f},
+	{"\320\275\321\204\320\276\321\200", 0.0115615f}, {"\320\275\321\204\320\276\321\200\320\274", 0.0115615f}, {"\320\275\321\206", 0.00602956f},
+	{"\320\275\321\213", 0.176613f}, {"\320\275\321\213$", 0.0217767f}, {"\320\275\321\213\320\265", 0.0359432f},
+	{"\320\275\321\213\320\265$", 0.0359432f}, {"\320\275\321\213\320\271", 0.0891263f}, {"\320\275\321\213\320\271$", 0.0891263f},
+	{"\320\275\321\213\320\274", 0.0168594f}, {"\320\275\321\213\320\274$", 0.0133177f}, {"\320\275\321\213\321\205", 0.0323723f},
+	{"\320\275\321\213\321\205$", 0.0323723f}, {"\320\275\321\214", 0.00960047f}, {"\320\275\321\217", 0.0225962f},
+	{"\320\275\321\217\320\265", 0.00749305f}, {"\320\275\321\217\320\265\321\202", 0.00518074f}, {"\320\275\321\217\321\202", 0.00623445f},
+	{"\320\275\321\217\321\202\321\214", 0.00500512f}, {"\320\275\321\217\321\217", 0.00623445f}, {"\320\275\321\217\321\217$", 0.00620518f},
+	{"\320\276$", 0.240304f}, {"\320\276\320\261", 0.116962f}, {"\320\276\320\261\320\260", 0.0113859f},
+	{"\320\276\320\261\320\260\320\262", 0.00816625f}, {"\320\276\320\261\320\265", 0.0051222f}, {"\320\276\320\261\320\273", 0.0103908f},
+	{"\320\276\320\261\320\273\320\260", 0.00749305f}, {"\320\276\320\261\320\273\320\260\321\201", 0.00749305f}, {"\320\276\320\261\320\275", 0.0156886f},
+	{"\320\276\320\261\320\275\320\276", 0.0100395f}, {"\320\276\320\261\320\275\320\276\320\262", 0.00837114f}, {"\320\276\320\261\320\276", 0.00506366f},
+	{"\320\276\320\261\321\200", 0.0301185f}, {"\320\276\320\261\321\200\320\260", 0.0281282f}, {"\320\276\320\261\321\200\320\260\320\261", 0.00886873f},
+	{"\320\276\320\261\321\200\320\260\320\267", 0.00819552f}, {"\320\276\320\261\321\200\320\260\321\202", 0.00576613f}, {"\320\276\320\261\321\205", 0.0063808f},
+	{"\320\276\320\261\321\205\320\276", 0.00632226f}, {"\320\276\320\261\321\205\320\276\320\264", 0.00632226f}, {"\320\276\320\261\321\211", 0.0137275f},
+	{"\320\276\320\261\321\211\320\265", 0.00933704f}, {"\320\276\320\261\321\211\320\265\320\275", 0.00699546f}, {"\320\276\320\261\321\212", 0.0153373f},
+	{"\320\276\320\261\321\212\320\265", 0.0145178f}, {"\320\276\320\261\321\212\320\265\320\272", 0.011942f}, {"\320\276\320\261\321\213", 0.011942f},
+	{"\320\276\320\261\321\213$", 0.00758086f}, {"\320\276\320\262", 0.247358f}, {"\320\276\320\262$", 0.0598273f},
+	{"\320\276\320\262\320\260", 0.100981f}, {"\320\276\320\262\320\260\320\275", 0.0435826f}, {"\320\276\320\262\320\260\320\275\320\270", 0.023445f},
+	{"\320\276\320\262\320\260\320\275\320\275", 0.0110347f}, {"\320\276\320\262\320\260\321\202", 0.0527148f}, {"\320\276\320\262\320\260\321\202\320\265", 0.0150739f},
+	{"\320\276\320\262\320\260\321\202\321\214", 0.0385775f}, {"\320\276\320\262\320\265", 0.0189375f}, {"\320\276\320\262\320\265\321\200", 0.0131128f},
+	{"\320\276\320\262\320\270", 0.0136982f}, {"\320\276\320\262\320\270\321\202", 0.00992244f}, {"\320\276\320\262\320\270\321\202\321\214", 0.00930777f},
+	{"\320\276\320\262\320\272", 0.0192595f}, {"\320\276\320\262\320\272\320\260", 0.0073467f}, {"\320\276\320\262\320\272\320\260$", 0.00708327f},
+	{"\320\276\320\262\320\272\320\270", 0.00670277f}, {"\320\276\320\262\320\272\320\270$", 0.00670277f}, {"\320\276\320\262\320\273", 0.0123518f},
+	{"\320\276\320\262\320\273\320\265", 0.0112981f}, {"\320\276\320\262\320\273\320\265\320\275", 0.0109469f}, {"\320\276\320\262\320\275", 0.00559052f},
+	{"\320\276\320\262\320\276", 0.0217181f}, {"\320\276\320\262\320\276\320\271", 0.00559052f}, {"\320\276\320\262\320\276\320\271$", 0.00559052f},
+	{"\320\276\320\262\320\277", 0.00550271f}, {"\320\276\320\262\320\277\320\260", 0.00550271f}, {"\320\276\320\262\320\277\320\260\320\264", 0.00526855f},
+	{"\320\276\320\262\321\200", 0.00766867f}, {"\320\276\320\262\321\200\320\265", 0.0076394f}, {"\320\276\320\262\321\200\320\265\320\266", 0.00535636f},
+	{"\320\276\320\262\321\202", 0.00521001f}, {"\320\276\320\262\321\202\320\276", 0.00521001f}, {"\320\276\320\262\321\202\320\276\321\200", 0.00521001f},
+	{"\320\276\320\262\321\213", 0.0149861f}, {"\320\276\320\262\321\213\320\271", 0.00749305f}, {"\320\276\320\262\321\213\320\271$", 0.00749305f},
+	{"\320\276\320\263", 0.0955656f}, {"\320\276\320\263$", 0.0116493f}, {"\320\276\320\263\320\260", 0.00611737f},
+	{"\320\276\320\263\320\276", 0.0572223f}, {"\320\276\320\263\320\276$", 0.0527148f}, {"\320\276\320\263\321\200", 0.0137275f},
+	{"\320\276\320\263\321\200\320\260", 0.0126445f}, {"\320\276\320\263\321\200\320\260\320\274", 0.00936631f}, {"\320\276\320\264", 0.149744f},
+	{"\320\276\320\264$", 0.0237377f}, {"\320\276\320\264\320\260", 0.0133763f}, {"\320\276\320\264\320\260$", 0.0127031f},
+	{"\320\276\320\264\320\264", 0.0217474f}, {"\320\276\320\264\320\264\320\265", 0.0217181f}, {"\320\276\320\264\320\264\320\265\321\200", 0.0216011f},
+	{"\320\276\320\264\320\265", 0.0191424f}, {"\320\276\320\264\320\265\321\200", 0.0149861f}, {"\320\276\320\264\320\265\321\200\320\266", 0.0148983f},
+	{"\320\276\320\264\320\270", 0.027133f}, {"\320\276\320\264\320\270\320\274", 0.00673204f}, {"\320\276\320\264\320\270\320\274\320\276", 0.00515147f},
+	{"\320\276\320\264\320\270\320\275", 0.00506366f}, {"\320\276\320\264\320\270\321\202", 0.0109469f}, {"\320\276\320\264\320\270\321\202\321\214", 0.00515147f},
+	{"\320\276\320\264\320\275", 0.0251427f}, {"\320\276\320\264\320\275\320\276", 0.0147812f}, {"\320\276\320\264\320\275\321\213", 0.0073467f},
+	{"\320\276\320\264\320\276", 0.00567833f}, {"\320\276\320\264\320\277", 0.0103908f}, {"\320\276\320\264\320\277\320\270", 0.0095712f},
+	{"\320\276\320\264\320\277\320\270\321\201", 0.0095712f}, {"\320\276\320\264\321\203", 0.00564906f}, {"\320\276\320\264\321\203\320\273", 0.00526855f},
+	{"\320\276\320\265", 0.0620518f}, {"\320\276\320\265$", 0.0541783f}, {"\320\276\320\266", 0.0761013f},
+	{"\320\276\320\266\320\265", 0.0242646f}, {"\320\276\320\266\320\265\320\275", 0.0113567f}, {"\320\276\320\266\320\265\320\275\320\270", 0.00951266f},
+	{"\320\276\320\266\320\265\321\202", 0.011942f}, {"\320\276\320\266\320\265\321\202$", 0.0103908f}, {"\320\276\320\266\320\270", 0.0209571f},
+	{"\320\276\320\266\320\270\320\264", 0.0192887f}, {"\320\276\320\266\320\270\320\264\320\260", 0.0192887f}, {"\320\276\320\266\320\275", 0.0296795f},
+	{"\320\276\320\266\320\275\320\276", 0.0280989f}, {"\320\276\320\266\320\275\320\276$", 0.0261671f}, {"\320\276\320\267", 0.067174f},
+	{"\320\276\320\267\320\262", 0.00623445f}, {"\320\276\320\267\320\264", 0.0198156f}, {"\320\276\320\267\320\264\320\260", 0.0194936f},
+	{"\320\276\320\267\320\264\320\260\320\275", 0.00784429f}, {"\320\276\320\267\320\264\320\260\321\202", 0.00837114f}, {"\320\276\320\267\320\270", 0.00670277f},
+	{"\320\276\320\267\320\270\321\202", 0.00529782f}, {"\320\276\320\267\320\270\321\202\320\276", 0.00529782f}, {"\320\276\320\267\320\274", 0.0266062f},
+	{"\320\276\320\267\320\274\320\276", 0.0266062f}, {"\320\276\320\267\320\274\320\276\320\266", 0.0266062f}, {"\320\276\320\267\320\275", 0.00933704f},
+	{"\320\276\320\267\320\275\320\260", 0.00834187f}, {"\320\276\320\267\320\275\320\260\320\275", 0.0057076f}, {"\320\276\320\270", 0.0166837f},
+	{"\320\276\320\271", 0.0750476f}, {"\320\276\320\271$", 0.0632811f}, {"\320\276\320\271\321\201", 0.00515147f},
+	{"\320\276\320\272", 0.0928436f}, {"\320\276\320\272$", 0.029299f}, {"\320\276\320\272\320\260", 0.0271623f},
+	{"\320\276\320\272\320\260$", 0.0117957f}, {"\320\276\320\272\320\260\320\267", 0.00857603f}, {"\320\276\320\272\320\260\320\267\320\260", 0.0060881f},
+	{"\320\276\320\272\320\260\320\273", 0.00573687f}, {"\320\276\320\272\320\260\320\273\321\214", 0.00515147f}, {"\320\276\320\272\320\265", 0.0066735f},
+	{"\320\276\320\272\320\270", 0.0166837f}, {"\320\276\320\272\320\270$", 0.0119713f}, {"\320\276\320\272\320\276", 0.00611737f},
+	{"\320\276\320\272\321\200", 0.00547344f}, {"\320\276\320\272\321\203", 0.00702473f}, {"\320\276\320\273", 0.218557f},
+	{"\320\276\320\273$", 0.0136104f}, {"\320\276\320\273\320\260", 0.0106834f}, {"\320\276\320\273\320\260$", 0.00749305f},
+	{"\320\276\320\273\320\265", 0.0123518f}, {"\320\276\320\273\320\265$", 0.00509293f}, {"\320\276\320\273\320\266", 0.0204595f},
+	{"\320\276\320\273\320\266\320\265", 0.00901507f}, {"\320\276\320\273\320\266\320\265\320\275", 0.00901507f}, {"\320\276\320\273\320\266\320\275", 0.0102151f},
+	{"\320\276\320\273\320\270", 0.00840041f}, {"\320\276\320\273\320\270\321\207", 0.0051222f}, {"\320\276\320\273\320\270\321\207\320\265", 0.00500512f},
+	{"\320\276\320\273\320\275", 0.0272501f}, {"\320\276\320\273\320\275\320\265", 0.00965901f}, {"\320\276\320\273\320\275\320\265\320\275", 0.00965901f},
+	{"\320\276\320\273\320\275\320\270", 0.00954193f}, {"\320\276\320\273\320\275\320\270\321\202", 0.0092785f}, {"\320\276\320\273\320\275\321\217", 0.00623445f},
+	{"\320\276\320\273\320\276", 0.0239719f}, {"\320\276\320\273\320\276\320\262", 0.0138446f}, {"\320\276\320\273\320\276\320\262$", 0.00626372f},
+	{"\320\276\320\273\320\276\320\266", 0.00550271f}, {"\320\276\320\273\321\203", 0.0137568f}, {"\320\276\320\273\321\203\321\207", 0.0125567f},
+	{"\320\276\320\273\321\203\321\207\320\265", 0.00649788f}, {"\320\276\320\273\321\203\321\207\320\270", 0.00538563f}, {"\320\276\320\273\321\207", 0.0121177f},
+	{"\320\276\320\273\321\207\320\260", 0.0121177f}, {"\320\276\320\273\321\207\320\260\320\275", 0.0120884f}, {"\320\276\320\273\321\213", 0.0057954f},
+	{"\320\276\320\273\321\213$", 0.00564906f}, {"\320\276\320\273\321\214", 0.0956534f}, {"\320\276\320\273\321\214$", 0.00523928f},
+	{"\320\276\320\273\321\214\320\267", 0.0602956f}, {"\320\276\320\273\321\214\320\267\320\276", 0.0412118f}, {"\320\276\320\273\321\214\320\267\321\203", 0.0207522f},
+	{"\320\276\320\273\321\214\320\272", 0.0208693f}, {"\320\276\320\273\321\214\320\272\320\276", 0.0201083f}, {"\320\276\320\273\321\214\320\275", 0.00679058f},
+	{"\320\276\320\273\321\214\321\210", 0.007054f}, {"\320\276\320\273\321\217", 0.00582467f}, {"\320\276\320\274", 0.121791f},
+	{"\320\276\320\274$", 0.0560808f}, {"\320\276\320\274\320\260", 0.0214547f}, {"\320\276\320\274\320\260\320\275", 0.01563f},
+	{"\320\276\320\274\320\260\320\275\320\264", 0.0148397f}, {"\320\276\320\274\320\265", 0.0186155f}, {"\320\276\320\274\320\265\321\200", 0.0102737f},
+	{"\320\276\320\274\320\265\321\200$", 0.00673204f}, {"\320\276\320\274\320\274", 0.0098639f}, {"\320\276\320\274\320\274\320\270", 0.00886873f},
+	{"\320\276\320\274\320\274\320\270\321\202", 0.00869311f}, {"\320\276\320\274\320\276", 0.00588321f}, {"\320\276\320\274\320\277", 0.0112103f},
+	{"\320\276\320\274\320\277\320\276", 0.0076394f}, {"\320\276\320\274\320\277\320\276\320\275", 0.00755159f}, {"\320\276\320\274\321\203", 0.00567833f},
+	{"\320\276\320\274\321\203$", 0.00553198f}, {"\320\276\320\275", 0.092463f}, {"\320\276\320\275$", 0.0158935f},
+	{"\320\276\320\275\320\260", 0.0126738f}, {"\320\276\320\275\320\260$", 0.0102737f}, {"\320\276\320\275\320\265", 0.0131714f},
+	{"\320\276\320\275\320\270", 0.00781502f}, {"\320\276\320\275\320\276", 0.0073467f}, {"\320\276\320\275\321\201", 0.00714181f},
+	{"\320\276\320\275\321\202", 0.00866384f}, {"\320\276\320\276", 0.014869f}, {"\320\276\320\276\320\261", 0.00857603f},
+	{"\320\276\320\276\320\261\321\211", 0.00848822f}, {"\320\276\320\276\320\261\321\211\320\265", 0.00702473f}, {"\320\276\320\277", 0.0960047f},
+	{"\320\276\320\277\320\265", 0.0230645f}, {"\320\276\320\277\320\265\321\200", 0.0226548f}, {"\320\276\320\277\320\265\321\200\320\260", 0.022567f},
+	{"\320\276\320\277\320\270", 0.00930777f}, {"\320\276\320\277\320\276", 0.00766867f}, {"\320\276\320\277\320\276\320\273", 0.00582467f},
+	{"\320\276\320\277\321\200", 0.0177667f}, {"\320\276\320\277\321\200\320\265", 0.0142251f}, {"\320\276\320\277\321\200\320\265\320\264", 0.0141958f},
+	{"\320\276\320\277\321\203", 0.0275135f}, {"\320\276\320\277\321\203\321\201", 0.0242646f}, {"\320\276\320\277\321\203\321\201\320\272", 0.00629299f},
+	{"\320\276\320\277\321\203\321\201\321\202", 0.0180594f}, {"\320\276\320\277\321\206", 0.00529782f}, {"\320\276\320\277\321\206\320\270", 0.00529782f},
+	{"\320\276\321\200", 0.138036f}, {"\320\276\321\200$", 0.0133177f}, {"\320\276\321\200\320\260", 0.0113274f},
+	{"\320\276\321\200\320\260$", 0.00737597f}, {"\320\276\321\200\320\270", 0.0242939f}, {"\320\276\321\200\320\270\321\200", 0.0118542f},
+	{"\320\276\321\200\320\270\321\200\321\203", 0.00842968f}, {"\320\276\321\200\320\274", 0.0261086f}, {"\320\276\321\200\320\274\320\260", 0.0243817f},
+	{"\320\276\321\200\320\274\320\260\321\202", 0.012586f}, {"\320\276\321\200\320\274\320\260\321\206", 0.0115323f}, {"\320\276\321\200\320\276", 0.0134348f},
+	{"\320\276\321\200\321\200", 0.0166837f}, {"\320\276\321\200\321\200\320\265", 0.0162154f}, {"\320\276\321\200\321\200\320\265\320\272", 0.0161569f},
+	{"\320\276\321\200\321\202", 0.0098639f}, {"\320\276\321\200\321\213", 0.00904434f}, {"\320\276\321\201", 0.141987f},
+	{"\320\276\321\201\320\270", 0.00690765f}, {"\320\276\321\201\320\270\321\202", 0.00561979f}, {"\320\276\321\201\320\273", 0.0184107f},
+	{"\320\276\321\201\320\273\320\265", 0.0157471f}, {"\320\276\321\201\320\273\320\265$", 0.00910288f}, {"\320\276\321\201\320\273\320\265\320\264", 0.00687838f},
+	{"\320\276\321\201\321\200", 0.00529782f}, {"\320\276\321\201\321\202", 0.0563442f}, {"\320\276\321\201\321\202\320\260", 0.0117372f},
+	{"\320\276\321\201\321\202\320\260\320\262", 0.00529782f}, {"\320\276\321\201\321\202\320\270", 0.0112103f}, {"\320\276\321\201\321\202\320\270$", 0.0100395f},
+	{"\320\276\321\201\321\202\320\276", 0.00983463f}, {"\320\276\321\201\321\202\320\276\321\217", 0.0060881f}, {"\320\276\321\201\321\202\321\200", 0.00564906f},
+	{"\320\276\321\201\321\202\321\203", 0.0103615f}, {"\320\276\321\201\321\202\321\203\320\277", 0.0103322f}, {"\320\276\321\201\321\202\321\214", 0.00711254f},
+	{"\320\276\321\201\321\202\321\214$", 0.00597102f}, {"\320\276\321\201\321\214", 0.046012f}, {"\320\276\321\201\321\214$", 0.0451339f},
+	{"\320\276\321\202", 0.112981f}, {"\320\276\321\202$", 0.00998097f}, {"\320\276\321\202\320\260", 0.00799063f},
+	{"\320\276\321\202\320\262", 0.00708327f}, {"\320\276\321\202\320\262\320\265", 0.00690765f}, {"\320\276\321\202\320\262\320\265\321\202", 0.00643934f},
+	{"\320\276\321\202\320\272", 0.0198156f}, {"\320\276\321\202\320\272\321\200", 0.00916142f}, {"\320\276\321\202\320\272\321\200\321\213", 0.00910288f},
+	{"\320\276\321\202\320\273", 0.0057076f}, {"\320\276\321\202\320\276", 0.0220694f}, {"\320\276\321\202\320\276\321\200", 0.00933704f},
+	{"\320\276\321\202\320\276\321\200\321\213", 0.00594175f}, {"\320\276\321\202\321\200", 0.00553198f}, {"\320\276\321\202\321\201", 0.0171521f},
+	{"\320\276\321\202\321\201\321\203", 0.0132006f}, {"\320\276\321\202\321\201\321\203\321\202", 0.0132006f}, {"\320\276\321\205", 0.00787355f},
+	{"\320\276\321\206", 0.0105956f}, {"\320\276\321\206\320\265", 0.00998097f}, {"\320\276\321\206\320\265\321\201", 0.00854676f},
+	{"\320\276\321\206\320\265\321\201\321\201", 0.00854676f}, {"\320\276\321\207", 0.0403629f}, {"\320\276\321\207\320\265", 0.00661496f},
+	{"\320\276\321\207\320\270", 0.0113274f}, {"\320\276\321\207\320\270\321\202", 0.00629299f}, {"\320\276\321\207\320\270\321\202\320\260", 0.00626372f},
+	{"\320\276\321\207\320\272", 0.00547344f}, {"\320\276\321\207\320\275", 0.0144007f}, {"\320\276\321\207\320\275\320\276", 0.00526855f},
+	{"\320\276\321\210", 0.0458364f}, {"\320\276\321\210\320\270", 0.042324f}, {"\320\276\321\210\320\270\320\261", 0.0419435f},
+	{"\320\276\321\210\320\270\320\261\320\272", 0.0400702f}, {"\320\276\321\217", 0.00983463f}, {"\320\276\321\217\320\275", 0.00585394f},
+	{"\320\276\321\217\320\275\320\270", 0.00553198f}, {"\320\277$", 0.0184692f}, {"\320\277\320\260", 0.106015f},
+	{"\320\277\320\260$", 0.00992244f}, {"\320\277\320\260\320\264", 0.00690765f}, {"\320\277\320\260\320\267", 0.0109469f},
+	{"\320\277\320\260\320\267\320\276", 0.0108298f}, {"\320\277\320\260\320\267\320\276\320\275", 0.0108298f}, {"\320\277\320\260\320\272", 0.0215425f},
+	{"\320\277\320\260\320\272\320\265", 0.0184399f}, {"\320\277\320\260\320\272\320\265\321\202", 0.0184399f}, {"\320\277\320\260\320\274", 0.00600029f},
+	{"\320\277\320\260\320\274\321\217", 0.00564906f}, {"\320\277\320\260\320\274\321\217\321\202", 0.00564906f}, {"\320\277\320\260\321\200", 0.041241f},
+	{"\320\277\320\260\321\200\320\260", 0.0328992f}, {"\320\277\320\260\321\200\320\260\320\274", 0.0294453f}, {"\320\277\320\260\321\200\320\276", 0.00614664f},
+	{"\320\277\320\260\321\200\320\276\320\273", 0.00597102f}, {"\320\277\320\265", 0.100688f}, {"\320\277\320\265\321\200", 0.0800234f},
+	{"\320\277\320\265\321\200\320\260", 0.0228304f}, {"\320\277\320\265\321\200\320\260\320\275", 0.013347f}, {"\320\277\320\265\321\200\320\260\321\206", 0.00828333f},
+	{"\320\277\320\265\321\200\320\262", 0.00620518f}, {"\320\277\320\265\321\200\320\265", 0.0509586f}, {"\320\277\320\265\321\200\320\265\320\264", 0.00649788f},
+	{"\320\277\320\265\321\200\320\265\320\274", 0.0229475f}, {"\320\277\320\265\321\206", 0.0080199f}, {"\320\277\320\265\321\206\320\270", 0.00576613f},
+	{"\320\277\320\265\321\207", 0.00652715f}, {"\320\277\320\265\321\207\320\260", 0.00518074f}, {"\320\277\320\265\321\207\320\260\321\202", 0.00518074f},
+	{"\320\277\320\270", 0.0587443f}, {"\320\277\320\270\321\201", 0.0461291f}, {"\320\277\320\270\321\201\320\260", 0.00942485f},
+	{"\320\277\320\270\321\201\320\270", 0.0112103f}, {"\320\277\320\270\321\201\320\270$", 0.0110932f}, {"\320\277\320\270\321\201\320\272", 0.00632226f},
+	{"\320\277\320\270\321\201\320\276", 0.00676131f}, {"\320\277\320\270\321\201\320\276\320\272", 0.00676131f}, {"\320\277\320\270\321\201\321\214", 0.0105956f},
+	{"\320\277\320\270\321\201\321\214$", 0.00942485f}, {"\320\277\320\273", 0.01042f}, {"\320\277\320\276", 0.254003f},
+	{"\320\277\320\276$", 0.0242353f}, {"\320\277\320\276\320\262", 0.0125274f}, {"\320\277\320\276\320\262\321\200", 0.00547344f},
+	{"\320\277\320\276\320\262\321\200\320\265", 0.00547344f}, {"\320\277\320\276\320\262\321\202", 0.00521001f}, {"\320\277\320\276\320\262\321\202\320\276", 0.00521001f},
+	{"\320\277\320\276\320\264", 0.0505488f}, {"\320\277\320\276\320\264\320\264", 0.0217474f}, {"\320\277\320\276\320\264\320\264\320\265", 0.0217181f},
+	{"\320\277\320\276\320\264\320\277", 0.0103908f}, {"\320\277\320\276\320\264\320\277\320\270", 0.0095712f}, {"\320\277\320\276\320\267", 0.0144007f},
+	{"\320\277\320\276\320\267\320\270", 0.00652715f}, {"\320\277\320\276\320\267\320\270\321\202", 0.00529782f}, {"\320\277\320\276\320\267\320\275", 0.00626372f},
+	{"\320\277\320\276\320\267\320\275\320\260", 0.00626372f}, {"\320\277\320\276\320\272", 0.0105078f}, {"\320\277\320\276\320\272\320\260", 0.0100981f},
+	{"\320\277\320\276\320\272\320\260\320\267", 0.00857603f}, {"\320\277\320\276\320\273", 0.113127f}, {"\320\277\320\276\320\273\320\265", 0.00617591f},
+	{"\320\277\320\276\320\273\320\275", 0.0271916f}, {"\320\277\320\276\320\273\320\275\320\265", 0.00965901f}, {"\320\277\320\276\320\273\320\275\320\270", 0.00948339f},
+	{"\320\277\320\276\320\273\320\275\321\217", 0.00623445f}, {"\320\277\320\276\320\273\320\276", 0.00594175f}, {"\320\277\320\276\320\273\320\276\320\266", 0.00550271f},
+	{"\320\277\320\276\320\273\321\203", 0.0128201f}, {"\320\277\320\276\320\273\321\203\321\207", 0.0125567f}, {"\320\277\320\276\320\273\321\214", 0.061525f},
+	{"\320\277\320\276\320\273\321\214\320\267", 0.0602956f}, {"\320\277\320\276\320\274", 0.0110932f}, {"\320\277\320\276\320\275", 0.00971755f},
+	{"\320\277\320\276\320\277", 0.00556125f}, {"\320\277\320\276\321\200", 0.0115323f}, {"\320\277\320\276\321\200\321\202", 0.00740524f},
+	{"\320\277\320\276\321\201", 0.0254061f}, {"\320\277\320\276\321\201\320\273", 0.0162154f}, {"\320\277\320\276\321\201\320\273\320\265", 0.0157471f},
+	{"\320\277\320\276\321\202", 0.0057954f}, {"\320\277\320\277", 0.0102737f}, {"\320\277\321\200", 0.189434f},
+	{"\320\277\321\200\320\260", 0.0313479f}, {"\320\277\321\200\320\260\320\262", 0.0299137f}, {"\320\277\321\200\320\260\320\262\320\270", 0.013669f},
+	{"\320\277\321\200\320\260\320\262\320\273", 0.00796136f}, {"\320\277\321\200\320\265", 0.0598273f}, {"\320\277\321\200\320\265\320\264", 0.0451632f},
+	{"\320\277\321\200\320\265\320\264\320\265", 0.0189668f}, {"\320\277\321\200\320\265\320\264\321\203", 0.0135226f}, {"\320\277\321\200\320\265\320\266", 0.0139324f},
+	{"\320\277\321\200\320\265\320\266\320\264", 0.0139031f}, {"\320\277\321\200\320\270", 0.0484121f}, {"\320\277\321\200\320\270$", 0.0235914f},
+	{"\320\277\321\200\320\270\320\274", 0.00749305f}, {"\320\277\321\200\320\270\320\274\320\265", 0.00711254f}, {"\320\277\321\200\320\270\320\275", 0.00602956f},
+	{"\320\277\321\200\320\276", 0.0724426f}, {"\320\277\321\200\320\276\320\261", 0.00679058f}, {"\320\277\321\200\320\276\320\262", 0.0095712f},
+	{"\320\277\321\200\320\276\320\262\320\265", 0.00866384f}, {"\320\277\321\200\320\276\320\263", 0.00936631f}, {"\320\277\321\200\320\276\320\263\321\200", 0.0092785f},
+	{"\320\277\321\200\320\276\320\270", 0.00655642f}, {"\320\277\321\200\320\276\320\277", 0.00749305f}, {"\320\277\321\200\320\276\320\277\321\203", 0.00737597f},
+	{"\320\277\321\200\320\276\321\201", 0.00904434f}, {"\320\277\321\200\320\276\321\206", 0.00954193f}, {"\320\277\321\200\320\276\321\206\320\265", 0.00954193f},
+	{"\320\277\321\200\320\276\321\207", 0.00620518f}, {"\320\277\321\200\320\276\321\207\320\270", 0.00588321f}, {"\320\277\321\203", 0.0618762f},
+	{"\320\277\321\203\320\261", 0.0092785f}, {"\320\277\321\203\320\261\320\273", 0.0092785f}, {"\320\277\321\203\320\261\320\273\320\270", 0.0092785f},
+	{"\320\277\321\203\321\201", 0.036792f}, {"\320\277\321\203\321\201\320\272", 0.00962974f}, {"\320\277\321\203\321\201\320\272\320\260", 0.00737597f},
+	{"\320\277\321\203\321\201\321\202", 0.0275428f}, {"\320\277\321\203\321\201\321\202\320\270", 0.0208693f}, {"\320\277\321\203\321\202", 0.00725889f},
+	{"\320\277\321\206", 0.00535636f}, {"\320\277\321\206\320\270", 0.00529782f}, {"\320\277\321\213", 0.00781502f},
+	{"\321\200$", 0.0748427f}, {"\321\200\320\260", 0.287165f}, {"\321\200\320\260$", 0.0347432f},
+	{"\321\200\320\260\320\261", 0.0216889f}, {"\321\200\320\260\320\261\320\276", 0.0187619f}, {"\321\200\320\260\320\261\320\276\321\202", 0.013669f},
+	{"\321\200\320\260\320\261\320\276\321\207", 0.00506366f}, {"\321\200\320\260\320\262", 0.0406264f}, {"\321\200\320\260\320\262\320\270", 0.0140495f},
+	{"\321\200\320\260\320\262\320\270\320\273", 0.0121177f}, {"\321\200\320\260\320\262\320\273", 0.00796136f}, {"\321\200\320\260\320\262\320\275", 0.00910288f},
+	{"\321\200\320\260\320\266", 0.0134641f}, {"\321\200\320\260\320\266\320\265", 0.0124689f}, {"\321\200\320\260\320\266\320\265\320\275", 0.0124689f},
+	{"\321\200\320\260\320\267", 0.0684326f}, {"\321\200\320\260\320\267\320\264", 0.0265769f}, {"\321\200\320\260\320\267\320\264\320\265", 0.0265476f},
+	{"\321\200\320\260\320\267\320\274", 0.0158056f}, {"\321\200\320\260\320\267\320\274\320\265", 0.0152495f}, {"\321\200\320\260\320\267\320\276", 0.00681984f},
+	{"\321\200\320\260\320\267\321\200", 0.00746378f}, {"\321\200\320\260\320\267\321\200\320\265", 0.00673204f}, {"\321\200\320\260\320\271", 0.0127323f},
+	{"\321\200\320\260\320\271$", 0.00761013f}, {"\321\200\320\260\320\274", 0.0403922f}, {"\321\200\320\260\320\274\320\265", 0.0295917f},
+	{"\321\200\320\260\320\274\320\265\321\202", 0.0294453f}, {"\321\200\320\260\320\274\320\274", 0.00977609f}, {"\321\200\320\260\320\275", 0.04048f},
+	{"\321\200\320\260\320\275\320\264", 0.013669f}, {"\321\200\320\260\320\275\320\264$", 0.00679058f}, {"\321\200\320\260\320\275\320\270", 0.01042f},
+	{"\321\200\320\260\321\201", 0.0216889f}, {"\321\200\320\260\321\201\320\277", 0.0095712f}, {"\321\200\320\260\321\201\320\277\320\276", 0.00740524f},
+	{"\321\200\320\260\321\201\321\210", 0.0063808f}, {"\321\200\320\260\321\201\321\210\320\270", 0.00635153f}, {"\321\200\320\260\321\202", 0.0179716f},
+	{"\321\200\320\260\321\202\320\275", 0.00509293f}, {"\321\200\320\260\321\206", 0.0113274f}, {"\321\200\320\260\321\206\320\270", 0.0112688f},
+	{"\321\200\320\260\321\206\320\270\320\270", 0.00623445f}, {"\321\200\320\262", 0.0173277f}, {"\321\200\320\262\320\265", 0.00687838f},
+	{"\321\200\320\262\320\265\321\200", 0.00585394f}, {"\321\200\320\263", 0.0164203f}, {"\321\200\320\263\321\203", 0.0124982f},
+	{"\321\200\320\263\321\203\320\274", 0.0123226f}, {"\321\200\320\263\321\203\320\274\320\265", 0.0123226f}, {"\321\200\320\264", 0.00643934f},
+	{"\321\200\320\265", 0.252568f}, {"\321\200\320\265$", 0.00585394f}, {"\321\200\320\265\320\261", 0.0122347f},
+	{"\321\200\320\265\320\261\321\203", 0.0107713f}, {"\321\200\320\265\320\261\321\203\320\265", 0.00980536f}, {"\321\200\320\265\320\262", 0.0080199f},
+	{"\321\200\320\265\320\263", 0.023767f}, {"\321\200\320\265\320\263\320\270", 0.0213376f}, {"\321\200\320\265\320\263\320\270\321\201", 0.0212205f},
+	{"\321\200\320\265\320\264", 0.0588907f}, {"\321\200\320\265\320\264\320\260", 0.00509293f}, {"\321\200\320\265\320\264\320\265", 0.0190253f},
+	{"\321\200\320\265\320\264\320\265\320\273", 0.018996f}, {"\321\200\320\265\320\264\321\201", 0.00696619f}, {"\321\200\320\265\320\264\321\201\321\202", 0.00605883f},
+	{"\321\200\320\265\320\264\321\203", 0.0135519f}, {"\321\200\320\265\320\264\321\203\320\277", 0.0134933f}, {"\321\200\320\265\320\266", 0.0300015f},
+	{"\321\200\320\265\320\266\320\264", 0.0190546f}, {"\321\200\320\265\320\266\320\264\320\265", 0.0143422f}, {"\321\200\320\265\320\266\320\270", 0.0107127f},
+	{"\321\200\320\265\320\266\320\270\320\274", 0.0107127f}, {"\321\200\320\265\320\267", 0.0107127f}, {"\321\200\320\265\320\272", 0.027016f},
+	{"\321\200\320\265\320\272\321\202", 0.0203132f}, {"\321\200\320\265\320\272\321\202\320\275", 0.0157471f}, {"\321\200\320\265\320\274", 0.0376409f},
+	{"\321\200\320\265\320\274\320\265", 0.0316991f}, {"\321\200\320\265\320\274\320\265\320\275", 0.0133177f}, {"\321\200\320\265\320\274\320\265\321\211", 0.0174155f},
+	{"\321\200\320\265\320\274\321\217", 0.00523928f}, {"\321\200\320\265\320\274\321\217$", 0.00523928f}, {"\321\200\320\265\320\275", 0.018235f},
+	{"\321\200\320\265\320\275\320\275", 0.00825406f}, {"\321\200\320\265\320\276", 0.00614664f}, {"\321\200\320\265\320\277", 0.0095712f},
+	{"\321\200\320\265\320\277\320\276", 0.00845895f}, {"\321\200\320\265\320\277\320\276\320\267", 0.00526855f}, {"\321\200\320\265\321\201", 0.0286551f},
+	{"\321\200\320\265\321\201$", 0.00521001f}, {"\321\200\320\265\321\201\320\260", 0.00532709f}, {"\321\200\320\265\321\201\320\277", 0.00933704f},
+	{"\321\200\320\265\321\201\320\277\321\203", 0.00930777f}, {"\321\200\320\265\321\210", 0.00740524f}, {"\321\200\320\266", 0.037875f},
+	{"\321\200\320\266\320\270", 0.030821f}, {"\321\200\320\266\320\270\320\262", 0.0191717f}, {"\321\200\320\266\320\270\320\262\320\260", 0.0191717f},
+	{"\321\200\320\266\320\270\321\202", 0.0073467f}, {"\321\200\320\266\320\270\321\202$", 0.00661496f}, {"\321\200\320\270", 0.121499f},
+	{"\321\200\320\270$", 0.0286551f}, {"\321\200\320\270\320\261", 0.0057076f}, {"\321\200\320\270\320\261\321\203", 0.00518074f},
+	{"\321\200\320\270\320\261\321\203\321\202", 0.00518074f}, {"\321\200\320\270\320\271", 0.00556125f}, {"\321\200\320\270\320\274", 0.00796136f},
+	{"\321\200\320\270\320\274\320\265", 0.00722962f}, {"\321\200\320\270\320\275", 0.0103029f}, {"\321\200\320\270\321\200", 0.0189375f},
+	{"\321\200\320\270\321\200\320\276", 0.0102444f}, {"\321\200\320\270\321\200\320\276\320\262", 0.0100981f}, {"\321\200\320\270\321\200\321\203", 0.00875165f},
+	{"\321\200\320\270\321\200\321\203\320\265", 0.00778575f}, {"\321\200\320\270\321\202", 0.0109176f}, {"\321\200\320\270\321\217", 0.00737597f},
+	{"\321\200\320\270\321\217$", 0.007054f}, {"\321\200\320\272", 0.0103908f}, {"\321\200\320\274", 0.03006f},
+	{"\321\200\320\274\320\260", 0.0256403f}, {"\321\200\320\274\320\260\321\202", 0.012586f}, {"\321\200\320\274\320\260\321\202$", 0.0063808f},
+	{"\321\200\320\274\320\260\321\206", 0.0115323f}, {"\321\200\320\274\320\260\321\206\320\270", 0.0115323f}, {"\321\200\320\275", 0.0424118f},
+	{"\321\200\320\275\320\260", 0.00851749f}, {"\321\200\320\275\320\260\321\217", 0.00509293f}, {"\321\200\320\275\320\260\321\217$", 0.00509293f},
+	{"\321\200\320\275\320\276", 0.0128787f}, {"\321\200\320\275\320\276\320\265", 0.00664423f}, {"\321\200\320\275\320\276\320\265$", 0.00664423f},
+	{"\321\200\320\275\321\213", 0.0155422f}, {"\321\200\320\275\321\213\320\271", 0.0127909f}, {"\321\200\320\275\321\213\320\271$", 0.0127909f},
+	{"\321\200\320\276", 0.196049f}, {"\321\200\320\276\320\261", 0.00913215f}, {"\321\200\320\276\320\262", 0.0714474f},
+	{"\321\200\320\276\320\262$", 0.00910288f}, {"\321\200\320\276\320\262\320\260", 0.0422655f}, {"\321\200\320\276\320\262\320\260\320\275", 0.0231231f},
+	{"\321\200\320\276\320\262\320\260\321\202", 0.0172691f}, {"\321\200\320\276\320\262\320\265", 0.0102444f}, {"\321\200\320\276\320\262\320\265\321\200", 0.00857603f},
+	{"\321\200\320\276\320\262\320\272", 0.00573687f}, {"\321\200\320\276\320\263", 0.0107127f}, {"\321\200\320\276\320\263\321\200", 0.0092785f},
+	{"\321\200\320\276\320\263\321\200\320\260", 0.00886873f}, {"\321\200\320\276\320\264", 0.00547344f}, {"\321\200\320\276\320\270", 0.00816625f},
+	{"\321\200\320\276\320\271", 0.0114445f}, {"\321\200\320\276\320\272", 0.0307332f}, {"\321\200\320\276\320\272$", 0.00538563f},
+	{"\321\200\320\276\320\272\320\260", 0.00842968f}, {"\321\200\320\276\320\272\320\260$", 0.00772721f}, {"\321\200\320\276\320\272\320\270", 0.0109761f},
+	{"\321\200\320\276\320\272\320\270$", 0.010742f}, {"\321\200\320\276\320\273", 0.0103029f}, {"\321\200\320\276\320\273\321\214", 0.00561979f},
+	{"\321\200\320\276\320\274", 0.0100395f}, {"\321\200\320\276\320\274$", 0.0080199f}, {"\321\200\320\276\320\275", 0.00506366f},
+	{"\321\200\320\276\320\277", 0.00837114f}, {"\321\200\320\276\320\277\321\203", 0.00737597f}, {"\321\200\320\276\321\201", 0.0142836f},
+	{"\321\200\320\276\321\206", 0.00965901f}, {"\321\200\320\276\321\206\320\265", 0.00965901f}, {"\321\200\320\276\321\206\320\265\321\201", 0.00854676f},
+	{"\321\200\320\276\321\207", 0.00804917f}, {"\321\200\320\276\321\207\320\270", 0.00591248f}, {"\321\200\320\276\321\207\320\270\321\202", 0.00591248f},
+	{"\321\200\321\200", 0.0182936f}, {"\321\200\321\200\320\265", 0.0165081f}, {"\321\200\321\200\320\265\320\272", 0.0161569f},
+	{"\321\200\321\200\320\265\320\272\321\202", 0.0160983f}, {"\321\200\321\201", 0.0309088f}, {"\321\200\321\201\320\270", 0.0180594f},
+	{"\321\200\321\201\320\270\320\270", 0.00699546f}, {"\321\200\321\201\320\270\320\270$", 0.00699546f}, {"\321\200\321\201\320\270\321\217", 0.00594175f},
+	{"\321\200\321\201\320\270\321\217$", 0.00526855f}, {"\321\200\321\201\320\272", 0.00837114f}, {"\321\200\321\202", 0.0306747f},
+	{"\321\200\321\202\320\270", 0.0125274f}, {"\321\200\321\202\320\270\321\204", 0.00737597f}, {"\321\200\321\202\320\270\321\204\320\270", 0.00737597f},
+	{"\321\200\321\202\320\275", 0.00532709f}, {"\321\200\321\203", 0.0729401f}, {"\321\200\321\203\320\263", 0.00863457f},
+	{"\321\200\321\203\320\265", 0.010742f}, {"\321\200\321\203\320\265\321\202", 0.00848822f}, {"\321\200\321\203\320\265\321\202\321\201", 0.0076394f},
+	{"\321\200\321\203\320\266", 0.00790282f}, {"\321\200\321\203\320\266\320\265", 0.00661496f}, {"\321\200\321\203\320\266\320\265\320\275", 0.00635153f},
+	{"\321\200\321\203\320\267", 0.00576613f}, {"\321\200\321\203\320\272", 0.0192302f}, {"\321\200\321\203\320\272\321\206", 0.0170057f},
+	{"\321\200\321\203\320\272\321\206\320\270", 0.0170057f}, {"\321\200\321\203\320\277", 0.0080199f}, {"\321\200\321\203\320\277\320\277", 0.00761013f},
+	{"\321\200\321\205", 0.0186741f}, {"\321\200\321\205\320\270", 0.0154544f}, {"\321\200\321\205\320\270\320\262", 0.00962974f},
+	{"\321\200\321\205\320\270\321\202", 0.00576613f}, {"\321\200\321\205\320\270\321\202\320\265", 0.00576613f}, {"\321\200\321\210", 0.0109176f},
+	{"\321\200\321\213", 0.0456608f}, {"\321\200\321\213$", 0.0206644f}, {"\321\200\321\213\321\202", 0.0127031f},
+	{"\321\200\321\213\321\202\321\214", 0.00641007f}, {"\321\200\321\213\321\202\321\214$", 0.00641007f}, {"\321\200\321\217", 0.0128201f},
+	{"\321\200\321\217\320\264", 0.00523928f}, {"\321\201$", 0.081282f}, {"\321\201\320\260", 0.0410947f},
+	{"\321\201\320\260$", 0.0141665f}, {"\321\201\320\260\320\275", 0.00819552f}, {"\321\201\320\261", 0.0110932f},
+	{"\321\201\320\261\320\276", 0.00825406f}, {"\321\201\320\261\320\276\320\271", 0.0063808f}, {"\321\201\320\261\320\276\320\271$", 0.0063808f},
+	{"\321\201\320\262", 0.0108883f}, {"\321\201\320\262\320\276", 0.00518074f}, {"\321\201\320\265", 0.0565784f},
+	{"\321\201\320\265$", 0.00930777f}, {"\321\201\320\265\320\262", 0.00538563f}, {"\321\201\320\265\320\263", 0.00497585f},
+	{"\321\201\320\265\320\274", 0.00497585f}, {"\321\201\320\265\321\200", 0.015191f}, {"\321\201\320\265\321\200\320\262", 0.00602956f},
+	{"\321\201\320\265\321\200\320\262\320\265", 0.00582467f}, {"\321\201\320\265\321\200\321\202", 0.00737597f}, {"\321\201\320\265\321\200\321\202\320\270", 0.00737597f},
+	{"\321\201\320\270", 0.105137f}, {"\321\201\320\270$", 0.0131421f}, {"\321\201\320\270\320\270", 0.00708327f},
+	{"\321\201\320\270\320\270$", 0.00708327f}, {"\321\201\320\270\320\274", 0.0433192f}, {"\321\201\320\270\320\274\320\262", 0.0363823f},
+	{"\321\201\320\270\320\274\320\262\320\276", 0.0362359f}, {"\321\201\320\270\320\275", 0.00752232f}, {"\321\201\320\270\321\201", 0.0115615f},
+	{"\321\201\320\270\321\201\321\202", 0.00930777f}, {"\321\201\320\270\321\201\321\202\320\265", 0.00924923f}, {"\321\201\320\270\321\202", 0.00687838f},
+	{"\321\201\320\270\321\217", 0.00632226f}, {"\321\201\320\270\321\217$", 0.00564906f}, {"\321\201\320\272", 0.14029f},
+	{"\321\201\320\272\320\260", 0.0529489f}, {"\321\201\320\272\320\260$", 0.00828333f}, {"\321\201\320\272\320\260\321\217", 0.0329284f},
+	{"\321\201\320\272\320\260\321\217$", 0.0329284f}, {"\321\201\320\272\320\270", 0.0569881f}, {"\321\201\320\272\320\270\320\265", 0.0120299f},
+	{"\321\201\320\272\320\270\320\265$", 0.0120299f}, {"\321\201\320\272\320\270\320\271", 0.0398361f}, {"\321\201\320\272\320\270\320\271$", 0.0398361f},
+	{"\321\201\320\272\320\276", 0.0190839f}, {"\321\201\320\273", 0.0751939f}, {"\321\201\320\273\320\260", 0.0057954f},
+	{"\321\201\320\273\320\265", 0.0259037f}, {"\321\201\320\273\320\265$", 0.00913215f}, {"\321\201\320\273\320\265\320\264", 0.0120006f},
+	{"\321\201\320\273\320\270", 0.03006f}, {"\321\201\320\273\320\270$", 0.0120299f}, {"\321\201\320\273\320\270\321\210", 0.0119713f},
+	{"\321\201\320\273\320\270\321\210\320\272", 0.0119713f}, {"\321\201\320\273\320\276", 0.0162154f}, {"\321\201\320\273\320\276\320\262", 0.00866384f},
+	{"\321\201\320\274", 0.0185277f}, {"\321\201\320\274\320\265", 0.0112688f}, {"\321\201\320\274\320\265\321\211", 0.00878092f},
+	{"\321\201\320\274\320\265\321\211\320\265", 0.0083126f}, {"\321\201\320\275", 0.0122055f}, {"\321\201\320\275\320\276", 0.0076394f},
+	{"\321\201\320\276", 0.103176f}, {"\321\201\320\276\320\262", 0.013669f}, {"\321\201\320\276\320\262\320\277", 0.00550271f},
+	{"\321\201\320\276\320\262\320\277\320\260", 0.00550271f}, {"\321\201\320\276\320\264", 0.0150739f}, {"\321\201\320\276\320\264\320\265", 0.0148983f},
+	{"\321\201\320\276\320\264\320\265\321\200", 0.0148983f}, {"\321\201\320\276\320\267", 0.0194936f}, {"\321\201\320\276\320\267\320\264", 0.0194936f},
+	{"\321\201\320\276\320\267\320\264\320\260", 0.0194936f}, {"\321\201\320\276\320\272", 0.00968828f}, {"\321\201\320\276\320\272$", 0.00679058f},
+	{"\321\201\320\276\320\276", 0.013025f}, {"\321\201\320\276\320\276\320\261", 0.00845895f}, {"\321\201\320\276\320\276\320\261\321\211", 0.00842968f},
+	{"\321\201\320\276\321\200", 0.00676131f}, {"\321\201\320\276\321\201", 0.00652715f}, {"\321\201\320\276\321\201\321\202", 0.00643934f},
+	{"\321\201\320\276\321\201\321\202\320\276", 0.00573687f}, {"\321\201\320\277", 0.1018f}, {"\321\201\320\277\320\265", 0.0117372f},
+	{"\321\201\320\277\320\265\321\206", 0.00796136f}, {"\321\201\320\277\320\265\321\206\320\270", 0.00576613f}, {"\321\201\320\277\320\270", 0.0131421f},
+	{"\321\201\320\277\320\270\321\201", 0.0127909f}, {"\321\201\320\277\320\270\321\201\320\272", 0.00632226f}, {"\321\201\320\277\320\270\321\201\320\276", 0.00673204f},
+	{"\321\201\320\277\320\276", 0.0625494f}, {"\321\201\320\277\320\276\320\267", 0.0057954f}, {"\321\201\320\277\320\276\320\267\320\275", 0.0057954f},
+	{"\321\201\320\277\320\276\320\273", 0.0517781f}, {"\321\201\320\277\320\276\320\273\321\214", 0.0483536f}, {"\321\201\320\277\321\200", 0.00717108f},
+	{"\321\201\320\277\321\203", 0.00945412f}, {"\321\201\320\277\321\203\320\261", 0.00919069f}, {"\321\201\320\277\321\203\320\261\320\273", 0.00919069f},
+	{"\321\201\321\200", 0.0116201f}, {"\321\201\321\200\320\265", 0.00602956f}, {"\321\201\321\200\320\265\320\264", 0.00594175f},
+	{"\321\201\321\201", 0.039397f}, {"\321\201\321\201\321\213", 0.0157178f}, {"\321\201\321\201\321\213\320\273", 0.0153081f},
+	{"\321\201\321\201\321\213\320\273\320\272", 0.011503f}, {"\321\201\321\202", 0.29738f}, {"\321\201\321\202$", 0.00564906f},
+	{"\321\201\321\202\320\260", 0.0607932f}, {"\321\201\321\202\320\260\320\262", 0.00840041f}, {"\321\201\321\202\320\260\320\262\320\273", 0.00526855f},
+	{"\321\201\321\202\320\260\320\275", 0.03407f}, {"\321\201\321\202\320\260\320\275\320\264", 0.00518074f}, {"\321\201\321\202\320\260\320\275\320\276", 0.02084f},
+	{"\321\201\321\202\320\260\321\200", 0.00854676f}, {"\321\201\321\202\320\262", 0.0589492f}, {"\321\201\321\202\320\262\320\265", 0.00910288f},
+	{"\321\201\321\202\320\262\320\265\320\275", 0.00591248f}, {"\321\201\321\202\320\262\320\270", 0.0101273f}, {"\321\201\321\202\320\262\320\276", 0.0111225f},
+	{"\321\201\321\202\320\262\320\276$", 0.0095712f}, {"\321\201\321\202\320\262\321\203", 0.0252598f}, {"\321\201\321\202\320\262\321\203\320\265", 0.0178253f},
+	{"\321\201\321\202\320\262\321\203\321\216", 0.00746378f}, {"\321\201\321\202\320\265", 0.020401f}, {"\321\201\321\202\320\265\320\274", 0.00924923f},
+	{"\321\201\321\202\320\270", 0.0477389f}, {"\321\201\321\202\320\270$", 0.0166545f}, {"\321\201\321\202\320\270\320\274", 0.0194644f},
+	{"\321\201\321\202\320\270\320\274\320\276", 0.00602956f}, {"\321\201\321\202\320\270\320\274\321\213", 0.0095712f}, {"\321\201\321\202\320\270\321\202", 0.00684911f},
+	{"\321\201\321\202\320\270\321\202\321\214", 0.00535636f}, {"\321\201\321\202\320\275", 0.0193766f}, {"\321\201\321\202\320\275\320\276", 0.00564906f},
+	{"\321\201\321\202\320\275\321\213", 0.00916142f}, {"\321\201\321\202\320\275\321\213\320\271", 0.00834187f}, {"\321\201\321\202\320\276", 0.0314064f},
+	{"\321\201\321\202\320\276\321\207", 0.00503439f}, {"\321\201\321\202\320\276\321\207\320\275", 0.00503439f}, {"\321\201\321\202\320\276\321\217", 0.00749305f},
+	{"\321\201\321\202\320\276\321\217\320\275", 0.00582467f}, {"\321\201\321\202\321\200", 0.0881019f}, {"\321\201\321\202\321\200$", 0.00945412f},
+	{"\321\201\321\202\321\200\320\260", 0.0124689f}, {"\321\201\321\202\321\200\320\276", 0.0468023f}, {"\321\201\321\202\321\200\320\276\320\262", 0.00676131f},
+	{"\321\201\321\202\321\200\320\276\320\271", 0.00602956f}, {"\321\201\321\202\321\200\320\276\320\272", 0.0264598f}, {"\321\201\321\202\321\200\321\203", 0.0194351f},
+	{"\321\201\321\202\321\200\321\203\320\272", 0.018557f}, {"\321\201\321\202\321\203", 0.0112981f}, {"\321\201\321\202\321\203\320\277", 0.0104493f},
+	{"\321\201\321\202\321\214", 0.0178838f}, {"\321\201\321\202\321\214$", 0.0163032f}, {"\321\201\321\203", 0.0366457f},
+	{"\321\201\321\203\321\202", 0.013786f}, {"\321\201\321\203\321\202\321\201", 0.0136982f}, {"\321\201\321\203\321\202\321\201\321\202", 0.0136982f},
+	{"\321\201\321\203\321\211", 0.00837114f}, {"\321\201\321\203\321\211\320\265", 0.00828333f}, {"\321\201\321\203\321\211\320\265\321\201", 0.00828333f},
+	{"\321\201\321\205", 0.00740524f}, {"\321\201\321\207", 0.00602956f}, {"\321\201\321\210", 0.00840041f},
+	{"\321\201\321\210\320\270", 0.00635153f}, {"\321\201\321\210\320\270\321\200", 0.00591248f}, {"\321\201\321\210\320\270\321\200\320\265", 0.00535636f},
+	{"\321\201\321\213", 0.0202546f}, {"\321\201\321\213\320\273", 0.015952f}, {"\321\201\321\213\320\273\320\272", 0.0116493f},
+	{"\321\201\321\214", 0.061642f}, {"\321\201\321\214$", 0.0590078f}, {"\321\201\321\217", 0.100776f},
+	{"\321\201\321\217$", 0.0997512f}, {"\321\202$", 0.166076f}, {"\321\202\320\260", 0.169091f},
+	{"\321\202\320\260$", 0.043729f}, {"\321\202\320\260\320\261", 0.0103029f}, {"\321\202\320\260\320\261\320\273", 0.00781502f},
+	{"\321\202\320\260\320\261\320\273\320\270", 0.00772721f}, {"\321\202\320\260\320\262", 0.00883946f}, {"\321\202\320\260\320\262\320\273", 0.00538563f},
+	{"\321\202\320\260\320\265", 0.00523928f}, {"\321\202\320\260\320\272", 0.0129665f}, {"\321\202\320\260\320\273", 0.0248207f},
+	{"\321\202\320\260\320\273\320\276", 0.0213084f}, {"\321\202\320\260\320\273\320\276\320\263", 0.0206352f}, {"\321\202\320\260\320\275", 0.04048f},
+	{"\321\202\320\260\320\275\320\264", 0.00529782f}, {"\321\202\320\260\320\275\320\264\320\260", 0.00518074f}, {"\321\202\320\260\320\275\320\276", 0.0212498f},
+	{"\321\202\320\260\320\275\320\276\320\262", 0.0207815f}, {"\321\202\320\260\321\200", 0.0112103f}, {"\321\202\320\260\321\202", 0.0196693f},
+	{"\321\202\320\260\321\202\321\214", 0.0127909f}, {"\321\202\320\260\321\202\321\214$", 0.0122347f}, {"\321\202\320\262", 0.0662374f},
+	{"\321\202\320\262\320\265", 0.0168008f}, {"\321\202\320\262\320\265\320\275", 0.00591248f}, {"\321\202\320\262\320\265\320\275\320\275", 0.00591248f},
+	{"\321\202\320\262\320\265\321\202", 0.00643934f}, {"\321\202\320\262\320\270", 0.010742f}, {"\321\202\320\262\320\276", 0.011503f},
+	{"\321\202\320\262\320\276$", 0.0095712f}, {"\321\202\320\262\321\203", 0.0252598f}, {"\321\202\320\262\321\203\320\265", 0.0178253f},
+	{"\321\202\320\262\321\203\320\265\321\202", 0.0178253f}, {"\321\202\320\262\321\203\321\216", 0.00746378f}, {"\321\202\320\262\321\203\321\216\321\211", 0.00591248f},
+	{"\321\202\320\265", 0.139148f}, {"\321\202\320\265$", 0.0363237f}, {"\321\202\320\265\320\272", 0.0236499f},
+	{"\321\202\320\265\320\272\321\201", 0.00658569f}, {"\321\202\320\265\320\272\321\201\321\202", 0.00629299f}, {"\321\202\320\265\320\272\321\202", 0.00576613f},
+	{"\321\202\320\265\320\272\321\202\321\203", 0.00576613f}, {"\321\202\320\265\320\272\321\203", 0.00585394f}, {"\321\202\320\265\320\272\321\203\321\211", 0.00532709f},
+	{"\321\202\320\265\320\273", 0.0438168f}, {"\321\202\320\265\320\273\321\214", 0.0290356f}, {"\321\202\320\265\320\273\321\214$", 0.00714181f},
+	{"\321\202\320\265\320\273\321\214\320\275", 0.0203132f}, {"\321\202\320\265\320\273\321\217", 0.0104493f}, {"\321\202\320\265\320\273\321\217$", 0.00983463f},
+	{"\321\202\320\265\320\274", 0.0121469f}, {"\321\202\320\265\320\275", 0.0163325f}, {"\321\202\320\265\320\275\320\270", 0.0083126f},
+	{"\321\202\320\265\321\200", 0.0127909f}, {"\321\202\320\270", 0.13906f}, {"\321\202\320\270$", 0.0350944f},
+	{"\321\202\320\270\320\262", 0.0108591f}, {"\321\202\320\270\320\274", 0.0214254f}, {"\321\202\320\270\320\274\320\276", 0.00617591f},
+	{"\321\202\320\270\320\274\321\213", 0.0095712f}, {"\321\202\320\270\320\274\321\213\320\271", 0.00550271f}, {"\321\202\320\270\320\277", 0.018557f},
+	{"\321\202\320\270\320\277$", 0.0124689f}, {"\321\202\320\270\321\200", 0.00971755f}, {"\321\202\320\270\321\200\320\276", 0.00772721f},
+	{"\321\202\320\270\321\200\320\276\320\262", 0.00766867f}, {"\321\202\320\270\321\202", 0.0123811f}, {"\321\202\320\270\321\202\321\214", 0.00781502f},
+	{"\321\202\320\270\321\202\321\214$", 0.00752232f}, {"\321\202\320\270\321\204", 0.0191717f}, {"\321\202\320\270\321\204\320\270", 0.0190839f},
+	{"\321\202\320\270\321\204\320\270\320\272", 0.0185863f}, {"\321\202\320\270\321\207", 0.00881019f}, {"\321\202\320\270\321\207\320\265", 0.00676131f},
+	{"\321\202\320\270\321\207\320\265\321\201", 0.00676131f}, {"\321\202\320\272", 0.0398654f}, {"\321\202\320\272\320\260", 0.0104493f},
+	{"\321\202\320\272\320\260$", 0.0089858f}, {"\321\202\320\272\320\270", 0.0103029f}, {"\321\202\320\272\320\270$", 0.0089858f},
+	{"\321\202\320\272\321\200", 0.00916142f}, {"\321\202\320\272\321\200\321\213", 0.00910288f}, {"\321\202\320\272\321\200\321\213\321\202", 0.00875165f},
+	{"\321\202\320\273", 0.00673204f}, {"\321\202\320\274", 0.00497585f}, {"\321\202\320\275", 0.0698668f},
+	{"\321\202\320\275\320\260", 0.00921996f}, {"\321\202\320\275\320\260\321\217", 0.00728816f}, {"\321\202\320\275\320\260\321\217$", 0.00728816f},
+	{"\321\202\320\275\320\276", 0.0284502f}, {"\321\202\320\275\320\276\320\263", 0.00550271f}, {"\321\202\320\275\320\276\320\263\320\276", 0.00550271f},
+	{"\321\202\320\275\320\276\320\265", 0.00910288f}, {"\321\202\320\275\320\276\320\265$", 0.00910288f}, {"\321\202\320\275\321\213", 0.0318455f},
+	{"\321\202\320\275\321\213\320\271", 0.0236499f}, {"\321\202\320\275\321\213\320\271$", 0.0236499f}, {"\321\202\320\276", 0.16353f},
+	{"\321\202\320\276$", 0.0249378f}, {"\321\202\320\276\320\261", 0.00980536f}, {"\321\202\320\276\320\261\321\213", 0.00752232f},
+	{"\321\202\320\276\320\261\321\213$", 0.00752232f}, {"\321\202\320\276\320\262", 0.0243231f}, {"\321\202\320\276\320\262$", 0.0161569f},
+	{"\321\202\320\276\320\263", 0.00684911f}, {"\321\202\320\276\320\263\320\276", 0.00556125f}, {"\321\202\320\276\320\263\320\276$", 0.00547344f},
+	{"\321\202\320\276\320\271", 0.00851749f}, {"\321\202\320\276\320\271$", 0.00828333f}, {"\321\202\320\276\320\272", 0.00913215f},
+	{"\321\202\320\276\320\272$", 0.00538563f}, {"\321\202\320\276\320\273", 0.0185863f}, {"\321\202\320\276\320\273\321\214", 0.0165667f},
+	{"\321\202\320\276\320\273\321\214\320\272", 0.0165374f}, {"\321\202\320\276\320\274", 0.0121469f}, {"\321\202\320\276\320\274$", 0.00658569f},
+	{"\321\202\320\276\321\200", 0.042002f}, {"\321\202\320\276\321\200$", 0.00793209f}, {"\321\202\320\276\321\200\320\260", 0.0051222f},
+	{"\321\202\320\276\321\200\320\270", 0.00766867f}, {"\321\202\320\276\321\200\320\276", 0.00690765f}, {"\321\202\320\276\321\200\321\213", 0.00892726f},
+	{"\321\202\320\276\321\207", 0.0129958f}, {"\321\202\320\276\321\207\320\275", 0.00892726f}, {"\321\202\320\276\321\217", 0.00755159f},
+	{"\321\202\320\276\321\217\320\275", 0.00582467f}, {"\321\202\320\276\321\217\320\275\320\270", 0.00553198f}, {"\321\202\321\200", 0.149071f},
+	{"\321\202\321\200$", 0.0235036f}, {"\321\202\321\200\320\260", 0.0199327f}, {"\321\202\321\200\320\260$", 0.00837114f},
+	{"\321\202\321\200\320\260\320\275", 0.00556125f}, {"\321\202\321\200\320\265", 0.0199619f}, {"\321\202\321\200\320\265\320\261", 0.011825f},
+	{"\321\202\321\200\320\265\320\261\321\203", 0.0107713f}, {"\321\202\321\200\320\265\320\275", 0.00535636f}, {"\321\202\321\200\320\265\320\275\320\275", 0.00500512f},
+	{"\321\202\321\200\320\270", 0.0147227f}, {"\321\202\321\200\320\270\320\261", 0.00518074f}, {"\321\202\321\200\320\270\320\261\321\203", 0.00518074f},
+	{"\321\202\321\200\320\276", 0.0542075f}, {"\321\202\321\200\320\276\320\262", 0.00907361f}, {"\321\202\321\200\320\276\320\262$", 0.00509293f},
+	{"\321\202\321\200\320\276\320\271", 0.00614664f}, {"\321\202\321\200\320\276\320\272", 0.0265184f}, {"\321\202\321\200\320\276\320\272\320\260", 0.00796136f},
+	{"\321\202\321\200\320\276\320\272\320\270", 0.0105956f}, {"\321\202\321\200\321\203", 0.0197863f}, {"\321\202\321\200\321\203\320\272", 0.0186155f},
+	{"\321\202\321\200\321\203\320\272\321\206", 0.0170057f}, {"\321\202\321\200\321\213", 0.0109176f}, {"\321\202\321\200\321\213$", 0.0109176f},
+	{"\321\202\321\201", 0.110435f}, {"\321\202\321\201\320\272", 0.00500512f}, {"\321\202\321\201\321\202", 0.0182643f},
+	{"\321\202\321\201\321\202\320\262", 0.0182058f}, {"\321\202\321\201\321\202\320\262\321\203", 0.015513f}, {"\321\202\321\201\321\203", 0.0132006f},
+	{"\321\202\321\201\321\203\321\202", 0.0132006f}, {"\321\202\321\201\321\203\321\202\321\201", 0.0132006f}, {"\321\202\321\201\321\217", 0.0840626f},
+	{"\321\202\321\201\321\217$", 0.0839748f}, {"\321\202\321\203", 0.0328699f}, {"\321\202\321\203$", 0.00550271f},
+	{"\321\202\321\203\320\277", 0.0105664f}, {"\321\202\321\203\321\200", 0.0100981f}, {"\321\202\321\207", 0.00696619f},
+	{"\321\202\321\213", 0.0312015f}, {"\321\202\321\213$", 0.0208108f}, {"\321\202\321\214", 0.225962f},
+	{"\321\202\321\214$", 0.216976f}, {"\321\202\321\214\321\201", 0.00954193f}, {"\321\202\321\214\321\201\321\217", 0.00954193f},
+	{"\321\202\321\214\321\201\321\217$", 0.00954193f}, {"\321\203$", 0.060442f}, {"\321\203\320\260", 0.00670277f},
+	{"\321\203\320\261", 0.0141373f}, {"\321\203\320\261\320\273", 0.00977609f}, {"\321\203\320\261\320\273\320\270", 0.00971755f},
+	{"\321\203\320\261\320\273\320\270\320\272", 0.00933704f}, {"\321\203\320\263", 0.0110932f}, {"\321\203\320\264", 0.0779453f},
+	{"\321\203\320\264\320\260", 0.0650959f}, {"\321\203\320\264\320\260\320\273", 0.0592126f}, {"\321\203\320\264\320\260\320\273\320\265", 0.00687838f},
+	{"\321\203\320\264\320\260\320\273\320\270", 0.00737597f}, {"\321\203\320\264\320\260\320\273\320\276", 0.0427923f}, {"\321\203\320\264\320\265", 0.0054149f},
+	{"\321\203\320\264\320\265\321\202", 0.00529782f}, {"\321\203\320\264\320\265\321\202$", 0.00526855f}, {"\321\203\320\265", 0.0528026f},
+	{"\321\203\320\265\320\274", 0.00658569f}, {"\321\203\320\265\321\202", 0.0465681f}, {"\321\203\320\265\321\202$", 0.0228304f},
+	{"\321\203\320\265\321\202\321\201", 0.024089f}, {"\321\203\320\265\321\202\321\201\321\217", 0.024089f}, {"\321\203\320\266", 0.0186155f},
+	{"\321\203\320\266\320\265", 0.0134055f}, {"\321\203\320\266\320\265$", 0.0063808f}, {"\321\203\320\266\320\265\320\275", 0.00681984f},
+	{"\321\203\320\267", 0.0105078f}, {"\321\203\320\271", 0.0103908f}, {"\321\203\320\271\321\202", 0.00828333f},
+	{"\321\203\320\271\321\202\320\265", 0.00828333f}, {"\321\203\320\271\321\202\320\265$", 0.00813698f}, {"\321\203\320\272", 0.0502854f},
+	{"\321\203\320\272\320\260", 0.0268989f}, {"\321\203\320\272\320\260\320\267", 0.0248207f}, {"\321\203\320\272\320\260\320\267\320\260", 0.0217181f},
+	{"\321\203\320\272\321\206", 0.0170057f}, {"\321\203\320\272\321\206\320\270", 0.0170057f}, {"\321\203\320\272\321\206\320\270\320\270", 0.00954193f},
+	{"\321\203\320\273", 0.0226255f}, {"\321\203\320\273\321\214", 0.0051222f}, {"\321\203\320\273\321\217", 0.00772721f},
+	{"\321\203\320\274", 0.0379628f}, {"\321\203\320\274\320\265", 0.0195522f}, {"\321\203\320\274\320\265\320\275", 0.017796f},
+	{"\321\203\320\274\320\265\320\275\321\202", 0.0173277f}, {"\321\203\320\274\320\276", 0.0121762f}, {"\321\203\320\274\320\276\320\273", 0.0120884f},
+	{"\321\203\320\274\320\276\320\273\321\207", 0.0120884f}, {"\321\203\320\275", 0.0168886f}, {"\321\203\320\275\320\272", 0.00702473f},
+	{"\321\203\320\275\320\272\321\206", 0.00658569f}, {"\321\203\320\275\320\272\321\206\320\270", 0.00658569f}, {"\321\203\320\277", 0.0408313f},
+	{"\321\203\320\277\320\277", 0.00761013f}, {"\321\203\320\277\321\200", 0.0187912f}, {"\321\203\320\277\321\200\320\260", 0.00526855f},
+	{"\321\203\320\277\321\200\320\260\320\262", 0.00526855f}, {"\321\203\320\277\321\200\320\265", 0.0135226f}, {"\321\203\320\277\321\200\320\265\320\266", 0.0134641f},
+	{"\321\203\321\200", 0.0277184f}, {"\321\203\321\200\320\260", 0.00561979f}, {"\321\203\321\201", 0.0704815f},
+	{"\321\203\321\201\320\272", 0.00992244f}, {"\321\203\321\201\320\272\320\260", 0.00749305f}, {"\321\203\321\201\321\202", 0.0499341f},
+	{"\321\203\321\201\321\202\320\260", 0.0206644f}, {"\321\203\321\201\321\202\320\260\320\275", 0.0167715f}, {"\321\203\321\201\321\202\320\270", 0.0209864f},
+	{"\321\203\321\201\321\202\320\270\320\274", 0.016391f}, {"\321\203\321\202", 0.050022f}, {"\321\203\321\202$", 0.00819552f},
+	{"\321\203\321\202\320\265", 0.00567833f}, {"\321\203\321\202\321\200", 0.00778575f}, {"\321\203\321\202\321\201", 0.0143714f},
+	{"\321\203\321\202\321\201\321\202", 0.0136982f}, {"\321\203\321\202\321\201\321\202\320\262", 0.0136982f}, {"\321\203\321\204", 0.00573687f},
+	{"\321\203\321\207", 0.0190546f}, {"\321\203\321\207\320\265", 0.00728816f}, {"\321\203\321\207\320\265\320\275", 0.00655642f},
+	{"\321\203\321\207\320\270", 0.0063808f}, {"\321\203\321\207\320\270\321\202", 0.00576613f}, {"\321\203\321\207\320\270\321\202\321\214", 0.00509293f},
+	{"\321\203\321\211", 0.0204303f}, {"\321\203\321\211\320\265", 0.0164496f}, {"\321\203\321\211\320\265\321\201", 0.00828333f},
+	{"\321\203\321\211\320\265\321\201\321\202", 0.00828333f}, {"\321\203\321\216", 0.0320796f}, {"\321\203\321\216$", 0.0164496f},
+	{"\321\203\321\216\321\211", 0.0124396f}, {"\321\203\321\216\321\211\320\270", 0.00804917f}, {"\321\204\320\260", 0.0858481f},
+	{"\321\204\320\260\320\271", 0.0830382f}, {"\321\204\320\260\320\271\320\273", 0.0829211f}, {"\321\204\320\260\320\271\320\273$", 0.0350944f},
+	{"\321\204\320\260\320\271\320\273\320\260", 0.025933f}, {"\321\204\320\260\320\271\320\273\320\265", 0.00532709f}, {"\321\204\320\260\320\271\320\273\320\276", 0.0154544f},
+	{"\321\204\320\260\320\271\320\273\321\213", 0.0076394f}, {"\321\204\320\265", 0.00629299f}, {"\321\204\320\270", 0.0367335f},
+	{"\321\204\320\270\320\272", 0.0278355f}, {"\321\204\320\270\320\272\320\260", 0.0220108f}, {"\321\204\320\270\320\272\320\260\321\202", 0.0155422f},
+	{"\321\204\320\270\320\272\320\260\321\206", 0.00652715f}, {"\321\204\320\270\320\272\321\201", 0.00553198f}, {"\321\204\320\273", 0.00810771f},
+	{"\321\204\320\276", 0.0307917f}, {"\321\204\320\276\321\200", 0.0271038f}, {"\321\204\320\276\321\200\320\274", 0.0256695f},
+	{"\321\204\320\276\321\200\320\274\320\260", 0.0240012f}, {"\321\204\321\200", 0.0111518f}, {"\321\204\321\200\320\260", 0.00521001f},
+	{"\321\204\321\203", 0.0076394f}, {"\321\204\321\203\320\275", 0.00687838f}, {"\321\204\321\203\320\275\320\272", 0.00658569f},
+	{"\321\204\321\203\320\275\320\272\321\206", 0.00658569f}, {"\321\205$", 0.0588029f}, {"\321\205\320\260", 0.00749305f},
+	{"\321\205\320\265", 0.00529782f}, {"\321\205\320\270", 0.0188497f}, {"\321\205\320\270\320\262", 0.00968828f},
+	{"\321\205\320\270\321\202", 0.00582467f}, {"\321\205\320\270\321\202\320\265", 0.00576613f}, {"\321\205\320\270\321\202\320\265\320\272", 0.00576613f},
+	{"\321\205\320\276", 0.0386653f}, {"\321\205\320\276\320\264", 0.0311137f}, {"\321\205\320\276\320\264\320\270", 0.00960047f},
+	{"\321\205\320\276\320\264\320\270\320\274", 0.00600029f}, {"\321\205\320\276\320\264\320\275", 0.0132885f}, {"\321\205\320\276\320\264\320\275\320\276", 0.00623445f},
+	{"\321\205\320\276\320\264\320\275\321\213", 0.00652715f}, {"\321\205\321\200", 0.00851749f}, {"\321\205\321\200\320\260", 0.00687838f},
+	{"\321\205\321\200\320\260\320\275", 0.00676131f}, {"\321\206$", 0.00561979f}, {"\321\206\320\260", 0.0115323f},
+	{"\321\206\320\260$", 0.00772721f}, {"\321\206\320\265", 0.0294161f}, {"\321\206\320\265\320\273", 0.00904434f},
+	{"\321\206\320\265\321\201", 0.00866384f}, {"\321\206\320\265\321\201\321\201", 0.00854676f}, {"\321\206\320\270", 0.0806381f},
+	{"\321\206\320\270\320\260", 0.00509293f}, {"\321\206\320\270\320\270", 0.034831f}, {"\321\206\320\270\320\270$", 0.0347139f},
+	{"\321\206\320\270\321\216", 0.0123226f}, {"\321\206\320\270\321\216$", 0.0123226f}, {"\321\206\320\270\321\217", 0.0188204f},
+	{"\321\206\320\270\321\217$", 0.0174155f}, {"\321\206\320\272", 0.00506366f}, {"\321\207$", 0.0117664f},
+	{"\321\207\320\260", 0.0478853f}, {"\321\207\320\260$", 0.00740524f}, {"\321\207\320\260\320\273", 0.00535636f},
+	{"\321\207\320\260\320\275", 0.0158056f}, {"\321\207\320\260\320\275\320\270", 0.0153373f}, {"\321\207\320\260\320\275\320\270\321\216", 0.0120884f},
+	{"\321\207\320\260\321\201", 0.00664423f}, {"\321\207\320\260\321\202", 0.00881019f}, {"\321\207\320\265", 0.0932241f},
+	{"\321\207\320\265\320\275", 0.0508415f}, {"\321\207\320\265\320\275\320\270", 0.0402459f}, {"\321\207\320\265\320\275\320\270\320\265", 0.0260793f},
+	{"\321\207\320\265\320\275\320\270\321\217", 0.0117079f}, {"\321\207\320\265\321\200", 0.00617591f}, {"\321\207\320\265\321\201", 0.0240304f},
+	{"\321\207\320\265\321\201\320\272", 0.0166837f}, {"\321\207\320\265\321\201\320\272\320\260", 0.0057954f}, {"\321\207\320\265\321\201\320\272\320\270", 0.00684911f},
+	{"\321\207\320\265\321\201\321\202", 0.00746378f}, {"\321\207\320\265\321\201\321\202\320\262", 0.00693692f}, {"\321\207\320\270", 0.0590078f},
+	{"\321\207\320\270\320\275", 0.00591248f}, {"\321\207\320\270\321\201", 0.0136397f}, {"\321\207\320\270\321\201\320\273", 0.0114152f},
+	{"\321\207\320\270\321\201\320\273\320\276", 0.00699546f}, {"\321\207\320\270\321\202", 0.0262842f}, {"\321\207\320\270\321\202\320\260", 0.0107127f},
+	{"\321\207\320\270\321\202\320\260\321\202", 0.00819552f}, {"\321\207\320\270\321\202\321\214", 0.0139324f}, {"\321\207\320\270\321\202\321\214$", 0.0129958f},
+	{"\321\207\320\272", 0.00743451f}, {"\321\207\320\275", 0.0320796f}, {"\321\207\320\275\320\276", 0.0128787f},
+	{"\321\207\320\275\321\213", 0.0126738f}, {"\321\207\320\275\321\213\320\271", 0.0054149f}, {"\321\207\320\275\321\213\320\271$", 0.0054149f},
+	{"\321\207\321\202", 0.0262257f}, {"\321\207\321\202\320\265", 0.00837114f}, {"\321\207\321\202\320\265\320\275", 0.00834187f},
+	{"\321\207\321\202\320\265\320\275\320\270", 0.00828333f}, {"\321\207\321\202\320\276", 0.0165081f}, {"\321\207\321\202\320\276$", 0.00875165f},
+	{"\321\207\321\202\320\276\320\261", 0.00752232f}, {"\321\207\321\202\320\276\320\261\321\213", 0.00752232f}, {"\321\207\321\221", 0.00766867f},
+	{"\321\207\321\221\321\202", 0.00518074f}, {"\321\210$", 0.00561979f}, {"\321\210\320\260", 0.0164789f},
+	{"\321\210\320\265", 0.0232694f}, {"\321\210\320\265$", 0.00550271f}, {"\321\210\320\265\320\275", 0.0106834f},
+	{"\321\210\320\265\320\275\320\270", 0.00550271f}, {"\321\210\320\270", 0.0720035f}, {"\321\210\320\270\320\261", 0.0420606f},
+	{"\321\210\320\270\320\261\320\272", 0.0400702f}, {"\321\210\320\270\320\261\320\272\320\260", 0.0355334f}, {"\321\210\320\270\321\200", 0.011064f},
+	{"\321\210\320\270\321\200\320\265", 0.00538563f}, {"\321\210\320\270\321\200\320\265\320\275", 0.00535636f}, {"\321\210\320\272", 0.014869f},
+	{"\321\210\320\272\320\276", 0.0122933f}, {"\321\210\320\272\320\276\320\274", 0.0120006f}, {"\321\210\320\272\320\276\320\274$", 0.0120006f},
+	{"\321\210\320\275", 0.00746378f}, {"\321\211\320\260", 0.00942485f}, {"\321\211\320\265", 0.063808f},
+	{"\321\211\320\265\320\263", 0.00535636f}, {"\321\211\320\265\320\263\320\276", 0.00535636f}, {"\321\211\320\265\320\263\320\276$", 0.00515147f},
+	{"\321\211\320\265\320\271", 0.00673204f}, {"\321\211\320\265\320\271$", 0.0066735f}, {"\321\211\320\265\320\275", 0.0382848f},
+	{"\321\211\320\265\320\275\320\270", 0.0326357f}, {"\321\211\320\265\320\275\320\270\320\265", 0.0189082f}, {"\321\211\320\265\320\275\320\270\321\217", 0.0105078f},
+	{"\321\211\320\265\321\201", 0.00840041f}, {"\321\211\320\265\321\201\321\202", 0.00840041f}, {"\321\211\320\265\321\201\321\202\320\262", 0.00840041f},
+	{"\321\211\320\270", 0.0280697f}, {"\321\211\320\270\320\265", 0.00743451f}, {"\321\211\320\270\320\265$", 0.00597102f},
+	{"\321\211\320\270\320\271", 0.00968828f}, {"\321\211\320\270\320\271$", 0.00886873f}, {"\321\212\320\265", 0.0148105f},
+	{"\321\212\320\265\320\272", 0.0122347f}, {"\321\212\320\265\320\272\321\202", 0.0122347f}, {"\321\213$", 0.106952f},
+	{"\321\213\320\261", 0.00693692f}, {"\321\213\320\262", 0.0367628f}, {"\321\213\320\262\320\260", 0.0200498f},
+	{"\321\213\320\262\320\260\320\265", 0.00611737f}, {"\321\213\320\262\320\260\320\265\321\202", 0.00497585f}, {"\321\213\320\262\320\260\321\202", 0.0076394f},
+	{"\321\213\320\262\320\260\321\202\321\214", 0.00743451f}, {"\321\213\320\262\320\276", 0.0148105f}, {"\321\213\320\262\320\276\320\264", 0.0147812f},
+	{"\321\213\320\262\320\276\320\264$", 0.00626372f}, {"\321\213\320\262\320\276\320\264\320\270", 0.00529782f}, {"\321\213\320\264", 0.0057954f},
+	{"\321\213\320\265", 0.0479145f}, {"\321\213\320\265$", 0.0479145f}, {"\321\213\320\267", 0.00626372f},
+	{"\321\213\320\271", 0.113449f}, {"\321\213\320\271$", 0.112484f}, {"\321\213\320\272", 0.0151324f},
+	{"\321\213\320\272\320\270", 0.0101859f}, {"\321\213\320\272\320\270$", 0.0101273f}, {"\321\213\320\273", 0.0225084f},
+	{"\321\213\320\273\320\272", 0.0116493f}, {"\321\213\320\274", 0.0245866f}, {"\321\213\320\274$", 0.0192595f},
+	{"\321\213\320\274\320\270", 0.00506366f}, {"\321\213\320\274\320\270$", 0.00500512f}, {"\321\213\320\277", 0.0159227f},
+	{"\321\213\320\277\320\276", 0.0149276f}, {"\321\213\320\277\320\276\320\273", 0.0149276f}, {"\321\213\320\277\320\276\320\273\320\275", 0.0149276f},
+	{"\321\213\321\200", 0.0142544f}, {"\321\213\321\200\320\260", 0.0117957f}, {"\321\213\321\200\320\260\320\266", 0.00851749f},
+	{"\321\213\321\200\320\260\320\266\320\265", 0.00845895f}, {"\321\213\321\202", 0.0364115f}, {"\321\213\321\202\321\214", 0.0255817f},
+	{"\321\213\321\202\321\214$", 0.0255817f}, {"\321\213\321\205", 0.0462169f}, {"\321\213\321\205$", 0.0399824f},
+	{"\321\213\321\205\320\276", 0.00746378f}, {"\321\213\321\205\320\276\320\264", 0.00746378f}, {"\321\213\321\207", 0.00655642f},
+	{"\321\214$", 0.253329f}, {"\321\214\320\267", 0.0642763f}, {"\321\214\320\267\320\276", 0.0412118f},
+	{"\321\214\320\267\320\276\320\262", 0.0412118f}, {"\321\214\320\267\320\276\320\262\320\260", 0.0412118f}, {"\321\214\320\267\321\203", 0.0207522f},
+	{"\321\214\320\267\321\203\320\265", 0.0120299f}, {"\321\214\320\267\321\203\320\265\321\202", 0.0099517f}, {"\321\214\320\267\321\203\320\271", 0.00617591f},
+	{"\321\214\320\267\321\203\320\271\321\202", 0.00617591f}, {"\321\214\320\267\321\217", 0.00679058f}, {"\321\214\320\267\321\217$", 0.00679058f},
+	{"\321\214\320\272", 0.0214547f}, {"\321\214\320\272\320\276", 0.0201961f}, {"\321\214\320\272\320\276$", 0.0201083f},
+	{"\321\214\320\275", 0.0606176f}, {"\321\214\320\275\320\260", 0.00547344f}, {"\321\214\320\275\320\260\321\217", 0.00509293f},
+	{"\321\214\320\275\320\260\321\217$", 0.00509293f}, {"\321\214\320\275\320\276", 0.0264891f}, {"\321\214\320\275\320\276$", 0.00690765f},
+	{"\321\214\320\275\320\276\320\265", 0.00684911f}, {"\321\214\320\275\320\276\320\265$", 0.00684911f}, {"\321\214\320\275\321\213", 0.0272501f},
+	{"\321\214\320\275\321\213\320\265", 0.00635153f}, {"\321\214\320\275\321\213\320\265$", 0.00635153f}, {"\321\214\320\275\321\213\320\271", 0.0140787f},
+	{"\321\214\320\275\321\213\320\271$", 0.0140787f}, {"\321\214\321\201", 0.0179716f}, {"\321\214\321\201\320\272", 0.00793209f},
+	{"\321\214\321\201\321\217", 0.00954193f}, {"\321\214\321\201\321\217$", 0.00954193f}, {"\321\214\321\202", 0.00951266f},
+	{"\321\214\321\210", 0.00907361f}, {"\321\214\321\216", 0.00725889f}, {"\321\214\321\216$", 0.00617591f},
+	{"\321\215\320\272", 0.00617591f}, {"\321\215\320\273", 0.014108f}, {"\321\215\320\273\320\265", 0.0116201f},
+	{"\321\215\320\273\320\265\320\274", 0.0100395f}, {"\321\215\320\273\320\265\320\274\320\265", 0.0100395f}, {"\321\215\321\202", 0.0234743f},
+	{"\321\215\321\202\320\276", 0.0196985f}, {"\321\215\321\202\320\276$", 0.00769794f}, {"\321\216$", 0.0501098f},
+	{"\321\216\321\202", 0.0166837f}, {"\321\216\321\202$", 0.0054149f}, {"\321\216\321\202\321\201", 0.00866384f},
+	{"\321\216\321\202\321\201\321\217", 0.00866384f}, {"\321\216\321\202\321\201\321\217$", 0.00866384f}, {"\321\216\321\207", 0.038519f},
+	{"\321\216\321\207$", 0.00895653f}, {"\321\216\321\207\320\260", 0.00954193f}, {"\321\216\321\207\320\260$", 0.00611737f},
+	{"\321\216\321\207\320\265", 0.0104786f}, {"\321\216\321\207\320\265\320\275", 0.00597102f}, {"\321\216\321\207\320\270", 0.00924923f},
+	{"\321\216\321\207\320\270\321\202", 0.00749305f}, {"\321\216\321\207\320\270\321\202\321\214", 0.00728816f}, {"\321\216\321\211", 0.0283624f},
+	{"\321\216\321\211\320\265", 0.00971755f}, {"\321\216\321\211\320\270", 0.0160398f}, {"\321\216\321\211\320\270\320\265", 0.00588321f},
+	{"\321\216\321\211\320\270\320\271", 0.00591248f}, {"\321\216\321\211\320\270\320\271$", 0.0051222f}, {"\321\217$", 0.351822f},
+	{"\321\217\320\262", 0.0139617f}, {"\321\217\320\262\320\273", 0.0113859f}, {"\321\217\320\262\320\273\321\217", 0.01042f},
+	{"\321\217\320\262\320\273\321\217\320\265", 0.00901507f}, {"\321\217\320\264", 0.00658569f}, {"\321\217\320\265", 0.0226548f},
+	{"\321\217\320\265\321\202", 0.0190546f}, {"\321\217\320\265\321\202\321\201", 0.0145471f}, {"\321\217\320\265\321\202\321\201\321\217", 0.0145471f},
+	{"\321\217\320\267", 0.0163618f}, {"\321\217\320\267\321\213", 0.0122055f}, {"\321\217\320\267\321\213\320\272", 0.0116201f},
+	{"\321\217\320\267\321\213\320\272\320\270", 0.0100981f}, {"\321\217\320\274", 0.00828333f}, {"\321\217\320\275", 0.0151032f},
+	{"\321\217\320\275\320\270", 0.00942485f}, {"\321\217\320\275\320\270\320\265", 0.00500512f}, {"\321\217\321\202", 0.0257281f},
+	{"\321\217\321\202\321\214", 0.0128787f}, {"\321\217\321\202\321\214$", 0.0118542f}, {"\321\217\321\216", 0.00834187f},
+	{"\321\217\321\216\321\211", 0.0057954f}, {"\321\217\321\217", 0.0066735f}, {"\321\217\321\217$", 0.00664423f},
+	{"\321\221\320\275", 0.0238548f}, {"\321\221\320\275$", 0.0103615f}, {"\321\221\320\275\320\275", 0.0135519f},
+	{"\321\221\320\275\320\275\321\213", 0.00784429f}, {"\321\221\321\202", 0.00992244f}
+};
+
+static const QGramTableElement russianCharacters[] = {
+	{"$", 0.144358f}, {"0", 0.00165995f}, {"1", 0.000922038f},
+	{"2", 0.0010662f}, {"3", 0.000527389f}, {"4", 0.000442464f},
+	{"5", 0.000573776f}, {"6", 0.000456737f}, {"7", 0.000175558f},
+	{"8", 0.000382517f}, {"9", 0.00012703f}, {"a", 0.00546158f},
+	{"b", 0.00236718f}, {"c", 0.00390082f}, {"d", 0.00476933f},
+	{"e", 0.00795293f}, {"f", 0.00252847f}, {"g", 0.00245924f},
+	{"h", 0.00161357f}, {"i", 0.00552152f}, {"j", 0.000169135f},
+	{"k", 0.000952011f}, {"l", 0.0047886f}, {"m", 0.00319859f},
+	{"n", 0.00466229f}, {"o", 0.00469155f}, {"p", 0.00484569f},
+	{"q", 0.000247637f}, {"r", 0.00531599f}, {"s", 0.0134852f},
+	{"t", 0.00596113f}, {"u", 0.00296165f}, {"v", 0.00109902f},
+	{"w", 0.000837827f}, {"x", 0.00184978f}, {"y", 0.00090491f},
+	{"z", 0.000403213f}, {"\320\260", 0.0651257f}, {"\320\261", 0.011215f},
+	{"\320\262", 0.0306827f}, {"\320\263", 0.00814205f}, {"\320\264", 0.0239723f},
+	{"\320\265", 0.0696938f}, {"\320\266", 0.00631724f}, {"\320\267", 0.0151423f},
+	{"\320\270", 0.0577722f}, {"\320\271", 0.0131305f}, {"\320\272", 0.0275184f},
+	{"\320\273", 0.0319609f}, {"\320\274", 0.0222417f}, {"\320\275", 0.0548099f},
+	{"\320\276", 0.0688602f}, {"\320\277", 0.0254581f}, {"\321\200", 0.0401843f},
+	{"\321\201", 0.0392259f}, {"\321\202", 0.0457229f}, {"\321\203", 0.0179027f},
+	{"\321\204", 0.00545301f}, {"\321\205", 0.00430974f}, {"\321\206", 0.00399145f},
+	{"\321\207", 0.00814276f}, {"\321\210", 0.00408708f}, {"\321\211", 0.00291883f},
+	{"\321\212", 0.000403213f}, {"\321\213", 0.0148361f}, {"\321\214", 0.0143622f},
+	{"\321\215", 0.00155862f}, {"\321\216", 0.00412205f}, {"\321\217", 0.0159972f},
+	{"\321\221", 0.00109474f}
+};
+
+#define RUSSIAN_AVG_CHARACTERS (41.0140f)
+
+/* Code: non-comment lines of C headers of a Debian system, 200000 documents */
+static const QGramTableElement codeQGrams[] = {
+	{"$0", 0.07724f}, {"$0$", 0.037595f}, {"$0x", 0.038995f},
+	{"$0x0", 0.0153f}, {"$0x00", 0.00682f}, {"$0x1", 0.00589f},
+	{"$0x8", 0.00874f}, {"$1", 0.054295f}, {"$1$", 0.027945f},
+	{"$10", 0.005615f}, {"$2", 0.024155f}, {"$2$", 0.010305f},
+	{"$3", 0.02025f}, {"$3$", 0.012555f}, {"$4", 0.009525f},
+	{"$4$", 0.00532f}, {"$5", 0.007135f}, {"$6", 0.007235f},
+	{"$8", 0.006855f}, {"$8$", 0.005045f}, {"$a", 0.20066f},
+	{"$a$", 0.019815f}, {"$ab", 0.00675f}, {"$ac", 0.00837f},
+	{"$ad", 0.02233f}, {"$add", 0.01596f}, {"$add$", 0.006445f},
+	{"$addr", 0.00609f}, {"$al", 0.025155f}, {"$all", 0.012705f},
+	{"$allo", 0.00727f}, {"$an", 0.011085f}, {"$and", 0.00566f},
+	{"$and$", 0.005445f}, {"$ap", 0.01408f}, {"$api", 0.00895f},
+	{"$apie", 0.005735f}, {"$ar", 0.02424f}, {"$arg", 0.0128f},
+	{"$as", 0.06069f}, {"$asn", 0.04583f}, {"$asn1", 0.04576f},
+	{"$ass", 0.007115f}, {"$at", 0.019135f}, {"$att", 0.01207f},
+	{"$attr", 0.011255f}, {"$au", 0.007315f}, {"$aut", 0.005615f},
+	{"$b", 0.13242f}, {"$b$", 0.012975f}, {"$ba", 0.02044f},
+	{"$bas", 0.01531f}, {"$base", 0.012135f}, {"$be", 0.010575f},
+	{"$bi", 0.039185f}, {"$bio", 0.02336f}, {"$bio$", 0.023305f},
+	{"$bit", 0.010185f}, {"$bit$", 0.00503f}, {"$bl", 0.0071f},
+	{"$bo", 0.02076f}, {"$boo", 0.017845f}, {"$bool", 0.016175f},
+	{"$bu", 0.013945f}, {"$buf", 0.00882f}, {"$by", 0.009705f},
+	{"$by$", 0.005195f}, {"$c", 0.40762f}, {"$c$", 0.01516f},
+	{"$ca", 0.03139f}, {"$cal", 0.00761f}, {"$call", 0.007035f},
+	{"$car", 0.00504f}, {"$cas", 0.00731f}, {"$cb", 0.00961f},
+	{"$cb$", 0.007645f}, {"$ce", 0.02036f}, {"$cer", 0.019225f},
+	{"$cert", 0.019165f}, {"$ch", 0.117735f}, {"$cha", 0.057435f},
+	{"$char", 0.05208f}, {"$che", 0.05779f}, {"$chec", 0.05764f},
+	{"$ci", 0.0061f}, {"$cl", 0.024485f}, {"$cla", 0.012415f},
+	{"$clas", 0.01179f}, {"$cli", 0.00526f}, {"$cm", 0.030795f},
+	{"$cmp", 0.019885f}, {"$cmp$", 0.019365f}, {"$cms", 0.008815f},
+	{"$cms$", 0.008535f}, {"$co", 0.209805f}, {"$col", 0.006345f},
+	{"$com", 0.02806f}, {"$comm", 0.005705f}, {"$comp", 0.02178f},
+	{"$con", 0.16417f}, {"$conf", 0.00779f}, {"$cons", 0.14319f},
+	{"$cont", 0.010105f}, {"$cop", 0.006435f}, {"$copy", 0.006235f},
+	{"$cou", 0.005935f}, {"$coun", 0.00578f}, {"$cp", 0.00597f},
+	{"$cr", 0.024465f}, {"$cre", 0.005415f}, {"$crea", 0.005195f},
+	{"$crl", 0.00546f}, {"$cry", 0.0067f}, {"$cryp", 0.0067f},
+	{"$ct", 0.04449f}, {"$ctr", 0.012585f}, {"$ctrl", 0.012385f},
+	{"$ctx", 0.029925f}, {"$ctx$", 0.029665f}, {"$cu", 0.00771f},
+	{"$cur", 0.005775f}, {"$d", 0.33656f}, {"$da", 0.02177f},
+	{"$dat", 0.02011f}, {"$data", 0.01947f}, {"$de", 0.27769f},
+	{"$dec", 0.019215f}, {"$decl", 0.01667f}, {"$def", 0.22425f},
+	{"$defa", 0.00546f}, {"$defi", 0.218565f}, {"$del", 0.00831f},
+	{"$dele", 0.007445f}, {"$dep", 0.01168f}, {"$depr", 0.00998f},
+	{"$der", 0.01165f}, {"$der$", 0.00905f}, {"$des", 0.0069f},
+	{"$dev", 0.005165f}, {"$di", 0.018805f}, {"$dis", 0.00684f},
+	{"$do", 0.012585f}, {"$dou", 0.005915f}, {"$doub", 0.005915f},
+	{"$ds", 0.00665f}, {"$du", 0.00749f}, {"$dup", 0.005f},
+	{"$e", 0.19306f}, {"$ei", 0.01073f}, {"$eig", 0.009845f},
+	{"$eige", 0.00969f}, {"$el", 0.012305f}, {"$els", 0.006215f},
+	{"$else", 0.006205f}, {"$en", 0.05747f}, {"$enc", 0.005005f},
+	{"$end", 0.03572f}, {"$end$", 0.007445f}, {"$endi", 0.027565f},
+	{"$enu", 0.00608f}, {"$enum", 0.00604f}, {"$er", 0.02242f},
+	{"$err", 0.02171f}, {"$err$", 0.01389f}, {"$erro", 0.009345f},
+	{"$ev", 0.014005f}, {"$evp", 0.007295f}, {"$evp$", 0.00727f},
+	{"$ex", 0.063035f}, {"$ex$", 0.01092f}, {"$exp", 0.01229f},
+	{"$ext", 0.03644f}, {"$ext$", 0.00908f}, {"$exte", 0.02652f},
+	{"$f", 0.15479f}, {"$f$", 0.007525f}, {"$fa", 0.01015f},
+	{"$fi", 0.03636f}, {"$fil", 0.013155f}, {"$file", 0.01148f},
+	{"$fin", 0.011075f}, {"$find", 0.008075f}, {"$fir", 0.005255f},
+	{"$firs", 0.00517f}, {"$fl", 0.02358f}, {"$fla", 0.016215f},
+	{"$flag", 0.01595f}, {"$flo", 0.0062f}, {"$floa", 0.00549f},
+	{"$fn", 0.007215f}, {"$fn$", 0.006125f}, {"$fo", 0.019955f},
+	{"$for", 0.01736f}, {"$for$", 0.008465f}, {"$fr", 0.0216f},
+	{"$fre", 0.012885f}, {"$free", 0.012595f}, {"$fu", 0.025515f},
+	{"$fun", 0.024215f}, {"$func", 0.023935f}, {"$g", 0.11272f},
+	{"$ge", 0.0623f}, {"$gen", 0.010305f}, {"$gene", 0.00863f},
+	{"$get", 0.051695f}, {"$get$", 0.02656f}, {"$get0", 0.00615f},
+	{"$gl", 0.022765f}, {"$gl$", 0.010085f}, {"$gli", 0.007295f},
+	{"$gn", 0.00772f}, {"$gnu", 0.00595f}, {"$gr", 0.007835f},
+	{"$h", 0.06886f}, {"$h$", 0.03132f}, {"$ha", 0.01766f},
+	{"$has", 0.00872f}, {"$he", 0.00817f}, {"$i", 0.33787f},
+	{"$i$", 0.00943f}, {"$id", 0.027185f}, {"$id$", 0.01617f},
+	{"$idx", 0.008715f}, {"$idx$", 0.008495f}, {"$if", 0.041985f},
+	{"$if$", 0.020365f}, {"$ifd", 0.00674f}, {"$ifde", 0.006735f},
+	{"$ifn", 0.01381f}, {"$ifnd", 0.01375f}, {"$im", 0.010015f},
+	{"$imp", 0.00748f}, {"$impl", 0.006445f}, {"$in", 0.21889f},
+	{"$in$", 0.00919f}, {"$inc", 0.022185f}, {"$incl", 0.02049f},
+	{"$ind", 0.013275f}, {"$inde", 0.01192f}, {"$inf", 0.01252f},
+	{"$info", 0.011975f}, {"$ini", 0.007765f}, {"$init", 0.00776f},
+	{"$inl", 0.01494f}, {"$inli", 0.014605f}, {"$ins", 0.008345f},
+	{"$int", 0.138915f}, {"$int$", 0.11045f}, {"$inte", 0.024155f},
+	{"$ip", 0.00612f}, {"$is", 0.025075f}, {"$is$", 0.01381f},
+	{"$it", 0.02208f}, {"$ite", 0.016235f}, {"$item", 0.00675f},
+	{"$iter", 0.009505f}, {"$j", 0.005425f}, {"$k", 0.028925f},
+	{"$ke", 0.0172f}, {"$key", 0.01506f}, {"$key$", 0.01196f},
+	{"$l", 0.124535f}, {"$la", 0.01649f}, {"$lap", 0.00714f},
+	{"$lapa", 0.007095f}, {"$le", 0.01951f}, {"$len", 0.012315f},
+	{"$len$", 0.00799f}, {"$lh", 0.009325f}, {"$li", 0.027925f},
+	{"$lib", 0.00987f}, {"$lib$", 0.007435f}, {"$lin", 0.007645f},
+	{"$lis", 0.005425f}, {"$list", 0.005405f}, {"$ll", 0.015465f},
+	{"$llv", 0.014825f}, {"$llvm", 0.01482f}, {"$lo", 0.03542f},
+	{"$loc", 0.00802f}, {"$lon", 0.013055f}, {"$long", 0.013055f},
+	{"$loo", 0.00569f}, {"$m", 0.135835f}, {"$m$", 0.01621f},
+	{"$ma", 0.04039f}, {"$mac", 0.00594f}, {"$mat", 0.007145f},
+	{"$max", 0.00947f}, {"$max$", 0.007595f}, {"$mc", 0.006625f},
+	{"$md", 0.00539f}, {"$me", 0.02144f}, {"$mem", 0.00639f},
+	{"$met", 0.010095f}, {"$meth", 0.008645f}, {"$mi", 0.0088f},
+	{"$mo", 0.016155f}, {"$mod", 0.011455f}, {"$modu", 0.005555f},
+	{"$mp", 0.012915f}, {"$mpi", 0.006685f}, {"$mpi$", 0.00657f},
+	{"$ms", 0.00658f}, {"$mu", 0.00592f}, {"$n", 0.15238f},
+	{"$n$", 0.015005f}, {"$na", 0.033505f}, {"$nam", 0.03182f},
+	{"$name", 0.03134f}, {"$ne", 0.024115f}, {"$new", 0.014935f},
+	{"$new$", 0.01277f}, {"$ni", 0.006175f}, {"$nid", 0.005225f},
+	{"$nid$", 0.00511f}, {"$no", 0.03627f}, {"$no$", 0.01312f},
+	{"$nod", 0.00708f}, {"$node", 0.006545f}, {"$not", 0.006925f},
+	{"$nu", 0.028605f}, {"$nul", 0.013935f}, {"$null", 0.013865f},
+	{"$num", 0.01476f}, {"$num$", 0.00732f}, {"$o", 0.247275f},
+	{"$ob", 0.01865f}, {"$obj", 0.01774f}, {"$obj$", 0.00707f},
+	{"$obje", 0.010835f}, {"$oc", 0.012265f}, {"$ocs", 0.009525f},
+	{"$ocsp", 0.009525f}, {"$of", 0.039575f}, {"$of$", 0.0348f},
+	{"$oi", 0.009025f}, {"$oid", 0.008865f}, {"$oid$", 0.00881f},
+	{"$om", 0.00647f}, {"$omp", 0.006215f}, {"$ompi", 0.006005f},
+	{"$on", 0.009315f}, {"$op", 0.11355f}, {"$op$", 0.007695f},
+	{"$opa", 0.008315f}, {"$opal", 0.00813f}, {"$ope", 0.0878f},
+	{"$open", 0.08025f}, {"$oper", 0.007545f}, {"$opt", 0.00857f},
+	{"$opti", 0.006655f}, {"$or", 0.01306f}, {"$os", 0.085025f},
+	{"$oss", 0.07821f}, {"$ossl", 0.078195f}, {"$ot", 0.00544f},
+	{"$oth", 0.0053f}, {"$othe", 0.0053f}, {"$ou", 0.011205f},
+	{"$out", 0.01117f}, {"$out$", 0.00647f}, {"$ow", 0.00901f},
+	{"$owu", 0.00834f}, {"$owur", 0.00834f}, {"$p", 0.20564f},
+	{"$p$", 0.00956f}, {"$pa", 0.035765f}, {"$pac", 0.007085f},
+	{"$pack", 0.007035f}, {"$par", 0.014915f}, {"$para", 0.009f},
+	{"$pe", 0.010615f}, {"$pk", 0.023735f}, {"$pkc", 0.01452f},
+	{"$pkcs", 0.01452f}, {"$pke", 0.005275f}, {"$pkey", 0.005275f},
+	{"$pn", 0.006125f}, {"$po", 0.024155f}, {"$poi", 0.00615f},
+	{"$poin", 0.006015f}, {"$pol", 0.006415f}, {"$poli", 0.00581f},
+	{"$pop", 0.00531f}, {"$pr", 0.04729f}, {"$pre", 0.00903f},
+	{"$pri", 0.012265f}, {"$pro", 0.02229f}, {"$prot", 0.007665f},
+	{"$ps", 0.007175f}, {"$pt", 0.02707f}, {"$ptr", 0.02576f},
+	{"$ptr$", 0.024365f}, {"$pu", 0.017065f}, {"$pub", 0.00963f},
+	{"$publ", 0.007515f}, {"$q", 0.005485f}, {"$r", 0.151205f},
+	{"$r$", 0.010035f}, {"$ra", 0.01068f}, {"$ran", 0.00557f},
+	{"$re", 0.11045f}, {"$rea", 0.009675f}, {"$read", 0.00533f},
+	{"$rec", 0.00815f}, {"$req", 0.010305f}, {"$requ", 0.005795f},
+	{"$res", 0.020495f}, {"$rese", 0.007445f}, {"$resu", 0.00516f},
+	{"$ret", 0.0398f}, {"$retu", 0.036485f}, {"$ro", 0.005715f},
+	{"$s", 0.3858f}, {"$s$", 0.018115f}, {"$sa", 0.009335f},
+	{"$sc", 0.016895f}, {"$sca", 0.006235f}, {"$scal", 0.005435f},
+	{"$se", 0.071995f}, {"$sec", 0.008095f}, {"$ser", 0.005045f},
+	{"$ses", 0.00575f}, {"$sess", 0.00554f}, {"$set", 0.04054f},
+	{"$set$", 0.02996f}, {"$sh", 0.0212f}, {"$sha", 0.008165f},
+	{"$si", 0.04762f}, {"$sig", 0.012515f}, {"$sign", 0.010295f},
+	{"$siz", 0.02825f}, {"$size", 0.02825f}, {"$sk", 0.058565f},
+	{"$sk$", 0.05554f}, {"$so", 0.01467f}, {"$sor", 0.00524f},
+	{"$sort", 0.00521f}, {"$sp", 0.008525f}, {"$sr", 0.01173f},
+	{"$ss", 0.046535f}, {"$ssl", 0.04392f}, {"$ssl$", 0.04302f},
+	{"$st", 0.14059f}, {"$st$", 0.008405f}, {"$sta", 0.05148f},
+	{"$stac", 0.022335f}, {"$stat", 0.02545f}, {"$std", 0.017775f},
+	{"$std$", 0.015715f}, {"$sto", 0.011185f}, {"$stor", 0.01073f},
+	{"$str", 0.06129f}, {"$stri", 0.024465f}, {"$stru", 0.02761f},
+	{"$su", 0.01459f}, {"$sub", 0.00613f}, {"$sy", 0.009695f},
+	{"$sz", 0.006255f}, {"$sz$", 0.00621f}, {"$t", 0.306085f},
+	{"$t$", 0.06008f}, {"$ta", 0.01536f}, {"$tar", 0.006195f},
+	{"$targ", 0.00617f}, {"$tc", 0.021575f}, {"$tcl", 0.01978f},
+	{"$tcl$", 0.016295f}, {"$te", 0.026945f}, {"$tem", 0.01854f},
+	{"$temp", 0.01854f}, {"$th", 0.02789f}, {"$the", 0.01428f},
+	{"$the$", 0.01321f}, {"$thi", 0.00866f}, {"$this", 0.008405f},
+	{"$thr", 0.00522f}, {"$ti", 0.010465f}, {"$tim", 0.00793f},
+	{"$time", 0.007535f}, {"$tk", 0.009365f}, {"$tk$", 0.006175f},
+	{"$tl", 0.006825f}, {"$tls", 0.00626f}, {"$to", 0.016715f},
+	{"$to$", 0.012605f}, {"$tp", 0.00594f}, {"$tp$", 0.0053f},
+	{"$tr", 0.018015f}, {"$tra", 0.00832f}, {"$tru", 0.006025f},
+	{"$ty", 0.12685f}, {"$typ", 0.126265f}, {"$type", 0.12619f},
+	{"$u", 0.121515f}, {"$u$", 0.00686f}, {"$ui", 0.018835f},
+	{"$uin", 0.014105f}, {"$uint", 0.014085f}, {"$un", 0.055945f},
+	{"$uni", 0.00708f}, {"$uns", 0.035005f}, {"$unsi", 0.03128f},
+	{"$us", 0.01944f}, {"$use", 0.0118f}, {"$use$", 0.005355f},
+	{"$usi", 0.005435f}, {"$usin", 0.00543f}, {"$v", 0.142075f},
+	{"$v$", 0.012755f}, {"$va", 0.034125f}, {"$val", 0.030405f},
+	{"$valu", 0.024375f}, {"$ve", 0.021155f}, {"$ver", 0.015745f},
+	{"$veri", 0.00669f}, {"$vers", 0.007265f}, {"$vi", 0.00751f},
+	{"$vo", 0.064225f}, {"$voi", 0.06357f}, {"$void", 0.06354f},
+	{"$w", 0.039935f}, {"$wa", 0.005525f}, {"$wi", 0.01573f},
+	{"$win", 0.00546f}, {"$wit", 0.00635f}, {"$with", 0.00635f},
+	{"$wr", 0.006935f}, {"$wri", 0.005375f}, {"$writ", 0.005375f},
+	{"$x", 0.095155f}, {"$x$", 0.018f}, {"$x5", 0.056f},
+	{"$x50", 0.05596f}, {"$x509", 0.05593f}, {"$xm", 0.00576f},
+	{"$xml", 0.005505f}, {"$y", 0.00725f}, {"$z", 0.00939f},
+	{"0$", 0.07301f}, {"00", 0.01651f}, {"00$", 0.00818f},
+	{"000", 0.00861f}, {"0000", 0.00533f}, {"01", 0.0073f},
+	{"02", 0.00609f}, {"09", 0.057315f}, {"09$", 0.05149f},
+	{"09v", 0.005755f}, {"09v3", 0.005755f}, {"09v3$", 0.00572f},
+	{"0x", 0.03918f}, {"0x0", 0.0153f}, {"0x00", 0.00682f},
+	{"0x1", 0.005915f}, {"0x8", 0.00874f}, {"1$", 0.10795f},
+	{"10", 0.011965f}, {"11", 0.007905f}, {"11$", 0.005485f},
+	{"12", 0.01482f}, {"12$", 0.008615f}, {"16", 0.01249f},
+	{"16$", 0.010255f}, {"2$", 0.06188f}, {"20", 0.00749f},
+	{"25", 0.006035f}, {"28", 0.00518f}, {"2d", 0.00503f},
+	{"3$", 0.034735f}, {"32", 0.020875f}, {"32$", 0.019525f},
+	{"4$", 0.032585f}, {"5$", 0.01384f}, {"50", 0.05755f},
+	{"509", 0.056255f}, {"509$", 0.050925f}, {"509v", 0.005755f},
+	{"509v3", 0.005755f}, {"6$", 0.02652f}, {"64", 0.01527f},
+	{"64$", 0.014105f}, {"7$", 0.016215f}, {"8$", 0.027865f},
+	{"86", 0.006055f}, {"9$", 0.059425f}, {"9v", 0.00657f},
+	{"9v3", 0.005945f}, {"9v3$", 0.00591f}, {"a$", 0.07105f},
+	{"ab", 0.027345f}, {"abl", 0.017395f}, {"able", 0.017335f},
+	{"able$", 0.013655f}, {"abs", 0.005125f}, {"ac", 0.092855f},
+	{"acc", 0.006585f}, {"acce", 0.005555f}, {"ace", 0.01576f},
+	{"ace$", 0.013365f}, {"ach", 0.009205f}, {"ack", 0.048075f},
+	{"ack$", 0.03692f}, {"acke", 0.009055f}, {"acket", 0.00654f},
+	{"act", 0.0073f}, {"ad", 0.057895f}, {"ad$", 0.01543f},
+	{"add", 0.02285f}, {"add$", 0.007295f}, {"addr", 0.010115f},
+	{"af", 0.007785f}, {"ag", 0.04655f}, {"ag$", 0.016125f},
+	{"age", 0.012625f}, {"age$", 0.008055f}, {"ags", 0.01231f},
+	{"ags$", 0.012055f}, {"ai", 0.031275f}, {"ail", 0.008265f},
+	{"ain", 0.01072f}, {"ain$", 0.00613f}, {"ait", 0.00736f},
+	{"aits", 0.0051f}, {"ak", 0.006825f}, {"al", 0.15622f},
+	{"al$", 0.05378f}, {"ala", 0.007245f}, {"alar", 0.00636f},
+	{"alar$", 0.005315f}, {"alg", 0.006205f}, {"ali", 0.016625f},
+	{"aliz", 0.00525f}, {"all", 0.033865f}, {"all$", 0.01107f},
+	{"allb", 0.00525f}, {"allba", 0.005125f}, {"allo", 0.010815f},
+	{"alloc", 0.00926f}, {"als", 0.0076f}, {"alu", 0.030125f},
+	{"alue", 0.028865f}, {"alue$", 0.025175f}, {"am", 0.09317f},
+	{"am$", 0.0129f}, {"ame", 0.07029f}, {"ame$", 0.05401f},
+	{"ames", 0.011445f}, {"amesp", 0.00877f}, {"an", 0.063805f},
+	{"an$", 0.008685f}, {"and", 0.019595f}, {"and$", 0.00871f},
+	{"andl", 0.00511f}, {"ang", 0.01047f}, {"ange", 0.00825f},
+	{"ange$", 0.006235f}, {"ans", 0.00516f}, {"ant", 0.00595f},
+	{"ap", 0.046535f}, {"ap$", 0.01014f}, {"apa", 0.008465f},
+	{"apac", 0.007915f}, {"apack", 0.007115f}, {"api", 0.012795f},
+	{"api$", 0.007865f}, {"apie", 0.006235f}, {"apien", 0.006225f},
+	{"app", 0.008415f}, {"ar", 0.15869f}, {"ar$", 0.06363f},
+	{"ara", 0.01327f}, {"aram", 0.009655f}, {"aram$", 0.00554f},
+	{"ard", 0.010035f}, {"are", 0.02008f}, {"are$", 0.01333f},
+	{"arg", 0.021715f}, {"arg$", 0.005395f}, {"arge", 0.007315f},
+	{"arget", 0.00678f}, {"arr", 0.00755f}, {"arra", 0.006225f},
+	{"array", 0.00562f}, {"ars", 0.00534f}, {"art", 0.00915f},
+	{"art$", 0.00548f}, {"ary", 0.00563f}, {"as", 0.13952f},
+	{"as$", 0.008055f}, {"ase", 0.02082f}, {"ase$", 0.01802f},
+	{"ash", 0.008735f}, {"ash$", 0.00649f}, {"asi", 0.00678f},
+	{"ask", 0.00641f}, {"ask$", 0.00568f}, {"asn", 0.046105f},
+	{"asn1", 0.045775f}, {"asn1$", 0.045405f}, {"ass", 0.026755f},
+	{"ass$", 0.01511f}, {"asse", 0.00558f}, {"ast", 0.014155f},
+	{"ast$", 0.00976f}, {"at", 0.1937f}, {"at$", 0.016985f},
+	{"ata", 0.027205f}, {"ata$", 0.020445f}, {"atc", 0.005775f},
+	{"ate", 0.06053f}, {"ate$", 0.03678f}, {"ated", 0.014205f},
+	{"ated$", 0.008065f}, {"ath", 0.005195f}, {"ati", 0.03405f},
+	{"atic", 0.015165f}, {"atic$", 0.01484f}, {"atio", 0.014865f},
+	{"ation", 0.0147f}, {"ato", 0.026875f}, {"ator", 0.022115f},
+	{"ator$", 0.02019f}, {"att", 0.01712f}, {"attr", 0.013335f},
+	{"attr$", 0.007245f}, {"attri", 0.006825f}, {"atu", 0.01056f},
+	{"atus", 0.007075f}, {"atus$", 0.0068f}, {"au", 0.01594f},
+	{"aul", 0.006355f}, {"ault", 0.006325f}, {"ault$", 0.0055f},
+	{"aut", 0.006325f}, {"av", 0.00969f}, {"ave", 0.005075f},
+	{"ax", 0.01236f}, {"ax$", 0.008985f}, {"ay", 0.01426f},
+	{"ay$", 0.007945f}, {"b$", 0.047335f}, {"ba", 0.03572f},
+	{"bac", 0.00779f}, {"back", 0.007725f}, {"back$", 0.005675f},
+	{"bas", 0.01912f}, {"base", 0.01543f}, {"base$", 0.01388f},
+	{"bc", 0.009655f}, {"be", 0.022315f}, {"ber", 0.006205f},
+	{"bi", 0.049f}, {"bin", 0.005425f}, {"bio", 0.023655f},
+	{"bio$", 0.023585f}, {"bit", 0.01307f}, {"bit$", 0.00582f},
+	{"bj", 0.023995f}, {"bj$", 0.008315f}, {"bje", 0.01539f},
+	{"bjec", 0.01528f}, {"bject", 0.01528f}, {"bl", 0.04522f},
+	{"ble", 0.026375f}, {"ble$", 0.02122f}, {"bli", 0.00867f},
+	{"blic", 0.008f}, {"blic$", 0.00737f}, {"blo", 0.007805f},
+	{"bloc", 0.007595f}, {"block", 0.00758f}, {"bo", 0.028585f},
+	{"boo", 0.019535f}, {"bool", 0.017825f}, {"bool$", 0.016315f},
+	{"br", 0.00694f}, {"bs", 0.01504f}, {"bu", 0.033085f},
+	{"buf", 0.01572f}, {"buf$", 0.00866f}, {"buff", 0.00668f},
+	{"buffe", 0.00653f}, {"but", 0.008235f}, {"bute", 0.006555f},
+	{"bute$", 0.005f}, {"by", 0.012f}, {"by$", 0.00536f},
+	{"byt", 0.005905f}, {"byte", 0.00588f}, {"c$", 0.12902f},
+	{"ca", 0.082975f}, {"ca$", 0.006185f}, {"cal", 0.025465f},
+	{"cala", 0.006255f}, {"calar", 0.00607f}, {"call", 0.011805f},
+	{"car", 0.00622f}, {"card", 0.005465f}, {"cas", 0.00967f},
+	{"cast", 0.006135f}, {"cast$", 0.00566f}, {"cat", 0.02416f},
+	{"cate", 0.01538f}, {"cated", 0.01092f}, {"cati", 0.00518f},
+	{"catio", 0.005085f}, {"cb", 0.013795f}, {"cb$", 0.009825f},
+	{"cc", 0.012515f}, {"cce", 0.00701f}, {"ce", 0.08288f},
+	{"ce$", 0.0356f}, {"cep", 0.006525f}, {"cept", 0.006025f},
+	{"cer", 0.021245f}, {"cert", 0.02035f}, {"cert$", 0.01078f},
+	{"ces", 0.009195f}, {"cess", 0.00676f}, {"ch", 0.147245f},
+	{"ch$", 0.009f}, {"cha", 0.06354f}, {"char", 0.055505f},
+	{"char$", 0.05197f}, {"che", 0.065085f}, {"chec", 0.058735f},
+	{"check", 0.058725f}, {"ci", 0.02012f}, {"cip", 0.008895f},
+	{"ck", 0.11876f}, {"ck$", 0.095515f}, {"cke", 0.014645f},
+	{"cket", 0.009425f}, {"cket$", 0.00535f}, {"cl", 0.08504f},
+	{"cl$", 0.01841f}, {"cla", 0.022605f}, {"clar", 0.00862f},
+	{"clare", 0.00826f}, {"clas", 0.01318f}, {"class", 0.013155f},
+	{"cle", 0.00528f}, {"cli", 0.00646f}, {"clie", 0.005155f},
+	{"clien", 0.005155f}, {"cls", 0.009435f}, {"clsp", 0.006295f},
+	{"clspe", 0.006255f}, {"clu", 0.02109f}, {"clud", 0.020595f},
+	{"clude", 0.02034f}, {"cm", 0.03509f}, {"cmp", 0.021045f},
+	{"cmp$", 0.020175f}, {"cms", 0.00912f}, {"cms$", 0.008535f},
+	{"co", 0.23895f}, {"cod", 0.013495f}, {"code", 0.012305f},
+	{"code$", 0.00765f}, {"col", 0.00894f}, {"com", 0.03247f},
+	{"comm", 0.00673f}, {"comp", 0.02468f}, {"compf", 0.006745f},
+	{"con", 0.172755f}, {"conf", 0.00916f}, {"conf$", 0.006165f},
+	{"cons", 0.144565f}, {"const", 0.14363f}, {"cont", 0.01307f},
+	{"conte", 0.008475f}, {"cop", 0.011145f}, {"copy", 0.006985f},
+	{"copy$", 0.005045f}, {"cou", 0.00789f}, {"coun", 0.00768f},
+	{"count", 0.00768f}, {"cp", 0.01079f}, {"cr", 0.042315f},
+	{"cre", 0.00987f}, {"crea", 0.00633f}, {"creat", 0.006155f},
+	{"cri", 0.00589f}, {"crl", 0.00569f}, {"crl$", 0.00513f},
+	{"cry", 0.011915f}, {"cryp", 0.01153f}, {"crypt", 0.01153f},
+	{"cs", 0.03266f}, {"cs1", 0.005255f}, {"cs7", 0.007965f},
+	{"cs7$", 0.00785f}, {"csp", 0.009705f}, {"csp$", 0.009505f},
+	{"ct", 0.14323f}, {"ct$", 0.0526f}, {"cte", 0.006585f},
+	{"cti", 0.026435f}, {"ctio", 0.02382f}, {"ction", 0.023815f},
+	{"cto", 0.010435f}, {"ctor", 0.010125f}, {"ctor$", 0.00625f},
+	{"ctr", 0.01363f}, {"ctrl", 0.012615f}, {"ctrl$", 0.012555f},
+	{"ctx", 0.03161f}, {"ctx$", 0.031225f}, {"cu", 0.01795f},
+	{"cur", 0.011035f}, {"cx", 0.00617f}, {"cxx", 0.005165f},
+	{"cy", 0.00927f}, {"cy$", 0.006215f}, {"d$", 0.28127f},
+	{"da", 0.038715f}, {"dat", 0.031285f}, {"data", 0.025895f},
+	{"data$", 0.020415f}, {"db", 0.00688f}, {"dc", 0.00532f},
+	{"dd", 0.025925f}, {"dd$", 0.007525f}, {"ddr", 0.01013f},
+	{"de", 0.393805f}, {"de$", 0.044805f}, {"dec", 0.02077f},
+	{"decl", 0.017205f}, {"decla", 0.008605f}, {"decls", 0.00712f},
+	{"def", 0.27485f}, {"def$", 0.051225f}, {"defa", 0.00616f},
+	{"defau", 0.006125f}, {"defi", 0.21941f}, {"defin", 0.219335f},
+	{"del", 0.009975f}, {"dele", 0.008205f}, {"delet", 0.007745f},
+	{"den", 0.006285f}, {"dep", 0.01282f}, {"depr", 0.010105f},
+	{"depre", 0.01005f}, {"der", 0.02656f}, {"der$", 0.01899f},
+	{"des", 0.01204f}, {"dev", 0.00692f}, {"devi", 0.005135f},
+	{"dex", 0.01473f}, {"dex$", 0.01254f}, {"di", 0.07639f},
+	{"dif", 0.030245f}, {"dif$", 0.026885f}, {"din", 0.01246f},
+	{"dis", 0.008775f}, {"dl", 0.01115f}, {"dle", 0.006175f},
+	{"do", 0.02456f}, {"dou", 0.00695f}, {"doub", 0.00665f},
+	{"doubl", 0.006645f}, {"dow", 0.005965f}, {"dp", 0.00543f},
+	{"dr", 0.017415f}, {"dr$", 0.00608f}, {"dre", 0.006805f},
+	{"dres", 0.005055f}, {"ds", 0.01779f}, {"ds$", 0.005615f},
+	{"dt", 0.010715f}, {"du", 0.018185f}, {"dul", 0.00682f},
+	{"dule", 0.006575f}, {"dule$", 0.005555f}, {"dup", 0.005545f},
+	{"dx", 0.010385f}, {"dx$", 0.009935f}, {"e$", 0.548945f},
+	{"ea", 0.05292f}, {"ead", 0.016405f}, {"ead$", 0.008665f},
+	{"ear", 0.006525f}, {"eat", 0.00865f}, {"eate", 0.006955f},
+	{"eb", 0.01181f}, {"ec", 0.1563f}, {"ec$", 0.016415f},
+	{"eca", 0.01107f}, {"ecat", 0.01003f}, {"ecate", 0.01f},
+	{"eci", 0.00716f}, {"eck", 0.05957f}, {"eck$", 0.05659f},
+	{"ecl", 0.01771f}, {"ecla", 0.008805f}, {"eclar", 0.008605f},
+	{"ecls", 0.00712f}, {"eclsp", 0.00625f}, {"eco", 0.008485f},
+	{"ect", 0.037705f}, {"ect$", 0.017955f}, {"ecti", 0.00606f},
+	{"ectio", 0.005485f}, {"ecto", 0.00769f}, {"ector", 0.007625f},
+	{"ed", 0.144135f}, {"ed$", 0.09498f}, {"ede", 0.028995f},
+	{"edef", 0.026255f}, {"edef$", 0.025575f}, {"edi", 0.00892f},
+	{"edin", 0.00536f}, {"ee", 0.03066f}, {"ee$", 0.014375f},
+	{"eef", 0.00514f}, {"ef", 0.293845f}, {"ef$", 0.060155f},
+	{"efa", 0.006325f}, {"efau", 0.006135f}, {"efaul", 0.00613f},
+	{"efi", 0.22151f}, {"efin", 0.21949f}, {"efine", 0.21909f},
+	{"efu", 0.005675f}, {"efun", 0.0052f}, {"efunc", 0.005195f},
+	{"eg", 0.026055f}, {"ege", 0.00709f}, {"egi", 0.00853f},
+	{"ei", 0.02484f}, {"eig", 0.01183f}, {"eige", 0.00975f},
+	{"eigen", 0.00975f}, {"ein", 0.00732f}, {"el", 0.05592f},
+	{"el$", 0.009525f}, {"eld", 0.006565f}, {"ele", 0.01693f},
+	{"elet", 0.007925f}, {"elete", 0.007805f}, {"els", 0.00713f},
+	{"else", 0.00627f}, {"else$", 0.00615f}, {"em", 0.064135f},
+	{"em$", 0.018845f}, {"eme", 0.007605f}, {"emen", 0.00649f},
+	{"ement", 0.00639f}, {"emo", 0.00633f}, {"emp", 0.021825f},
+	{"empl", 0.0188f}, {"empla", 0.01878f}, {"en", 0.271525f},
+	{"en$", 0.03377f}, {"ena", 0.02549f}, {"enam", 0.02095f},
+	{"ename", 0.020945f}, {"enc", 0.015805f}, {"ence", 0.006755f},
+	{"ence$", 0.005285f}, {"end", 0.04614f}, {"end$", 0.012685f},
+	{"endi", 0.02871f}, {"endif", 0.026795f}, {"ene", 0.01117f},
+	{"ener", 0.009485f}, {"enera", 0.008115f}, {"eng", 0.007445f},
+	{"engt", 0.005595f}, {"ength", 0.005595f}, {"ens", 0.0898f},
+	{"ensi", 0.00669f}, {"ensio", 0.006545f}, {"enss", 0.078215f},
+	{"enssl", 0.07821f}, {"ent", 0.05267f}, {"ent$", 0.022585f},
+	{"enti", 0.007705f}, {"entr", 0.012115f}, {"entry", 0.01136f},
+	{"enu", 0.010925f}, {"enum", 0.010015f}, {"enum$", 0.00842f},
+	{"eo", 0.011805f}, {"eof", 0.00568f}, {"ep", 0.03677f},
+	{"epr", 0.01245f}, {"epre", 0.010495f}, {"eprec", 0.010045f},
+	{"ept", 0.00958f}, {"eq", 0.023105f}, {"eq$", 0.009545f},
+	{"equ", 0.01293f}, {"eque", 0.00908f}, {"er", 0.26452f},
+	{"er$", 0.08805f}, {"era", 0.030355f}, {"eral", 0.006735f},
+	{"erat", 0.020355f}, {"erato", 0.017215f}, {"ere", 0.01165f},
+	{"eri", 0.020865f}, {"erif", 0.0071f}, {"erify", 0.006405f},
+	{"ern", 0.038615f}, {"ern$", 0.02139f}, {"erna", 0.014805f},
+	{"ernal", 0.01377f}, {"erp", 0.00777f}, {"err", 0.03084f},
+	{"err$", 0.016045f}, {"erro", 0.01237f}, {"error", 0.012345f},
+	{"ers", 0.01681f}, {"ersi", 0.0087f}, {"ersio", 0.00793f},
+	{"ert", 0.03554f}, {"ert$", 0.01996f}, {"erti", 0.005595f},
+	{"erv", 0.012245f}, {"erve", 0.01021f}, {"es", 0.12338f},
+	{"es$", 0.033785f}, {"esc", 0.005875f}, {"ese", 0.010885f},
+	{"eser", 0.007315f}, {"eserv", 0.007185f}, {"esp", 0.015675f},
+	{"espa", 0.00912f}, {"espac", 0.008955f}, {"ess", 0.0314f},
+	{"ess$", 0.013365f}, {"essi", 0.00769f}, {"essio", 0.0069f},
+	{"est", 0.02028f}, {"est$", 0.010075f}, {"esu", 0.006805f},
+	{"esul", 0.005955f}, {"esult", 0.005955f}, {"et", 0.19218f},
+	{"et$", 0.081405f}, {"et0", 0.00817f}, {"et0$", 0.00817f},
+	{"et1", 0.005425f}, {"eta", 0.00825f}, {"ete", 0.013935f},
+	{"ete$", 0.00718f}, {"eth", 0.01088f}, {"etho", 0.00868f},
+	{"ethod", 0.00861f}, {"ets", 0.00612f}, {"etu", 0.03857f},
+	{"etur", 0.03753f}, {"eturn", 0.03753f}, {"ev", 0.03371f},
+	{"eve", 0.00948f}, {"evi", 0.0058f}, {"evp", 0.007395f},
+	{"evp$", 0.00727f}, {"ew", 0.01961f}, {"ew$", 0.014815f},
+	{"ex", 0.11017f}, {"ex$", 0.02877f}, {"exc", 0.005245f},
+	{"exp", 0.020355f}, {"expo", 0.005545f}, {"expor", 0.00514f},
+	{"expr", 0.008005f}, {"expr$", 0.006585f}, {"ext", 0.05312f},
+	{"ext$", 0.020595f}, {"exte", 0.027475f}, {"exten", 0.00634f},
+	{"exter", 0.02112f}, {"ey", 0.02503f}, {"ey$", 0.020515f},
+	{"f$", 0.185465f}, {"fa", 0.02126f}, {"fau", 0.006345f},
+	{"faul", 0.00632f}, {"fault", 0.00632f}, {"fd", 0.010325f},
+	{"fde", 0.006995f}, {"fdef", 0.006775f}, {"fdef$", 0.006735f},
+	{"fe", 0.020625f}, {"fer", 0.010525f}, {"fer$", 0.005535f},
+	{"ff", 0.022095f}, {"ffe", 0.007865f}, {"ffer", 0.00752f},
+	{"ffer$", 0.00514f}, {"ffs", 0.00557f}, {"ffse", 0.005145f},
+	{"ffset", 0.00513f}, {"fi", 0.260525f}, {"fie", 0.009865f},
+	{"fiel", 0.00634f}, {"field", 0.00634f}, {"fil", 0.01747f},
+	{"file", 0.01516f}, {"file$", 0.011785f}, {"fin", 0.224975f},
+	{"find", 0.008325f}, {"find$", 0.00754f}, {"fine", 0.21917f},
+	{"fine$", 0.21308f}, {"fined", 0.006205f}, {"fir", 0.00588f},
+	{"firs", 0.00559f}, {"first", 0.00559f}, {"fl", 0.034315f},
+	{"fla", 0.020665f}, {"flag", 0.01933f}, {"flag$", 0.007855f},
+	{"flags", 0.01164f}, {"flo", 0.008555f}, {"floa", 0.007275f},
+	{"float", 0.00719f}, {"fn", 0.0258f}, {"fn$", 0.00688f},
+	{"fnd", 0.01375f}, {"fnde", 0.01375f}, {"fndef", 0.01375f},
+	{"fo", 0.05832f}, {"fo$", 0.02697f}, {"for", 0.02649f},
+	{"for$", 0.00858f}, {"form", 0.010815f}, {"forma", 0.005935f},
+	{"fp", 0.005465f}, {"fr", 0.027145f}, {"fre", 0.014955f},
+	{"free", 0.013345f}, {"free$", 0.00929f}, {"fro", 0.00677f},
+	{"from", 0.006185f}, {"fs", 0.010355f}, {"fse", 0.00542f},
+	{"fset", 0.00517f}, {"ft", 0.013305f}, {"ft$", 0.00876f},
+	{"fu", 0.040035f}, {"fun", 0.03779f}, {"func", 0.03652f},
+	{"func$", 0.021135f}, {"funct", 0.014835f}, {"fy", 0.00892f},
+	{"fy$", 0.008115f}, {"g$", 0.11159f}, {"ga", 0.007f},
+	{"gc", 0.006475f}, {"ge", 0.115215f}, {"ge$", 0.016035f},
+	{"gen", 0.022955f}, {"gen$", 0.01227f}, {"gene", 0.00923f},
+	{"gener", 0.00915f}, {"ger", 0.007015f}, {"ger$", 0.006005f},
+	{"get", 0.06288f}, {"get$", 0.03212f}, {"get0", 0.006155f},
+	{"get0$", 0.006155f}, {"gh", 0.00575f}, {"gi", 0.017485f},
+	{"gin", 0.008465f}, {"gl", 0.029945f}, {"gl$", 0.011035f},
+	{"gle", 0.007515f}, {"gli", 0.00794f}, {"gm", 0.006245f},
+	{"gn", 0.058155f}, {"gn$", 0.00608f}, {"gne", 0.03779f},
+	{"gned", 0.03453f}, {"gned$", 0.034005f}, {"gnu", 0.00809f},
+	{"go", 0.01135f}, {"gr", 0.018535f}, {"gra", 0.00619f},
+	{"gs", 0.02355f}, {"gs$", 0.021075f}, {"gt", 0.009845f},
+	{"gth", 0.00604f}, {"gth$", 0.00537f}, {"h$", 0.07977f},
+	{"ha", 0.09892f}, {"han", 0.010625f}, {"hand", 0.0055f},
+	{"har", 0.05776f}, {"har$", 0.051975f}, {"has", 0.013105f},
+	{"hash", 0.00828f}, {"hash$", 0.00624f}, {"he", 0.10254f},
+	{"he$", 0.01667f}, {"hec", 0.058785f}, {"heck", 0.058725f},
+	{"heck$", 0.056565f}, {"her", 0.01491f}, {"her$", 0.010435f},
+	{"hi", 0.026135f}, {"hif", 0.005405f}, {"hift", 0.005405f},
+	{"hift$", 0.00519f}, {"his", 0.00863f}, {"his$", 0.00817f},
+	{"hm", 0.010055f}, {"hme", 0.007255f}, {"hmem", 0.006695f},
+	{"hmem$", 0.00654f}, {"ho", 0.0229f}, {"hod", 0.008625f},
+	{"hod$", 0.00789f}, {"hr", 0.01073f}, {"hre", 0.005925f},
+	{"hrea", 0.00506f}, {"hread", 0.00505f}, {"hs", 0.010015f},
+	{"hs$", 0.00693f}, {"ht", 0.008475f}, {"i$", 0.053965f},
+	{"i2", 0.00522f}, {"ia", 0.017965f}, {"ial", 0.00757f},
+	{"ib", 0.02804f}, {"ib$", 0.009215f}, {"ibc", 0.00707f},
+	{"ibu", 0.007185f}, {"ibut", 0.00706f}, {"ibute", 0.006555f},
+	{"ic", 0.07641f}, {"ic$", 0.03346f}, {"ica", 0.009255f},
+	{"icat", 0.00527f}, {"ice", 0.01186f}, {"ice$", 0.00724f},
+	{"icy", 0.00694f}, {"icy$", 0.005165f}, {"id", 0.12733f},
+	{"id$", 0.102545f}, {"ide", 0.01129f}, {"ide$", 0.00566f},
+	{"idx", 0.00975f}, {"idx$", 0.00947f}, {"ie", 0.03704f},
+	{"iel", 0.0065f}, {"ield", 0.00645f}, {"ien", 0.016845f},
+	{"ient", 0.014535f}, {"ientr", 0.00629f}, {"if", 0.096575f},
+	{"if$", 0.04915f}, {"ifd", 0.006745f}, {"ifde", 0.00674f},
+	{"ifdef", 0.006735f}, {"ifi", 0.00708f}, {"ifn", 0.013985f},
+	{"ifnd", 0.01375f}, {"ifnde", 0.01375f}, {"ift", 0.00556f},
+	{"ift$", 0.005215f}, {"ify", 0.00843f}, {"ify$", 0.007775f},
+	{"ig", 0.073975f}, {"ige", 0.012035f}, {"igen", 0.00984f},
+	{"igen$", 0.00953f}, {"ign", 0.04939f}, {"igne", 0.037775f},
+	{"igned", 0.03453f}, {"il", 0.04303f}, {"ile", 0.0207f},
+	{"ile$", 0.01401f}, {"im", 0.03857f}, {"ime", 0.01526f},
+	{"ime$", 0.008875f}, {"imp", 0.011155f}, {"impl", 0.00975f},
+	{"impl$", 0.005765f}, {"in", 0.520585f}, {"in$", 0.032285f},
+	{"ina", 0.006035f}, {"inc", 0.023375f}, {"incl", 0.02059f},
+	{"inclu", 0.02046f}, {"ind", 0.03396f}, {"ind$", 0.01087f},
+	{"inde", 0.01553f}, {"index", 0.013955f}, {"ine", 0.24646f},
+	{"ine$", 0.233695f}, {"ined", 0.00683f}, {"ined$", 0.006435f},
+	{"inf", 0.030205f}, {"info", 0.02916f}, {"info$", 0.026775f},
+	{"ing", 0.0593f}, {"ing$", 0.046845f}, {"ini", 0.012225f},
+	{"init", 0.01024f}, {"init$", 0.00618f}, {"inl", 0.015595f},
+	{"inli", 0.01503f}, {"inlin", 0.015025f}, {"ins", 0.01409f},
+	{"inst", 0.006865f}, {"int", 0.17581f}, {"int$", 0.125205f},
+	{"int3", 0.007795f}, {"int32", 0.00779f}, {"int6", 0.006005f},
+	{"int64", 0.006005f}, {"inte", 0.03117f}, {"integ", 0.005375f},
+	{"inter", 0.02513f}, {"io", 0.110505f}, {"io$", 0.0282f},
+	{"ion", 0.079215f}, {"ion$", 0.05219f}, {"ions", 0.017925f},
+	{"ions$", 0.01675f}, {"ip", 0.02555f}, {"ipt", 0.00516f},
+	{"ir", 0.0223f}, {"ire", 0.006175f}, {"irs", 0.00594f},
+	{"irst", 0.005655f}, {"is", 0.06935f}, {"is$", 0.02245f},
+	{"iss", 0.00613f}, {"ist", 0.01791f}, {"ist$", 0.00949f},
+	{"it", 0.10154f}, {"it$", 0.0262f}, {"ite", 0.032135f},
+	{"ite$", 0.00551f}, {"item", 0.007545f}, {"item$", 0.00661f},
+	{"iter", 0.015835f}, {"itera", 0.01125f}, {"ith", 0.010625f},
+	{"ith$", 0.005525f}, {"iti", 0.009005f}, {"its", 0.011785f},
+	{"its$", 0.01061f}, {"ity", 0.00763f}, {"ity$", 0.00622f},
+	{"iv", 0.02034f}, {"iva", 0.005035f}, {"ive", 0.01066f},
+	{"ix", 0.01297f}, {"ix$", 0.00674f}, {"iz", 0.043055f},
+	{"ize", 0.04113f}, {"ize$", 0.03041f}, {"j$", 0.01049f},
+	{"je", 0.016035f}, {"jec", 0.015775f}, {"ject", 0.015775f},
+	{"ject$", 0.0138f}, {"k$", 0.126095f}, {"kc", 0.01573f},
+	{"kcs", 0.014575f}, {"kcs1", 0.005245f}, {"kcs7", 0.007965f},
+	{"kcs7$", 0.00785f}, {"ke", 0.049595f}, {"ket", 0.009495f},
+	{"ket$", 0.005365f}, {"key", 0.024655f}, {"key$", 0.02028f},
+	{"ki", 0.010545f}, {"ks", 0.005455f}, {"ku", 0.006115f},
+	{"l$", 0.3057f}, {"la", 0.101475f}, {"lag", 0.01938f},
+	{"lag$", 0.00786f}, {"lags", 0.01164f}, {"lags$", 0.011565f},
+	{"lap", 0.00996f}, {"lapa", 0.007095f}, {"lapac", 0.007095f},
+	{"lar", 0.017275f}, {"lar$", 0.006065f}, {"lare", 0.0087f},
+	{"lare$", 0.00812f}, {"las", 0.0203f}, {"lass", 0.01345f},
+	{"lass$", 0.012195f}, {"last", 0.00507f}, {"lat", 0.024655f},
+	{"late", 0.02045f}, {"late$", 0.018965f}, {"lb", 0.0089f},
+	{"lba", 0.005425f}, {"lbac", 0.005075f}, {"lback", 0.005075f},
+	{"lc", 0.006025f}, {"ld", 0.02063f}, {"ld$", 0.00942f},
+	{"le", 0.13103f}, {"le$", 0.052315f}, {"lea", 0.009195f},
+	{"lem", 0.0068f}, {"leme", 0.005455f}, {"lemen", 0.00538f},
+	{"len", 0.02548f}, {"len$", 0.014535f}, {"leng", 0.005665f},
+	{"lengt", 0.005495f}, {"ler", 0.006345f}, {"les", 0.00522f},
+	{"let", 0.01141f}, {"lete", 0.008595f}, {"lete$", 0.00713f},
+	{"lf", 0.007235f}, {"lg", 0.01042f}, {"lh", 0.0101f},
+	{"li", 0.109245f}, {"lib", 0.015855f}, {"lib$", 0.008065f},
+	{"libc", 0.00706f}, {"lic", 0.02104f}, {"lic$", 0.00769f},
+	{"licy", 0.00694f}, {"licy$", 0.005165f}, {"lid", 0.00515f},
+	{"lie", 0.006115f}, {"lien", 0.00516f}, {"lient", 0.005155f},
+	{"lin", 0.034055f}, {"line", 0.021285f}, {"line$", 0.018835f},
+	{"lis", 0.010425f}, {"list", 0.009355f}, {"list$", 0.007895f},
+	{"lit", 0.005415f}, {"liz", 0.0054f}, {"ll", 0.07309f},
+	{"ll$", 0.026915f}, {"llb", 0.005425f}, {"llba", 0.005285f},
+	{"llbac", 0.00506f}, {"llo", 0.01257f}, {"lloc", 0.00929f},
+	{"lloc$", 0.005265f}, {"llv", 0.015925f}, {"llvm", 0.014835f},
+	{"llvm$", 0.0134f}, {"lo", 0.0851f}, {"loa", 0.01255f},
+	{"load", 0.00544f}, {"loat", 0.00719f}, {"loat$", 0.00576f},
+	{"loc", 0.029505f}, {"loc$", 0.00884f}, {"loca", 0.00984f},
+	{"locat", 0.00604f}, {"lock", 0.01112f}, {"lock$", 0.00748f},
+	{"log", 0.00624f}, {"lon", 0.015435f}, {"long", 0.01489f},
+	{"long$", 0.014525f}, {"loo", 0.006835f}, {"lp", 0.01062f},
+	{"ls", 0.044165f}, {"ls$", 0.012875f}, {"lse", 0.01335f},
+	{"lse$", 0.00999f}, {"lsp", 0.00643f}, {"lspe", 0.006305f},
+	{"lspec", 0.00627f}, {"lt", 0.025435f}, {"lt$", 0.01342f},
+	{"lu", 0.0642f}, {"lud", 0.0206f}, {"lude", 0.02034f},
+	{"lude$", 0.019685f}, {"lue", 0.029215f}, {"lue$", 0.025485f},
+	{"lus", 0.005645f}, {"lv", 0.019735f}, {"lvm", 0.014835f},
+	{"lvm$", 0.0134f}, {"ly", 0.0123f}, {"ly$", 0.008715f},
+	{"m$", 0.10897f}, {"ma", 0.07436f}, {"mac", 0.008275f},
+	{"map", 0.009505f}, {"mas", 0.00601f}, {"mask", 0.005415f},
+	{"mat", 0.01619f}, {"max", 0.01063f}, {"max$", 0.008245f},
+	{"mb", 0.01348f}, {"mbe", 0.00616f}, {"mber", 0.005755f},
+	{"mc", 0.009195f}, {"md", 0.01317f}, {"md$", 0.007575f},
+	{"me", 0.129985f}, {"me$", 0.063665f}, {"mem", 0.014615f},
+	{"mem$", 0.00843f}, {"men", 0.01407f}, {"ment", 0.011875f},
+	{"ment$", 0.00705f}, {"mes", 0.015795f}, {"mesp", 0.00896f},
+	{"mespa", 0.008765f}, {"met", 0.014305f}, {"meth", 0.008995f},
+	{"metho", 0.00861f}, {"mf", 0.005625f}, {"mi", 0.03023f},
+	{"mic", 0.00556f}, {"min", 0.008615f}, {"ml", 0.00947f},
+	{"mm", 0.012795f}, {"mo", 0.030185f}, {"mod", 0.01428f},
+	{"mode", 0.00581f}, {"modu", 0.00634f}, {"modul", 0.006335f},
+	{"mp", 0.096805f}, {"mp$", 0.03318f}, {"mpf", 0.007115f},
+	{"mpfu", 0.006745f}, {"mpfun", 0.006745f}, {"mpi", 0.014285f},
+	{"mpi$", 0.010975f}, {"mpl", 0.034765f}, {"mpl$", 0.00589f},
+	{"mpla", 0.018795f}, {"mplat", 0.01849f}, {"mple", 0.00905f},
+	{"ms", 0.023495f}, {"ms$", 0.01432f}, {"msg", 0.00501f},
+	{"mt", 0.005875f}, {"mu", 0.009905f}, {"n$", 0.214855f},
+	{"n1", 0.04635f}, {"n1$", 0.04586f}, {"na", 0.09934f},
+	{"nal", 0.021285f}, {"nal$", 0.01609f}, {"nam", 0.06649f},
+	{"name", 0.065025f}, {"name$", 0.05236f}, {"names", 0.011165f},
+	{"nb", 0.005505f}, {"nc", 0.089215f}, {"nc$", 0.02558f},
+	{"nce", 0.01283f}, {"nce$", 0.00887f}, {"ncl", 0.02094f},
+	{"nclu", 0.02046f}, {"nclud", 0.02039f}, {"nco", 0.005235f},
+	{"nct", 0.01527f}, {"ncti", 0.01445f}, {"nctio", 0.01445f},
+	{"nd", 0.1248f}, {"nd$", 0.03652f}, {"nde", 0.036905f},
+	{"ndef", 0.01758f}, {"ndef$", 0.01722f}, {"ndex", 0.014065f},
+	{"ndex$", 0.01247f}, {"ndi", 0.03343f}, {"ndif", 0.026825f},
+	{"ndif$", 0.026795f}, {"ndl", 0.005845f}, {"ndle", 0.00516f},
+	{"ndo", 0.00651f}, {"ne", 0.315105f}, {"ne$", 0.23775f},
+	{"ned", 0.04207f}, {"ned$", 0.04095f}, {"ner", 0.018425f},
+	{"nera", 0.00818f}, {"neral", 0.006145f}, {"new", 0.0157f},
+	{"new$", 0.01308f}, {"nf", 0.0422f}, {"nf$", 0.007265f},
+	{"nfo", 0.0295f}, {"nfo$", 0.026775f}, {"ng", 0.0988f},
+	{"ng$", 0.06705f}, {"nge", 0.009265f}, {"nge$", 0.00639f},
+	{"ngl", 0.00679f}, {"ngt", 0.00637f}, {"ngth", 0.00562f},
+	{"ngth$", 0.00536f}, {"ni", 0.036155f}, {"nid", 0.00627f},
+	{"nid$", 0.00585f}, {"nit", 0.01252f}, {"nit$", 0.007315f},
+	{"nk", 0.007f}, {"nl", 0.024185f}, {"nli", 0.015615f},
+	{"nlin", 0.015255f}, {"nline", 0.01504f}, {"nn", 0.00899f},
+	{"nne", 0.00595f}, {"no", 0.05089f}, {"no$", 0.01425f},
+	{"nod", 0.009545f}, {"node", 0.00898f}, {"node$", 0.006945f},
+	{"not", 0.009265f}, {"np", 0.0099f}, {"nr", 0.005385f},
+	{"ns", 0.26854f}, {"ns$", 0.020585f}, {"nse", 0.011415f},
+	{"nsi", 0.04045f}, {"nsig", 0.031525f}, {"nsign", 0.03149f},
+	{"nsio", 0.006665f}, {"nsion", 0.006665f}, {"nss", 0.07957f},
+	{"nssl", 0.078245f}, {"nssl$", 0.078055f}, {"nst", 0.149445f},
+	{"nst$", 0.1359f}, {"nste", 0.005125f}, {"nstr", 0.006515f},
+	{"nt", 0.233435f}, {"nt$", 0.152415f}, {"nt3", 0.007835f},
+	{"nt32", 0.007795f}, {"nt32$", 0.007695f}, {"nt6", 0.00605f},
+	{"nt64", 0.00605f}, {"nt64$", 0.005765f}, {"nta", 0.005165f},
+	{"nte", 0.04302f}, {"nteg", 0.005375f}, {"nten", 0.00538f},
+	{"nter", 0.02618f}, {"ntern", 0.013255f}, {"nterp", 0.0057f},
+	{"ntex", 0.005235f}, {"ntext", 0.00506f}, {"nti", 0.010505f},
+	{"ntr", 0.016595f}, {"ntry", 0.011415f}, {"ntry$", 0.00802f},
+	{"nts", 0.00602f}, {"nu", 0.059145f}, {"nul", 0.014705f},
+	{"null", 0.01458f}, {"null$", 0.011215f}, {"num", 0.03107f},
+	{"num$", 0.020255f}, {"numb", 0.005205f}, {"nv", 0.01251f},
+	{"o$", 0.1052f}, {"oa", 0.0155f}, {"oad", 0.005725f},
+	{"oat", 0.00736f}, {"oat$", 0.00577f}, {"ob", 0.03158f},
+	{"obj", 0.02262f}, {"obj$", 0.008295f}, {"obje", 0.01404f},
+	{"objec", 0.01393f}, {"oc", 0.058725f}, {"oc$", 0.01625f},
+	{"oca", 0.01129f}, {"ocat", 0.007175f}, {"ock", 0.01447f},
+	{"ock$", 0.009205f}, {"ocs", 0.010175f}, {"ocsp", 0.00956f},
+	{"ocsp$", 0.009475f}, {"od", 0.048925f}, {"od$", 0.009695f},
+	{"ode", 0.0271f}, {"ode$", 0.01944f}, {"odu", 0.007225f},
+	{"odul", 0.006335f}, {"odule", 0.006145f}, {"oe", 0.00592f},
+	{"of", 0.05421f}, {"of$", 0.04139f}, {"off", 0.007385f},
+	{"offs", 0.005255f}, {"offse", 0.005145f}, {"og", 0.009945f},
+	{"oi", 0.0838f}, {"oid", 0.072785f}, {"oid$", 0.07254f},
+	{"oin", 0.00947f}, {"oint", 0.00867f}, {"ok", 0.01124f},
+	{"ol", 0.049435f}, {"ol$", 0.02284f}, {"oli", 0.0081f},
+	{"olic", 0.00719f}, {"olicy", 0.00694f}, {"om", 0.055995f},
+	{"om$", 0.007705f}, {"omi", 0.005225f}, {"omm", 0.00715f},
+	{"omp", 0.031495f}, {"ompf", 0.006745f}, {"ompfu", 0.006745f},
+	{"ompi", 0.008725f}, {"ompi$", 0.00584f}, {"on", 0.270895f},
+	{"on$", 0.061215f}, {"one", 0.008805f}, {"onf", 0.00962f},
+	{"onf$", 0.006165f}, {"ong", 0.01861f}, {"ong$", 0.017915f},
+	{"ons", 0.16126f}, {"ons$", 0.017165f}, {"onst", 0.14387f},
+	{"onst$", 0.134525f}, {"ont", 0.01662f}, {"onte", 0.00857f},
+	{"oo", 0.034395f}, {"ook", 0.005965f}, {"ool", 0.01953f},
+	{"ool$", 0.017645f}, {"op", 0.139945f}, {"op$", 0.017025f},
+	{"opa", 0.008925f}, {"opal", 0.00814f}, {"opal$", 0.008125f},
+	{"ope", 0.095225f}, {"open", 0.081285f}, {"opens", 0.078255f},
+	{"oper", 0.010255f}, {"opera", 0.009085f}, {"opt", 0.011335f},
+	{"opti", 0.00824f}, {"optio", 0.00772f}, {"opy", 0.007045f},
+	{"opy$", 0.005095f}, {"or", 0.1454f}, {"or$", 0.05927f},
+	{"ord", 0.010835f}, {"orde", 0.00553f}, {"order", 0.00539f},
+	{"ore", 0.014905f}, {"ore$", 0.012035f}, {"ori", 0.006195f},
+	{"orm", 0.012765f}, {"orma", 0.00717f}, {"ormat", 0.005725f},
+	{"ort", 0.027235f}, {"ort$", 0.01464f}, {"orte", 0.00806f},
+	{"os", 0.106705f}, {"os$", 0.00715f}, {"ose", 0.005445f},
+	{"oss", 0.07874f}, {"ossl", 0.078215f}, {"ossl$", 0.078195f},
+	{"ost", 0.00854f}, {"ot", 0.03214f}, {"ot$", 0.00732f},
+	{"oth", 0.00637f}, {"othe", 0.00551f}, {"other", 0.005495f},
+	{"oto", 0.007405f}, {"ou", 0.04745f}, {"oub", 0.006655f},
+	{"oubl", 0.006645f}, {"ouble", 0.006635f}, {"oun", 0.01138f},
+	{"ount", 0.008035f}, {"ount$", 0.006465f}, {"our", 0.005715f},
+	{"out", 0.017115f}, {"out$", 0.010095f}, {"ov", 0.01215f},
+	{"ove", 0.010185f}, {"over", 0.00521f}, {"ow", 0.029835f},
+	{"ow$", 0.01039f}, {"owu", 0.00838f}, {"owur", 0.00834f},
+	{"owur$", 0.00834f}, {"p$", 0.140835f}, {"pa", 0.080845f},
+	{"pac", 0.02742f}, {"pace", 0.01039f}, {"pace$", 0.009915f},
+	{"pack", 0.01594f}, {"pack$", 0.008155f}, {"packe", 0.008345f},
+	{"pad", 0.006025f}, {"pal", 0.00882f}, {"pal$", 0.00815f},
+	{"par", 0.023025f}, {"para", 0.011485f}, {"param", 0.00965f},
+	{"pas", 0.005175f}, {"pat", 0.00676f}, {"pc", 0.01097f},
+	{"pd", 0.00544f}, {"pe", 0.212965f}, {"pe$", 0.11346f},
+	{"pec", 0.011555f}, {"pec$", 0.007355f}, {"ped", 0.026475f},
+	{"pede", 0.024825f}, {"pedef", 0.024765f}, {"pen", 0.102135f},
+	{"pena", 0.018135f}, {"penam", 0.01808f}, {"pens", 0.07831f},
+	{"penss", 0.07821f}, {"per", 0.01897f}, {"pera", 0.009115f},
+	{"perat", 0.00731f}, {"pf", 0.012505f}, {"pfu", 0.006775f},
+	{"pfun", 0.006775f}, {"pfunc", 0.006775f}, {"ph", 0.01025f},
+	{"phe", 0.005085f}, {"pi", 0.040785f}, {"pi$", 0.019875f},
+	{"pie", 0.00965f}, {"pien", 0.009025f}, {"pient", 0.009025f},
+	{"pk", 0.024735f}, {"pkc", 0.014575f}, {"pkcs", 0.014575f},
+	{"pkcs1", 0.005245f}, {"pkcs7", 0.007965f}, {"pke", 0.005475f},
+	{"pkey", 0.005455f}, {"pkey$", 0.005255f}, {"pl", 0.05631f},
+	{"pl$", 0.006345f}, {"pla", 0.025495f}, {"plat", 0.019905f},
+	{"plate", 0.018495f}, {"ple", 0.0119f}, {"pli", 0.005705f},
+	{"pm", 0.005735f}, {"pn", 0.008345f}, {"po", 0.05121f},
+	{"poi", 0.00837f}, {"poin", 0.00818f}, {"point", 0.00818f},
+	{"pol", 0.008425f}, {"poli", 0.00711f}, {"polic", 0.00706f},
+	{"pop", 0.005855f}, {"por", 0.013815f}, {"port", 0.01339f},
+	{"port$", 0.00929f}, {"pos", 0.009555f}, {"pp", 0.018515f},
+	{"pr", 0.083995f}, {"pr$", 0.00947f}, {"pre", 0.026f},
+	{"prec", 0.01093f}, {"preca", 0.010045f}, {"pri", 0.01498f},
+	{"prin", 0.00605f}, {"print", 0.005885f}, {"priv", 0.005805f},
+	{"pro", 0.031595f}, {"proc", 0.00849f}, {"proc$", 0.006465f},
+	{"prot", 0.00879f}, {"proto", 0.006815f}, {"ps", 0.01434f},
+	{"pt", 0.084565f}, {"pt$", 0.011315f}, {"pti", 0.01224f},
+	{"ptio", 0.011465f}, {"ption", 0.011465f}, {"pto", 0.009215f},
+	{"pto$", 0.006215f}, {"ptr", 0.04577f}, {"ptr$", 0.042975f},
+	{"pu", 0.02985f}, {"pub", 0.011635f}, {"publ", 0.008365f},
+	{"publi", 0.00835f}, {"put", 0.010205f}, {"put$", 0.005195f},
+	{"py", 0.012845f}, {"py$", 0.007985f}, {"q$", 0.01535f},
+	{"qu", 0.019945f}, {"que", 0.0134f}, {"r$", 0.285755f},
+	{"ra", 0.09773f}, {"rac", 0.0054f}, {"rag", 0.005465f},
+	{"rai", 0.008725f}, {"rait", 0.00564f}, {"raits", 0.00505f},
+	{"ral", 0.008915f}, {"ral$", 0.00532f}, {"ram", 0.014835f},
+	{"ram$", 0.008625f}, {"ran", 0.01775f}, {"rang", 0.00639f},
+	{"range", 0.006365f}, {"rat", 0.02348f}, {"rato", 0.017575f},
+	{"rator", 0.01754f}, {"ray", 0.00582f}, {"rb", 0.006015f},
+	{"rc", 0.022105f}, {"rce", 0.005915f}, {"rd", 0.024445f},
+	{"rd$", 0.006495f}, {"rde", 0.00658f}, {"rder", 0.005945f},
+	{"re", 0.234875f}, {"re$", 0.034635f}, {"rea", 0.02924f},
+	{"read", 0.0117f}, {"read$", 0.00703f}, {"reat", 0.00645f},
+	{"reate", 0.006225f}, {"rec", 0.023825f}, {"reca", 0.010065f},
+	{"recat", 0.01002f}, {"red", 0.011895f}, {"red$", 0.005695f},
+	{"ree", 0.01888f}, {"ree$", 0.012485f}, {"reef", 0.005005f},
+	{"ref", 0.013205f}, {"ref$", 0.00772f}, {"reg", 0.007325f},
+	{"ren", 0.01204f}, {"rep", 0.00639f}, {"req", 0.01464f},
+	{"req$", 0.00739f}, {"requ", 0.007115f}, {"reque", 0.00512f},
+	{"res", 0.03738f}, {"rese", 0.009205f}, {"reser", 0.007105f},
+	{"resp", 0.006005f}, {"ress", 0.00844f}, {"resu", 0.006295f},
+	{"resul", 0.005955f}, {"ret", 0.042585f}, {"retu", 0.037535f},
+	{"retur", 0.03753f}, {"rev", 0.00638f}, {"rf", 0.00905f},
+	{"rg", 0.025445f}, {"rg$", 0.006025f}, {"rge", 0.00886f},
+	{"rget", 0.007005f}, {"rh", 0.00663f}, {"rhs", 0.00539f},
+	{"ri", 0.117035f}, {"rib", 0.00826f}, {"ribu", 0.00706f},
+	{"ribut", 0.00705f}, {"rid", 0.006235f}, {"ride", 0.005335f},
+	{"rif", 0.007125f}, {"rify", 0.006415f}, {"rify$", 0.006235f},
+	{"rin", 0.044215f}, {"ring", 0.032545f}, {"ring$", 0.02688f},
+	{"rint", 0.00639f}, {"rit", 0.012865f}, {"rite", 0.006295f},
+	{"riv", 0.009915f}, {"rk", 0.00564f}, {"rl", 0.023985f},
+	{"rl$", 0.01916f}, {"rm", 0.023185f}, {"rm$", 0.005095f},
+	{"rma", 0.007855f}, {"rmat", 0.005865f}, {"rn", 0.077875f},
+	{"rn$", 0.057745f}, {"rna", 0.01549f}, {"rnal", 0.013785f},
+	{"rnal$", 0.012335f}, {"ro", 0.07718f}, {"roc", 0.00865f},
+	{"roc$", 0.006465f}, {"rom", 0.007485f}, {"rop", 0.005735f},
+	{"ror", 0.01248f}, {"ror$", 0.009405f}, {"rot", 0.00937f},
+	{"roto", 0.006815f}, {"rou", 0.006095f}, {"row", 0.00587f},
+	{"rp", 0.02239f}, {"rp$", 0.010135f}, {"rr", 0.04509f},
+	{"rr$", 0.01699f}, {"rra", 0.008395f}, {"rray", 0.00562f},
+	{"rro", 0.013075f}, {"rror", 0.01239f}, {"rror$", 0.00933f},
+	{"rs", 0.041395f}, {"rs$", 0.00883f}, {"rse", 0.008755f},
+	{"rsi", 0.009435f}, {"rsio", 0.007975f}, {"rsion", 0.007975f},
+	{"rst", 0.00719f}, {"rt", 0.08063f}, {"rt$", 0.041135f},
+	{"rte", 0.010145f}, {"rti", 0.00825f}, {"ru", 0.0418f},
+	{"ruc", 0.031885f}, {"ruct", 0.031835f}, {"ruct$", 0.02749f},
+	{"rv", 0.015665f}, {"rve", 0.01128f}, {"rve$", 0.005245f},
+	{"ry", 0.037275f}, {"ry$", 0.01829f}, {"ryp", 0.014945f},
+	{"rypt", 0.011565f}, {"rypto", 0.00673f}, {"s$", 0.23863f},
+	{"s1", 0.008445f}, {"s7", 0.00797f}, {"s7$", 0.007855f},
+	{"sa", 0.028965f}, {"sa$", 0.00704f}, {"sc", 0.03408f},
+	{"sca", 0.01057f}, {"scal", 0.00771f}, {"scala", 0.00618f},
+	{"scr", 0.006695f}, {"se", 0.171695f}, {"se$", 0.04755f},
+	{"sec", 0.0123f}, {"sed", 0.007485f}, {"sed$", 0.00652f},
+	{"seq", 0.00557f}, {"ser", 0.028365f}, {"sert", 0.00935f},
+	{"sert$", 0.00806f}, {"serv", 0.011155f}, {"serve", 0.010095f},
+	{"ses", 0.010585f}, {"sess", 0.005755f}, {"set", 0.052785f},
+	{"set$", 0.037995f}, {"sf", 0.005685f}, {"sg", 0.006655f},
+	{"sh", 0.04349f}, {"sh$", 0.011535f}, {"sha", 0.010045f},
+	{"shi", 0.00571f}, {"shif", 0.005405f}, {"shift", 0.005405f},
+	{"shm", 0.006935f}, {"shme", 0.00667f}, {"shmem", 0.00666f},
+	{"si", 0.130995f}, {"sic", 0.005005f}, {"sig", 0.046205f},
+	{"sign", 0.04381f}, {"signe", 0.03661f}, {"sin", 0.01294f},
+	{"sing", 0.00893f}, {"sing$", 0.00662f}, {"sio", 0.02391f},
+	{"sion", 0.023645f}, {"sion$", 0.019705f}, {"siz", 0.03504f},
+	{"size", 0.034985f}, {"size$", 0.02874f}, {"sk", 0.0669f},
+	{"sk$", 0.06247f}, {"sl", 0.154075f}, {"sl$", 0.147345f},
+	{"sm", 0.009515f}, {"sn", 0.051f}, {"sn1", 0.045775f},
+	{"sn1$", 0.045405f}, {"so", 0.028375f}, {"sor", 0.009915f},
+	{"sort", 0.00544f}, {"sou", 0.005035f}, {"sp", 0.053545f},
+	{"sp$", 0.01108f}, {"spa", 0.013115f}, {"spac", 0.01076f},
+	{"space", 0.01039f}, {"spe", 0.010405f}, {"spec", 0.009745f},
+	{"spec$", 0.007355f}, {"spl", 0.007395f}, {"sr", 0.015175f},
+	{"ss", 0.20005f}, {"ss$", 0.030565f}, {"sse", 0.008755f},
+	{"sser", 0.005525f}, {"ssi", 0.014255f}, {"ssio", 0.008645f},
+	{"ssion", 0.008645f}, {"ssl", 0.14516f}, {"ssl$", 0.143575f},
+	{"st", 0.324645f}, {"st$", 0.179545f}, {"sta", 0.062155f},
+	{"stac", 0.02342f}, {"stack", 0.02339f}, {"stat", 0.02957f},
+	{"stati", 0.01518f}, {"statu", 0.007075f}, {"std", 0.018755f},
+	{"std$", 0.01592f}, {"ste", 0.013575f}, {"sto", 0.015035f},
+	{"stor", 0.012315f}, {"store", 0.00934f}, {"str", 0.08532f},
+	{"str$", 0.005765f}, {"stre", 0.00533f}, {"stri", 0.03638f},
+	{"strin", 0.03135f}, {"stru", 0.032015f}, {"struc", 0.031865f},
+	{"stu", 0.005225f}, {"su", 0.029785f}, {"sub", 0.00807f},
+	{"sul", 0.00612f}, {"sult", 0.00596f}, {"sult$", 0.005005f},
+	{"sup", 0.005765f}, {"sw", 0.005355f}, {"sy", 0.01432f},
+	{"sym", 0.005155f}, {"sz", 0.00651f}, {"sz$", 0.006365f},
+	{"t$", 0.48242f}, {"t0", 0.008635f}, {"t0$", 0.008615f},
+	{"t1", 0.011905f}, {"t1$", 0.0076f}, {"t3", 0.00864f},
+	{"t32", 0.008125f}, {"t32$", 0.007965f}, {"t6", 0.006735f},
+	{"t64", 0.00646f}, {"t64$", 0.00612f}, {"ta", 0.12369f},
+	{"ta$", 0.022255f}, {"tab", 0.00842f}, {"tabl", 0.007565f},
+	{"table", 0.00754f}, {"tac", 0.02528f}, {"tack", 0.02343f},
+	{"tack$", 0.02282f}, {"tag", 0.00551f}, {"tan", 0.00516f},
+	{"tar", 0.012425f}, {"targ", 0.007105f}, {"targe", 0.006775f},
+	{"tat", 0.03507f}, {"tate", 0.00534f}, {"tati", 0.01694f},
+	{"tatic", 0.01504f}, {"tatu", 0.007075f}, {"tatus", 0.007075f},
+	{"tb", 0.00618f}, {"tc", 0.03698f}, {"tch", 0.00767f},
+	{"tcl", 0.020125f}, {"tcl$", 0.016295f}, {"td", 0.0242f},
+	{"td$", 0.016145f}, {"te", 0.219655f}, {"te$", 0.060575f},
+	{"ted", 0.029255f}, {"ted$", 0.020215f}, {"teg", 0.006175f},
+	{"tem", 0.0291f}, {"tem$", 0.007805f}, {"temp", 0.01977f},
+	{"templ", 0.01851f}, {"ten", 0.0164f}, {"tens", 0.00709f},
+	{"tensi", 0.00545f}, {"tent", 0.00525f}, {"ter", 0.076305f},
+	{"ter$", 0.01616f}, {"tera", 0.011455f}, {"terat", 0.010935f},
+	{"tern", 0.035745f}, {"tern$", 0.021365f}, {"terna", 0.01397f},
+	{"terp", 0.00597f}, {"tes", 0.01016f}, {"tes$", 0.00531f},
+	{"tex", 0.01848f}, {"texp", 0.005205f}, {"texpr", 0.00501f},
+	{"text", 0.00968f}, {"text$", 0.00652f}, {"tf", 0.01073f},
+	{"th", 0.071785f}, {"th$", 0.021065f}, {"the", 0.021135f},
+	{"the$", 0.01321f}, {"ther", 0.00734f}, {"ther$", 0.005305f},
+	{"thi", 0.009345f}, {"this", 0.00849f}, {"this$", 0.00816f},
+	{"tho", 0.011095f}, {"thod", 0.00861f}, {"thod$", 0.007885f},
+	{"thr", 0.0088f}, {"thre", 0.00563f}, {"threa", 0.00506f},
+	{"ti", 0.12424f}, {"tia", 0.005215f}, {"tic", 0.019955f},
+	{"tic$", 0.015285f}, {"tim", 0.013295f}, {"time", 0.01126f},
+	{"time$", 0.007335f}, {"tin", 0.013885f}, {"tio", 0.055625f},
+	{"tion", 0.054755f}, {"tion$", 0.031465f}, {"tions", 0.014585f},
+	{"tk", 0.011315f}, {"tk$", 0.006875f}, {"tl", 0.023795f},
+	{"tls", 0.01006f}, {"tls$", 0.006255f}, {"tm", 0.008405f},
+	{"tn", 0.01309f}, {"tna", 0.0084f}, {"tnam", 0.00833f},
+	{"tname", 0.00833f}, {"to", 0.095605f}, {"to$", 0.02545f},
+	{"tom", 0.006625f}, {"tor", 0.047075f}, {"tor$", 0.0281f},
+	{"tore", 0.00957f}, {"tore$", 0.008515f}, {"tp", 0.023485f},
+	{"tp$", 0.009545f}, {"tr", 0.195505f}, {"tr$", 0.05648f},
+	{"tra", 0.0184f}, {"trai", 0.006325f}, {"trait", 0.005185f},
+	{"tran", 0.00564f}, {"tre", 0.013745f}, {"tri", 0.052055f},
+	{"trib", 0.008015f}, {"tribu", 0.00706f}, {"trin", 0.03312f},
+	{"tring", 0.03126f}, {"trl", 0.012855f}, {"trl$", 0.01257f},
+	{"tro", 0.00605f}, {"tru", 0.038265f}, {"truc", 0.031875f},
+	{"truct", 0.031835f}, {"try", 0.01367f}, {"try$", 0.010005f},
+	{"ts", 0.04002f}, {"ts$", 0.025945f}, {"tst", 0.00596f},
+	{"tt", 0.034f}, {"ttr", 0.014075f}, {"ttr$", 0.00726f},
+	{"ttri", 0.006915f}, {"ttrib", 0.00682f}, {"tu", 0.0645f},
+	{"tur", 0.043425f}, {"ture", 0.005725f}, {"turn", 0.037605f},
+	{"turn$", 0.036105f}, {"tus", 0.007305f}, {"tus$", 0.006805f},
+	{"tx", 0.036485f}, {"tx$", 0.03191f}, {"ty", 0.15733f},
+	{"ty$", 0.012045f}, {"typ", 0.145265f}, {"type", 0.145005f},
+	{"type$", 0.10665f}, {"typed", 0.02504f}, {"typen", 0.018125f},
+	{"u$", 0.018375f}, {"ua", 0.01069f}, {"ual", 0.00735f},
+	{"ual$", 0.005315f}, {"ub", 0.03293f}, {"ubl", 0.015305f},
+	{"uble", 0.00664f}, {"uble$", 0.006305f}, {"ubli", 0.00841f},
+	{"ublic", 0.008f}, {"ubs", 0.00587f}, {"uc", 0.039575f},
+	{"uct", 0.032655f}, {"uct$", 0.027945f}, {"ud", 0.022925f},
+	{"ude", 0.020415f}, {"ude$", 0.01969f}, {"ue", 0.04997f},
+	{"ue$", 0.03194f}, {"uer", 0.005015f}, {"ues", 0.00665f},
+	{"uf", 0.01721f}, {"uf$", 0.00877f}, {"uff", 0.007775f},
+	{"uffe", 0.00654f}, {"uffer", 0.00653f}, {"ug", 0.0054f},
+	{"ui", 0.030615f}, {"uin", 0.01818f}, {"uint", 0.018005f},
+	{"ul", 0.045935f}, {"ule", 0.00719f}, {"ule$", 0.005865f},
+	{"ull", 0.01603f}, {"ull$", 0.012145f}, {"ult", 0.014575f},
+	{"ult$", 0.010605f}, {"um", 0.03911f}, {"um$", 0.021845f},
+	{"umb", 0.00529f}, {"ume", 0.005025f}, {"un", 0.11096f},
+	{"unc", 0.03767f}, {"unc$", 0.021275f}, {"unct", 0.015125f},
+	{"uncti", 0.01445f}, {"und", 0.007405f}, {"uni", 0.010155f},
+	{"uns", 0.03531f}, {"unsi", 0.031445f}, {"unsig", 0.031445f},
+	{"unt", 0.009185f}, {"unt$", 0.006465f}, {"up", 0.028325f},
+	{"up$", 0.01429f}, {"upp", 0.005295f}, {"ur", 0.076175f},
+	{"ur$", 0.011215f}, {"ure", 0.009745f}, {"ure$", 0.006935f},
+	{"urn", 0.037815f}, {"urn$", 0.03611f}, {"us", 0.04843f},
+	{"us$", 0.0126f}, {"use", 0.016885f}, {"use$", 0.00624f},
+	{"usi", 0.00598f}, {"usin", 0.005645f}, {"using", 0.005535f},
+	{"ust", 0.00573f}, {"ut", 0.051215f}, {"ut$", 0.01607f},
+	{"ute", 0.01131f}, {"ute$", 0.006315f}, {"uti", 0.00577f},
+	{"v$", 0.03449f}, {"v3", 0.00693f}, {"v3$", 0.00677f},
+	{"va", 0.055475f}, {"val", 0.04236f}, {"val$", 0.007395f},
+	{"valu", 0.029995f}, {"value", 0.028865f}, {"ve", 0.07418f},
+	{"ve$", 0.018565f}, {"vec", 0.007825f}, {"vect", 0.00631f},
+	{"vecto", 0.00622f}, {"ved", 0.006315f}, {"ven", 0.0057f},
+	{"ver", 0.03174f}, {"veri", 0.007485f}, {"verif", 0.007095f},
+	{"vers", 0.01009f}, {"versi", 0.007995f}, {"vi", 0.017625f},
+	{"vic", 0.005545f}, {"vice", 0.00546f}, {"vm", 0.01645f},
+	{"vm$", 0.01429f}, {"vo", 0.06848f}, {"voi", 0.06365f},
+	{"void", 0.063615f}, {"void$", 0.063535f}, {"vp", 0.009845f},
+	{"vp$", 0.007605f}, {"w$", 0.03258f}, {"wa", 0.016375f},
+	{"war", 0.0069f}, {"wi", 0.02376f}, {"win", 0.008665f},
+	{"wit", 0.009145f}, {"with", 0.0084f}, {"with$", 0.00549f},
+	{"wo", 0.005875f}, {"wr", 0.00971f}, {"wri", 0.006545f},
+	{"writ", 0.006535f}, {"write", 0.00587f}, {"wu", 0.00933f},
+	{"wur", 0.00918f}, {"wur$", 0.00918f}, {"x$", 0.109695f},
+	{"x0", 0.015445f}, {"x00", 0.00682f}, {"x1", 0.00727f},
+	{"x2", 0.00638f}, {"x4", 0.00564f}, {"x5", 0.05803f},
+	{"x50", 0.0563f}, {"x509", 0.05623f}, {"x509$", 0.05092f},
+	{"x509v", 0.005755f}, {"x8", 0.01051f}, {"xc", 0.010215f},
+	{"xe", 0.007015f}, {"xf", 0.00526f}, {"xm", 0.006735f},
+	{"xml", 0.00576f}, {"xp", 0.023245f}, {"xpo", 0.00576f},
+	{"xpor", 0.005155f}, {"xport", 0.005155f}, {"xpr", 0.00957f},
+	{"xpr$", 0.00704f}, {"xt", 0.06066f}, {"xt$", 0.024825f},
+	{"xte", 0.027615f}, {"xten", 0.00634f}, {"xtens", 0.00542f},
+	{"xter", 0.02114f}, {"xtern", 0.021115f}, {"xx", 0.005875f},
+	{"y$", 0.100075f}, {"ym", 0.00619f}, {"yn", 0.00616f},
+	{"yo", 0.00521f}, {"yp", 0.15765f}, {"ype", 0.145115f},
+	{"ype$", 0.10665f}, {"yped", 0.02504f}, {"ypede", 0.024815f},
+	{"ypen", 0.018135f}, {"ypena", 0.018075f}, {"ypt", 0.01187f},
+	{"ypto", 0.00673f}, {"ypto$", 0.00621f}, {"ys", 0.009615f},
+	{"yt", 0.007675f}, {"yte", 0.00612f}, {"z$", 0.01006f},
+	{"ze", 0.045355f}, {"ze$", 0.030485f}, {"zer", 0.00514f}
+};
+
+static const QGramTableElement codeCharacters[] = {
+	{"$", 0.172167f}, {"0", 0.00829326f}, {"1", 0.00590408f},
+	{"2", 0.00374031f}, {"3", 0.00223689f}, {"4", 0.0016383f},
+	{"5", 0.00361592f}, {"6", 0.00171735f}, {"7", 0.000852929f},
+	{"8", 0.00164928f}, {"9", 0.00313212f}, {"a", 0.0427917f},
+	{"b", 0.0117623f}, {"c", 0.0440841f}, {"d", 0.0328657f},
+	{"e", 0.092549f}, {"f", 0.0239708f}, {"g", 0.0149643f},
+	{"h", 0.0130008f}, {"i", 0.0543757f}, {"j", 0.00131778f},
+	{"k", 0.0151589f}, {"l", 0.0384076f}, {"m", 0.0206801f},
+	{"n", 0.0595644f}, {"o", 0.0467556f}, {"p", 0.0349961f},
+	{"q", 0.00140846f}, {"r", 0.0465872f}, {"s", 0.0687925f},
+	{"t", 0.0701229f}, {"u", 0.0203902f}, {"v", 0.00998485f},
+	{"w", 0.0040343f}, {"x", 0.0129792f}, {"y", 0.011403f},
+	{"z", 0.00210416f}
+};
+
+#define CODE_AVG_CHARACTERS (39.5930f)
+static const BuiltinDictionary builtinDictionaries[] = {
+	{"english", englishQGrams, lengthof(englishQGrams),
+	englishCharacters, lengthof(englishCharacters),
+	ENGLISH_AVG_CHARACTERS, false},
+	{"russian", russianQGrams, lengthof(russianQGrams),
+	russianCharacters, lengthof(russianCharacters),
+	RUSSIAN_AVG_CHARACTERS, true},
+	{"code", codeQGrams, lengthof(codeQGrams),
+	codeCharacters, lengthof(codeCharacters),
+	CODE_AVG_CHARACTERS, false}
+};
+
+/**
+ * Get built-in dictionary by number of vgram.default_dictionary value.
+ *
+ * @param dictionary Value of vgram.default_dictionary
+ * @return Built-in dictionary or NULL if it's not available
+ */
+const BuiltinDictionary *
+getBuiltinDictionary(int dictionary)
+{
+	const BuiltinDictionary *result;
+
+	if (dictionary <= VGRAM_DICTIONARY_NONE ||
+		dictionary > lengthof(builtinDictionaries))
+		return NULL;
+
+	result = &builtinDictionaries[dictionary - 1];
+	if (result->requiresUTF8 && GetDatabaseEncoding() != PG_UTF8)
+	{
+		elog(WARNING, "Built-in dictionary \"%s\" requires UTF8 database encoding.",
+			 result->name);
+		return NULL;
+	}
+	return result;
+}
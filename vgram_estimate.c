@@ -0,0 +1,494 @@
+/*-------------------------------------------------------------------------
+ *
+ * vgram_estimate.c
+ *		Routines for estimating V-gram index size and build time using
+ *		sample of the table.
+ *
+ * Copyright (c) 2011-2017, Alexander Korotkov
+ *
+ * IDENTIFICATION
+ *	  contrib/vgram/vgram_estimate.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include <math.h>
+
+#include "fmgr.h"
+#include "funcapi.h"
+#include "access/genam.h"
+#include "access/htup_details.h"
+#include "catalog/pg_am.h"
+#include "catalog/pg_type.h"
+#include "executor/spi.h"
+#include "portability/instr_time.h"
+#include "utils/builtins.h"
+#include "utils/hsearch.h"
+#include "utils/lsyscache.h"
+#include "utils/memutils.h"
+#include "utils/rel.h"
+
+#include "vgram.h"
+
+Datum		vgram_estimate_index(PG_FUNCTION_ARGS);
+Datum		vgram_estimate_count(PG_FUNCTION_ARGS);
+
+PG_FUNCTION_INFO_V1(vgram_estimate_index);
+PG_FUNCTION_INFO_V1(vgram_estimate_count);
+
+/* Multipliers of statistics limit frequency to be estimated */
+static const float4 limitMultipliers[] = {1.0f, 2.0f, 4.0f};
+
+#define N_LIMIT_MULTIPLIERS lengthof(limitMultipliers)
+#define N_ESTIMATE_CONFIGS	((maxQ - minQ) * N_LIMIT_MULTIPLIERS)
+
+/*
+ * Alternative extraction parameters and statistics of sample gathered
+ * with them.
+ */
+typedef struct
+{
+	int				maxLength;
+	float4			limitFrequency;
+	HTAB		   *keysHash;
+	double			postings;
+	double			extractTime;
+} EstimateConfig;
+
+typedef struct
+{
+	char		  **data;
+	int				count;
+	int				allocated;
+} EstimateKeys;
+
+typedef struct
+{
+	int				maxLength;
+	float4			limitFrequency;
+	double			distinctKeys,
+					totalPostings,
+					indexSize,
+					buildTime;
+} EstimateResult;
+
+static void
+addEstimateKey(char *vgram, void *userData)
+{
+	EstimateKeys *keys = (EstimateKeys *) userData;
+
+	if (keys->count >= keys->allocated)
+	{
+		keys->allocated *= 2;
+		keys->data = (char **) repalloc(keys->data,
+										sizeof(char *) * keys->allocated);
+	}
+	keys->data[keys->count++] = vgram;
+}
+
+static int
+cstringCmp(const void *a1, const void *a2)
+{
+	return strcmp(*((char *const *) a1), *((char *const *) a2));
+}
+
+/**
+ * Extract V-grams of the sample row using given configuration and account
+ * them in the configuration statistics.
+ */
+static void
+estimateRow(EstimateConfig *config, text *s, MemoryContext context)
+{
+	LimitedExtractVGramsInfo userData;
+	EstimateKeys keys;
+	instr_time	startTime,
+				endTime;
+	int			i;
+
+	keys.count = 0;
+	keys.allocated = 16;
+	keys.data = (char **) palloc(sizeof(char *) * keys.allocated);
+
+	userData.info.callback = addEstimateKey;
+	userData.info.userData = &keys;
+	userData.maxLength = config->maxLength;
+	userData.limitFrequency = config->limitFrequency;
+
+	INSTR_TIME_SET_CURRENT(startTime);
+	extractWords(VARDATA_ANY(s), VARSIZE_ANY_EXHDR(s),
+				 extractMinimalVGramsWordLimited, &userData);
+	INSTR_TIME_SET_CURRENT(endTime);
+	INSTR_TIME_SUBTRACT(endTime, startTime);
+	config->extractTime += INSTR_TIME_GET_DOUBLE(endTime);
+
+	if (keys.count > 0)
+		qsort(keys.data, keys.count, sizeof(char *), cstringCmp);
+
+	for (i = 0; i < keys.count; i++)
+	{
+		QGramHashKey key;
+		QGramHashValue *value;
+		bool		found;
+
+		if (i > 0 && strcmp(keys.data[i], keys.data[i - 1]) == 0)
+			continue;
+
+		key.qgram = keys.data[i];
+		value = (QGramHashValue *) hash_search(config->keysHash,
+											   (const void *) &key,
+											   HASH_ENTER,
+											   &found);
+		if (!found)
+		{
+			value->key.qgram = MemoryContextStrdup(context, keys.data[i]);
+			value->count = 1;
+		}
+		else
+			value->count++;
+		config->postings += 1.0;
+	}
+
+	for (i = 0; i < keys.count; i++)
+		pfree(keys.data[i]);
+	pfree(keys.data);
+}
+
+/**
+ * Scale statistics of sample to the whole table.  Rows are units of sampling,
+ * and key count is number of sampled rows containing it.  Row contains many
+ * keys, so Duj1 estimator of ANALYZE doesn't apply: number of keys seen in
+ * single row easily exceeds number of rows.  Instead, every key seen in
+ * single sampled row stands for keys of single table row, which are sampled
+ * with probability q = sampleRows / totalRows, so (1 - q) / q unseen keys
+ * are added per such key.
+ */
+static void
+estimateConfigResult(EstimateConfig *config, double sampleRows,
+					 double totalRows, EstimateResult *result)
+{
+	HASH_SEQ_STATUS scanStatus;
+	QGramHashValue *item;
+	double		distinct = 0.0,
+				singletons = 0.0,
+				keyBytes = 0.0,
+				q;
+
+	hash_seq_init(&scanStatus, config->keysHash);
+	while ((item = (QGramHashValue *) hash_seq_search(&scanStatus)) != NULL)
+	{
+		distinct += 1.0;
+		keyBytes += strlen(item->key.qgram);
+		if (item->count == 1)
+			singletons += 1.0;
+	}
+
+	q = (totalRows > sampleRows && sampleRows > 0.0) ?
+		sampleRows / totalRows : 1.0;
+
+	result->maxLength = config->maxLength;
+	result->limitFrequency = config->limitFrequency;
+	result->totalPostings = config->postings / q;
+
+	result->distinctKeys = distinct + singletons * (1.0 - q) / q;
+	result->distinctKeys = Min(result->distinctKeys, result->totalPostings);
+
+	result->indexSize = result->distinctKeys *
+		(VGRAM_ENTRY_OVERHEAD + (distinct > 0.0 ? keyBytes / distinct : 0.0)) +
+		result->totalPostings * VGRAM_POSTING_BYTES;
+
+	result->buildTime = result->totalPostings * VGRAM_BUILD_POSTING_TIME;
+	if (sampleRows > 0.0)
+		result->buildTime += config->extractTime * totalRows / sampleRows;
+}
+
+/**
+ * Sample the table and estimate V-gram index for current statistics as well
+ * as for alternative maxQ and limit frequency settings.
+ */
+static EstimateResult *
+estimateIndex(Oid relid, text *attname, float4 samplePercent, int *nresults)
+{
+	EstimateConfig *configs;
+	EstimateResult *results;
+	MemoryContext context,
+				rowContext,
+				oldContext;
+	HASHCTL		keysHashCtl;
+	char	   *query;
+	Portal		portal;
+	SPIPlanPtr	plan;
+	double		sampleRows = 0.0,
+				totalRows;
+	float4		baseLimit;
+	bool		isnull;
+	int			i,
+				j,
+				nconfigs = N_ESTIMATE_CONFIGS;
+
+	if (samplePercent <= 0.0f || samplePercent > 100.0f)
+		elog(ERROR, "sample percent must be in (0, 100] range.");
+
+	loadStats();
+	baseLimit = getStatsLimitFrequency();
+
+	results = (EstimateResult *) palloc(sizeof(EstimateResult) * nconfigs);
+
+	context = AllocSetContextCreate(CurrentMemoryContext,
+									"vgram estimate",
+									ALLOCSET_DEFAULT_MINSIZE,
+									ALLOCSET_DEFAULT_INITSIZE,
+									ALLOCSET_DEFAULT_MAXSIZE);
+	rowContext = AllocSetContextCreate(context,
+									   "vgram estimate row",
+									   ALLOCSET_DEFAULT_MINSIZE,
+									   ALLOCSET_DEFAULT_INITSIZE,
+									   ALLOCSET_DEFAULT_MAXSIZE);
+	oldContext = MemoryContextSwitchTo(context);
+
+	configs = (EstimateConfig *) palloc(sizeof(EstimateConfig) * nconfigs);
+	keysHashCtl.keysize = sizeof(QGramHashKey);
+	keysHashCtl.entrysize = sizeof(QGramHashValue);
+	keysHashCtl.hcxt = context;
+	keysHashCtl.hash = qgram_key_hash;
+	keysHashCtl.match = qgram_key_match;
+	for (i = 0; i < maxQ - minQ; i++)
+	{
+		for (j = 0; j < N_LIMIT_MULTIPLIERS; j++)
+		{
+			EstimateConfig *config = &configs[i * N_LIMIT_MULTIPLIERS + j];
+
+			config->maxLength = maxQ - i;
+			config->limitFrequency = (j == 0) ? 0.0f :
+				baseLimit * limitMultipliers[j];
+			config->keysHash = hash_create("vgram estimate keys hash",
+										   1024,
+										   &keysHashCtl,
+										   HASH_ELEM | HASH_CONTEXT
+										   | HASH_FUNCTION | HASH_COMPARE);
+			config->postings = 0.0;
+			config->extractTime = 0.0;
+		}
+	}
+
+	SPI_connect();
+
+	query = psprintf("SELECT reltuples FROM pg_class WHERE oid = %u", relid);
+	if (SPI_execute(query, true, 1) != SPI_OK_SELECT || SPI_processed != 1)
+		elog(ERROR, "Can't read pg_class entry of relation %u.", relid);
+	totalRows = DatumGetFloat4(SPI_getbinval(SPI_tuptable->vals[0],
+											 SPI_tuptable->tupdesc, 1,
+											 &isnull));
+
+	query = psprintf("SELECT %s FROM %s TABLESAMPLE SYSTEM (%g)",
+					 quote_identifier(text_to_cstring(attname)),
+					 quote_qualified_identifier(get_namespace_name(get_rel_namespace(relid)),
+												get_rel_name(relid)),
+					 (double) samplePercent);
+	plan = SPI_prepare(query, 0, NULL);
+	if (!plan)
+		elog(ERROR, "Can't prepare sampling query \"%s\".", query);
+	portal = SPI_cursor_open(NULL, plan, NULL, NULL, true);
+
+	for (;;)
+	{
+		SPI_cursor_fetch(portal, true, 1000);
+		if (SPI_processed == 0)
+			break;
+
+		if (SPI_gettypeid(SPI_tuptable->tupdesc, 1) != TEXTOID)
+			elog(ERROR, "Estimated column must be text.");
+
+		for (i = 0; i < SPI_processed; i++)
+		{
+			Datum		value;
+			text	   *s;
+			MemoryContext spiContext;
+
+			value = SPI_getbinval(SPI_tuptable->vals[i],
+								  SPI_tuptable->tupdesc, 1, &isnull);
+			sampleRows += 1.0;
+			if (isnull)
+				continue;
+
+			spiContext = MemoryContextSwitchTo(rowContext);
+			s = DatumGetTextPP(value);
+			for (j = 0; j < nconfigs; j++)
+				estimateRow(&configs[j], s, context);
+			MemoryContextSwitchTo(spiContext);
+			MemoryContextReset(rowContext);
+		}
+		SPI_freetuptable(SPI_tuptable);
+	}
+	SPI_cursor_close(portal);
+	SPI_finish();
+
+	/* Table was never analyzed, extrapolate the sample */
+	if (totalRows <= 0.0)
+		totalRows = sampleRows * 100.0 / samplePercent;
+
+	for (j = 0; j < nconfigs; j++)
+	{
+		estimateConfigResult(&configs[j], sampleRows, totalRows, &results[j]);
+		if (results[j].limitFrequency == 0.0f)
+			results[j].limitFrequency = baseLimit;
+	}
+
+	MemoryContextSwitchTo(oldContext);
+	MemoryContextDelete(context);
+
+	*nresults = nconfigs;
+	return results;
+}
+
+Datum
+vgram_estimate_index(PG_FUNCTION_ARGS)
+{
+	FuncCallContext *funcctx;
+	EstimateResult *results;
+
+	if (SRF_IS_FIRSTCALL())
+	{
+		MemoryContext oldContext;
+		TupleDesc	tupdesc;
+		int			nresults;
+
+		funcctx = SRF_FIRSTCALL_INIT();
+		oldContext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
+
+		if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+			elog(ERROR, "return type must be a row type");
+		funcctx->tuple_desc = BlessTupleDesc(tupdesc);
+
+		funcctx->user_fctx = estimateIndex(PG_GETARG_OID(0),
+										   PG_GETARG_TEXT_PP(1),
+										   PG_GETARG_FLOAT4(2),
+										   &nresults);
+		funcctx->max_calls = nresults;
+
+		MemoryContextSwitchTo(oldContext);
+	}
+
+	funcctx = SRF_PERCALL_SETUP();
+	results = (EstimateResult *) funcctx->user_fctx;
+
+	if (funcctx->call_cntr < funcctx->max_calls)
+	{
+		EstimateResult *result = &results[funcctx->call_cntr];
+		Datum		values[6];
+		bool		nulls[6] = {false, false, false, false, false, false};
+		HeapTuple	tuple;
+
+		values[0] = Int32GetDatum(result->maxLength);
+		values[1] = Float4GetDatum(result->limitFrequency);
+		values[2] = Float8GetDatum(result->distinctKeys);
+		values[3] = Float8GetDatum(result->totalPostings);
+		values[4] = Int64GetDatum((int64) result->indexSize);
+		values[5] = Float8GetDatum(result->buildTime);
+
+		tuple = heap_form_tuple(funcctx->tuple_desc, values, nulls);
+		SRF_RETURN_NEXT(funcctx, HeapTupleGetDatum(tuple));
+	}
+
+	SRF_RETURN_DONE(funcctx);
+}
+
+static int
+int64Cmp(const void *a1, const void *a2)
+{
+	int64		v1 = *((const int64 *) a1);
+	int64		v2 = *((const int64 *) a2);
+
+	if (v1 < v2)
+		return -1;
+	else if (v1 > v2)
+		return 1;
+	return 0;
+}
+
+/*
+ * Estimate number of rows matching like/ilike pattern without touching the
+ * heap.  Only sizes of posting lists of pattern V-grams are read from the
+ * entry tree.  The smallest posting list together with the pending list
+ * gives the upper bound.  V-grams of the same pattern are strongly
+ * correlated, so instead of multiplying their selectivities, selectivity of
+ * each next rarest V-gram is damped by square root of the previous one's
+ * exponent.  Index contains entries of dead rows until vacuum, so no positive
+ * lower bound could be given.  Keys are lowercased, so estimate is the same
+ * for like and ilike.  Posting list sizes reveal table contents, so SELECT
+ * privilege on the table is required.
+ */
+Datum
+vgram_estimate_count(PG_FUNCTION_ARGS)
+{
+	Oid			indexOid = PG_GETARG_OID(0);
+	text	   *pattern = PG_GETARG_TEXT_PP(1);
+	Relation	indexRel,
+				heapRel;
+	TupleDesc	tupdesc;
+	Datum		values[3];
+	bool		nulls[3] = {false, false, false};
+	Datum	   *entries;
+	int32		nentries,
+				i;
+	int64	   *counts,
+				pending;
+	double		totalRows,
+				estimate,
+				exponent = 1.0;
+
+	if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+		elog(ERROR, "return type must be a row type");
+
+	loadStats();
+	entries = extractQueryLike(&nentries, pattern);
+
+	indexRel = index_open(indexOid, AccessShareLock);
+	if (indexRel->rd_rel->relam != GIN_AM_OID ||
+		!OidIsValid(get_opfamily_member(indexRel->rd_opfamily[0], TEXTOID,
+										TEXTARRAYOID, KeysMatchStrategyNumber)))
+		elog(ERROR, "Index \"%s\" isn't V-gram index.",
+			 RelationGetRelationName(indexRel));
+	checkIndexedTableSelect(indexRel);
+
+	heapRel = relation_open(indexRel->rd_index->indrelid, AccessShareLock);
+	totalRows = Max(heapRel->rd_rel->reltuples, 0.0);
+	relation_close(heapRel, AccessShareLock);
+
+	counts = (int64 *) palloc(sizeof(int64) * Max(nentries, 1));
+	for (i = 0; i < nentries; i++)
+	{
+		char	   *vgram = text_to_cstring(DatumGetTextPP(entries[i]));
+
+		CHECK_FOR_INTERRUPTS();
+		counts[i] = getIndexKeyCount(indexRel, vgram);
+		totalRows = Max(totalRows, (double) counts[i]);
+		pfree(vgram);
+	}
+	pending = getIndexPendingTuples(indexRel);
+	index_close(indexRel, AccessShareLock);
+
+	if (nentries == 0)
+	{
+		/* Pattern without V-grams could match any row */
+		estimate = totalRows;
+	}
+	else
+	{
+		qsort(counts, nentries, sizeof(int64), int64Cmp);
+		estimate = (double) counts[0];
+		for (i = 1; i < nentries && totalRows > 0.0; i++)
+		{
+			exponent /= 2.0;
+			estimate *= pow((double) counts[i] / totalRows, exponent);
+		}
+	}
+
+	values[0] = Float8GetDatum(estimate);
+	values[1] = Float8GetDatum(0.0);
+	values[2] = Float8GetDatum((nentries > 0 ? (double) counts[0] : totalRows) +
+							   (double) pending);
+
+	PG_RETURN_DATUM(HeapTupleGetDatum(heap_form_tuple(BlessTupleDesc(tupdesc),
+													  values, nulls)));
+}
@@ -13,8 +13,14 @@
 #include "postgres.h"
 #include "access/gin.h"
 #include "access/skey.h"
+#include "catalog/pg_type.h"
 #include "fmgr.h"
+#include "access/hash.h"
+#include "lib/ilist.h"
+#include "utils/array.h"
 #include "utils/builtins.h"
+#include "utils/hsearch.h"
+#include "utils/memutils.h"
 
 #include "vgram.h"
 
@@ -38,6 +44,26 @@ Datum		vgram_gin_extract_query(PG_FUNCTION_ARGS);
 
 PG_FUNCTION_INFO_V1(vgram_gin_extract_query);
 
+Datum		vgram_gin_compare_partial(PG_FUNCTION_ARGS);
+
+PG_FUNCTION_INFO_V1(vgram_gin_compare_partial);
+
+Datum		vgram_pattern_extract_value(PG_FUNCTION_ARGS);
+
+PG_FUNCTION_INFO_V1(vgram_pattern_extract_value);
+
+Datum		vgram_pattern_extract_query(PG_FUNCTION_ARGS);
+
+PG_FUNCTION_INFO_V1(vgram_pattern_extract_query);
+
+Datum		vgram_pattern_consistent(PG_FUNCTION_ARGS);
+
+PG_FUNCTION_INFO_V1(vgram_pattern_consistent);
+
+Datum		vgram_pattern_triconsistent(PG_FUNCTION_ARGS);
+
+PG_FUNCTION_INFO_V1(vgram_pattern_triconsistent);
+
 static int
 vgram_cmp_internal(Datum d1, Datum d2)
 {
@@ -132,6 +158,9 @@ vgram_gin_extract_value(PG_FUNCTION_ARGS)
 
 	loadStats();
 
+	/* Index is going to be changed, cached results become outdated */
+	resultCacheInvalidateAtEOXact();
+
 	info.nentries = 0;
 	info.allocatedEntries = 4;
 	info.entries = (Datum *) palloc(sizeof(Datum) * info.allocatedEntries);
@@ -149,6 +178,18 @@ vgram_gin_extract_value(PG_FUNCTION_ARGS)
 	PG_RETURN_POINTER(info.entries);
 }
 
+/*
+ * Mapping of like/ilike patterns to indexes of their V-grams in the entries
+ * array.  V-grams of i-th pattern are keyIndexes[offsets[i]] ...
+ * keyIndexes[offsets[i + 1] - 1].
+ */
+typedef struct
+{
+	int32		npatterns;
+	int32	   *offsets;
+	int32	   *keyIndexes;
+} LikeAnyQuery;
+
 Datum
 vgram_gin_consistent(PG_FUNCTION_ARGS)
 {
@@ -158,12 +199,12 @@ vgram_gin_consistent(PG_FUNCTION_ARGS)
 	/* text    *query = PG_GETARG_TEXT_P(2); */
 	int32		nkeys = PG_GETARG_INT32(3);
 
-	/* Pointer	  *extra_data = (Pointer *) PG_GETARG_POINTER(4); */
+	Pointer    *extra_data = (Pointer *) PG_GETARG_POINTER(4);
 	bool	   *recheck = (bool *) PG_GETARG_POINTER(5);
 	bool		res;
 	int32		i;
 
-	/* All cases served by this function are inexact */
+	/* Only exact ilike patterns don't need recheck, see isExactPattern() */
 	*recheck = true;
 
 	switch (strategy)
@@ -180,6 +221,44 @@ vgram_gin_consistent(PG_FUNCTION_ARGS)
 					break;
 				}
 			}
+			if (res && extra_data && extra_data[0])
+				*recheck = false;
+			break;
+		case KeysMatchStrategyNumber:
+			/* Check if any of given V-gram prefixes is presented. */
+			res = false;
+			for (i = 0; i < nkeys; i++)
+			{
+				if (check[i])
+				{
+					res = true;
+					break;
+				}
+			}
+			break;
+		case LikeAnyStrategyNumber:
+		case ILikeAnyStrategyNumber:
+			/* Check if all V-grams of any pattern are presented. */
+			res = true;
+			if (nkeys > 0)
+			{
+				LikeAnyQuery *query = (LikeAnyQuery *) extra_data[0];
+				int32		j;
+
+				res = false;
+				for (i = 0; i < query->npatterns && !res; i++)
+				{
+					res = true;
+					for (j = query->offsets[i]; j < query->offsets[i + 1]; j++)
+					{
+						if (!check[query->keyIndexes[j]])
+						{
+							res = false;
+							break;
+						}
+					}
+				}
+			}
 			break;
 		default:
 			elog(ERROR, "unrecognized strategy number: %d", strategy);
@@ -199,7 +278,7 @@ vgram_gin_triconsistent(PG_FUNCTION_ARGS)
 	/* text    *query = PG_GETARG_TEXT_P(2); */
 	int32		nkeys = PG_GETARG_INT32(3);
 
-	/* Pointer	  *extra_data = (Pointer *) PG_GETARG_POINTER(4); */
+	Pointer    *extra_data = (Pointer *) PG_GETARG_POINTER(4);
 	GinTernaryValue res = GIN_MAYBE;
 	int32		i;
 
@@ -216,6 +295,44 @@ vgram_gin_triconsistent(PG_FUNCTION_ARGS)
 					break;
 				}
 			}
+			if (res == GIN_MAYBE && extra_data && extra_data[0] &&
+				nkeys == 1 && check[0] == GIN_TRUE)
+				res = GIN_TRUE;
+			break;
+		case KeysMatchStrategyNumber:
+			/* Check if any of given V-gram prefixes is presented. */
+			res = GIN_FALSE;
+			for (i = 0; i < nkeys; i++)
+			{
+				if (check[i] != GIN_FALSE)
+				{
+					res = GIN_MAYBE;
+					break;
+				}
+			}
+			break;
+		case LikeAnyStrategyNumber:
+		case ILikeAnyStrategyNumber:
+			/* Check if all V-grams of any pattern could be presented. */
+			if (nkeys > 0)
+			{
+				LikeAnyQuery *query = (LikeAnyQuery *) extra_data[0];
+				int32		j;
+
+				res = GIN_FALSE;
+				for (i = 0; i < query->npatterns && res == GIN_FALSE; i++)
+				{
+					res = GIN_MAYBE;
+					for (j = query->offsets[i]; j < query->offsets[i + 1]; j++)
+					{
+						if (check[query->keyIndexes[j]] == GIN_FALSE)
+						{
+							res = GIN_FALSE;
+							break;
+						}
+					}
+				}
+			}
 			break;
 		default:
 			elog(ERROR, "unrecognized strategy number: %d", strategy);
@@ -223,20 +340,291 @@ vgram_gin_triconsistent(PG_FUNCTION_ARGS)
 			break;
 	}
 
-	/* All cases served by this function are inexact */
-	Assert(res != GIN_TRUE);
 	PG_RETURN_GIN_TERNARY_VALUE(res);
 }
 
+/*
+ * Backend-local cache of V-grams extracted from like/ilike patterns.  Cache
+ * is bounded by vgram.query_cache_size entries, least recently used entries
+ * are evicted.  Whole cache is discarded when statistics is reloaded.
+ */
+typedef struct
+{
+	StrategyNumber strategy;
+	text	   *pattern;
+} QueryCacheKey;
+
+typedef struct
+{
+	QueryCacheKey key;
+	dlist_node	lruNode;
+	int32		nentries;
+	Datum	   *entries;
+} QueryCacheEntry;
+
+static HTAB *queryCache = NULL;
+static MemoryContext queryCacheContext = NULL;
+static dlist_head queryCacheLRU;
+static uint32 queryCacheGeneration = 0;
+
+static uint32
+query_cache_key_hash(const void *key, Size keysize)
+{
+	const QueryCacheKey *cacheKey = (const QueryCacheKey *) key;
+
+	return DatumGetUInt32(hash_any((const unsigned char *) VARDATA_ANY(cacheKey->pattern),
+								   VARSIZE_ANY_EXHDR(cacheKey->pattern)))
+		^ (uint32) cacheKey->strategy;
+}
+
+static int
+query_cache_key_match(const void *key1, const void *key2, Size keysize)
+{
+	const QueryCacheKey *cacheKey1 = (const QueryCacheKey *) key1;
+	const QueryCacheKey *cacheKey2 = (const QueryCacheKey *) key2;
+	int			len1 = VARSIZE_ANY_EXHDR(cacheKey1->pattern),
+				len2 = VARSIZE_ANY_EXHDR(cacheKey2->pattern);
+
+	if (cacheKey1->strategy != cacheKey2->strategy || len1 != len2)
+		return 1;
+	return memcmp(VARDATA_ANY(cacheKey1->pattern),
+				  VARDATA_ANY(cacheKey2->pattern), len1);
+}
+
+/*
+ * Create query cache or discard its contents when statistics was changed.
+ */
+static void
+queryCacheInit(void)
+{
+	HASHCTL		ctl;
+
+	if (queryCache && queryCacheGeneration == statsGeneration)
+		return;
+
+	if (!queryCacheContext)
+		queryCacheContext = AllocSetContextCreate(TopMemoryContext,
+												  "vgram query cache",
+												  ALLOCSET_DEFAULT_MINSIZE,
+												  ALLOCSET_DEFAULT_INITSIZE,
+												  ALLOCSET_DEFAULT_MAXSIZE);
+	else
+		MemoryContextReset(queryCacheContext);
+
+	ctl.keysize = sizeof(QueryCacheKey);
+	ctl.entrysize = sizeof(QueryCacheEntry);
+	ctl.hcxt = queryCacheContext;
+	ctl.hash = query_cache_key_hash;
+	ctl.match = query_cache_key_match;
+	queryCache = hash_create("vgram query cache",
+							 256,
+							 &ctl,
+							 HASH_ELEM | HASH_CONTEXT
+							 | HASH_FUNCTION | HASH_COMPARE);
+	dlist_init(&queryCacheLRU);
+	queryCacheGeneration = statsGeneration;
+}
+
+/**
+ * Search query cache for V-grams extracted from the pattern.
+ *
+ * @param strategy Strategy number
+ * @param pattern like/ilike pattern
+ * @param nentries Receives number of V-grams
+ * @return Copy of cached V-grams or NULL if not found
+ */
+static Datum *
+queryCacheLookup(StrategyNumber strategy, text *pattern, int32 *nentries)
+{
+	QueryCacheKey key;
+	QueryCacheEntry *entry;
+	Datum	   *entries;
+	int32		i;
+
+	if (vgramQueryCacheSize <= 0)
+		return NULL;
+	queryCacheInit();
+
+	key.strategy = strategy;
+	key.pattern = pattern;
+	entry = (QueryCacheEntry *) hash_search(queryCache, (const void *) &key,
+											HASH_FIND, NULL);
+	if (!entry)
+		return NULL;
+
+	dlist_move_head(&queryCacheLRU, &entry->lruNode);
+
+	/* GIN scan keeps entries, so they must survive cache eviction */
+	entries = (Datum *) palloc(sizeof(Datum) * Max(entry->nentries, 1));
+	for (i = 0; i < entry->nentries; i++)
+		entries[i] = PointerGetDatum(DatumGetTextPCopy(entry->entries[i]));
+	*nentries = entry->nentries;
+	return entries;
+}
+
+/**
+ * Put V-grams extracted from the pattern into query cache evicting least
+ * recently used entry if needed.
+ */
+static void
+queryCacheStore(StrategyNumber strategy, text *pattern, Datum *entries,
+				int32 nentries)
+{
+	QueryCacheKey key;
+	QueryCacheEntry *entry;
+	MemoryContext oldContext;
+	bool		found;
+	int32		i;
+
+	if (vgramQueryCacheSize <= 0)
+		return;
+	queryCacheInit();
+
+	while (hash_get_num_entries(queryCache) >= vgramQueryCacheSize)
+	{
+		QueryCacheEntry *victim;
+
+		victim = dlist_container(QueryCacheEntry, lruNode,
+								 dlist_tail_node(&queryCacheLRU));
+		dlist_delete(&victim->lruNode);
+		for (i = 0; i < victim->nentries; i++)
+			pfree(DatumGetPointer(victim->entries[i]));
+		pfree(victim->entries);
+		key = victim->key;
+		hash_search(queryCache, (const void *) &key, HASH_REMOVE, NULL);
+		pfree(key.pattern);
+	}
+
+	key.strategy = strategy;
+	key.pattern = pattern;
+	entry = (QueryCacheEntry *) hash_search(queryCache, (const void *) &key,
+											HASH_ENTER, &found);
+	if (found)
+		return;
+
+	oldContext = MemoryContextSwitchTo(queryCacheContext);
+	entry->key.pattern = DatumGetTextPCopy(PointerGetDatum(pattern));
+	entry->nentries = nentries;
+	entry->entries = (Datum *) palloc(sizeof(Datum) * Max(nentries, 1));
+	for (i = 0; i < nentries; i++)
+		entry->entries[i] = PointerGetDatum(DatumGetTextPCopy(entries[i]));
+	dlist_push_head(&queryCacheLRU, &entry->lruNode);
+	MemoryContextSwitchTo(oldContext);
+}
+
+/**
+ * Extract V-grams of all like/ilike patterns of the array.  V-grams shared
+ * by patterns are extracted once, so their posting lists are read once per
+ * scan.  Mapping of patterns to their V-grams is passed to consistent
+ * functions in extra_data[0].
+ *
+ * @param patterns Array of patterns
+ * @param strategy LikeAnyStrategyNumber or ILikeAnyStrategyNumber
+ * @param nentries Receives number of V-grams
+ * @param extra_data Receives extra data of V-grams
+ * @param searchMode Receives GIN search mode
+ * @return V-grams
+ */
+static Datum *
+extractQueryLikeAny(ArrayType *patterns, StrategyNumber strategy,
+					int32 *nentries, Pointer **extra_data, int32 *searchMode)
+{
+	StrategyNumber patternStrategy;
+	LikeAnyQuery *query;
+	Datum	   *elems,
+			   *entries,
+			  **patternEntries;
+	bool	   *nulls;
+	int32	   *patternNentries;
+	int			nelems,
+				i,
+				j,
+				total = 0;
+
+	patternStrategy = (strategy == LikeAnyStrategyNumber) ?
+		LikeStrategyNumber : ILikeStrategyNumber;
+
+	deconstruct_array(patterns, TEXTOID, -1, false, 'i',
+					  &elems, &nulls, &nelems);
+
+	query = (LikeAnyQuery *) palloc(sizeof(LikeAnyQuery));
+	query->npatterns = 0;
+	query->offsets = (int32 *) palloc(sizeof(int32) * (nelems + 1));
+	patternEntries = (Datum **) palloc(sizeof(Datum *) * Max(nelems, 1));
+	patternNentries = (int32 *) palloc(sizeof(int32) * Max(nelems, 1));
+
+	/* Null pattern never matches, so it's just skipped */
+	for (i = 0; i < nelems; i++)
+	{
+		text	   *val;
+		int			n = query->npatterns;
+
+		if (nulls[i])
+			continue;
+
+		val = DatumGetTextP(elems[i]);
+		patternEntries[n] = queryCacheLookup(patternStrategy, val,
+											 &patternNentries[n]);
+		if (!patternEntries[n])
+		{
+			patternEntries[n] = extractQueryLike(&patternNentries[n], val);
+			entries_unique(patternEntries[n], &patternNentries[n]);
+			queryCacheStore(patternStrategy, val, patternEntries[n],
+							patternNentries[n]);
+		}
+
+		/* Pattern without V-grams matches any document */
+		if (patternNentries[n] == 0)
+			*searchMode = GIN_SEARCH_MODE_ALL;
+
+		total += patternNentries[n];
+		query->npatterns++;
+	}
+
+	entries = (Datum *) palloc(sizeof(Datum) * Max(total, 1));
+	*nentries = 0;
+	for (i = 0; i < query->npatterns; i++)
+	{
+		memcpy(entries + *nentries, patternEntries[i],
+			   sizeof(Datum) * patternNentries[i]);
+		*nentries += patternNentries[i];
+	}
+	entries_unique(entries, nentries);
+
+	query->keyIndexes = (int32 *) palloc(sizeof(int32) * Max(total, 1));
+	total = 0;
+	for (i = 0; i < query->npatterns; i++)
+	{
+		query->offsets[i] = total;
+		for (j = 0; j < patternNentries[i]; j++)
+		{
+			Datum	   *found;
+
+			found = (Datum *) bsearch(&patternEntries[i][j], entries,
+									  *nentries, sizeof(Datum),
+									  vgram_sort_cmp);
+			Assert(found);
+			query->keyIndexes[total++] = found - entries;
+		}
+	}
+	query->offsets[query->npatterns] = total;
+
+	if (*nentries > 0)
+	{
+		*extra_data = (Pointer *) palloc0(sizeof(Pointer) * *nentries);
+		(*extra_data)[0] = (Pointer) query;
+	}
+
+	return entries;
+}
+
 Datum
 vgram_gin_extract_query(PG_FUNCTION_ARGS)
 {
-	text	   *val = (text *) PG_GETARG_TEXT_P(0);
 	int32	   *nentries = (int32 *) PG_GETARG_POINTER(1);
 	StrategyNumber strategy = PG_GETARG_UINT16(2);
-
-	/* bool   **pmatch = (bool **) PG_GETARG_POINTER(3); */
-	/* Pointer	  *extra_data = (Pointer *) PG_GETARG_POINTER(4); */
+	bool	  **pmatch = (bool **) PG_GETARG_POINTER(3);
+	Pointer   **extra_data = (Pointer **) PG_GETARG_POINTER(4);
 	/* bool   **nullFlags = (bool **) PG_GETARG_POINTER(5); */
 	int32	   *searchMode = (int32 *) PG_GETARG_POINTER(6);
 	Datum	   *entries = NULL;
@@ -247,16 +635,60 @@ vgram_gin_extract_query(PG_FUNCTION_ARGS)
 	{
 		case ILikeStrategyNumber:
 		case LikeStrategyNumber:
+			{
+				text	   *val = PG_GETARG_TEXT_P(0);
 
-			entries = extractQueryLike(nentries, val);
+				entries = queryCacheLookup(strategy, val, nentries);
+				if (!entries)
+				{
+					entries = extractQueryLike(nentries, val);
+					entries_unique(entries, nentries);
+					queryCacheStore(strategy, val, entries, *nentries);
+				}
+
+				/* Mark exact patterns for consistent functions */
+				if (strategy == ILikeStrategyNumber &&
+					isExactPattern(val, entries, *nentries))
+				{
+					*extra_data = (Pointer *) palloc0(sizeof(Pointer) * *nentries);
+					(*extra_data)[0] = (Pointer) entries[0];
+				}
+			}
 			break;
+		case KeysMatchStrategyNumber:
+			{
+				ArrayType  *keys = PG_GETARG_ARRAYTYPE_P(0);
+				bool	   *nulls;
+				int32		i,
+							j = 0;
+
+				deconstruct_array(keys, TEXTOID, -1, false, 'i',
+								  &entries, &nulls, nentries);
+				for (i = 0; i < *nentries; i++)
+				{
+					if (!nulls[i])
+						entries[j++] = entries[i];
+				}
+				*nentries = j;
+
+				/* Given V-grams are prefixes of keys to be matched */
+				*pmatch = (bool *) palloc(sizeof(bool) * Max(j, 1));
+				for (i = 0; i < j; i++)
+					(*pmatch)[i] = true;
+
+				entries_unique(entries, nentries);
+				PG_RETURN_POINTER(entries);
+			}
+		case LikeAnyStrategyNumber:
+		case ILikeAnyStrategyNumber:
+			entries = extractQueryLikeAny(PG_GETARG_ARRAYTYPE_P(0), strategy,
+										  nentries, extra_data, searchMode);
+			PG_RETURN_POINTER(entries);
 		default:
 			elog(ERROR, "unrecognized strategy number: %d", strategy);
 			break;
 	}
 
-	entries_unique(entries, nentries);
-
 	/*
 	 * If no trigram was extracted then we have to scan all the index.
 	 */
@@ -265,3 +697,123 @@ vgram_gin_extract_query(PG_FUNCTION_ARGS)
 
 	PG_RETURN_POINTER(entries);
 }
+
+Datum
+vgram_gin_compare_partial(PG_FUNCTION_ARGS)
+{
+	text	   *partial = PG_GETARG_TEXT_PP(0);
+	text	   *key = PG_GETARG_TEXT_PP(1);
+	StrategyNumber strategy = PG_GETARG_UINT16(2);
+	int			partialLen = VARSIZE_ANY_EXHDR(partial);
+
+	if (strategy != KeysMatchStrategyNumber)
+		elog(ERROR, "unrecognized strategy number: %d", strategy);
+
+	/*
+	 * Keys are scanned starting from the partial key, so the first key
+	 * without given prefix finishes the scan.
+	 */
+	if (VARSIZE_ANY_EXHDR(key) >= partialLen &&
+		memcmp(VARDATA_ANY(key), VARDATA_ANY(partial), partialLen) == 0)
+		PG_RETURN_INT32(0);
+	PG_RETURN_INT32(1);
+}
+
+/*
+ * Index over like/ilike patterns.  Every pattern is indexed by its rarest
+ * V-gram, which is contained in every matching document.  Patterns without
+ * V-grams are indexed by empty key, which is always searched.  So, matching
+ * patterns are looked up by V-grams of the document, and the search cost
+ * depends on the document size rather than on the number of patterns.
+ */
+Datum
+vgram_pattern_extract_value(PG_FUNCTION_ARGS)
+{
+	text	   *pattern = PG_GETARG_TEXT_PP(0);
+	int32	   *nentries = (int32 *) PG_GETARG_POINTER(1);
+	Datum	   *entries;
+	char	   *vgram;
+
+	loadStats();
+
+	vgram = getRarestVGram(pattern);
+	entries = (Datum *) palloc(sizeof(Datum));
+	entries[0] = PointerGetDatum(cstring_to_text(vgram ? vgram : ""));
+	*nentries = 1;
+
+	PG_RETURN_POINTER(entries);
+}
+
+Datum
+vgram_pattern_extract_query(PG_FUNCTION_ARGS)
+{
+	text	   *s = PG_GETARG_TEXT_PP(0);
+	int32	   *nentries = (int32 *) PG_GETARG_POINTER(1);
+	StrategyNumber strategy = PG_GETARG_UINT16(2);
+	ExtractValueInfo info;
+	ExtractVGramsInfo userData;
+
+	if (strategy != PatternLikeStrategyNumber &&
+		strategy != PatternILikeStrategyNumber)
+		elog(ERROR, "unrecognized strategy number: %d", strategy);
+
+	loadStats();
+
+	info.nentries = 1;
+	info.allocatedEntries = 4;
+	info.entries = (Datum *) palloc(sizeof(Datum) * info.allocatedEntries);
+
+	/* Patterns without V-grams are candidates for any document */
+	info.entries[0] = PointerGetDatum(cstring_to_text(""));
+
+	userData.callback = extractVGram;
+	userData.userData = &info;
+
+	extractWords(VARDATA_ANY(s), VARSIZE_ANY_EXHDR(s), extractMinimalVGramsWord, &userData);
+
+	entries_unique(info.entries, &info.nentries);
+
+	*nentries = info.nentries;
+	PG_RETURN_POINTER(info.entries);
+}
+
+Datum
+vgram_pattern_consistent(PG_FUNCTION_ARGS)
+{
+	bool	   *check = (bool *) PG_GETARG_POINTER(0);
+
+	/* StrategyNumber strategy = PG_GETARG_UINT16(1); */
+	/* text    *query = PG_GETARG_TEXT_P(2); */
+	int32		nkeys = PG_GETARG_INT32(3);
+
+	/* Pointer    *extra_data = (Pointer *) PG_GETARG_POINTER(4); */
+	bool	   *recheck = (bool *) PG_GETARG_POINTER(5);
+	int32		i;
+
+	/* Pattern has the only key, so any of keys present gives candidate */
+	*recheck = true;
+	for (i = 0; i < nkeys; i++)
+	{
+		if (check[i])
+			PG_RETURN_BOOL(true);
+	}
+	PG_RETURN_BOOL(false);
+}
+
+Datum
+vgram_pattern_triconsistent(PG_FUNCTION_ARGS)
+{
+	GinTernaryValue *check = (GinTernaryValue *) PG_GETARG_POINTER(0);
+
+	/* StrategyNumber strategy = PG_GETARG_UINT16(1); */
+	/* text    *query = PG_GETARG_TEXT_P(2); */
+	int32		nkeys = PG_GETARG_INT32(3);
+	int32		i;
+
+	for (i = 0; i < nkeys; i++)
+	{
+		if (check[i] != GIN_FALSE)
+			PG_RETURN_GIN_TERNARY_VALUE(GIN_MAYBE);
+	}
+	PG_RETURN_GIN_TERNARY_VALUE(GIN_FALSE);
+}
@@ -0,0 +1,543 @@
+/*-------------------------------------------------------------------------
+ *
+ * vgram_join.c
+ *		Routines for joining table of like/ilike patterns against documents
+ *		indexed by V-gram index.
+ *
+ * Copyright (c) 2011-2017, Alexander Korotkov
+ *
+ * IDENTIFICATION
+ *	  contrib/vgram/vgram_join.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+#include "fmgr.h"
+#include "funcapi.h"
+#include "miscadmin.h"
+#include "access/genam.h"
+#include "access/htup_details.h"
+#include "catalog/pg_collation.h"
+#include "catalog/pg_operator.h"
+#include "catalog/pg_type.h"
+#include "executor/executor.h"
+#include "executor/spi.h"
+#include "lib/binaryheap.h"
+#include "storage/itemptr.h"
+#include "utils/array.h"
+#include "utils/builtins.h"
+#include "utils/lsyscache.h"
+#include "utils/memutils.h"
+#include "utils/rel.h"
+#include "utils/syscache.h"
+
+#include "vgram.h"
+
+Datum		vgram_like_join(PG_FUNCTION_ARGS);
+
+PG_FUNCTION_INFO_V1(vgram_like_join);
+
+/*
+ * Pattern together with V-gram its candidates are taken from.  Patterns
+ * without V-grams have NULL driving V-gram and are checked against the whole
+ * table.
+ */
+typedef struct
+{
+	char	   *vgram;
+	int32		patternNo;
+} JoinPattern;
+
+typedef struct
+{
+	int32		patternNo;
+	ItemPointerData ctid;
+} JoinResult;
+
+typedef struct
+{
+	JoinPattern *patterns;
+	Datum	   *patternValues;
+	int			npatterns,
+				nextPattern,
+				groupStart,
+				groupEnd;
+	PGFunction	likeFunc;
+	SPIPlanPtr	indexPlan,
+				scanPlan;
+	char	   *portalName;
+	MemoryContext context,
+				resultsContext;
+	JoinResult *results;
+	int64		nresults,
+				nextResult;
+} LikeJoinState;
+
+/*
+ * V-gram of patterns considered as driving one.  Its posting list is scanned
+ * once for all the patterns it's chosen for.
+ */
+typedef struct
+{
+	QGramHashKey key;
+	float4		selectivity;
+	int		   *patterns;		/* indexes of patterns containing V-gram */
+	int			npatterns,
+				allocated,
+				nuncovered;		/* patterns not assigned to any V-gram yet */
+} JoinVGram;
+
+/*
+ * V-gram in the heap of greedy cover with the cost it was pushed with.
+ */
+typedef struct
+{
+	JoinVGram  *vgram;
+	double		cost;
+} JoinVGramCost;
+
+static double
+joinVGramCost(JoinVGram *vgram)
+{
+	return (double) vgram->selectivity / (double) vgram->nuncovered;
+}
+
+/*
+ * Cheaper V-gram goes first in the heap, ties are broken by selectivity and
+ * then by V-gram itself for stable grouping.
+ */
+static int
+joinVGramCostCmp(Datum a, Datum b, void *arg)
+{
+	JoinVGramCost *ca = (JoinVGramCost *) DatumGetPointer(a);
+	JoinVGramCost *cb = (JoinVGramCost *) DatumGetPointer(b);
+
+	if (ca->cost != cb->cost)
+		return (ca->cost < cb->cost) ? 1 : -1;
+	if (ca->vgram->selectivity != cb->vgram->selectivity)
+		return (ca->vgram->selectivity < cb->vgram->selectivity) ? 1 : -1;
+	return strcmp(cb->vgram->key.qgram, ca->vgram->key.qgram);
+}
+
+/**
+ * Choose driving V-grams of patterns.  Candidates of V-gram are fetched once
+ * for all the patterns it drives, so the fetching cost estimated by V-gram
+ * selectivity is shared between them.  V-grams are chosen greedily by the
+ * cost per pattern not covered yet, which prefers V-grams shared by many
+ * patterns, unless they are much more frequent than the rarest V-grams of
+ * individual patterns.  Costs only grow as patterns get covered, so stale
+ * heap entries are just pushed back with the actual cost.
+ *
+ * @param patterns Patterns to assign driving V-grams
+ * @param npatterns Number of patterns
+ * @param patternValues Pattern texts indexed by pattern number
+ */
+static void
+chooseDrivingVGrams(JoinPattern *patterns, int npatterns, Datum *patternValues)
+{
+	HASHCTL		hashCtl;
+	HTAB	   *vgramsHash;
+	HASH_SEQ_STATUS status;
+	JoinVGram  *vgram;
+	JoinVGram ***patternVGrams;
+	int		   *patternNVGrams;
+	binaryheap *heap;
+	JoinVGramCost *costs;
+	int			nvgrams,
+				i,
+				j;
+
+	memset(&hashCtl, 0, sizeof(hashCtl));
+	hashCtl.keysize = sizeof(QGramHashKey);
+	hashCtl.entrysize = sizeof(JoinVGram);
+	hashCtl.hash = qgram_key_hash;
+	hashCtl.match = qgram_key_match;
+	hashCtl.hcxt = CurrentMemoryContext;
+	vgramsHash = hash_create("vgram join vgrams", 1024, &hashCtl,
+							 HASH_ELEM | HASH_FUNCTION | HASH_COMPARE |
+							 HASH_CONTEXT);
+
+	patternVGrams = (JoinVGram ***) palloc(sizeof(JoinVGram **) * Max(npatterns, 1));
+	patternNVGrams = (int *) palloc0(sizeof(int) * Max(npatterns, 1));
+	for (i = 0; i < npatterns; i++)
+	{
+		Datum	   *entries;
+		int32		nentries;
+
+		patterns[i].vgram = NULL;
+		entries = extractQueryLike(&nentries,
+								   DatumGetTextPP(patternValues[patterns[i].patternNo - 1]));
+		patternVGrams[i] = (JoinVGram **) palloc(sizeof(JoinVGram *) * Max(nentries, 1));
+		for (j = 0; j < nentries; j++)
+		{
+			QGramHashKey key;
+			bool		found;
+
+			key.qgram = text_to_cstring(DatumGetTextPP(entries[j]));
+			vgram = (JoinVGram *) hash_search(vgramsHash, (const void *) &key,
+											  HASH_ENTER, &found);
+			if (!found)
+			{
+				vgram->selectivity = estimateVGramSelectivilty(key.qgram);
+				vgram->allocated = 4;
+				vgram->patterns = (int *) palloc(sizeof(int) * vgram->allocated);
+				vgram->npatterns = 0;
+			}
+			else if (vgram->patterns[vgram->npatterns - 1] == i)
+				continue;
+
+			if (vgram->npatterns >= vgram->allocated)
+			{
+				vgram->allocated *= 2;
+				vgram->patterns = (int *) repalloc(vgram->patterns,
+												   sizeof(int) * vgram->allocated);
+			}
+			vgram->patterns[vgram->npatterns++] = i;
+			vgram->nuncovered = vgram->npatterns;
+			patternVGrams[i][patternNVGrams[i]++] = vgram;
+		}
+	}
+
+	nvgrams = (int) hash_get_num_entries(vgramsHash);
+	costs = (JoinVGramCost *) palloc(sizeof(JoinVGramCost) * Max(nvgrams, 1));
+	heap = binaryheap_allocate(Max(nvgrams, 1), joinVGramCostCmp, NULL);
+	i = 0;
+	hash_seq_init(&status, vgramsHash);
+	while ((vgram = (JoinVGram *) hash_seq_search(&status)) != NULL)
+	{
+		costs[i].vgram = vgram;
+		costs[i].cost = joinVGramCost(vgram);
+		binaryheap_add_unordered(heap, PointerGetDatum(&costs[i]));
+		i++;
+	}
+	binaryheap_build(heap);
+
+	while (!binaryheap_empty(heap))
+	{
+		JoinVGramCost *cost = (JoinVGramCost *) DatumGetPointer(binaryheap_first(heap));
+
+		vgram = cost->vgram;
+		if (vgram->nuncovered == 0)
+		{
+			(void) binaryheap_remove_first(heap);
+			continue;
+		}
+		if (cost->cost != joinVGramCost(vgram))
+		{
+			cost->cost = joinVGramCost(vgram);
+			binaryheap_replace_first(heap, PointerGetDatum(cost));
+			continue;
+		}
+
+		(void) binaryheap_remove_first(heap);
+		for (i = 0; i < vgram->npatterns; i++)
+		{
+			int			p = vgram->patterns[i];
+
+			if (patterns[p].vgram)
+				continue;
+			patterns[p].vgram = vgram->key.qgram;
+			for (j = 0; j < patternNVGrams[p]; j++)
+				patternVGrams[p][j]->nuncovered--;
+		}
+	}
+
+	/* Driving V-gram strings are allocated separately and survive the hash */
+	binaryheap_free(heap);
+	hash_destroy(vgramsHash);
+}
+
+/*
+ * Get schema-qualified keys match operator of V-gram index, so that query
+ * doesn't depend on search_path.
+ */
+static char *
+getKeysMatchOperator(Relation indexRel)
+{
+	Oid			opno;
+	HeapTuple	tuple;
+	char	   *result;
+
+	opno = get_opfamily_member(indexRel->rd_opfamily[0], TEXTOID, TEXTARRAYOID,
+							   KeysMatchStrategyNumber);
+	if (!OidIsValid(opno))
+		elog(ERROR, "Index \"%s\" isn't V-gram index.",
+			 RelationGetRelationName(indexRel));
+
+	tuple = SearchSysCache1(OPEROID, ObjectIdGetDatum(opno));
+	if (!HeapTupleIsValid(tuple))
+		elog(ERROR, "cache lookup failed for operator %u", opno);
+	result = psprintf("OPERATOR(%s.%s)",
+					  quote_identifier(get_namespace_name(((Form_pg_operator) GETSTRUCT(tuple))->oprnamespace)),
+					  NameStr(((Form_pg_operator) GETSTRUCT(tuple))->oprname));
+	ReleaseSysCache(tuple);
+	return result;
+}
+
+/*
+ * Patterns are ordered by driving V-gram, so that patterns sharing it form
+ * contiguous group.  Patterns without V-grams go first.
+ */
+static int
+joinPatternCmp(const void *a, const void *b)
+{
+	const JoinPattern *pa = (const JoinPattern *) a;
+	const JoinPattern *pb = (const JoinPattern *) b;
+	int			cmp;
+
+	if (!pa->vgram || !pb->vgram)
+		cmp = (pb->vgram == NULL) - (pa->vgram == NULL);
+	else
+		cmp = strcmp(pa->vgram, pb->vgram);
+	if (cmp != 0)
+		return cmp;
+	return (pa->patternNo > pb->patternNo) - (pa->patternNo < pb->patternNo);
+}
+
+static bool
+sameVGram(const char *a, const char *b)
+{
+	if (!a || !b)
+		return a == b;
+	return strcmp(a, b) == 0;
+}
+
+/*
+ * Open cursor over candidate documents of the next group of patterns sharing
+ * driving V-gram.
+ */
+static void
+openJoinGroup(LikeJoinState *state)
+{
+	char	   *vgram = state->patterns[state->nextPattern].vgram;
+	Portal		portal;
+
+	state->groupStart = state->nextPattern;
+	state->groupEnd = state->groupStart;
+	while (state->groupEnd < state->npatterns &&
+		   sameVGram(state->patterns[state->groupEnd].vgram, vgram))
+		state->groupEnd++;
+	state->nextPattern = state->groupEnd;
+
+	if (vgram)
+	{
+		Datum		args[1];
+		Datum		key = CStringGetTextDatum(vgram);
+
+		args[0] = PointerGetDatum(construct_array(&key, 1, TEXTOID,
+												  -1, false, 'i'));
+		portal = SPI_cursor_open(NULL, state->indexPlan, args, NULL, true);
+	}
+	else
+		portal = SPI_cursor_open(NULL, state->scanPlan, NULL, NULL, true);
+	state->portalName = MemoryContextStrdup(state->context, portal->name);
+}
+
+/*
+ * Check next batch of candidate documents of the current group against all
+ * the patterns of the group.  Candidate documents are fetched once for the
+ * whole group.  Cursor is closed when candidates are exhausted.
+ */
+static void
+fetchJoinBatch(LikeJoinState *state)
+{
+	Portal		portal;
+	int64		allocated = 1024;
+	int			i,
+				j;
+
+	MemoryContextReset(state->resultsContext);
+	state->results = (JoinResult *) MemoryContextAlloc(state->resultsContext,
+													   sizeof(JoinResult) * allocated);
+	state->nresults = 0;
+	state->nextResult = 0;
+
+	SPI_connect();
+	if (!state->portalName)
+		openJoinGroup(state);
+	portal = SPI_cursor_find(state->portalName);
+	if (!portal)
+		elog(ERROR, "Join cursor \"%s\" is lost.", state->portalName);
+
+	SPI_cursor_fetch(portal, true, VGRAM_JOIN_BATCH_SIZE);
+	for (i = 0; i < SPI_processed; i++)
+	{
+		ItemPointer ctid;
+		Datum		value;
+		bool		isnull;
+
+		CHECK_FOR_INTERRUPTS();
+
+		value = SPI_getbinval(SPI_tuptable->vals[i], SPI_tuptable->tupdesc,
+							  2, &isnull);
+		if (isnull)
+			continue;
+		ctid = DatumGetItemPointer(SPI_getbinval(SPI_tuptable->vals[i],
+												 SPI_tuptable->tupdesc, 1,
+												 &isnull));
+		value = PointerGetDatum(PG_DETOAST_DATUM_PACKED(value));
+
+		for (j = state->groupStart; j < state->groupEnd; j++)
+		{
+			int32		patternNo = state->patterns[j].patternNo;
+			JoinResult *result;
+
+			if (!DatumGetBool(DirectFunctionCall2Coll(state->likeFunc,
+													  DEFAULT_COLLATION_OID,
+													  value,
+													  state->patternValues[patternNo - 1])))
+				continue;
+
+			if (state->nresults >= allocated)
+			{
+				allocated *= 2;
+				state->results = (JoinResult *) repalloc(state->results,
+														 sizeof(JoinResult) * allocated);
+			}
+			result = &state->results[state->nresults++];
+			result->patternNo = patternNo;
+			ItemPointerCopy(ctid, &result->ctid);
+		}
+	}
+
+	if (SPI_processed < VGRAM_JOIN_BATCH_SIZE)
+	{
+		SPI_cursor_close(portal);
+		pfree(state->portalName);
+		state->portalName = NULL;
+	}
+	SPI_finish();
+}
+
+/*
+ * Release plans kept for the whole scan, when scan is finished or abandoned.
+ */
+static void
+freeJoinPlans(Datum arg)
+{
+	LikeJoinState *state = (LikeJoinState *) DatumGetPointer(arg);
+
+	if (state->indexPlan)
+		SPI_freeplan(state->indexPlan);
+	if (state->scanPlan)
+		SPI_freeplan(state->scanPlan);
+	state->indexPlan = NULL;
+	state->scanPlan = NULL;
+}
+
+/*
+ * Return (pattern_no, ctid) pairs of documents matching like/ilike patterns
+ * given as array, where pattern_no is 1-based position of pattern in the
+ * array.  Patterns are grouped by driving V-grams chosen by
+ * chooseDrivingVGrams(), so posting list of each such V-gram is scanned once
+ * and each candidate document is fetched once per group.  Queries are
+ * planned once per scan.  Results are streamed by batches of candidates.
+ */
+Datum
+vgram_like_join(PG_FUNCTION_ARGS)
+{
+	FuncCallContext *funcctx;
+	LikeJoinState *state;
+
+	if (SRF_IS_FIRSTCALL())
+	{
+		MemoryContext oldContext;
+		TupleDesc	tupdesc;
+		Relation	indexRel;
+		ArrayType  *patterns = PG_GETARG_ARRAYTYPE_P(1);
+		bool		caseInsensitive = PG_GETARG_BOOL(2);
+		bool	   *nulls;
+		int			nelems,
+					i;
+		char	   *relname,
+				   *attname,
+				   *keysMatchOperator,
+				   *query;
+		Oid			argTypes[1] = {TEXTARRAYOID};
+
+		funcctx = SRF_FIRSTCALL_INIT();
+		oldContext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
+
+		if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+			elog(ERROR, "return type must be a row type");
+		funcctx->tuple_desc = BlessTupleDesc(tupdesc);
+
+		indexRel = index_open(PG_GETARG_OID(0), AccessShareLock);
+		getIndexedColumn(indexRel, &relname, &attname);
+		keysMatchOperator = getKeysMatchOperator(indexRel);
+		index_close(indexRel, AccessShareLock);
+
+		state = (LikeJoinState *) palloc0(sizeof(LikeJoinState));
+		state->context = funcctx->multi_call_memory_ctx;
+		state->likeFunc = caseInsensitive ? texticlike : textlike;
+
+		SPI_connect();
+		query = psprintf("SELECT ctid, %s FROM %s WHERE %s %s $1",
+						 attname, relname, attname, keysMatchOperator);
+		state->indexPlan = SPI_prepare(query, 1, argTypes);
+		if (!state->indexPlan)
+			elog(ERROR, "Can't prepare join query \"%s\".", query);
+		query = psprintf("SELECT ctid, %s FROM %s", attname, relname);
+		state->scanPlan = SPI_prepare(query, 0, NULL);
+		if (!state->scanPlan)
+			elog(ERROR, "Can't prepare join query \"%s\".", query);
+		if (SPI_keepplan(state->indexPlan) != 0 ||
+			SPI_keepplan(state->scanPlan) != 0)
+			elog(ERROR, "Can't keep join query plans.");
+		SPI_finish();
+		RegisterExprContextCallback(((ReturnSetInfo *) fcinfo->resultinfo)->econtext,
+									freeJoinPlans, PointerGetDatum(state));
+
+		state->resultsContext = AllocSetContextCreate(funcctx->multi_call_memory_ctx,
+													  "vgram join results",
+													  ALLOCSET_DEFAULT_MINSIZE,
+													  ALLOCSET_DEFAULT_INITSIZE,
+													  ALLOCSET_DEFAULT_MAXSIZE);
+
+		deconstruct_array(patterns, TEXTOID, -1, false, 'i',
+						  &state->patternValues, &nulls, &nelems);
+
+		/* Null patterns never match, so they are just skipped */
+		loadStats();
+		state->patterns = (JoinPattern *) palloc(sizeof(JoinPattern) *
+												 Max(nelems, 1));
+		for (i = 0; i < nelems; i++)
+		{
+			if (nulls[i])
+				continue;
+			state->patterns[state->npatterns++].patternNo = i + 1;
+		}
+		chooseDrivingVGrams(state->patterns, state->npatterns,
+							state->patternValues);
+		qsort(state->patterns, state->npatterns, sizeof(JoinPattern),
+			  joinPatternCmp);
+
+		funcctx->user_fctx = state;
+		MemoryContextSwitchTo(oldContext);
+	}
+
+	funcctx = SRF_PERCALL_SETUP();
+	state = (LikeJoinState *) funcctx->user_fctx;
+
+	while (state->nextResult >= state->nresults &&
+		   (state->portalName || state->nextPattern < state->npatterns))
+		fetchJoinBatch(state);
+
+	if (state->nextResult < state->nresults)
+	{
+		JoinResult *result = &state->results[state->nextResult++];
+		Datum		values[2];
+		bool		nulls[2] = {false, false};
+		HeapTuple	tuple;
+
+		values[0] = Int32GetDatum(result->patternNo);
+		values[1] = PointerGetDatum(&result->ctid);
+		tuple = heap_form_tuple(funcctx->tuple_desc, values, nulls);
+		SRF_RETURN_NEXT(funcctx, HeapTupleGetDatum(tuple));
+	}
+
+	UnregisterExprContextCallback(((ReturnSetInfo *) fcinfo->resultinfo)->econtext,
+								  freeJoinPlans, PointerGetDatum(state));
+	freeJoinPlans(PointerGetDatum(state));
+	SRF_RETURN_DONE(funcctx);
+}
@@ -0,0 +1,259 @@
+/*-------------------------------------------------------------------------
+ *
+ * vgram_lazy.c
+ *		Lazy lookup of q-grams statistics in qgram_stat table for
+ *		dictionaries too large to be loaded into every backend.
+ *
+ * Copyright (c) 2011-2017, Alexander Korotkov
+ *
+ * IDENTIFICATION
+ *	  contrib/vgram/vgram_lazy.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include <limits.h>
+
+#include "fmgr.h"
+#include "access/transam.h"
+#include "catalog/pg_type.h"
+#include "executor/spi.h"
+#include "utils/builtins.h"
+#include "utils/guc.h"
+#include "utils/hsearch.h"
+#include "utils/memutils.h"
+
+#include "vgram.h"
+
+/*
+ * Cached result of q-gram lookup.  Negative results are cached as well,
+ * since most of lookups are done for infrequent q-grams.
+ */
+typedef struct
+{
+	QGramHashKey key;
+	int			result;
+	float4		frequency;
+} LazyCacheEntry;
+
+static int	lazyStatsLookupQGram(const char *qgram, int len, float *frequency,
+								 void *arg);
+
+bool		vgramLazyStats = false;
+
+/* Maximal number of cached lookups */
+static int	vgramLazyStatsCacheSize = 65536;
+
+const VGramLookup lazyStatsLookup = {lazyStatsLookupQGram, NULL};
+
+static MemoryContext lazyCacheContext = NULL;
+static HTAB *lazyCache = NULL;
+static SPIPlanPtr lazyPlan = NULL;
+
+/*
+ * Version of statistics loaded: xmin of its limit frequency row, which is
+ * written anew each time statistics is collected.  Lookups notice change of
+ * version, then statistics is stale and reloaded by the next loadStats().
+ */
+static TransactionId lazyStatsVersion = InvalidTransactionId;
+bool		lazyStatsStale = false;
+
+void
+lazyStatsInit(void)
+{
+	DefineCustomBoolVariable("vgram.lazy_stats",
+							 "Look up frequent q-grams in qgram_stat table "
+							 "on demand instead of loading them.",
+							 NULL,
+							 &vgramLazyStats,
+							 false,
+							 PGC_USERSET, 0,
+							 NULL, NULL, NULL);
+
+	DefineCustomIntVariable("vgram.lazy_stats_cache_size",
+							"Maximal number of q-gram lookups cached in "
+							"backend memory in lazy statistics mode.",
+							"Zero disables the cache.",
+							&vgramLazyStatsCacheSize,
+							65536, 0, INT_MAX,
+							PGC_USERSET, 0,
+							NULL, NULL, NULL);
+}
+
+/**
+ * Remember version of loaded statistics.
+ */
+void
+lazyStatsSetVersion(TransactionId version)
+{
+	lazyStatsVersion = version;
+	lazyStatsStale = false;
+}
+
+/**
+ * Forget all the cached lookups.
+ */
+void
+lazyStatsReset(void)
+{
+	if (lazyCacheContext)
+		MemoryContextDelete(lazyCacheContext);
+	lazyCacheContext = NULL;
+	lazyCache = NULL;
+}
+
+static void
+lazyCacheCreate(void)
+{
+	HASHCTL		ctl;
+
+	lazyCacheContext = AllocSetContextCreate(TopMemoryContext,
+											 "vgram lazy stats cache",
+											 ALLOCSET_DEFAULT_MINSIZE,
+											 ALLOCSET_DEFAULT_INITSIZE,
+											 ALLOCSET_DEFAULT_MAXSIZE);
+	ctl.keysize = sizeof(QGramHashKey);
+	ctl.entrysize = sizeof(LazyCacheEntry);
+	ctl.hcxt = lazyCacheContext;
+	ctl.hash = qgram_key_hash;
+	ctl.match = qgram_key_match;
+	lazyCache = hash_create("vgram lazy stats cache",
+							1024,
+							&ctl,
+							HASH_ELEM | HASH_CONTEXT
+							| HASH_FUNCTION | HASH_COMPARE);
+}
+
+/**
+ * Find the least q-gram of qgram_stat table which isn't less than given one.
+ * Btree index over qgram in "C" collation orders q-grams the same way as
+ * strcmp() does, so that q-gram starts with given prefix if any q-gram
+ * does.  Version of statistics is fetched by the same query, and the
+ * statistics is marked stale once it's changed.
+ *
+ * @param qgram Null-terminated q-gram
+ * @param len Length of q-gram *in bytes*
+ * @param frequency Frequency of found q-gram
+ * @return Lookup result
+ */
+static int
+lookupStatsTable(const char *qgram, int len, float4 *frequency)
+{
+	Datum		args[1];
+	int			result = VGRAM_LOOKUP_NONE;
+
+	SPI_connect();
+
+	if (!lazyPlan)
+	{
+		Oid			argTypes[1] = {TEXTOID};
+		SPIPlanPtr	plan;
+
+		plan = SPI_prepare("SELECT q.qgram, q.frequency, v.xmin "
+						   "FROM (SELECT 1) d "
+						   "LEFT JOIN (SELECT xmin FROM qgram_stat "
+						   "WHERE qgram COLLATE \"C\" = '' LIMIT 1) v ON true "
+						   "LEFT JOIN (SELECT qgram, frequency FROM qgram_stat "
+						   "WHERE qgram COLLATE \"C\" >= $1 "
+						   "ORDER BY qgram COLLATE \"C\" LIMIT 1) q ON true;",
+						   1, argTypes);
+		if (!plan)
+			elog(ERROR, "Can't prepare lookup of table qgram_stat.");
+		SPI_keepplan(plan);
+		lazyPlan = plan;
+	}
+
+	args[0] = CStringGetTextDatum(qgram);
+	if (SPI_execute_plan(lazyPlan, args, NULL, true, 1) != SPI_OK_SELECT)
+		elog(ERROR, "Can't read table qgram_stat;");
+
+	if (SPI_processed > 0)
+	{
+		char	   *found;
+		bool		isnull;
+		Datum		value;
+		TransactionId version;
+
+		value = SPI_getbinval(SPI_tuptable->vals[0], SPI_tuptable->tupdesc, 3,
+							  &isnull);
+		version = isnull ? InvalidTransactionId : DatumGetTransactionId(value);
+		if (!TransactionIdEquals(version, lazyStatsVersion))
+			lazyStatsStale = true;
+
+		value = SPI_getbinval(SPI_tuptable->vals[0], SPI_tuptable->tupdesc, 1,
+							  &isnull);
+		if (isnull)
+		{
+			SPI_finish();
+			return result;
+		}
+		found = TextDatumGetCString(value);
+		value = SPI_getbinval(SPI_tuptable->vals[0], SPI_tuptable->tupdesc, 2,
+							  &isnull);
+		if (isnull)
+			elog(ERROR, "qgram value must be not null.");
+		if (strncmp(found, qgram, len) == 0)
+		{
+			*frequency = DatumGetFloat4(value);
+			result = (found[len] == '\0') ? VGRAM_LOOKUP_EXACT : VGRAM_LOOKUP_PREFIX;
+		}
+	}
+
+	SPI_finish();
+	return result;
+}
+
+/*
+ * Look up q-gram in the cache, falling back to qgram_stat table.  Once cache
+ * is full, it's dropped as a whole, so memory is bounded regardless of
+ * dictionary size while hot q-grams are quickly cached again.  Cache is
+ * dropped as well once statistics turns out to be rewritten, and results are
+ * not cached until it's reloaded.
+ */
+static int
+lazyStatsLookupQGram(const char *qgram, int len, float *frequency, void *arg)
+{
+	QGramHashKey key;
+	LazyCacheEntry *entry;
+	char	   *qgramCopy;
+	int			result;
+	bool		found;
+
+	qgramCopy = pnstrdup(qgram, len);
+	key.qgram = qgramCopy;
+
+	if (lazyCache)
+	{
+		entry = (LazyCacheEntry *) hash_search(lazyCache, (const void *) &key,
+											   HASH_FIND, NULL);
+		if (entry)
+		{
+			pfree(qgramCopy);
+			*frequency = entry->frequency;
+			return entry->result;
+		}
+	}
+
+	*frequency = -1.0f;
+	result = lookupStatsTable(qgramCopy, len, frequency);
+
+	if (lazyStatsStale)
+		lazyStatsReset();
+	else if (vgramLazyStatsCacheSize > 0)
+	{
+		if (lazyCache && hash_get_num_entries(lazyCache) >= vgramLazyStatsCacheSize)
+			lazyStatsReset();
+		if (!lazyCache)
+			lazyCacheCreate();
+
+		key.qgram = MemoryContextStrdup(lazyCacheContext, qgramCopy);
+		entry = (LazyCacheEntry *) hash_search(lazyCache, (const void *) &key,
+											   HASH_ENTER, &found);
+		entry->result = result;
+		entry->frequency = *frequency;
+	}
+
+	pfree(qgramCopy);
+	return result;
+}
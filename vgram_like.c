@@ -13,10 +13,28 @@
  */
 #include "postgres.h"
 #include "fmgr.h"
+#include "catalog/pg_type.h"
+#include "utils/array.h"
 #include "utils/builtins.h"
 
 #include "vgram.h"
 
+Datum		vgram_like_any(PG_FUNCTION_ARGS);
+
+PG_FUNCTION_INFO_V1(vgram_like_any);
+
+Datum		vgram_ilike_any(PG_FUNCTION_ARGS);
+
+PG_FUNCTION_INFO_V1(vgram_ilike_any);
+
+Datum		vgram_pattern_like(PG_FUNCTION_ARGS);
+
+PG_FUNCTION_INFO_V1(vgram_pattern_like);
+
+Datum		vgram_pattern_ilike(PG_FUNCTION_ARGS);
+
+PG_FUNCTION_INFO_V1(vgram_pattern_ilike);
+
 #define ISESCAPECHAR(x) (*(x) == '\\')	/* Wildcard escape character */
 #define ISWILDCARDCHAR(x) (*(x) == '_' || *(x) == '%')	/* Wildcard
 														 * meta-character */
@@ -35,6 +53,9 @@
  *
  * If the found word is bounded by non-word characters or string boundaries
  * then this function will include corresponding padding spaces into buf.
+ * When continuous scripts are enabled, transition between continuous and
+ * other characters bounds word as well, and segments of continuous scripts
+ * are never padded, the same way as extractWords() does.
  */
 static const char *
 get_wildcard_part(const char *str, int lenstr,
@@ -45,6 +66,7 @@ get_wildcard_part(const char *str, int lenstr,
 	char	   *s = buf;
 	bool		in_wildcard_meta = false;
 	bool		in_escape = false;
+	bool		continuous;
 	int			clen;
 
 	/*
@@ -84,8 +106,9 @@ get_wildcard_part(const char *str, int lenstr,
 	 * Add left padding spaces if last character wasn't wildcard
 	 * meta-character.
 	 */
+	continuous = isContinuousChar(beginword);
 	*charlen = 0;
-	if (!in_wildcard_meta)
+	if (!in_wildcard_meta && !continuous)
 	{
 		*s++ = EMPTY_CHARACTER;
 		(*charlen)++;
@@ -105,7 +128,8 @@ get_wildcard_part(const char *str, int lenstr,
 		{
 			in_escape = false;
 			in_wildcard_meta = false;
-			if (isExtractable(endword))
+			if (isExtractable(endword) &&
+				isContinuousChar(endword) == continuous)
 			{
 				memcpy(s, endword, clen);
 				(*charlen)++;
@@ -123,7 +147,8 @@ get_wildcard_part(const char *str, int lenstr,
 				in_wildcard_meta = true;
 				break;
 			}
-			else if (isExtractable(endword))
+			else if (isExtractable(endword) &&
+					 isContinuousChar(endword) == continuous)
 			{
 				memcpy(s, endword, clen);
 				(*charlen)++;
@@ -142,7 +167,7 @@ get_wildcard_part(const char *str, int lenstr,
 	 * Add right padding spaces if last character wasn't wildcard
 	 * meta-character.
 	 */
-	if (!in_wildcard_meta)
+	if (!in_wildcard_meta && !continuous)
 	{
 		*s++ = EMPTY_CHARACTER;
 		(*charlen)++;
@@ -176,6 +201,56 @@ addVGram(char *vgram, void *userData)
 	vgrams->count++;
 }
 
+typedef struct
+{
+	char	   *vgram;
+	float4		selectivity;
+} RankedVGram;
+
+static int
+rankedVGramCmp(const void *a, const void *b)
+{
+	const RankedVGram *ra = (const RankedVGram *) a;
+	const RankedVGram *rb = (const RankedVGram *) b;
+
+	if (ra->selectivity != rb->selectivity)
+		return (ra->selectivity > rb->selectivity) ? 1 : -1;
+	return strcmp(ra->vgram, rb->vgram);
+}
+
+/*
+ * Keep only OPTIMAL_VGRAM_COUNT most selective V-grams.  Continuous text
+ * gives V-gram almost at every position, and long pattern would require
+ * scanning posting lists of all of them, while a few rarest ones are
+ * selective enough.  Any subset of pattern V-grams gives superset of
+ * matching documents, which are rechecked anyway.
+ */
+static void
+selectRarestVGrams(VGramInfo *vgrams)
+{
+	RankedVGram *ranked;
+	int			i,
+				count = 0;
+
+	ranked = (RankedVGram *) palloc(sizeof(RankedVGram) * vgrams->count);
+	for (i = 0; i < vgrams->count; i++)
+	{
+		ranked[i].vgram = vgrams->data[i];
+		ranked[i].selectivity = estimateVGramSelectivilty(vgrams->data[i]);
+	}
+	qsort(ranked, vgrams->count, sizeof(RankedVGram), rankedVGramCmp);
+
+	/* Equal V-grams are adjacent after sorting, keep distinct ones */
+	for (i = 0; i < vgrams->count && count < OPTIMAL_VGRAM_COUNT; i++)
+	{
+		if (count > 0 && strcmp(vgrams->data[count - 1], ranked[i].vgram) == 0)
+			continue;
+		vgrams->data[count++] = ranked[i].vgram;
+	}
+	vgrams->count = count;
+	pfree(ranked);
+}
+
 
 Datum *
 extractQueryLike(int32 *nentries, text *pattern)
@@ -191,6 +266,7 @@ extractQueryLike(int32 *nentries, text *pattern)
 	VGramInfo	vgrams;
 	ExtractVGramsInfo userData;
 	Datum	   *entries;
+	bool		hasContinuous = false;
 
 	userData.callback = addVGram;
 	userData.userData = (void *) &vgrams;
@@ -207,6 +283,10 @@ extractQueryLike(int32 *nentries, text *pattern)
 	while ((eword = get_wildcard_part(eword, len - (eword - str),
 									  buf, &bytelen, &charlen)) != NULL)
 	{
+		/* Padding is never extractable, so it's the first character */
+		if (isContinuousChar(*buf == EMPTY_CHARACTER ? buf + 1 : buf))
+			hasContinuous = true;
+
 		buf2 = lowerstr_with_len(buf, bytelen);
 		bytelen = strlen(buf2);
 
@@ -216,6 +296,9 @@ extractQueryLike(int32 *nentries, text *pattern)
 	}
 	pfree(buf);
 
+	if (hasContinuous && vgrams.count > OPTIMAL_VGRAM_COUNT)
+		selectRarestVGrams(&vgrams);
+
 	*nentries = vgrams.count;
 
 	entries = (Datum *) palloc(sizeof(Datum) * vgrams.count);
@@ -225,3 +308,147 @@ extractQueryLike(int32 *nentries, text *pattern)
 	}
 	return entries;
 }
+
+/*
+ * Check if V-grams extracted from ilike pattern determine the match exactly,
+ * i.e. recheck isn't needed.  Index isn't positional, so this is the case only
+ * when pattern is '%word%' and the word itself is the only V-gram extracted.
+ * Every V-gram is a substring of lowered indexed string, thus presence of such
+ * V-gram implies match.  Word is required to be ASCII to avoid differences
+ * between lowering of index and ilike.
+ */
+bool
+isExactPattern(text *pattern, Datum *entries, int32 nentries)
+{
+	const char *str = VARDATA_ANY(pattern);
+	int			len = VARSIZE_ANY_EXHDR(pattern),
+				i;
+	text	   *vgram;
+
+	if (nentries != 1 || len < 3 || str[0] != '%' || str[len - 1] != '%')
+		return false;
+
+	vgram = DatumGetTextPP(entries[0]);
+	if (VARSIZE_ANY_EXHDR(vgram) != len - 2)
+		return false;
+
+	for (i = 1; i < len - 1; i++)
+	{
+		if (IS_HIGHBIT_SET(str[i]) || ISWILDCARDCHAR(str + i) ||
+			ISESCAPECHAR(str + i) || !isExtractable(str + i))
+			return false;
+		if (pg_ascii_tolower((unsigned char) str[i]) !=
+			(unsigned char) VARDATA_ANY(vgram)[i - 1])
+			return false;
+	}
+	return true;
+}
+
+/**
+ * Choose the rarest V-gram of pattern.  Documents matching the pattern are
+ * among those containing this V-gram, so it's the most selective single key
+ * of the pattern.
+ *
+ * @param pattern like/ilike pattern
+ * @return Rarest V-gram or NULL if no V-gram could be extracted
+ */
+char *
+getRarestVGram(text *pattern)
+{
+	Datum	   *entries;
+	int32		nentries,
+				i;
+	char	   *result = NULL;
+	float4		minSelectivity = 0.0f;
+
+	entries = extractQueryLike(&nentries, pattern);
+	for (i = 0; i < nentries; i++)
+	{
+		char	   *vgram = text_to_cstring(DatumGetTextPP(entries[i]));
+		float4		selectivity = estimateVGramSelectivilty(vgram);
+
+		if (!result || selectivity < minSelectivity ||
+			(selectivity == minSelectivity && strcmp(vgram, result) < 0))
+		{
+			result = vgram;
+			minSelectivity = selectivity;
+		}
+	}
+	return result;
+}
+
+/*
+ * Check if string matches any of non-null patterns using given like/ilike
+ * function.
+ */
+static bool
+matchAnyPattern(PGFunction likeFunc, Oid collation, text *str,
+				ArrayType *patterns)
+{
+	Datum	   *elems;
+	bool	   *nulls;
+	int			nelems,
+				i;
+
+	deconstruct_array(patterns, TEXTOID, -1, false, 'i',
+					  &elems, &nulls, &nelems);
+
+	for (i = 0; i < nelems; i++)
+	{
+		if (nulls[i])
+			continue;
+		if (DatumGetBool(DirectFunctionCall2Coll(likeFunc, collation,
+												 PointerGetDatum(str),
+												 elems[i])))
+			return true;
+	}
+	return false;
+}
+
+/*
+ * Check if string matches any of like patterns.
+ */
+Datum
+vgram_like_any(PG_FUNCTION_ARGS)
+{
+	text	   *str = PG_GETARG_TEXT_PP(0);
+	ArrayType  *patterns = PG_GETARG_ARRAYTYPE_P(1);
+
+	PG_RETURN_BOOL(matchAnyPattern(textlike, PG_GET_COLLATION(), str,
+								   patterns));
+}
+
+/*
+ * Check if string matches any of ilike patterns.
+ */
+Datum
+vgram_ilike_any(PG_FUNCTION_ARGS)
+{
+	text	   *str = PG_GETARG_TEXT_PP(0);
+	ArrayType  *patterns = PG_GETARG_ARRAYTYPE_P(1);
+
+	PG_RETURN_BOOL(matchAnyPattern(texticlike, PG_GET_COLLATION(), str,
+								   patterns));
+}
+
+/*
+ * Check if like pattern matches given string, i.e. commutated like.
+ */
+Datum
+vgram_pattern_like(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_DATUM(DirectFunctionCall2Coll(textlike, PG_GET_COLLATION(),
+											PG_GETARG_DATUM(1),
+											PG_GETARG_DATUM(0)));
+}
+
+/*
+ * Check if ilike pattern matches given string, i.e. commutated ilike.
+ */
+Datum
+vgram_pattern_ilike(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_DATUM(DirectFunctionCall2Coll(texticlike, PG_GET_COLLATION(),
+											PG_GETARG_DATUM(1),
+											PG_GETARG_DATUM(0)));
+}
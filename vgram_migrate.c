@@ -0,0 +1,413 @@
+/*-------------------------------------------------------------------------
+ *
+ * vgram_migrate.c
+ *		Routines for migrating V-gram index to refreshed statistics without
+ *		full rebuild.
+ *
+ * Copyright (c) 2011-2017, Alexander Korotkov
+ *
+ * IDENTIFICATION
+ *	  contrib/vgram/vgram_migrate.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+#include "fmgr.h"
+#include "access/genam.h"
+#include "access/heapam.h"
+#include "access/htup_details.h"
+#include "access/skey.h"
+#include "catalog/index.h"
+#include "catalog/pg_class.h"
+#include "catalog/pg_collation.h"
+#include "catalog/pg_type.h"
+#include "executor/spi.h"
+#include "miscadmin.h"
+#include "nodes/tidbitmap.h"
+#include "storage/bufmgr.h"
+#include "storage/itemptr.h"
+#include "utils/acl.h"
+#include "utils/array.h"
+#include "utils/builtins.h"
+#include "utils/lsyscache.h"
+#include "utils/rel.h"
+#include "utils/snapmgr.h"
+
+#include "vgram.h"
+
+Datum		vgram_keys_match(PG_FUNCTION_ARGS);
+Datum		vgram_migrate_index(PG_FUNCTION_ARGS);
+
+PG_FUNCTION_INFO_V1(vgram_keys_match);
+PG_FUNCTION_INFO_V1(vgram_migrate_index);
+
+/*
+ * Recheck of keys matching operator.  Index is the only source of truth
+ * whether document is indexed with given V-grams, so check is conservative:
+ * document matches when it contains any of given V-grams with stripped word
+ * boundaries as a substring.
+ */
+Datum
+vgram_keys_match(PG_FUNCTION_ARGS)
+{
+	text	   *s = PG_GETARG_TEXT_PP(0);
+	ArrayType  *keys = PG_GETARG_ARRAYTYPE_P(1);
+	Datum	   *elems;
+	bool	   *nulls;
+	int			nelems,
+				i;
+	char	   *lower;
+	bool		res = false;
+
+	deconstruct_array(keys, TEXTOID, -1, false, 'i', &elems, &nulls, &nelems);
+	lower = lowerstr_with_len(VARDATA_ANY(s), VARSIZE_ANY_EXHDR(s));
+
+	for (i = 0; i < nelems && !res; i++)
+	{
+		char	   *key,
+				   *start,
+				   *end;
+
+		if (nulls[i])
+			continue;
+
+		key = text_to_cstring(DatumGetTextPP(elems[i]));
+		start = key;
+		end = key + strlen(key);
+		if (*start == EMPTY_CHARACTER)
+			start++;
+		if (end > start && *(end - 1) == EMPTY_CHARACTER)
+			*(--end) = '\0';
+
+		if (end == start || strstr(lower, start) != NULL)
+			res = true;
+		pfree(key);
+	}
+
+	pfree(lower);
+	PG_RETURN_BOOL(res);
+}
+
+/**
+ * Build array of V-gram prefixes, which locate documents affected by change
+ * of q-grams status.  Document containing changed q-gram might be indexed
+ * with V-gram which is a substring of q-gram or has q-gram as a prefix, but
+ * not necessary: V-gram starting at q-gram might be dropped as non-minimal
+ * in favor of shorter V-gram starting inside q-gram and ending after it.
+ * E.g. when "ab", "abc" and "bc" are frequent, word "abcd" is indexed by
+ * "cd" only, and "abc" becoming infrequent adds "abc" key.  Thus, all
+ * suffixes of changed q-grams down to the single last character are matched
+ * as prefixes, i.e. every key starting inside q-gram.  Trailing word
+ * boundary alone is skipped, since no key starts there.
+ *
+ * Documents containing q-gram, which became infrequent, can't be located if
+ * they had no V-grams starting inside it: when it's a part of frequent word
+ * ending or it's of maxQ length.  In this case warning is emitted.
+ */
+static ArrayType *
+getChangedPrefixes(bool warnUnlocatable)
+{
+	Datum	   *prefixes;
+	int			nprefixes = 0,
+				allocated = 16,
+				i;
+	bool		unlocatable = false;
+	ArrayType  *result;
+	MemoryContext oldContext = CurrentMemoryContext;
+
+	prefixes = (Datum *) palloc(sizeof(Datum) * allocated);
+
+	SPI_connect();
+	if (SPI_execute("SELECT qgram, frequent FROM qgram_stat_changes();",
+					true, 0) != SPI_OK_SELECT)
+		elog(ERROR, "Can't read q-gram statistics changes.");
+
+	for (i = 0; i < SPI_processed; i++)
+	{
+		bool		isnull;
+		char	   *qgram,
+				   *p;
+		int			len;
+		bool		frequent;
+
+		qgram = TextDatumGetCString(SPI_getbinval(SPI_tuptable->vals[i],
+												  SPI_tuptable->tupdesc, 1,
+												  &isnull));
+		frequent = DatumGetBool(SPI_getbinval(SPI_tuptable->vals[i],
+											  SPI_tuptable->tupdesc, 2,
+											  &isnull));
+
+		len = pg_mbstrlen(qgram);
+		if (!frequent &&
+			(len == maxQ || qgram[strlen(qgram) - 1] == EMPTY_CHARACTER))
+			unlocatable = true;
+
+		for (p = qgram; len >= 1; len--, p += pg_mblen(p))
+		{
+			MemoryContext spiContext;
+
+			if (len == 1 && *p == EMPTY_CHARACTER && p > qgram)
+				break;
+
+			spiContext = MemoryContextSwitchTo(oldContext);
+			if (nprefixes >= allocated)
+			{
+				allocated *= 2;
+				prefixes = (Datum *) repalloc(prefixes,
+											  sizeof(Datum) * allocated);
+			}
+			prefixes[nprefixes++] = PointerGetDatum(cstring_to_text(p));
+			MemoryContextSwitchTo(spiContext);
+		}
+	}
+	SPI_finish();
+
+	if (unlocatable && warnUnlocatable)
+		elog(WARNING, "Some documents affected by statistics change can't be located through the index, REINDEX is required for exact results.");
+
+	result = construct_array(prefixes, nprefixes, TEXTOID, -1, false, 'i');
+	pfree(prefixes);
+	return result;
+}
+
+/**
+ * Get quoted names of the table and the column indexed by V-gram index.
+ *
+ * @param indexRel Opened V-gram index
+ * @param relname Receives schema-qualified name of indexed table
+ * @param attname Receives name of indexed column
+ */
+void
+getIndexedColumn(Relation indexRel, char **relname, char **attname)
+{
+	Oid			heapOid = indexRel->rd_index->indrelid;
+	AttrNumber	attnum;
+
+	if (indexRel->rd_index->indnatts != 1 ||
+		indexRel->rd_index->indkey.values[0] == 0)
+		elog(ERROR, "Only single column V-gram indexes over table column are supported.");
+	attnum = indexRel->rd_index->indkey.values[0];
+
+	*relname = quote_qualified_identifier(get_namespace_name(get_rel_namespace(heapOid)),
+										  get_rel_name(heapOid));
+	*attname = pstrdup(quote_identifier(get_attname(heapOid, attnum
+#if PG_VERSION_NUM >= 110000
+													, false
+#endif
+													)));
+}
+
+/**
+ * Check that current user could read the table indexed by V-gram index.
+ * Functions reading index and heap directly bypass executor permission
+ * checks, while their results reveal the table contents.
+ *
+ * @param indexRel Opened V-gram index
+ */
+void
+checkIndexedTableSelect(Relation indexRel)
+{
+	Oid			heapOid = indexRel->rd_index->indrelid;
+	AclResult	aclresult;
+
+	aclresult = pg_class_aclcheck(heapOid, GetUserId(), ACL_SELECT);
+	if (aclresult != ACLCHECK_OK)
+		aclcheck_error(aclresult,
+#if PG_VERSION_NUM >= 110000
+					   OBJECT_TABLE,
+#else
+					   ACL_KIND_CLASS,
+#endif
+					   get_rel_name(heapOid));
+}
+
+/**
+ * Fetch the member of HOT chain visible to the snapshot.  Index entries and
+ * bitmaps built from them point to the root of HOT chain, while the visible
+ * tuple might be a heap-only tuple further in the chain.  TIDs of heap-only
+ * tuples themselves and unused line pointers give no tuple.
+ *
+ * @param heapRel Opened table
+ * @param tid TID of HOT chain root, replaced with TID of visible tuple
+ * @param snapshot Snapshot to check visibility against
+ * @return Palloc'd copy of visible tuple or NULL if there is no one
+ */
+HeapTuple
+getVisibleTuple(Relation heapRel, ItemPointer tid, Snapshot snapshot)
+{
+	HeapTupleData tuple;
+	HeapTuple	result = NULL;
+	Buffer		buffer;
+	bool		allDead;
+
+	buffer = ReadBuffer(heapRel, ItemPointerGetBlockNumber(tid));
+	LockBuffer(buffer, BUFFER_LOCK_SHARE);
+	if (heap_hot_search_buffer(tid, heapRel, buffer, snapshot, &tuple,
+							   &allDead, true))
+		result = heap_copytuple(&tuple);
+	UnlockReleaseBuffer(buffer);
+
+	return result;
+}
+
+/*
+ * Add keys extracted using current statistics for documents affected by
+ * statistics change.  Documents are located by a bitmap scan of keys match
+ * strategy, and streamed in TID order starting after given TID, at most
+ * batchSize per call (all of them when batchSize is zero).  Bitmap is built
+ * again by every call, so posting lists are read once per batch.  Returns TID
+ * of last processed document, or NULL when there are no more documents.
+ * Stale keys produce only false positives eliminated by recheck, and are
+ * removed by REINDEX.
+ */
+Datum
+vgram_migrate_index(PG_FUNCTION_ARGS)
+{
+	Oid			indexOid = PG_GETARG_OID(0);
+	ItemPointer after = PG_GETARG_ITEMPOINTER(1);
+	int32		batchSize = PG_GETARG_INT32(2);
+	BlockNumber afterBlkno = BlockIdGetBlockNumber(&after->ip_blkid);
+	OffsetNumber afterOffnum = after->ip_posid;
+	Relation	indexRel,
+				heapRel;
+	IndexInfo  *indexInfo;
+	IndexScanDesc scan;
+	ScanKeyData key;
+	TIDBitmap  *tbm;
+	TBMIterator *iterator;
+	TBMIterateResult *tbmres;
+	Snapshot	snapshot = GetActiveSnapshot();
+	ArrayType  *prefixes;
+	ItemPointerData last;
+	AttrNumber	attnum;
+	Oid			opno;
+	int32		processed = 0;
+	bool		done = true;
+
+	if (batchSize < 0)
+		elog(ERROR, "batch size must not be negative.");
+
+	loadStats();
+	/* Warn only once, when migration is started from the beginning */
+	prefixes = getChangedPrefixes(afterBlkno == 0 && afterOffnum == 0);
+
+	indexRel = index_open(indexOid, RowExclusiveLock);
+
+	/* Only owner of the table could add index entries, as REINDEX does */
+#if PG_VERSION_NUM >= 160000
+	if (!object_ownercheck(RelationRelationId, indexRel->rd_index->indrelid, GetUserId()))
+#else
+	if (!pg_class_ownercheck(indexRel->rd_index->indrelid, GetUserId()))
+#endif
+		aclcheck_error(ACLCHECK_NOT_OWNER,
+#if PG_VERSION_NUM >= 110000
+					   OBJECT_TABLE,
+#else
+					   ACL_KIND_CLASS,
+#endif
+					   get_rel_name(indexRel->rd_index->indrelid));
+
+	opno = get_opfamily_member(indexRel->rd_opfamily[0], TEXTOID, TEXTARRAYOID,
+							   KeysMatchStrategyNumber);
+	if (!OidIsValid(opno))
+		elog(ERROR, "Index \"%s\" isn't V-gram index.",
+			 RelationGetRelationName(indexRel));
+	if (indexRel->rd_index->indnatts != 1 ||
+		indexRel->rd_index->indkey.values[0] == 0)
+		elog(ERROR, "Only single column V-gram indexes over table column are supported.");
+	attnum = indexRel->rd_index->indkey.values[0];
+	heapRel = relation_open(indexRel->rd_index->indrelid, RowExclusiveLock);
+	indexInfo = BuildIndexInfo(indexRel);
+
+	ScanKeyEntryInitialize(&key, 0, 1, KeysMatchStrategyNumber, InvalidOid,
+						   DEFAULT_COLLATION_OID, get_opcode(opno),
+						   PointerGetDatum(prefixes));
+
+#if PG_VERSION_NUM >= 100000
+	tbm = tbm_create(work_mem * 1024L, NULL);
+#else
+	tbm = tbm_create(work_mem * 1024L);
+#endif
+	scan = index_beginscan_bitmap(indexRel, snapshot, 1);
+	index_rescan(scan, &key, 1, NULL, 0);
+	(void) index_getbitmap(scan, tbm);
+	index_endscan(scan);
+
+	/*
+	 * Bitmap is iterated in TID order, so blocks already processed are
+	 * skipped without heap access.  Bitmap entries are roots of HOT chains,
+	 * which are the TIDs new keys should point to.
+	 */
+	iterator = tbm_begin_iterate(tbm);
+	while ((tbmres = tbm_iterate(iterator)) != NULL)
+	{
+		int			n = (tbmres->ntuples >= 0) ? tbmres->ntuples : MaxHeapTuplesPerPage,
+					i;
+
+		if (tbmres->blockno < afterBlkno)
+			continue;
+
+		for (i = 0; i < n; i++)
+		{
+			ItemPointerData root,
+						tid;
+			HeapTuple	tuple;
+			Datum		values[1];
+			bool		isnull[1];
+
+			ItemPointerSet(&root, tbmres->blockno,
+						   (tbmres->ntuples >= 0) ? tbmres->offsets[i] : i + 1);
+			if (tbmres->blockno == afterBlkno &&
+				ItemPointerGetOffsetNumber(&root) <= afterOffnum)
+				continue;
+
+			if (batchSize > 0 && processed >= batchSize)
+			{
+				done = false;
+				break;
+			}
+
+			CHECK_FOR_INTERRUPTS();
+
+			ItemPointerCopy(&root, &last);
+			processed++;
+
+			ItemPointerCopy(&root, &tid);
+			tuple = getVisibleTuple(heapRel, &tid, snapshot);
+			if (!tuple)
+				continue;
+
+			values[0] = heap_getattr(tuple, attnum, RelationGetDescr(heapRel),
+									 &isnull[0]);
+			if (!isnull[0] && (tbmres->recheck || tbmres->ntuples < 0))
+				isnull[0] = !DatumGetBool(DirectFunctionCall2(vgram_keys_match,
+															  values[0],
+															  PointerGetDatum(prefixes)));
+			if (!isnull[0])
+				index_insert(indexRel, values, isnull, &root, heapRel,
+							 UNIQUE_CHECK_NO
+#if PG_VERSION_NUM >= 140000
+							 , false
+#endif
+#if PG_VERSION_NUM >= 100000
+							 , indexInfo
+#endif
+					);
+			heap_freetuple(tuple);
+		}
+		if (!done)
+			break;
+	}
+	tbm_end_iterate(iterator);
+	tbm_free(tbm);
+
+	relation_close(heapRel, RowExclusiveLock);
+	index_close(indexRel, RowExclusiveLock);
+
+	if (done)
+		PG_RETURN_NULL();
+
+	after = (ItemPointer) palloc(sizeof(ItemPointerData));
+	ItemPointerCopy(&last, after);
+	PG_RETURN_ITEMPOINTER(after);
+}
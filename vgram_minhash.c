@@ -0,0 +1,228 @@
+/*-------------------------------------------------------------------------
+ *
+ * vgram_minhash.c
+ *		Routines for near-duplicate detection using MinHash signatures of
+ *		V-gram sets.
+ *
+ * Copyright (c) 2011-2017, Alexander Korotkov
+ *
+ * IDENTIFICATION
+ *	  contrib/vgram/vgram_minhash.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+#include "fmgr.h"
+#include "access/hash.h"
+#include "catalog/pg_type.h"
+#include "utils/array.h"
+#include "utils/builtins.h"
+
+#include "vgram.h"
+
+Datum		vgram_minhash(PG_FUNCTION_ARGS);
+Datum		vgram_minhash_bands(PG_FUNCTION_ARGS);
+Datum		vgram_minhash_similarity(PG_FUNCTION_ARGS);
+
+PG_FUNCTION_INFO_V1(vgram_minhash);
+PG_FUNCTION_INFO_V1(vgram_minhash_bands);
+PG_FUNCTION_INFO_V1(vgram_minhash_similarity);
+
+typedef struct
+{
+	uint32	   *minimums;
+	uint64	   *seeds;
+	int32		k;
+	bool		empty;
+} MinHashInfo;
+
+/*
+ * Finalization of 64-bit MurmurHash3: bijective mixing where every input bit
+ * affects every output bit.
+ */
+static inline uint64
+mixHash64(uint64 h)
+{
+	h ^= h >> 33;
+	h *= UINT64CONST(0xFF51AFD7ED558CCD);
+	h ^= h >> 33;
+	h *= UINT64CONST(0xC4CEB9FE1A85EC53);
+	h ^= h >> 33;
+	return h;
+}
+
+/*
+ * Fill seeds of signature positions.  Seeds are fixed, so signatures of the
+ * same V-gram set are comparable across sessions and servers.
+ */
+static void
+initMinHashSeeds(uint64 *seeds, int32 k)
+{
+	uint64		state = UINT64CONST(0x5647524D494E4841);
+	int32		i;
+
+	for (i = 0; i < k; i++)
+	{
+		state += UINT64CONST(0x9E3779B97F4A7C15);
+		seeds[i] = mixHash64(state);
+	}
+}
+
+/*
+ * Update signature minimums with V-gram.  Hash function of each position
+ * mixes base hash of V-gram with its own 64-bit seed, so positions are
+ * hashed independently rather than by linear combinations of the same pair
+ * of hashes, whose minimums are correlated.
+ */
+static void
+addMinHashVGram(char *vgram, void *userData)
+{
+	MinHashInfo *info = (MinHashInfo *) userData;
+	uint64		base;
+	uint32		h;
+	int32		i;
+
+	base = DatumGetUInt32(hash_any((const unsigned char *) vgram, strlen(vgram)));
+	pfree(vgram);
+
+	for (i = 0; i < info->k; i++)
+	{
+		h = (uint32) (mixHash64(base ^ info->seeds[i]) >> 32);
+		if (h < info->minimums[i])
+			info->minimums[i] = h;
+	}
+	info->empty = false;
+}
+
+static int
+getSignatureLength(ArrayType *a)
+{
+	if (ARR_NDIM(a) > 1)
+		elog(ERROR, "MinHash signature must be one-dimensional array.");
+	if (array_contains_nulls(a))
+		elog(ERROR, "MinHash signature must not contain nulls.");
+	return ArrayGetNItems(ARR_NDIM(a), ARR_DIMS(a));
+}
+
+/*
+ * Calculate MinHash signature of the set of minimal V-grams of string.  The
+ * signature consists of k minimums of independent hash functions.  Fraction
+ * of equal positions of two signatures estimates Jaccard similarity of
+ * V-gram sets.  String without V-grams has empty signature.  V-grams depend
+ * on the current statistics, so the function is only stable.
+ */
+Datum
+vgram_minhash(PG_FUNCTION_ARGS)
+{
+	text	   *s = PG_GETARG_TEXT_PP(0);
+	int32		k = PG_GETARG_INT32(1);
+	MinHashInfo info;
+	ExtractVGramsInfo userData;
+	Datum	   *elems;
+	int32		i;
+
+	if (k <= 0 || k > VGRAM_MINHASH_MAX_K)
+		elog(ERROR, "Number of MinHash functions must be between 1 and %d.",
+			 VGRAM_MINHASH_MAX_K);
+
+	loadStats();
+
+	info.k = k;
+	info.empty = true;
+	info.minimums = (uint32 *) palloc(sizeof(uint32) * k);
+	for (i = 0; i < k; i++)
+		info.minimums[i] = PG_UINT32_MAX;
+	info.seeds = (uint64 *) palloc(sizeof(uint64) * k);
+	initMinHashSeeds(info.seeds, k);
+
+	userData.callback = addMinHashVGram;
+	userData.userData = &info;
+
+	extractWords(VARDATA_ANY(s), VARSIZE_ANY_EXHDR(s), extractMinimalVGramsWord, &userData);
+
+	if (info.empty)
+		PG_RETURN_ARRAYTYPE_P(construct_empty_array(INT4OID));
+
+	elems = (Datum *) palloc(sizeof(Datum) * k);
+	for (i = 0; i < k; i++)
+		elems[i] = Int32GetDatum((int32) info.minimums[i]);
+
+	PG_RETURN_ARRAYTYPE_P(construct_array(elems, k, INT4OID,
+										  sizeof(int32), true, 'i'));
+}
+
+/*
+ * Split MinHash signature into bands and hash each band together with its
+ * number.  Signatures sharing any band hash are candidate near-duplicates,
+ * which could be found by GIN index over band hashes using && operator.
+ * Trailing positions not filling the whole band are ignored.
+ */
+Datum
+vgram_minhash_bands(PG_FUNCTION_ARGS)
+{
+	ArrayType  *signature = PG_GETARG_ARRAYTYPE_P(0);
+	int32		nbands = PG_GETARG_INT32(1);
+	int32	   *values;
+	Datum	   *elems;
+	int			n,
+				rows,
+				i,
+				j;
+
+	if (nbands <= 0)
+		elog(ERROR, "Number of bands must be positive.");
+
+	n = getSignatureLength(signature);
+	if (n == 0)
+		PG_RETURN_ARRAYTYPE_P(construct_empty_array(INT4OID));
+	if (nbands > n)
+		elog(ERROR, "Number of bands can't exceed signature length %d.", n);
+
+	values = (int32 *) ARR_DATA_PTR(signature);
+	rows = n / nbands;
+	elems = (Datum *) palloc(sizeof(Datum) * nbands);
+	for (i = 0; i < nbands; i++)
+	{
+		uint32		h = DatumGetUInt32(hash_uint32((uint32) i));
+
+		for (j = 0; j < rows; j++)
+			h = DatumGetUInt32(hash_uint32(h ^ (uint32) values[i * rows + j]));
+		elems[i] = Int32GetDatum((int32) h);
+	}
+
+	PG_RETURN_ARRAYTYPE_P(construct_array(elems, nbands, INT4OID,
+										  sizeof(int32), true, 'i'));
+}
+
+/*
+ * Estimate Jaccard similarity of V-gram sets by their MinHash signatures.
+ */
+Datum
+vgram_minhash_similarity(PG_FUNCTION_ARGS)
+{
+	ArrayType  *a = PG_GETARG_ARRAYTYPE_P(0);
+	ArrayType  *b = PG_GETARG_ARRAYTYPE_P(1);
+	int32	   *valuesA,
+			   *valuesB;
+	int			na,
+				nb,
+				i,
+				equal = 0;
+
+	na = getSignatureLength(a);
+	nb = getSignatureLength(b);
+	if (na == 0 || nb == 0)
+		PG_RETURN_FLOAT4(0.0f);
+	if (na != nb)
+		elog(ERROR, "Can't compare MinHash signatures of different lengths.");
+
+	valuesA = (int32 *) ARR_DATA_PTR(a);
+	valuesB = (int32 *) ARR_DATA_PTR(b);
+	for (i = 0; i < na; i++)
+	{
+		if (valuesA[i] == valuesB[i])
+			equal++;
+	}
+
+	PG_RETURN_FLOAT4((float4) equal / (float4) na);
+}
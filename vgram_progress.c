@@ -0,0 +1,352 @@
+/*-------------------------------------------------------------------------
+ *
+ * vgram_progress.c
+ *		Shared memory progress reporting of q-gram statistics collection.
+ *
+ * Copyright (c) 2011-2017, Alexander Korotkov
+ *
+ * IDENTIFICATION
+ *	  contrib/vgram/vgram_progress.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "fmgr.h"
+#include "funcapi.h"
+#include "miscadmin.h"
+#include "access/htup_details.h"
+#include "access/xact.h"
+#include "port/atomics.h"
+#include "storage/ipc.h"
+#include "storage/shmem.h"
+#include "storage/spin.h"
+#include "utils/builtins.h"
+#include "utils/timestamp.h"
+
+#include "vgram.h"
+
+Datum		vgram_stat_progress(PG_FUNCTION_ARGS);
+
+PG_FUNCTION_INFO_V1(vgram_stat_progress);
+
+/*
+ * Progress of statistics collection in single backend.  Slot is written only
+ * by its owner, readers use change counter to get consistent copy like
+ * pgstat does for backend status.
+ */
+typedef struct
+{
+	int			pid;
+	Oid			dbid;
+	uint32		changeCount;
+	int			phase;
+	int64		rows,
+				totalRows,
+				distinct,
+				memory;
+	TimestampTz	started;
+} ProgressSlot;
+
+typedef struct
+{
+	slock_t		mutex;
+	ProgressSlot slots[VGRAM_PROGRESS_SLOTS];
+} ProgressShared;
+
+static const char *const phaseNames[] = {"counting", "filtering", "writing"};
+
+static ProgressShared *progress = NULL;
+static ProgressSlot *mySlot = NULL;
+static bool callbackRegistered = false;
+
+#if PG_VERSION_NUM >= 150000
+static shmem_request_hook_type prev_shmem_request_hook = NULL;
+#endif
+static shmem_startup_hook_type prev_shmem_startup_hook = NULL;
+
+#define BEGIN_SLOT_WRITE(slot) \
+	do { \
+		(slot)->changeCount++; \
+		pg_write_barrier(); \
+	} while (0)
+
+#define END_SLOT_WRITE(slot) \
+	do { \
+		pg_write_barrier(); \
+		(slot)->changeCount++; \
+	} while (0)
+
+#if PG_VERSION_NUM >= 150000
+static void
+progressShmemRequest(void)
+{
+	if (prev_shmem_request_hook)
+		prev_shmem_request_hook();
+
+	RequestAddinShmemSpace(sizeof(ProgressShared));
+}
+#endif
+
+static void
+progressShmemStartup(void)
+{
+	bool		found;
+
+	if (prev_shmem_startup_hook)
+		prev_shmem_startup_hook();
+
+	LWLockAcquire(AddinShmemInitLock, LW_EXCLUSIVE);
+	progress = ShmemInitStruct("vgram statistics progress",
+							   sizeof(ProgressShared), &found);
+	if (!found)
+	{
+		memset(progress, 0, sizeof(ProgressShared));
+		SpinLockInit(&progress->mutex);
+	}
+	LWLockRelease(AddinShmemInitLock);
+}
+
+/*
+ * Request shared memory for progress slots.  Progress is reported only when
+ * vgram is loaded by shared_preload_libraries.
+ */
+void
+progressInit(void)
+{
+	if (!process_shared_preload_libraries_in_progress)
+		return;
+
+#if PG_VERSION_NUM >= 150000
+	prev_shmem_request_hook = shmem_request_hook;
+	shmem_request_hook = progressShmemRequest;
+#else
+	RequestAddinShmemSpace(sizeof(ProgressShared));
+#endif
+	prev_shmem_startup_hook = shmem_startup_hook;
+	shmem_startup_hook = progressShmemStartup;
+}
+
+/*
+ * Release slot at the end of transaction, so that it isn't leaked when
+ * collection is interrupted by error.
+ */
+static void
+progressXactCallback(XactEvent event, void *arg)
+{
+	if (event == XACT_EVENT_COMMIT || event == XACT_EVENT_ABORT)
+		progressEnd();
+}
+
+/**
+ * Start reporting progress of statistics collection.  When all the slots are
+ * busy, progress isn't reported.
+ *
+ * @param totalRows Expected number of rows, or -1 when unknown
+ */
+void
+progressStart(int64 totalRows)
+{
+	int			i;
+
+	if (!progress)
+		return;
+
+	if (!callbackRegistered)
+	{
+		RegisterXactCallback(progressXactCallback, NULL);
+		callbackRegistered = true;
+	}
+
+	if (!mySlot)
+	{
+		SpinLockAcquire(&progress->mutex);
+		for (i = 0; i < VGRAM_PROGRESS_SLOTS; i++)
+		{
+			if (progress->slots[i].pid == 0)
+			{
+				mySlot = &progress->slots[i];
+				mySlot->pid = MyProcPid;
+				break;
+			}
+		}
+		SpinLockRelease(&progress->mutex);
+		if (!mySlot)
+			return;
+	}
+
+	BEGIN_SLOT_WRITE(mySlot);
+	mySlot->dbid = MyDatabaseId;
+	mySlot->phase = VGRAM_PROGRESS_COUNTING;
+	mySlot->rows = 0;
+	mySlot->totalRows = totalRows;
+	mySlot->distinct = 0;
+	mySlot->memory = 0;
+	mySlot->started = GetCurrentTimestamp();
+	END_SLOT_WRITE(mySlot);
+}
+
+/**
+ * Set expected number of rows of statistics collection.
+ *
+ * @param totalRows Expected number of rows, or -1 when unknown
+ */
+void
+progressSetTotal(int64 totalRows)
+{
+	if (!mySlot)
+		return;
+
+	BEGIN_SLOT_WRITE(mySlot);
+	mySlot->totalRows = totalRows;
+	END_SLOT_WRITE(mySlot);
+}
+
+/**
+ * Report current progress of statistics collection.
+ *
+ * @param phase Current phase
+ * @param rows Number of rows processed
+ * @param distinct Number of distinct q-grams held
+ * @param memory Memory used by collection in bytes, or -1 when unknown
+ */
+void
+progressUpdate(VGramProgressPhase phase, int64 rows, int64 distinct,
+			   int64 memory)
+{
+	if (!mySlot)
+		return;
+
+	BEGIN_SLOT_WRITE(mySlot);
+	mySlot->phase = phase;
+	mySlot->rows = rows;
+	mySlot->distinct = distinct;
+	mySlot->memory = memory;
+	END_SLOT_WRITE(mySlot);
+}
+
+/*
+ * Finish reporting progress of statistics collection.
+ */
+void
+progressEnd(void)
+{
+	if (!mySlot)
+		return;
+
+	SpinLockAcquire(&progress->mutex);
+	mySlot->pid = 0;
+	SpinLockRelease(&progress->mutex);
+	mySlot = NULL;
+}
+
+/*
+ * Get consistent copy of slot.  Returns false when slot is free.
+ */
+static bool
+readSlot(ProgressSlot *slot, ProgressSlot *copy)
+{
+	for (;;)
+	{
+		uint32		before,
+					after;
+
+		before = slot->changeCount;
+		pg_read_barrier();
+		memcpy(copy, slot, sizeof(ProgressSlot));
+		pg_read_barrier();
+		after = slot->changeCount;
+
+		if (before == after && (before & 1) == 0)
+			break;
+		CHECK_FOR_INTERRUPTS();
+	}
+	return copy->pid != 0;
+}
+
+typedef struct
+{
+	ProgressSlot slots[VGRAM_PROGRESS_SLOTS];
+	int			count;
+} ProgressSnapshot;
+
+/*
+ * Return progress of statistics collections running in all the backends.
+ * Completion is estimated assuming constant rate of rows processing.
+ */
+Datum
+vgram_stat_progress(PG_FUNCTION_ARGS)
+{
+	FuncCallContext *funcctx;
+	ProgressSnapshot *snapshot;
+
+	if (SRF_IS_FIRSTCALL())
+	{
+		MemoryContext oldContext;
+		TupleDesc	tupdesc;
+		int			i;
+
+		funcctx = SRF_FIRSTCALL_INIT();
+		oldContext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
+
+		if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+			elog(ERROR, "return type must be a row type");
+		funcctx->tuple_desc = BlessTupleDesc(tupdesc);
+
+		snapshot = (ProgressSnapshot *) palloc0(sizeof(ProgressSnapshot));
+		if (progress)
+		{
+			for (i = 0; i < VGRAM_PROGRESS_SLOTS; i++)
+			{
+				if (readSlot(&progress->slots[i],
+							 &snapshot->slots[snapshot->count]))
+					snapshot->count++;
+			}
+		}
+		funcctx->user_fctx = snapshot;
+		funcctx->max_calls = snapshot->count;
+
+		MemoryContextSwitchTo(oldContext);
+	}
+
+	funcctx = SRF_PERCALL_SETUP();
+	snapshot = (ProgressSnapshot *) funcctx->user_fctx;
+
+	if (funcctx->call_cntr < funcctx->max_calls)
+	{
+		ProgressSlot *slot = &snapshot->slots[funcctx->call_cntr];
+		Datum		values[9];
+		bool		nulls[9] = {false, false, false, false, false,
+								false, false, false, false};
+		HeapTuple	tuple;
+
+		values[0] = Int32GetDatum(slot->pid);
+		values[1] = ObjectIdGetDatum(slot->dbid);
+		values[2] = CStringGetTextDatum(phaseNames[slot->phase]);
+		values[3] = Int64GetDatum(slot->rows);
+		values[4] = Int64GetDatum(slot->totalRows);
+		nulls[4] = (slot->totalRows < 0);
+		values[5] = Int64GetDatum(slot->distinct);
+		values[6] = Int64GetDatum(slot->memory);
+		nulls[6] = (slot->memory < 0);
+		values[7] = TimestampTzGetDatum(slot->started);
+
+		if (slot->phase == VGRAM_PROGRESS_COUNTING &&
+			slot->totalRows > slot->rows && slot->rows > 0)
+		{
+			TimestampTz now = GetCurrentTimestamp();
+			double		remaining = (double) (slot->totalRows - slot->rows) /
+			(double) slot->rows;
+
+			values[8] = TimestampTzGetDatum(now + (TimestampTz)
+											((now - slot->started) * remaining));
+		}
+		else
+			nulls[8] = true;
+
+		tuple = heap_form_tuple(funcctx->tuple_desc, values, nulls);
+		SRF_RETURN_NEXT(funcctx, HeapTupleGetDatum(tuple));
+	}
+
+	SRF_RETURN_DONE(funcctx);
+}
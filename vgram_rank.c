@@ -0,0 +1,599 @@
+/*-------------------------------------------------------------------------
+ *
+ * vgram_rank.c
+ *		Routines for relevance-ranked top-k search of documents sharing
+ *		V-grams with the query.
+ *
+ * Copyright (c) 2011-2017, Alexander Korotkov
+ *
+ * IDENTIFICATION
+ *	  contrib/vgram/vgram_rank.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include <math.h>
+
+#include "fmgr.h"
+#include "funcapi.h"
+#include "miscadmin.h"
+#include "access/genam.h"
+#include "access/heapam.h"
+#include "access/htup_details.h"
+#include "access/skey.h"
+#include "catalog/pg_collation.h"
+#include "catalog/pg_type.h"
+#include "nodes/tidbitmap.h"
+#include "storage/itemptr.h"
+#include "utils/array.h"
+#include "utils/builtins.h"
+#include "utils/lsyscache.h"
+#include "utils/rel.h"
+#include "utils/snapmgr.h"
+
+#include "vgram.h"
+
+Datum		vgram_ranked_search(PG_FUNCTION_ARGS);
+
+PG_FUNCTION_INFO_V1(vgram_ranked_search);
+
+/*
+ * Distinct V-gram of query with its IDF weight.
+ */
+typedef struct
+{
+	char	   *vgram;
+	float4		weight;
+} RankedVGram;
+
+typedef struct
+{
+	RankedVGram *vgrams;
+	int			nvgrams,
+				allocated;
+} QueryVGramsInfo;
+
+/*
+ * Document found in posting lists.  Score is accumulated over exact pages of
+ * posting lists read so far, while bound also includes lossy pages.  Once
+ * document is verified, score and bound are exact, and liveTid is TID of its
+ * tuple visible to the snapshot found through HOT chain from the indexed
+ * root TID.
+ */
+typedef struct
+{
+	ItemPointerData tid;
+	ItemPointerData liveTid;
+	float4		score;
+	float4		bound;
+	bool		verified;
+} RankCandidate;
+
+/*
+ * Verified live documents having k largest scores, ordered by descending
+ * score.
+ */
+typedef struct
+{
+	RankCandidate *results;
+	int			nresults,
+				k;
+} TopResults;
+
+/*
+ * Heap access for candidates verification.
+ */
+typedef struct
+{
+	Relation	heapRel;
+	AttrNumber	attnum;
+	Snapshot	snapshot;
+	RankedVGram *vgrams;
+	int			nvgrams;
+} VerifyInfo;
+
+typedef struct
+{
+	RankedVGram *vgrams;
+	int			nvgrams;
+	bool	   *found;
+	float4		score;
+} ScoreInfo;
+
+typedef struct
+{
+	RankCandidate *results;
+	int			nresults;
+} RankedSearchState;
+
+static int
+rankedVGramNameCmp(const void *a, const void *b)
+{
+	return strcmp(((const RankedVGram *) a)->vgram,
+				  ((const RankedVGram *) b)->vgram);
+}
+
+/* Rarest V-grams, i.e. ones having largest weight, go first */
+static int
+rankedVGramWeightCmp(const void *a, const void *b)
+{
+	const RankedVGram *va = (const RankedVGram *) a;
+	const RankedVGram *vb = (const RankedVGram *) b;
+
+	if (va->weight != vb->weight)
+		return (va->weight < vb->weight) ? 1 : -1;
+	return strcmp(va->vgram, vb->vgram);
+}
+
+static int
+candidateBoundCmp(const void *a, const void *b)
+{
+	const RankCandidate *ca = (const RankCandidate *) a;
+	const RankCandidate *cb = (const RankCandidate *) b;
+
+	if (ca->bound != cb->bound)
+		return (ca->bound < cb->bound) ? 1 : -1;
+	return ItemPointerCompare((ItemPointer) &ca->tid, (ItemPointer) &cb->tid);
+}
+
+static int
+candidateScoreCmp(const void *a, const void *b)
+{
+	const RankCandidate *ca = (const RankCandidate *) a;
+	const RankCandidate *cb = (const RankCandidate *) b;
+
+	if (ca->score != cb->score)
+		return (ca->score < cb->score) ? 1 : -1;
+	return ItemPointerCompare((ItemPointer) &ca->tid, (ItemPointer) &cb->tid);
+}
+
+/* Unverified candidates having largest accumulated scores go first */
+static int
+candidatePtrScoreCmp(const void *a, const void *b)
+{
+	return candidateScoreCmp(*(RankCandidate *const *) a,
+							 *(RankCandidate *const *) b);
+}
+
+static void
+addQueryVGram(char *vgram, void *userData)
+{
+	QueryVGramsInfo *info = (QueryVGramsInfo *) userData;
+
+	if (info->nvgrams >= info->allocated)
+	{
+		info->allocated *= 2;
+		info->vgrams = (RankedVGram *) repalloc(info->vgrams,
+												sizeof(RankedVGram) * info->allocated);
+	}
+	info->vgrams[info->nvgrams++].vgram = vgram;
+}
+
+/**
+ * Extract distinct V-grams of query the same way as they are extracted from
+ * indexed documents, and weight them by IDF.  V-grams estimated to be
+ * contained in every document have zero weight, and are skipped.
+ *
+ * @param query Query string
+ * @param nvgrams Receives number of V-grams
+ * @return V-grams sorted by name
+ */
+static RankedVGram *
+getQueryVGrams(text *query, int *nvgrams)
+{
+	QueryVGramsInfo info;
+	ExtractVGramsInfo userData;
+	int			i,
+				j = 0;
+
+	info.nvgrams = 0;
+	info.allocated = 16;
+	info.vgrams = (RankedVGram *) palloc(sizeof(RankedVGram) * info.allocated);
+
+	userData.callback = addQueryVGram;
+	userData.userData = &info;
+	extractWords(VARDATA_ANY(query), VARSIZE_ANY_EXHDR(query),
+				 extractMinimalVGramsWord, &userData);
+
+	qsort(info.vgrams, info.nvgrams, sizeof(RankedVGram), rankedVGramNameCmp);
+	for (i = 0; i < info.nvgrams; i++)
+	{
+		float4		selectivity;
+
+		if (j > 0 && strcmp(info.vgrams[i].vgram, info.vgrams[j - 1].vgram) == 0)
+			continue;
+
+		selectivity = estimateVGramSelectivilty(info.vgrams[i].vgram);
+		if (selectivity >= 1.0f)
+			continue;
+		info.vgrams[j].vgram = info.vgrams[i].vgram;
+		info.vgrams[j].weight = -log(Max(selectivity, VGRAM_RANK_MIN_SELECTIVITY));
+		j++;
+	}
+
+	*nvgrams = j;
+	return info.vgrams;
+}
+
+/*
+ * Add weight of V-gram to the scores of documents in its posting list.
+ * Posting list is read by bitmap scan with keys match strategy.  Lossy pages
+ * are expanded to all possible offsets, but they contribute only to the
+ * bounds.  Non-existing TIDs are dropped by verification.
+ */
+static void
+addPostingList(Relation indexRel, RegProcedure keysMatchProc,
+			   RankedVGram *vgram, HTAB *candidates)
+{
+	IndexScanDesc scan;
+	ScanKeyData key;
+	TIDBitmap  *tbm;
+	TBMIterator *iterator;
+	TBMIterateResult *tbmres;
+	Datum		keyDatum = CStringGetTextDatum(vgram->vgram);
+
+	ScanKeyEntryInitialize(&key, 0, 1, KeysMatchStrategyNumber, InvalidOid,
+						   DEFAULT_COLLATION_OID, keysMatchProc,
+						   PointerGetDatum(construct_array(&keyDatum, 1, TEXTOID,
+														   -1, false, 'i')));
+
+#if PG_VERSION_NUM >= 100000
+	tbm = tbm_create(work_mem * 1024L, NULL);
+#else
+	tbm = tbm_create(work_mem * 1024L);
+#endif
+	scan = index_beginscan_bitmap(indexRel, GetActiveSnapshot(), 1);
+	index_rescan(scan, &key, 1, NULL, 0);
+	(void) index_getbitmap(scan, tbm);
+	index_endscan(scan);
+
+	iterator = tbm_begin_iterate(tbm);
+	while ((tbmres = tbm_iterate(iterator)) != NULL)
+	{
+		int			n = (tbmres->ntuples >= 0) ? tbmres->ntuples : MaxHeapTuplesPerPage,
+					i;
+
+		CHECK_FOR_INTERRUPTS();
+
+		for (i = 0; i < n; i++)
+		{
+			ItemPointerData tid;
+			RankCandidate *candidate;
+			bool		found;
+
+			ItemPointerSet(&tid, tbmres->blockno,
+						   (tbmres->ntuples >= 0) ? tbmres->offsets[i] : i + 1);
+			candidate = (RankCandidate *) hash_search(candidates,
+													  (const void *) &tid,
+													  HASH_ENTER, &found);
+			if (!found)
+			{
+				candidate->score = 0.0f;
+				candidate->bound = 0.0f;
+				candidate->verified = false;
+			}
+			else if (candidate->verified)
+				continue;
+			if (tbmres->ntuples >= 0)
+				candidate->score += vgram->weight;
+			candidate->bound += vgram->weight;
+		}
+	}
+	tbm_end_iterate(iterator);
+	tbm_free(tbm);
+}
+
+static void
+scoreVGram(char *vgram, void *userData)
+{
+	ScoreInfo  *info = (ScoreInfo *) userData;
+	RankedVGram key,
+			   *found;
+
+	key.vgram = vgram;
+	found = (RankedVGram *) bsearch(&key, info->vgrams, info->nvgrams,
+									sizeof(RankedVGram), rankedVGramNameCmp);
+	if (found && !info->found[found - info->vgrams])
+	{
+		info->found[found - info->vgrams] = true;
+		info->score += found->weight;
+	}
+	pfree(vgram);
+}
+
+/*
+ * Calculate exact score of the document: sum of weights of query V-grams
+ * extracted from the document.
+ */
+static float4
+scoreDocument(text *doc, RankedVGram *vgrams, int nvgrams)
+{
+	ScoreInfo	info;
+	ExtractVGramsInfo userData;
+
+	info.vgrams = vgrams;
+	info.nvgrams = nvgrams;
+	info.found = (bool *) palloc0(sizeof(bool) * nvgrams);
+	info.score = 0.0f;
+
+	userData.callback = scoreVGram;
+	userData.userData = &info;
+	extractWords(VARDATA_ANY(doc), VARSIZE_ANY_EXHDR(doc),
+				 extractMinimalVGramsWord, &userData);
+
+	pfree(info.found);
+	return info.score;
+}
+
+/*
+ * Score of k-th verified live document, or zero if less than k documents are
+ * verified.  No document scoring below it could get to the top.
+ */
+static float4
+getThreshold(TopResults *top)
+{
+	return (top->nresults < top->k) ? 0.0f : top->results[top->k - 1].score;
+}
+
+static void
+addTopResult(TopResults *top, RankCandidate *candidate)
+{
+	int			i;
+
+	if (top->nresults < top->k)
+		i = top->nresults++;
+	else if (candidateScoreCmp(candidate, &top->results[top->k - 1]) < 0)
+		i = top->k - 1;
+	else
+		return;
+
+	while (i > 0 && candidateScoreCmp(candidate, &top->results[i - 1]) < 0)
+	{
+		top->results[i] = top->results[i - 1];
+		i--;
+	}
+	top->results[i] = *candidate;
+}
+
+/*
+ * Verify candidate by the heap: follow HOT chain from the indexed TID to the
+ * tuple visible to the snapshot, and calculate its exact score.  Live
+ * documents having non-zero score are added to the top results.
+ */
+static void
+verifyCandidate(VerifyInfo *info, RankCandidate *candidate, TopResults *top)
+{
+	HeapTuple	tuple;
+	Datum		value;
+	bool		isnull;
+
+	CHECK_FOR_INTERRUPTS();
+
+	candidate->verified = true;
+	candidate->score = 0.0f;
+	candidate->liveTid = candidate->tid;
+
+	tuple = getVisibleTuple(info->heapRel, &candidate->liveTid, info->snapshot);
+	if (tuple)
+	{
+		value = heap_getattr(tuple, info->attnum,
+							 RelationGetDescr(info->heapRel), &isnull);
+		if (!isnull)
+			candidate->score = scoreDocument(DatumGetTextPP(value),
+											 info->vgrams, info->nvgrams);
+		heap_freetuple(tuple);
+	}
+	candidate->bound = candidate->score;
+
+	if (candidate->score > 0.0f)
+		addTopResult(top, candidate);
+}
+
+/*
+ * Verify unverified candidates having k largest accumulated scores, so that
+ * pruning threshold is raised by live documents only.  Verified candidates
+ * already contribute their exact scores to the top results.
+ */
+static void
+verifyBestCandidates(VerifyInfo *info, HTAB *candidates, TopResults *top)
+{
+	HASH_SEQ_STATUS status;
+	RankCandidate *candidate,
+			  **best;
+	int			nbest = 0,
+				i;
+
+	best = (RankCandidate **) palloc(sizeof(RankCandidate *) *
+									 Max(hash_get_num_entries(candidates), 1));
+	hash_seq_init(&status, candidates);
+	while ((candidate = (RankCandidate *) hash_seq_search(&status)) != NULL)
+	{
+		if (!candidate->verified)
+			best[nbest++] = candidate;
+	}
+
+	qsort(best, nbest, sizeof(RankCandidate *), candidatePtrScoreCmp);
+	for (i = 0; i < Min(nbest, top->k); i++)
+		verifyCandidate(info, best[i], top);
+	pfree(best);
+}
+
+/**
+ * Find top-k documents by IDF-weighted V-gram overlap with the query using
+ * MaxScore pruning.  Posting lists are read from the rarest V-gram.  After
+ * each posting list, candidates having the largest accumulated scores are
+ * verified by the heap, and the threshold is the k-th exact score of live
+ * documents.  Once the total weight of unread V-grams doesn't exceed the
+ * threshold, no document outside of candidates could get to the top, and
+ * remaining posting lists are skipped.  Then the rest of candidates are
+ * verified in the order of their upper bounds until the bound falls below
+ * the threshold.  Verification follows HOT chains, drops invisible tuples
+ * and gives exact scores.
+ *
+ * @param indexOid V-gram index
+ * @param query Query string
+ * @param k Number of documents to find
+ * @param nresults Receives number of documents found
+ * @return Documents ordered by descending score
+ */
+static RankCandidate *
+rankedSearch(Oid indexOid, text *query, int k, int *nresults)
+{
+	Relation	indexRel;
+	RankedVGram *vgrams,
+			   *byWeight;
+	RankCandidate *candidates,
+			   *candidate;
+	HTAB	   *candidatesHash;
+	HASHCTL		hashCtl;
+	HASH_SEQ_STATUS status;
+	RegProcedure keysMatchProc;
+	Oid			opno;
+	VerifyInfo	info;
+	TopResults	top;
+	float4		remaining = 0.0f;
+	int			nvgrams,
+				ncandidates = 0,
+				i;
+
+	loadStats();
+	vgrams = getQueryVGrams(query, &nvgrams);
+	*nresults = 0;
+	if (nvgrams == 0)
+		return NULL;
+
+	byWeight = (RankedVGram *) palloc(sizeof(RankedVGram) * nvgrams);
+	memcpy(byWeight, vgrams, sizeof(RankedVGram) * nvgrams);
+	qsort(byWeight, nvgrams, sizeof(RankedVGram), rankedVGramWeightCmp);
+	for (i = 0; i < nvgrams; i++)
+		remaining += byWeight[i].weight;
+
+	indexRel = index_open(indexOid, AccessShareLock);
+	opno = get_opfamily_member(indexRel->rd_opfamily[0], TEXTOID, TEXTARRAYOID,
+							   KeysMatchStrategyNumber);
+	if (!OidIsValid(opno))
+		elog(ERROR, "Index \"%s\" isn't V-gram index.",
+			 RelationGetRelationName(indexRel));
+	if (indexRel->rd_index->indnatts != 1 ||
+		indexRel->rd_index->indkey.values[0] == 0)
+		elog(ERROR, "Only single column V-gram indexes over table column are supported.");
+	keysMatchProc = get_opcode(opno);
+
+	checkIndexedTableSelect(indexRel);
+
+	info.heapRel = relation_open(indexRel->rd_index->indrelid, AccessShareLock);
+	info.attnum = indexRel->rd_index->indkey.values[0];
+	info.snapshot = GetActiveSnapshot();
+	info.vgrams = vgrams;
+	info.nvgrams = nvgrams;
+
+	top.k = k;
+	top.nresults = 0;
+	top.results = (RankCandidate *) palloc(sizeof(RankCandidate) * k);
+
+	memset(&hashCtl, 0, sizeof(hashCtl));
+	hashCtl.keysize = sizeof(ItemPointerData);
+	hashCtl.entrysize = sizeof(RankCandidate);
+	hashCtl.hcxt = CurrentMemoryContext;
+	candidatesHash = hash_create("vgram ranked search candidates",
+								 1024,
+								 &hashCtl,
+								 HASH_ELEM | HASH_BLOBS | HASH_CONTEXT);
+
+	/* Read posting lists until unseen documents can't get to the top */
+	for (i = 0; i < nvgrams && remaining > getThreshold(&top); i++)
+	{
+		addPostingList(indexRel, keysMatchProc, &byWeight[i], candidatesHash);
+		remaining -= byWeight[i].weight;
+		verifyBestCandidates(&info, candidatesHash, &top);
+	}
+	index_close(indexRel, AccessShareLock);
+
+	/* Skip candidates whose upper bound doesn't reach the threshold */
+	candidates = (RankCandidate *) palloc(sizeof(RankCandidate) *
+										  Max(hash_get_num_entries(candidatesHash), 1));
+	hash_seq_init(&status, candidatesHash);
+	while ((candidate = (RankCandidate *) hash_seq_search(&status)) != NULL)
+	{
+		if (candidate->verified ||
+			candidate->bound + remaining < getThreshold(&top))
+			continue;
+		candidates[ncandidates] = *candidate;
+		candidates[ncandidates].bound += remaining;
+		ncandidates++;
+	}
+	hash_destroy(candidatesHash);
+	qsort(candidates, ncandidates, sizeof(RankCandidate), candidateBoundCmp);
+
+	for (i = 0; i < ncandidates; i++)
+	{
+		/* Remaining candidates can't beat k-th exact score */
+		if (top.nresults >= k && candidates[i].bound < getThreshold(&top))
+			break;
+		verifyCandidate(&info, &candidates[i], &top);
+	}
+	relation_close(info.heapRel, AccessShareLock);
+
+	/* Return TIDs of visible tuples rather than indexed roots */
+	for (i = 0; i < top.nresults; i++)
+		top.results[i].tid = top.results[i].liveTid;
+
+	*nresults = top.nresults;
+	return top.results;
+}
+
+/*
+ * Return top-k documents ranked by the sum of IDF weights of query V-grams
+ * they contain, with their scores.  Documents don't need to contain all the
+ * V-grams of query.
+ */
+Datum
+vgram_ranked_search(PG_FUNCTION_ARGS)
+{
+	FuncCallContext *funcctx;
+	RankedSearchState *state;
+
+	if (SRF_IS_FIRSTCALL())
+	{
+		MemoryContext oldContext;
+		TupleDesc	tupdesc;
+		int32		k = PG_GETARG_INT32(2);
+
+		if (k <= 0)
+			elog(ERROR, "Number of documents to find must be positive.");
+
+		funcctx = SRF_FIRSTCALL_INIT();
+		oldContext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
+
+		if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+			elog(ERROR, "return type must be a row type");
+		funcctx->tuple_desc = BlessTupleDesc(tupdesc);
+
+		state = (RankedSearchState *) palloc(sizeof(RankedSearchState));
+		state->results = rankedSearch(PG_GETARG_OID(0), PG_GETARG_TEXT_PP(1),
+									  k, &state->nresults);
+		funcctx->user_fctx = state;
+		funcctx->max_calls = state->nresults;
+
+		MemoryContextSwitchTo(oldContext);
+	}
+
+	funcctx = SRF_PERCALL_SETUP();
+	state = (RankedSearchState *) funcctx->user_fctx;
+
+	if (funcctx->call_cntr < funcctx->max_calls)
+	{
+		RankCandidate *result = &state->results[funcctx->call_cntr];
+		Datum		values[2];
+		bool		nulls[2] = {false, false};
+		HeapTuple	tuple;
+
+		values[0] = PointerGetDatum(&result->tid);
+		values[1] = Float4GetDatum(result->score);
+		tuple = heap_form_tuple(funcctx->tuple_desc, values, nulls);
+		SRF_RETURN_NEXT(funcctx, HeapTupleGetDatum(tuple));
+	}
+
+	SRF_RETURN_DONE(funcctx);
+}
@@ -0,0 +1,208 @@
+/*-------------------------------------------------------------------------
+ *
+ * vgram_search.c
+ *		Routines for LIMIT-friendly streaming search of like/ilike
+ *		patterns.
+ *
+ * Copyright (c) 2011-2017, Alexander Korotkov
+ *
+ * IDENTIFICATION
+ *	  contrib/vgram/vgram_search.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+#include "fmgr.h"
+#include "funcapi.h"
+#include "access/genam.h"
+#include "catalog/pg_type.h"
+#include "executor/executor.h"
+#include "executor/spi.h"
+#include "storage/itemptr.h"
+#include "utils/builtins.h"
+#include "utils/guc.h"
+#include "utils/memutils.h"
+#include "utils/rel.h"
+
+#include "vgram.h"
+
+Datum		vgram_like_search(PG_FUNCTION_ARGS);
+
+PG_FUNCTION_INFO_V1(vgram_like_search);
+
+typedef struct
+{
+	char	   *portalName;
+	int32		maxRows,
+				returned;
+} LikeSearchState;
+
+/**
+ * Check if pattern is unselective enough to be searched by streaming the
+ * table.  Selectivity of pattern is at most selectivity of its rarest
+ * V-gram.  When it's high, then GIN scan would build large bitmap, while
+ * streaming scan is expected to find enough matches soon.
+ *
+ * @param pattern like/ilike pattern
+ * @return True if streaming scan should be used
+ */
+static bool
+isStreamable(text *pattern)
+{
+	Datum	   *entries;
+	int32		nentries,
+				i;
+	float4		minSelectivity = 1.0f;
+
+	loadStats();
+	entries = extractQueryLike(&nentries, pattern);
+
+	for (i = 0; i < nentries; i++)
+	{
+		char	   *vgram = text_to_cstring(DatumGetTextPP(entries[i]));
+
+		minSelectivity = Min(minSelectivity, estimateVGramSelectivilty(vgram));
+		pfree(vgram);
+	}
+
+	return minSelectivity >= VGRAM_STREAM_SELECTIVITY;
+}
+
+/*
+ * Close search cursor when scan is finished or abandoned, e.g. by LIMIT, so
+ * that its snapshot and locks aren't held till the end of transaction.
+ */
+static void
+closeSearchCursor(Datum arg)
+{
+	LikeSearchState *state = (LikeSearchState *) DatumGetPointer(arg);
+	Portal		portal;
+
+	if (!state->portalName)
+		return;
+	portal = SPI_cursor_find(state->portalName);
+	if (portal)
+		SPI_cursor_close(portal);
+	state->portalName = NULL;
+}
+
+/*
+ * Return ctids of at most max_rows rows matching like/ilike pattern, which
+ * are found lazily one by one in no particular order.  For unselective
+ * patterns table is streamed by sequential scan with recheck of pattern, and
+ * scan stops as soon as enough matches are found.  Selective patterns are
+ * searched using index.
+ */
+Datum
+vgram_like_search(PG_FUNCTION_ARGS)
+{
+	FuncCallContext *funcctx;
+	LikeSearchState *state;
+	Portal		portal;
+	ItemPointerData ctid;
+	ItemPointer result;
+	bool		found = false;
+
+	if (SRF_IS_FIRSTCALL())
+	{
+		MemoryContext oldContext;
+		Relation	indexRel;
+		text	   *pattern = PG_GETARG_TEXT_PP(1);
+		bool		caseInsensitive = PG_GETARG_BOOL(3);
+		char	   *relname,
+				   *attname,
+				   *query;
+		SPIPlanPtr	plan;
+		Oid			argTypes[1] = {TEXTOID};
+		Datum		args[1];
+		int			nestLevel;
+
+		funcctx = SRF_FIRSTCALL_INIT();
+		oldContext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
+
+		state = (LikeSearchState *) palloc(sizeof(LikeSearchState));
+		state->maxRows = PG_GETARG_INT32(2);
+		state->returned = 0;
+		funcctx->user_fctx = state;
+
+		indexRel = index_open(PG_GETARG_OID(0), AccessShareLock);
+		getIndexedColumn(indexRel, &relname, &attname);
+		index_close(indexRel, AccessShareLock);
+
+		query = psprintf("SELECT ctid FROM %s WHERE %s %s $1",
+						 relname, attname, caseInsensitive ? "~~*" : "~~");
+
+		/*
+		 * Plan is chosen and scan is started at cursor open, so settings are
+		 * restored after it.  Synchronized scan would start in the middle of
+		 * table where concurrent scan is, and return different rows on every
+		 * call.
+		 */
+		nestLevel = NewGUCNestLevel();
+		if (isStreamable(pattern))
+		{
+			(void) set_config_option("synchronize_seqscans", "off",
+									 PGC_USERSET, PGC_S_SESSION,
+									 GUC_ACTION_SAVE, true, 0, false);
+			(void) set_config_option("enable_bitmapscan", "off",
+									 PGC_USERSET, PGC_S_SESSION,
+									 GUC_ACTION_SAVE, true, 0, false);
+			(void) set_config_option("enable_indexscan", "off",
+									 PGC_USERSET, PGC_S_SESSION,
+									 GUC_ACTION_SAVE, true, 0, false);
+		}
+
+		SPI_connect();
+		plan = SPI_prepare(query, 1, argTypes);
+		if (!plan)
+			elog(ERROR, "Can't prepare search query \"%s\".", query);
+		args[0] = PointerGetDatum(pattern);
+		portal = SPI_cursor_open(NULL, plan, args, NULL, true);
+		state->portalName = MemoryContextStrdup(funcctx->multi_call_memory_ctx,
+												portal->name);
+		SPI_finish();
+		RegisterExprContextCallback(((ReturnSetInfo *) fcinfo->resultinfo)->econtext,
+									closeSearchCursor, PointerGetDatum(state));
+
+		AtEOXact_GUC(true, nestLevel);
+
+		MemoryContextSwitchTo(oldContext);
+	}
+
+	funcctx = SRF_PERCALL_SETUP();
+	state = (LikeSearchState *) funcctx->user_fctx;
+
+	SPI_connect();
+	portal = SPI_cursor_find(state->portalName);
+	if (!portal)
+		elog(ERROR, "Search cursor \"%s\" is lost.", state->portalName);
+
+	if (state->returned < state->maxRows)
+	{
+		SPI_cursor_fetch(portal, true, 1);
+		if (SPI_processed == 1)
+		{
+			bool		isnull;
+
+			ItemPointerCopy(DatumGetItemPointer(SPI_getbinval(SPI_tuptable->vals[0],
+															  SPI_tuptable->tupdesc,
+															  1, &isnull)),
+							&ctid);
+			found = true;
+		}
+	}
+	SPI_finish();
+
+	if (found)
+	{
+		state->returned++;
+		result = (ItemPointer) palloc(sizeof(ItemPointerData));
+		ItemPointerCopy(&ctid, result);
+		SRF_RETURN_NEXT(funcctx, PointerGetDatum(result));
+	}
+
+	UnregisterExprContextCallback(((ReturnSetInfo *) fcinfo->resultinfo)->econtext,
+								  closeSearchCursor, PointerGetDatum(state));
+	closeSearchCursor(PointerGetDatum(state));
+	SRF_RETURN_DONE(funcctx);
+}
@@ -0,0 +1,891 @@
+/*-------------------------------------------------------------------------
+ *
+ * vgram_vector.c
+ *		vgramvector data type storing precomputed set of V-grams of string,
+ *		its set operations and GIN/GiST support.
+ *
+ * Copyright (c) 2011-2017, Alexander Korotkov
+ *
+ * IDENTIFICATION
+ *	  contrib/vgram/vgram_vector.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+#include "fmgr.h"
+#include "access/gin.h"
+#include "access/gist.h"
+#include "access/skey.h"
+#include "lib/stringinfo.h"
+#include "libpq/pqformat.h"
+#include "utils/builtins.h"
+
+#include "vgram.h"
+
+/*
+ * Set of V-grams is stored as sorted array of V-gram ids, which are
+ * vgramId() hashes of V-grams, so clients linking vgram_core could compute
+ * them as well.  Array is delta-encoded: every id is stored as difference
+ * with previous one in variable number of bytes, 7 bits per byte.
+ */
+typedef struct
+{
+	int32		vl_len_;		/* varlena header (do not touch directly!) */
+	int32		size;			/* number of ids */
+	uint8		data[FLEXIBLE_ARRAY_MEMBER];
+} VGramVector;
+
+#define VGRAMVECTOR_HDRSZ	(offsetof(VGramVector, data))
+#define DatumGetVGramVector(x)		((VGramVector *) PG_DETOAST_DATUM(x))
+#define PG_GETARG_VGRAMVECTOR(n)	DatumGetVGramVector(PG_GETARG_DATUM(n))
+#define PG_RETURN_VGRAMVECTOR(x)	PG_RETURN_POINTER(x)
+
+/* GiST key is bytea holding signature of V-gram ids */
+#define SIGLENBIT			(VGRAM_SIGLEN * BITS_PER_BYTE)
+#define GETSIGN(x)			((uint8 *) VARDATA(x))
+#define HASHVAL(id)			((id) % SIGLENBIT)
+#define GETBIT(sign, i)		(((sign)[(i) / BITS_PER_BYTE] >> ((i) % BITS_PER_BYTE)) & 1)
+#define SETBIT(sign, i)		((sign)[(i) / BITS_PER_BYTE] |= (1 << ((i) % BITS_PER_BYTE)))
+
+Datum		vgramvector_in(PG_FUNCTION_ARGS);
+Datum		vgramvector_out(PG_FUNCTION_ARGS);
+Datum		vgramvector_recv(PG_FUNCTION_ARGS);
+Datum		vgramvector_send(PG_FUNCTION_ARGS);
+Datum		to_vgramvector(PG_FUNCTION_ARGS);
+Datum		vgramvector_length(PG_FUNCTION_ARGS);
+Datum		vgramvector_overlap(PG_FUNCTION_ARGS);
+Datum		vgramvector_contains(PG_FUNCTION_ARGS);
+Datum		vgramvector_contained(PG_FUNCTION_ARGS);
+Datum		vgramvector_union(PG_FUNCTION_ARGS);
+Datum		vgramvector_intersect(PG_FUNCTION_ARGS);
+Datum		vgramvector_similarity(PG_FUNCTION_ARGS);
+Datum		vgramvector_gin_extract_value(PG_FUNCTION_ARGS);
+Datum		vgramvector_gin_extract_query(PG_FUNCTION_ARGS);
+Datum		vgramvector_gin_consistent(PG_FUNCTION_ARGS);
+Datum		vgramvector_gin_triconsistent(PG_FUNCTION_ARGS);
+Datum		vgramvector_gist_compress(PG_FUNCTION_ARGS);
+Datum		vgramvector_gist_decompress(PG_FUNCTION_ARGS);
+Datum		vgramvector_gist_consistent(PG_FUNCTION_ARGS);
+Datum		vgramvector_gist_union(PG_FUNCTION_ARGS);
+Datum		vgramvector_gist_penalty(PG_FUNCTION_ARGS);
+Datum		vgramvector_gist_picksplit(PG_FUNCTION_ARGS);
+Datum		vgramvector_gist_same(PG_FUNCTION_ARGS);
+
+PG_FUNCTION_INFO_V1(vgramvector_in);
+PG_FUNCTION_INFO_V1(vgramvector_out);
+PG_FUNCTION_INFO_V1(vgramvector_recv);
+PG_FUNCTION_INFO_V1(vgramvector_send);
+PG_FUNCTION_INFO_V1(to_vgramvector);
+PG_FUNCTION_INFO_V1(vgramvector_length);
+PG_FUNCTION_INFO_V1(vgramvector_overlap);
+PG_FUNCTION_INFO_V1(vgramvector_contains);
+PG_FUNCTION_INFO_V1(vgramvector_contained);
+PG_FUNCTION_INFO_V1(vgramvector_union);
+PG_FUNCTION_INFO_V1(vgramvector_intersect);
+PG_FUNCTION_INFO_V1(vgramvector_similarity);
+PG_FUNCTION_INFO_V1(vgramvector_gin_extract_value);
+PG_FUNCTION_INFO_V1(vgramvector_gin_extract_query);
+PG_FUNCTION_INFO_V1(vgramvector_gin_consistent);
+PG_FUNCTION_INFO_V1(vgramvector_gin_triconsistent);
+PG_FUNCTION_INFO_V1(vgramvector_gist_compress);
+PG_FUNCTION_INFO_V1(vgramvector_gist_decompress);
+PG_FUNCTION_INFO_V1(vgramvector_gist_consistent);
+PG_FUNCTION_INFO_V1(vgramvector_gist_union);
+PG_FUNCTION_INFO_V1(vgramvector_gist_penalty);
+PG_FUNCTION_INFO_V1(vgramvector_gist_picksplit);
+PG_FUNCTION_INFO_V1(vgramvector_gist_same);
+
+typedef struct
+{
+	uint32	   *ids;
+	int			nids,
+				allocated;
+} VGramIdsInfo;
+
+static int
+uint32Cmp(const void *a, const void *b)
+{
+	uint32		ua = *((const uint32 *) a);
+	uint32		ub = *((const uint32 *) b);
+
+	return (ua > ub) - (ua < ub);
+}
+
+/*
+ * Sort ids and remove duplicates.  Returns number of distinct ids.
+ */
+static int
+uniqueIds(uint32 *ids, int n)
+{
+	int			i,
+				j = 0;
+
+	if (n == 0)
+		return 0;
+
+	qsort(ids, n, sizeof(uint32), uint32Cmp);
+	for (i = 1; i < n; i++)
+	{
+		if (ids[i] != ids[j])
+			ids[++j] = ids[i];
+	}
+	return j + 1;
+}
+
+/*
+ * Build vgramvector from sorted array of distinct ids.
+ */
+static VGramVector *
+encodeVGramVector(const uint32 *ids, int n)
+{
+	VGramVector *result;
+	uint8	   *ptr;
+	uint32		prev = 0;
+	int			i;
+
+	/* Each id takes at most 5 bytes */
+	result = (VGramVector *) palloc0(VGRAMVECTOR_HDRSZ + 5 * n);
+	result->size = n;
+	ptr = result->data;
+	for (i = 0; i < n; i++)
+	{
+		uint32		delta = ids[i] - prev;
+
+		while (delta >= 0x80)
+		{
+			*ptr++ = (uint8) (delta & 0x7F) | 0x80;
+			delta >>= 7;
+		}
+		*ptr++ = (uint8) delta;
+		prev = ids[i];
+	}
+	SET_VARSIZE(result, ptr - (uint8 *) result);
+	return result;
+}
+
+/*
+ * Decode sorted array of ids from vgramvector.
+ */
+static uint32 *
+decodeVGramVector(VGramVector *vector)
+{
+	uint32	   *ids = (uint32 *) palloc(sizeof(uint32) * Max(vector->size, 1));
+	uint8	   *ptr = vector->data,
+			   *end = (uint8 *) vector + VARSIZE(vector);
+	uint32		prev = 0;
+	int			i;
+
+	for (i = 0; i < vector->size; i++)
+	{
+		uint32		delta = 0;
+		int			shift = 0;
+
+		for (;;)
+		{
+			if (ptr >= end || shift > 28)
+				elog(ERROR, "Corrupted vgramvector.");
+			delta |= (uint32) (*ptr & 0x7F) << shift;
+			if (!(*ptr++ & 0x80))
+				break;
+			shift += 7;
+		}
+		prev += delta;
+		ids[i] = prev;
+	}
+	return ids;
+}
+
+static void
+addVGramId(char *vgram, void *userData)
+{
+	VGramIdsInfo *info = (VGramIdsInfo *) userData;
+
+	if (info->nids >= info->allocated)
+	{
+		info->allocated *= 2;
+		info->ids = (uint32 *) repalloc(info->ids, sizeof(uint32) * info->allocated);
+	}
+	info->ids[info->nids++] = vgramId(vgram);
+	pfree(vgram);
+}
+
+Datum
+vgramvector_in(PG_FUNCTION_ARGS)
+{
+	char	   *str = PG_GETARG_CSTRING(0),
+			   *p = str;
+	uint32	   *ids;
+	int			nids = 0,
+				allocated = 16;
+
+	ids = (uint32 *) palloc(sizeof(uint32) * allocated);
+	for (;;)
+	{
+		char	   *end;
+		unsigned long value;
+
+		while (*p == ' ')
+			p++;
+		if (*p == '\0')
+			break;
+
+		errno = 0;
+		value = strtoul(p, &end, 10);
+		if (end == p || errno != 0 || value > PG_UINT32_MAX ||
+			(*end != ' ' && *end != '\0'))
+			elog(ERROR, "Invalid vgramvector \"%s\".", str);
+		p = end;
+
+		if (nids >= allocated)
+		{
+			allocated *= 2;
+			ids = (uint32 *) repalloc(ids, sizeof(uint32) * allocated);
+		}
+		ids[nids++] = (uint32) value;
+	}
+
+	nids = uniqueIds(ids, nids);
+	PG_RETURN_VGRAMVECTOR(encodeVGramVector(ids, nids));
+}
+
+Datum
+vgramvector_out(PG_FUNCTION_ARGS)
+{
+	VGramVector *vector = PG_GETARG_VGRAMVECTOR(0);
+	uint32	   *ids = decodeVGramVector(vector);
+	StringInfoData buf;
+	int			i;
+
+	initStringInfo(&buf);
+	for (i = 0; i < vector->size; i++)
+	{
+		if (i > 0)
+			appendStringInfoChar(&buf, ' ');
+		appendStringInfo(&buf, "%u", ids[i]);
+	}
+	PG_RETURN_CSTRING(buf.data);
+}
+
+Datum
+vgramvector_recv(PG_FUNCTION_ARGS)
+{
+	StringInfo	buf = (StringInfo) PG_GETARG_POINTER(0);
+	uint32	   *ids;
+	int			nids,
+				i;
+
+	nids = pq_getmsgint(buf, 4);
+	if (nids < 0 || nids > (buf->len - buf->cursor) / 4)
+		elog(ERROR, "Invalid size of vgramvector.");
+
+	ids = (uint32 *) palloc(sizeof(uint32) * Max(nids, 1));
+	for (i = 0; i < nids; i++)
+		ids[i] = (uint32) pq_getmsgint(buf, 4);
+
+	nids = uniqueIds(ids, nids);
+	PG_RETURN_VGRAMVECTOR(encodeVGramVector(ids, nids));
+}
+
+Datum
+vgramvector_send(PG_FUNCTION_ARGS)
+{
+	VGramVector *vector = PG_GETARG_VGRAMVECTOR(0);
+	uint32	   *ids = decodeVGramVector(vector);
+	StringInfoData buf;
+	int			i;
+
+	pq_begintypsend(&buf);
+	pq_sendint(&buf, vector->size, 4);
+	for (i = 0; i < vector->size; i++)
+		pq_sendint(&buf, ids[i], 4);
+	PG_RETURN_BYTEA_P(pq_endtypsend(&buf));
+}
+
+/*
+ * Extract minimal V-grams of string into vgramvector, so that extraction
+ * is done once at write time.  V-grams depend on statistics, so vgramvectors
+ * have to be recalculated once statistics is updated.  For the same reason
+ * function is stable rather than immutable.
+ */
+Datum
+to_vgramvector(PG_FUNCTION_ARGS)
+{
+	text	   *s = PG_GETARG_TEXT_PP(0);
+	VGramIdsInfo info;
+	ExtractVGramsInfo userData;
+
+	loadStats();
+
+	info.nids = 0;
+	info.allocated = 16;
+	info.ids = (uint32 *) palloc(sizeof(uint32) * info.allocated);
+
+	userData.callback = addVGramId;
+	userData.userData = &info;
+	extractWords(VARDATA_ANY(s), VARSIZE_ANY_EXHDR(s), extractMinimalVGramsWord, &userData);
+
+	info.nids = uniqueIds(info.ids, info.nids);
+	PG_RETURN_VGRAMVECTOR(encodeVGramVector(info.ids, info.nids));
+}
+
+Datum
+vgramvector_length(PG_FUNCTION_ARGS)
+{
+	VGramVector *vector = PG_GETARG_VGRAMVECTOR(0);
+
+	PG_RETURN_INT32(vector->size);
+}
+
+/*
+ * Merge two sorted arrays of ids.  Returns number of common ids, and puts
+ * union or intersection into result when it's given.
+ */
+static int
+mergeIds(const uint32 *a, int na, const uint32 *b, int nb,
+		 bool intersect, uint32 *result, int *nresult)
+{
+	int			i = 0,
+				j = 0,
+				n = 0,
+				common = 0;
+
+	while (i < na || j < nb)
+	{
+		uint32		id;
+		bool		both = false;
+
+		if (j >= nb || (i < na && a[i] < b[j]))
+			id = a[i++];
+		else if (i >= na || b[j] < a[i])
+			id = b[j++];
+		else
+		{
+			id = a[i++];
+			j++;
+			both = true;
+			common++;
+		}
+
+		if (result && (both || !intersect))
+			result[n++] = id;
+	}
+
+	if (nresult)
+		*nresult = n;
+	return common;
+}
+
+Datum
+vgramvector_overlap(PG_FUNCTION_ARGS)
+{
+	VGramVector *a = PG_GETARG_VGRAMVECTOR(0);
+	VGramVector *b = PG_GETARG_VGRAMVECTOR(1);
+
+	PG_RETURN_BOOL(mergeIds(decodeVGramVector(a), a->size,
+							decodeVGramVector(b), b->size,
+							true, NULL, NULL) > 0);
+}
+
+Datum
+vgramvector_contains(PG_FUNCTION_ARGS)
+{
+	VGramVector *a = PG_GETARG_VGRAMVECTOR(0);
+	VGramVector *b = PG_GETARG_VGRAMVECTOR(1);
+
+	if (b->size > a->size)
+		PG_RETURN_BOOL(false);
+	PG_RETURN_BOOL(mergeIds(decodeVGramVector(a), a->size,
+							decodeVGramVector(b), b->size,
+							true, NULL, NULL) == b->size);
+}
+
+Datum
+vgramvector_contained(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_DATUM(DirectFunctionCall2(vgramvector_contains,
+										PG_GETARG_DATUM(1),
+										PG_GETARG_DATUM(0)));
+}
+
+static VGramVector *
+combineVGramVectors(VGramVector *a, VGramVector *b, bool intersect)
+{
+	uint32	   *result = (uint32 *) palloc(sizeof(uint32) *
+										   Max(a->size + b->size, 1));
+	int			nresult;
+
+	(void) mergeIds(decodeVGramVector(a), a->size,
+					decodeVGramVector(b), b->size,
+					intersect, result, &nresult);
+	return encodeVGramVector(result, nresult);
+}
+
+Datum
+vgramvector_union(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_VGRAMVECTOR(combineVGramVectors(PG_GETARG_VGRAMVECTOR(0),
+											  PG_GETARG_VGRAMVECTOR(1),
+											  false));
+}
+
+Datum
+vgramvector_intersect(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_VGRAMVECTOR(combineVGramVectors(PG_GETARG_VGRAMVECTOR(0),
+											  PG_GETARG_VGRAMVECTOR(1),
+											  true));
+}
+
+/*
+ * Jaccard similarity of V-gram sets.
+ */
+Datum
+vgramvector_similarity(PG_FUNCTION_ARGS)
+{
+	VGramVector *a = PG_GETARG_VGRAMVECTOR(0);
+	VGramVector *b = PG_GETARG_VGRAMVECTOR(1);
+	int			common;
+
+	if (a->size == 0 && b->size == 0)
+		PG_RETURN_FLOAT4(0.0f);
+
+	common = mergeIds(decodeVGramVector(a), a->size,
+					  decodeVGramVector(b), b->size,
+					  true, NULL, NULL);
+	PG_RETURN_FLOAT4((float4) common / (float4) (a->size + b->size - common));
+}
+
+/*
+ * GIN support.  Keys are V-gram ids, so overlap and contains are answered
+ * exactly.
+ */
+static Datum *
+getIdEntries(VGramVector *vector, int32 *nentries)
+{
+	uint32	   *ids = decodeVGramVector(vector);
+	Datum	   *entries = (Datum *) palloc(sizeof(Datum) * Max(vector->size, 1));
+	int			i;
+
+	for (i = 0; i < vector->size; i++)
+		entries[i] = Int32GetDatum((int32) ids[i]);
+	*nentries = vector->size;
+	pfree(ids);
+	return entries;
+}
+
+Datum
+vgramvector_gin_extract_value(PG_FUNCTION_ARGS)
+{
+	VGramVector *vector = PG_GETARG_VGRAMVECTOR(0);
+	int32	   *nentries = (int32 *) PG_GETARG_POINTER(1);
+
+	PG_RETURN_POINTER(getIdEntries(vector, nentries));
+}
+
+Datum
+vgramvector_gin_extract_query(PG_FUNCTION_ARGS)
+{
+	VGramVector *query = PG_GETARG_VGRAMVECTOR(0);
+	int32	   *nentries = (int32 *) PG_GETARG_POINTER(1);
+	StrategyNumber strategy = PG_GETARG_UINT16(2);
+	int32	   *searchMode = (int32 *) PG_GETARG_POINTER(6);
+	Datum	   *entries = getIdEntries(query, nentries);
+
+	switch (strategy)
+	{
+		case VGramVectorOverlapStrategyNumber:
+			/* Empty query overlaps nothing */
+			break;
+		case VGramVectorContainsStrategyNumber:
+			if (*nentries == 0)
+				*searchMode = GIN_SEARCH_MODE_ALL;
+			break;
+		case VGramVectorContainedStrategyNumber:
+			/* Empty vgramvectors are contained by any query */
+			*searchMode = GIN_SEARCH_MODE_INCLUDE_EMPTY;
+			break;
+		default:
+			elog(ERROR, "unrecognized strategy number: %d", strategy);
+			break;
+	}
+
+	PG_RETURN_POINTER(entries);
+}
+
+Datum
+vgramvector_gin_consistent(PG_FUNCTION_ARGS)
+{
+	bool	   *check = (bool *) PG_GETARG_POINTER(0);
+	StrategyNumber strategy = PG_GETARG_UINT16(1);
+
+	/* VGramVector *query = PG_GETARG_VGRAMVECTOR(2); */
+	int32		nkeys = PG_GETARG_INT32(3);
+
+	/* Pointer    *extra_data = (Pointer *) PG_GETARG_POINTER(4); */
+	bool	   *recheck = (bool *) PG_GETARG_POINTER(5);
+	bool		res;
+	int32		i;
+
+	*recheck = false;
+	switch (strategy)
+	{
+		case VGramVectorOverlapStrategyNumber:
+			res = false;
+			for (i = 0; i < nkeys; i++)
+			{
+				if (check[i])
+				{
+					res = true;
+					break;
+				}
+			}
+			break;
+		case VGramVectorContainsStrategyNumber:
+			res = true;
+			for (i = 0; i < nkeys; i++)
+			{
+				if (!check[i])
+				{
+					res = false;
+					break;
+				}
+			}
+			break;
+		case VGramVectorContainedStrategyNumber:
+			/* Index doesn't know whether all the ids are in query */
+			*recheck = true;
+			res = true;
+			break;
+		default:
+			elog(ERROR, "unrecognized strategy number: %d", strategy);
+			res = false;		/* keep compiler quiet */
+			break;
+	}
+
+	PG_RETURN_BOOL(res);
+}
+
+Datum
+vgramvector_gin_triconsistent(PG_FUNCTION_ARGS)
+{
+	GinTernaryValue *check = (GinTernaryValue *) PG_GETARG_POINTER(0);
+	StrategyNumber strategy = PG_GETARG_UINT16(1);
+
+	/* VGramVector *query = PG_GETARG_VGRAMVECTOR(2); */
+	int32		nkeys = PG_GETARG_INT32(3);
+	GinTernaryValue res;
+	int32		i;
+
+	switch (strategy)
+	{
+		case VGramVectorOverlapStrategyNumber:
+			res = GIN_FALSE;
+			for (i = 0; i < nkeys; i++)
+			{
+				if (check[i] == GIN_TRUE)
+				{
+					res = GIN_TRUE;
+					break;
+				}
+				else if (check[i] == GIN_MAYBE)
+					res = GIN_MAYBE;
+			}
+			break;
+		case VGramVectorContainsStrategyNumber:
+			res = GIN_TRUE;
+			for (i = 0; i < nkeys; i++)
+			{
+				if (check[i] == GIN_FALSE)
+				{
+					res = GIN_FALSE;
+					break;
+				}
+				else if (check[i] == GIN_MAYBE)
+					res = GIN_MAYBE;
+			}
+			break;
+		case VGramVectorContainedStrategyNumber:
+			res = GIN_MAYBE;
+			break;
+		default:
+			elog(ERROR, "unrecognized strategy number: %d", strategy);
+			res = GIN_FALSE;	/* keep compiler quiet */
+			break;
+	}
+
+	PG_RETURN_GIN_TERNARY_VALUE(res);
+}
+
+/*
+ * GiST support.  Keys are fixed-length signatures with bit per V-gram id
+ * hash, so all the matches are rechecked.
+ */
+static bytea *
+makeSignature(void)
+{
+	bytea	   *result = (bytea *) palloc0(VARHDRSZ + VGRAM_SIGLEN);
+
+	SET_VARSIZE(result, VARHDRSZ + VGRAM_SIGLEN);
+	return result;
+}
+
+static int
+countBits(uint8 byte)
+{
+	int			count = 0;
+
+	while (byte)
+	{
+		byte &= byte - 1;
+		count++;
+	}
+	return count;
+}
+
+/* Number of bits set in b but not in a */
+static int
+signatureGrowth(const uint8 *a, const uint8 *b)
+{
+	int			i,
+				growth = 0;
+
+	for (i = 0; i < VGRAM_SIGLEN; i++)
+		growth += countBits(b[i] & ~a[i]);
+	return growth;
+}
+
+static int
+signatureDistance(const uint8 *a, const uint8 *b)
+{
+	int			i,
+				distance = 0;
+
+	for (i = 0; i < VGRAM_SIGLEN; i++)
+		distance += countBits(a[i] ^ b[i]);
+	return distance;
+}
+
+static void
+unionSignature(uint8 *result, const uint8 *sign)
+{
+	int			i;
+
+	for (i = 0; i < VGRAM_SIGLEN; i++)
+		result[i] |= sign[i];
+}
+
+Datum
+vgramvector_gist_compress(PG_FUNCTION_ARGS)
+{
+	GISTENTRY  *entry = (GISTENTRY *) PG_GETARG_POINTER(0);
+	GISTENTRY  *retval = entry;
+
+	if (entry->leafkey)
+	{
+		VGramVector *vector = DatumGetVGramVector(entry->key);
+		uint32	   *ids = decodeVGramVector(vector);
+		bytea	   *key = makeSignature();
+		int			i;
+
+		for (i = 0; i < vector->size; i++)
+			SETBIT(GETSIGN(key), HASHVAL(ids[i]));
+
+		retval = (GISTENTRY *) palloc(sizeof(GISTENTRY));
+		gistentryinit(*retval, PointerGetDatum(key),
+					  entry->rel, entry->page, entry->offset, false);
+	}
+	PG_RETURN_POINTER(retval);
+}
+
+Datum
+vgramvector_gist_decompress(PG_FUNCTION_ARGS)
+{
+	GISTENTRY  *entry = (GISTENTRY *) PG_GETARG_POINTER(0);
+	bytea	   *key = (bytea *) PG_DETOAST_DATUM(entry->key);
+
+	if (key != (bytea *) DatumGetPointer(entry->key))
+	{
+		GISTENTRY  *retval = (GISTENTRY *) palloc(sizeof(GISTENTRY));
+
+		gistentryinit(*retval, PointerGetDatum(key),
+					  entry->rel, entry->page, entry->offset, false);
+		PG_RETURN_POINTER(retval);
+	}
+	PG_RETURN_POINTER(entry);
+}
+
+Datum
+vgramvector_gist_consistent(PG_FUNCTION_ARGS)
+{
+	GISTENTRY  *entry = (GISTENTRY *) PG_GETARG_POINTER(0);
+	VGramVector *query = PG_GETARG_VGRAMVECTOR(1);
+	StrategyNumber strategy = (StrategyNumber) PG_GETARG_UINT16(2);
+
+	/* Oid		subtype = PG_GETARG_OID(3); */
+	bool	   *recheck = (bool *) PG_GETARG_POINTER(4);
+	uint8	   *sign = GETSIGN(DatumGetPointer(entry->key));
+	uint32	   *ids;
+	bool		res;
+	int			i;
+
+	*recheck = true;
+	ids = decodeVGramVector(query);
+	switch (strategy)
+	{
+		case VGramVectorOverlapStrategyNumber:
+			res = false;
+			for (i = 0; i < query->size; i++)
+			{
+				if (GETBIT(sign, HASHVAL(ids[i])))
+				{
+					res = true;
+					break;
+				}
+			}
+			break;
+		case VGramVectorContainsStrategyNumber:
+			res = true;
+			for (i = 0; i < query->size; i++)
+			{
+				if (!GETBIT(sign, HASHVAL(ids[i])))
+				{
+					res = false;
+					break;
+				}
+			}
+			break;
+		case VGramVectorContainedStrategyNumber:
+			/* Signature can't tell whether all the ids are in query */
+			res = true;
+			break;
+		default:
+			elog(ERROR, "unrecognized strategy number: %d", strategy);
+			res = false;		/* keep compiler quiet */
+			break;
+	}
+	pfree(ids);
+
+	PG_RETURN_BOOL(res);
+}
+
+Datum
+vgramvector_gist_union(PG_FUNCTION_ARGS)
+{
+	GistEntryVector *entryvec = (GistEntryVector *) PG_GETARG_POINTER(0);
+	int		   *size = (int *) PG_GETARG_POINTER(1);
+	bytea	   *result = makeSignature();
+	int			i;
+
+	for (i = 0; i < entryvec->n; i++)
+		unionSignature(GETSIGN(result),
+					   GETSIGN(DatumGetPointer(entryvec->vector[i].key)));
+
+	*size = VARSIZE(result);
+	PG_RETURN_POINTER(result);
+}
+
+Datum
+vgramvector_gist_penalty(PG_FUNCTION_ARGS)
+{
+	GISTENTRY  *origentry = (GISTENTRY *) PG_GETARG_POINTER(0);
+	GISTENTRY  *newentry = (GISTENTRY *) PG_GETARG_POINTER(1);
+	float	   *penalty = (float *) PG_GETARG_POINTER(2);
+
+	*penalty = (float) signatureGrowth(GETSIGN(DatumGetPointer(origentry->key)),
+									   GETSIGN(DatumGetPointer(newentry->key)));
+	PG_RETURN_POINTER(penalty);
+}
+
+/*
+ * Split entries using two most distant signatures as seeds.  Every other
+ * entry goes to the side whose union grows less.
+ */
+Datum
+vgramvector_gist_picksplit(PG_FUNCTION_ARGS)
+{
+	GistEntryVector *entryvec = (GistEntryVector *) PG_GETARG_POINTER(0);
+	GIST_SPLITVEC *v = (GIST_SPLITVEC *) PG_GETARG_POINTER(1);
+	OffsetNumber maxoff = entryvec->n - 1,
+				i,
+				j,
+				seedLeft = FirstOffsetNumber,
+				seedRight = OffsetNumberNext(FirstOffsetNumber);
+	bytea	   *unionLeft = makeSignature(),
+			   *unionRight = makeSignature();
+	int			maxDistance = -1;
+
+	for (i = FirstOffsetNumber; i < maxoff; i = OffsetNumberNext(i))
+	{
+		for (j = OffsetNumberNext(i); j <= maxoff; j = OffsetNumberNext(j))
+		{
+			int			distance;
+
+			distance = signatureDistance(GETSIGN(DatumGetPointer(entryvec->vector[i].key)),
+										 GETSIGN(DatumGetPointer(entryvec->vector[j].key)));
+			if (distance > maxDistance)
+			{
+				maxDistance = distance;
+				seedLeft = i;
+				seedRight = j;
+			}
+		}
+	}
+
+	v->spl_left = (OffsetNumber *) palloc(sizeof(OffsetNumber) * (maxoff + 1));
+	v->spl_right = (OffsetNumber *) palloc(sizeof(OffsetNumber) * (maxoff + 1));
+	v->spl_nleft = 0;
+	v->spl_nright = 0;
+
+	unionSignature(GETSIGN(unionLeft),
+				   GETSIGN(DatumGetPointer(entryvec->vector[seedLeft].key)));
+	unionSignature(GETSIGN(unionRight),
+				   GETSIGN(DatumGetPointer(entryvec->vector[seedRight].key)));
+
+	for (i = FirstOffsetNumber; i <= maxoff; i = OffsetNumberNext(i))
+	{
+		uint8	   *sign = GETSIGN(DatumGetPointer(entryvec->vector[i].key));
+		int			growthLeft,
+					growthRight;
+
+		if (i == seedLeft)
+		{
+			v->spl_left[v->spl_nleft++] = i;
+			continue;
+		}
+		if (i == seedRight)
+		{
+			v->spl_right[v->spl_nright++] = i;
+			continue;
+		}
+
+		growthLeft = signatureGrowth(GETSIGN(unionLeft), sign);
+		growthRight = signatureGrowth(GETSIGN(unionRight), sign);
+		if (growthLeft < growthRight ||
+			(growthLeft == growthRight && v->spl_nleft <= v->spl_nright))
+		{
+			unionSignature(GETSIGN(unionLeft), sign);
+			v->spl_left[v->spl_nleft++] = i;
+		}
+		else
+		{
+			unionSignature(GETSIGN(unionRight), sign);
+			v->spl_right[v->spl_nright++] = i;
+		}
+	}
+
+	v->spl_ldatum = PointerGetDatum(unionLeft);
+	v->spl_rdatum = PointerGetDatum(unionRight);
+
+	PG_RETURN_POINTER(v);
+}
+
+Datum
+vgramvector_gist_same(PG_FUNCTION_ARGS)
+{
+	bytea	   *a = (bytea *) PG_GETARG_POINTER(0);
+	bytea	   *b = (bytea *) PG_GETARG_POINTER(1);
+	bool	   *result = (bool *) PG_GETARG_POINTER(2);
+
+	*result = (memcmp(GETSIGN(a), GETSIGN(b), VGRAM_SIGLEN) == 0);
+	PG_RETURN_POINTER(result);
+}